@@ -126,6 +126,19 @@ uint32_t rfKeeloqFileTestCallback(cmd *c) {
     // with its actual key + learning type). Diagnostic only; under RF_DEBUG.
     return rf_keeloq_filetest() ? true : false;
 }
+
+uint32_t rfHopSimCallback(cmd *c) {
+    // Linear sweep vs RSSI-ranked hop scheduler over an RSSI trace (synthetic
+    // without a path). Diagnostic only; under RF_DEBUG.
+    Command cmd(c);
+    String path = cmd.getArgument("filepath").getValue();
+    FS *fs = nullptr;
+    if (path.length() && (!getFsStorage(fs) || fs == nullptr)) {
+        serialDevice->println("no storage");
+        return false;
+    }
+    return rf_hop_sim(fs, path) ? true : false;
+}
 #endif
 
 uint32_t rfKeeloqTxCallback(cmd *c) {
@@ -189,6 +202,7 @@ uint32_t rfMfcodesAddCallback(cmd *c) {
     f.print(entry);
     f.print("\n");
     f.close();
+    keeloq_keystore_invalidate();
     serialDevice->println("added: " + entry);
     return true;
 }
@@ -197,6 +211,7 @@ uint32_t rfMfcodesClearCallback(cmd *c) {
     if (LittleFS.exists("/mfcodes")) LittleFS.remove("/mfcodes");
     File f = LittleFS.open("/mfcodes", FILE_WRITE, true);
     if (f) f.close();
+    keeloq_keystore_invalidate();
     serialDevice->println("/mfcodes cleared (LittleFS)");
     return true;
 }
@@ -399,6 +414,11 @@ void createRfKeeloqTestCommand(Command *rfCmd) {
 void createRfKeeloqFileTestCommand(Command *rfCmd) {
     rfCmd->addCommand("keeloqfiletest", rfKeeloqFileTestCallback);
 }
+
+void createRfHopSimCommand(Command *rfCmd) {
+    Command cmd = rfCmd->addCommand("hopsim", rfHopSimCallback);
+    cmd.addPosArg("filepath", "");
+}
 #endif
 
 void createRfMfcodesCommand(Command *rfCmd) {
@@ -450,6 +470,7 @@ void createRfCommands(SimpleCLI *cli) {
     createRfSelftestCommand(&cmd);
     createRfKeeloqTestCommand(&cmd);
     createRfKeeloqFileTestCommand(&cmd);
+    createRfHopSimCommand(&cmd);
 #endif
 
     cli->addSingleArgCmd("RfSend", rfSendCallback);
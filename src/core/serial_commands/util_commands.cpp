@@ -146,6 +146,8 @@ uint32_t helpCallback(cmd *c) {
     serialDevice->println("  arp - Starts Scan Hosts ARP Scanner");
     serialDevice->println("  listen   - Starts listening TCP default port");
     serialDevice->println("  sniffer - Starts Raw Sniffer");
+    serialDevice->println("  snifferstats - Sniffer ring drops / overruns, handshakes per hour");
+    serialDevice->println("  pcapbench [mb] - Sustained pcap write speed to SD");
     serialDevice->println("\nWebUI Commands:");
     serialDevice->println("  webui      - WebUI Webserver start");
     serialDevice->println("\nIR Commands:");
@@ -5,8 +5,10 @@
 #if !defined(LITE_VERSION)
 #include "esp_netif.h"
 #include "esp_netif_net_stack.h"
+#include "modules/wifi/pcap_writer.h"
 #include "modules/wifi/sniffer.h"
 #include "modules/wifi/tcp_utils.h"
+#include "modules/wifi/wifi_recover.h"
 #include <modules/ethernet/ARPScanner.h>
 // #include "modules/wifi/responder.h"
 #endif
@@ -83,6 +85,60 @@ uint32_t snifferCallback(cmd *c) {
     return true;
 }
 
+uint32_t snifferStatsCallback(cmd *c) {
+    SnifferRingStats rs;
+    sniffer_ring_stats(rs);
+    Serial.printf(
+        "sniffer ring: %lu B, frames %lu, drops %lu, overruns %lu, high watermark %lu B (%lu%%)\n",
+        (unsigned long)rs.capacity,
+        (unsigned long)rs.frames,
+        (unsigned long)rs.drops,
+        (unsigned long)rs.overruns,
+        (unsigned long)rs.highWater,
+        (unsigned long)(rs.capacity ? (uint64_t)rs.highWater * 100 / rs.capacity : 0)
+    );
+    ChannelSchedulerStats hs;
+    float perHour;
+    sniffer_hop_stats(hs, perHour);
+    Serial.printf(
+        "handshakes: %d (%.1f/h), hops %lu, M1 locks %lu, completed %lu, timed out %lu\n",
+        num_HS,
+        perHour,
+        (unsigned long)hs.hops,
+        (unsigned long)hs.locks,
+        (unsigned long)hs.completed,
+        (unsigned long)hs.timeouts
+    );
+    return true;
+}
+
+uint32_t crackBenchCallback(cmd *c) {
+    // PBKDF2 kernel throughput: single lane vs multi-lane, results must agree.
+    Command cmd(c);
+    String strCount = cmd.getArgument("count").getValue();
+    return wifi_crack_bench(strCount.length() ? strCount.toInt() : 8) ? true : false;
+}
+
+uint32_t pmkBenchCallback(cmd *c) {
+    // PBKDF2 vs precomputed PMK table per candidate, optionally streaming a .pmk file.
+    Command cmd(c);
+    String strCount = cmd.getArgument("count").getValue();
+    String table = cmd.getArgument("table").getValue();
+    return wifi_pmk_table_bench(strCount.length() ? strCount.toInt() : 8, table.c_str()) ? true : false;
+}
+
+uint32_t pcapBenchCallback(cmd *c) {
+    // Sustained pcap write speed to SD (LittleFS without a card): legacy vs buffered writer.
+    Command cmd(c);
+    String strMb = cmd.getArgument("mb").getValue();
+    FS *fs = nullptr;
+    if (!getFsStorage(fs)) {
+        serialDevice->println("No storage available");
+        return false;
+    }
+    return pcap_writer_bench(*fs, strMb.length() ? strMb.toInt() : 4) ? true : false;
+}
+
 uint32_t listenTCPCallback(cmd *c) {
     if (!wifiConnected) {
         Serial.println("Connect to a WiFi first.");
@@ -126,6 +182,18 @@ void createWifiCommands(SimpleCLI *cli) {
     Command snifferCmd =
         cli->addCommand("sniffer", snifferCallback); // TODO: be able to exit from it from Serial
 
+    cli->addCommand("snifferstats", snifferStatsCallback);
+
+    Command crackBenchCmd = cli->addCommand("crackbench", crackBenchCallback);
+    crackBenchCmd.addPosArg("count", "8");
+
+    Command pmkBenchCmd = cli->addCommand("pmkbench", pmkBenchCallback);
+    pmkBenchCmd.addPosArg("count", "8");
+    pmkBenchCmd.addPosArg("table", "");
+
+    Command pcapBenchCmd = cli->addCommand("pcapbench", pcapBenchCallback);
+    pcapBenchCmd.addPosArg("mb", "4");
+
 #endif
     // Command responderCmd = cli->addCommand("responder", responderCallback); TODO
 }
@@ -13,13 +13,14 @@ Distributed under Creative Commons 2.5 -- Attribution & Share Alike
 */
 
 #include "TV-B-Gone.h"
-#include "WORLD_IR_CODES.h"
 #include "core/display.h"
 #include "core/mykeyboard.h"
 #include "core/sd_functions.h"
 #include "core/settings.h"
 #include "core/utils.h"
+#include "ir_tx_stream.h"
 #include "ir_utils.h"
+#include "tvbg_codes.h"
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <freertos/semphr.h>
@@ -50,42 +51,11 @@ void xmitCodeElement(uint16_t ontime, uint16_t offtime, uint8_t PWM_code);
 void quickflashLEDx(uint8_t x);
 void delay_ten_us(uint16_t us);
 void quickflashLED(void);
-uint8_t read_bits(uint8_t count);
 #define MAX_WAIT_TIME 65535 // tens of us (ie: 655.350ms)
 
-extern const IrCode *const NApowerCodes[];
-extern const IrCode *const EUpowerCodes[];
-extern const IrCode *const UniversalParsedCodes[];
-extern const uint8_t num_UniversalParsedCodes;
-extern const RawIrCode *const UniversalRawCodes[];
-extern const uint8_t num_UniversalRawCodes;
-extern const uint8_t num_NAcodes;
-extern const uint8_t num_EUcodes;
-
-uint8_t bitsleft_r = 0;
-uint8_t bits_r = 0;
-uint8_t code_ptr;
-volatile const IrCode *powerCode;
-volatile const RawIrCode *rawPowerCode;
-
 // Semaphore for thread-safe IR transmission - protects IR LED pin access
 static SemaphoreHandle_t ir_tx_mutex = NULL;
 
-// Optimized bit reading - combines shift and bit test in single operation
-uint8_t read_bits(uint8_t count) {
-    uint8_t tmp = 0;
-
-    while (count--) {
-        if (bitsleft_r == 0) {
-            bits_r = powerCode->codes[code_ptr++];
-            bitsleft_r = 8;
-        }
-        // Shift and OR in one go - faster than separate operations
-        tmp = (tmp << 1) | ((bits_r >> --bitsleft_r) & 1);
-    }
-    return tmp;
-}
-
 uint16_t ontime, offtime;
 uint8_t i, num_codes;
 uint8_t region;
@@ -152,85 +122,56 @@ void unlock_ir_tx() {
     }
 }
 
-// Send parsed protocol codes (16-bit times)
-void sendParsedCodeBatch(const IrCode *const *codes, uint8_t count, IRsend &irsend) {
-    uint16_t rawData[300];
-
-    for (uint8_t i = 0; i < count; i++) {
-        lock_ir_tx();
-        powerCode = codes[i];
-
-        const uint8_t freq = powerCode->timer_val;
-        const uint8_t numpairs = powerCode->numpairs;
-        const uint8_t bitcompression = powerCode->bitcompression;
-
-        code_ptr = 0;
-        for (uint8_t k = 0; k < numpairs; k++) {
-            uint16_t ti = (read_bits(bitcompression)) * 2;
-            rawData[k * 2] = powerCode->times[ti] * 10;
-            rawData[(k * 2) + 1] = powerCode->times[ti + 1] * 10;
-        }
-
-        if (i % 5 == 0) {
-            progressHandler(i, count);
-        }
+// Pipelined transmit: while code N is on the air (RMT carrier + trailing
+// gap), code N+1 is decoded. Without a free RMT channel, blocking sendRaw()
+// followed by the same gap.
+static IrTxStream *tvbgStream = NULL;
+
+static void sendTvbgCode(const uint16_t *timings, size_t n, uint8_t freq, uint8_t set, IRsend &irsend) {
+    const uint32_t gapUs = tvbg_gap_after_us(timings, n, set);
+    if (tvbgStream) {
+        if (tvbgStream->queue(timings, n, freq, gapUs)) return;
+        tvbgStream->end(); // give the pin back to IRsend for the rest
+        tvbgStream = NULL;
+        setup_ir_pin(bruceConfigPins.irTx, OUTPUT);
+    }
+    irsend.sendRaw(timings, n, freq);
+    delay((gapUs + 999) / 1000);
+}
 
-        irsend.sendRaw(rawData, (numpairs * 2), freq);
-        unlock_ir_tx();
-        bitsleft_r = 0;
-        delay_ten_us(20500);
-
-        if (check(SelPress)) {
-            while (check(SelPress)) vTaskDelay(10 / portTICK_PERIOD_MS);
-            displayTextLine("Paused");
-            while (!check(SelPress)) {
-                if (check(EscPress)) { returnToMenu = true; return; }
-                vTaskDelay(10 / portTICK_PERIOD_MS);
+// Pause on Sel, stop on Esc; true when the user stopped.
+static bool checkTvbgPause() {
+    if (check(SelPress)) {
+        while (check(SelPress)) vTaskDelay(10 / portTICK_PERIOD_MS);
+        if (tvbgStream) tvbgStream->flush();
+        displayTextLine("Paused");
+        while (!check(SelPress)) {
+            if (check(EscPress)) {
+                returnToMenu = true;
+                return true;
             }
-            while (check(SelPress)) vTaskDelay(10 / portTICK_PERIOD_MS);
+            vTaskDelay(10 / portTICK_PERIOD_MS);
         }
-        if (returnToMenu) break;
+        while (check(SelPress)) vTaskDelay(10 / portTICK_PERIOD_MS);
     }
-    progressHandler(count, count);
+    return returnToMenu;
 }
 
-// Send raw codes (32-bit times - cast to uint16_t for sendRaw, no multiplication)
-void sendRawCodeBatch(const RawIrCode *const *codes, uint8_t count, IRsend &irsend) {
-    uint16_t rawData[300];
-
-    for (uint8_t i = 0; i < count; i++) {
-        lock_ir_tx();
-        rawPowerCode = codes[i];
-
-        const uint8_t freq = rawPowerCode->timer_val;
-        const uint8_t numpairs = rawPowerCode->numpairs;
+// Send every code of `set` (TvbgSet), decoded from the code blob
+void sendCodeBatch(uint8_t set, IRsend &irsend) {
+    uint16_t rawData[TVBG_MAX_TIMINGS];
+    const uint16_t count = tvbg_count(set);
 
-        for (uint8_t k = 0; k < numpairs; k++) {
-            // Raw data is already in correct format - no multiplication needed
-            // Values > 65535 are truncated, matching the custom IR loader behavior
-            rawData[k * 2] = (uint16_t)(rawPowerCode->times[k * 2]);
-            rawData[(k * 2) + 1] = (uint16_t)(rawPowerCode->times[(k * 2) + 1]);
-        }
+    for (uint16_t i = 0; i < count; i++) {
+        uint8_t khz;
+        size_t n = tvbg_decode(set, i, rawData, TVBG_MAX_TIMINGS, khz);
 
         if (i % 5 == 0) {
             progressHandler(i, count);
         }
 
-        irsend.sendRaw(rawData, (numpairs * 2), freq);
-        unlock_ir_tx();
-        bitsleft_r = 0;
-        delay_ten_us(20500);
-
-        if (check(SelPress)) {
-            while (check(SelPress)) vTaskDelay(10 / portTICK_PERIOD_MS);
-            displayTextLine("Paused");
-            while (!check(SelPress)) {
-                if (check(EscPress)) { returnToMenu = true; return; }
-                vTaskDelay(10 / portTICK_PERIOD_MS);
-            }
-            while (check(SelPress)) vTaskDelay(10 / portTICK_PERIOD_MS);
-        }
-        if (returnToMenu) break;
+        if (n) sendTvbgCode(rawData, n, khz, set, irsend);
+        if (checkTvbgPause()) break;
     }
     progressHandler(count, count);
 }
@@ -265,27 +206,39 @@ void StartTvBGone() {
 
         check(SelPress);
 
+        // One RMT session for the whole sweep; the LED pin stays ours meanwhile.
+        lock_ir_tx();
+        IrTxStream stream;
+        if (stream.begin(bruceConfigPins.irTx)) tvbgStream = &stream;
+
         // Send region-specific codes
         if (region == NA) {
             displayTextLine("Sending NA codes...");
-            sendParsedCodeBatch(NApowerCodes, num_NAcodes, irsend);
+            sendCodeBatch(TVBG_SET_NA, irsend);
         } else {
             displayTextLine("Sending EU codes...");
-            sendParsedCodeBatch(EUpowerCodes, num_EUcodes, irsend);
+            sendCodeBatch(TVBG_SET_EU, irsend);
         }
 
         // Send universal parsed codes if user didn't stop
         if (!returnToMenu) {
             displayTextLine("Sending universal parsed codes...");
-            sendParsedCodeBatch(UniversalParsedCodes, num_UniversalParsedCodes, irsend);
+            sendCodeBatch(TVBG_SET_UNIVERSAL, irsend);
         }
 
         // Send universal raw codes if user didn't stop
         if (!returnToMenu) {
             displayTextLine("Sending universal raw codes...");
-            sendRawCodeBatch(UniversalRawCodes, num_UniversalRawCodes, irsend);
+            sendCodeBatch(TVBG_SET_UNIVERSAL_RAW, irsend);
         }
 
+        if (tvbgStream) {
+            tvbgStream = NULL;
+            stream.end();
+            setup_ir_pin(bruceConfigPins.irTx, OUTPUT); // back from the RMT
+        }
+        unlock_ir_tx();
+
         // Ensure final progress is shown
         progressHandler(1, 1);
 
@@ -75,9 +75,6 @@ Distributed under Creative Commons 2.5 -- Attribution & Share Alike
 #include <freertos/task.h>
 #include <freertos/semphr.h>
 
-// Include the IR code definitions
-#include "WORLD_IR_CODES.h"
-
 // Function prototypes
 void quickflashLEDx(uint8_t x);
 void delay_ten_us(uint16_t us);
@@ -89,8 +86,7 @@ void lock_ir_tx();
 void unlock_ir_tx();
 void precise_delay_us(uint32_t us);
 
-// Batch send functions for different code types
-void sendParsedCodeBatch(const IrCode *const *codes, uint8_t count, IRsend &irsend);
-void sendRawCodeBatch(const RawIrCode *const *codes, uint8_t count, IRsend &irsend);
+// Send all codes of one set (TvbgSet: region, universal parsed or raw)
+void sendCodeBatch(uint8_t set, IRsend &irsend);
 
 #endif
@@ -3,6 +3,9 @@ Last Updated: 05/07/2026
 By Ninja-jr
 Removed duplicate IR codes while preserving different formats/protocols
 Added universal power-off codes for multi-device support (parsed + raw)
+
+Source only: the firmware sends these codes from world_ir_codes_blob.h,
+regenerated from this file by tools/gen_world_ir_codes.py at build time.
 */
 
 #ifndef WORLD_IR_CODES_H
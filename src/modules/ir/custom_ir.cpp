@@ -5,6 +5,8 @@
 #include "core/sd_functions.h"
 #include "core/settings.h"
 #include "core/type_convertion.h"
+#include "ir_db.h"
+#include "ir_raw.h"
 #include "ir_utils.h"
 #include <IRutils.h>
 
@@ -16,13 +18,6 @@ uint32_t swap32(uint32_t value) {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Custom IR
 
-static std::vector<IRCode *> codes;
-
-void resetCodesArray() {
-    for (auto code : codes) { delete code; }
-    codes.clear();
-}
-
 static std::vector<IRCode *> recent_ircodes;
 
 void addToRecentCodes(IRCode *ircode) {
@@ -72,11 +67,7 @@ void selectRecentIrMenu() {
 }
 
 bool txIrFile(FS *fs, const String &filepath, bool hideDefaultUI) {
-    // SPAM all codes of the file
-
-    int total_codes = 0;
-    String line;
-
+    // SPAM all codes of the file, in one pass over it (IrFileReader)
     File databaseFile = fs->open(filepath, FILE_READ);
 
     setup_ir_pin(bruceConfigPins.irTx, OUTPUT);
@@ -88,109 +79,24 @@ bool txIrFile(FS *fs, const String &filepath, bool hideDefaultUI) {
         delay(2000);
         return false;
     }
-    Serial.println("Opened database file.");
+    IrFileReader reader(databaseFile);
+    if (!reader.begin()) {
+        displayError("Not enough memory");
+        delay(2000);
+        return false;
+    }
+    const size_t total_bytes = databaseFile.size();
+    Serial.printf("\nStarted SPAM all codes of %s (%u bytes)\n", filepath.c_str(), (unsigned)total_bytes);
 
     bool endingEarly = false;
     int codes_sent = 0;
-    uint16_t frequency = 0;
-    String rawData = "";
-    String protocol = "";
-    String address = "";
-    String command = "";
-    String value = "";
-    uint8_t bits = 32;
-
-    databaseFile.seek(0); // comes back to first position
-
-    // count the number of codes to replay
-    while (databaseFile.available()) {
-        line = databaseFile.readStringUntil('\n');
-        if (line.startsWith("type:")) total_codes++;
-    }
+    IRCode code;
+    code.timings.reserve(IR_RAW_RESERVE); // raw codes are parsed into it as they are read
+    while (reader.next(code)) {
+        if (!hideDefaultUI) { progressHandler(reader.position(), total_bytes); }
+        codes_sent++;
+        sendIRCommand(&code, hideDefaultUI);
 
-    Serial.printf("\nStarted SPAM all codes with: %d codes", total_codes);
-    // comes back to first position, beggining of the file
-    databaseFile.seek(0);
-    while (databaseFile.available()) {
-        if (!hideDefaultUI) { progressHandler(codes_sent, total_codes); }
-        line = databaseFile.readStringUntil('\n');
-        if (line.endsWith("\r")) line.remove(line.length() - 1);
-
-        if (line.startsWith("type:")) {
-            codes_sent++;
-            String type = line.substring(5);
-            type.trim();
-            Serial.println("Type: " + type);
-            if (type == "raw") {
-                Serial.println("RAW code");
-                while (databaseFile.available()) {
-                    line = databaseFile.readStringUntil('\n');
-                    if (line.endsWith("\r")) line.remove(line.length() - 1);
-
-                    if (line.startsWith("frequency:")) {
-                        line = line.substring(10);
-                        line.trim();
-                        frequency = line.toInt();
-                        Serial.printf("Frequency: %d\n", frequency);
-                    } else if (line.startsWith("data:")) {
-                        rawData = line.substring(5);
-                        rawData.trim();
-                        Serial.println("RawData: " + rawData);
-                    } else if ((frequency != 0 && rawData != "") || line.startsWith("#")) {
-                        IRCode code;
-                        code.type = "raw";
-                        code.data = rawData;
-                        code.frequency = frequency;
-                        sendIRCommand(&code, hideDefaultUI);
-
-                        rawData = "";
-                        frequency = 0;
-                        type = "";
-                        line = "";
-                        break;
-                    }
-                }
-            } else if (type == "parsed") {
-                Serial.println("PARSED");
-                while (databaseFile.available()) {
-                    line = databaseFile.readStringUntil('\n');
-                    if (line.endsWith("\r")) line.remove(line.length() - 1);
-
-                    if (line.startsWith("protocol:")) {
-                        protocol = line.substring(9);
-                        protocol.trim();
-                        Serial.println("Protocol: " + protocol);
-                    } else if (line.startsWith("address:")) {
-                        address = line.substring(8);
-                        address.trim();
-                        Serial.println("Address: " + address);
-                    } else if (line.startsWith("command:")) {
-                        command = line.substring(8);
-                        command.trim();
-                        Serial.println("Command: " + command);
-                    } else if (line.startsWith("value:") || line.startsWith("state:")) {
-                        value = line.substring(6);
-                        value.trim();
-                        Serial.println("Value: " + value);
-                    } else if (line.startsWith("bits:")) {
-                        bits = line.substring(strlen("bits:")).toInt();
-                        Serial.println("bits: " + bits);
-                    } else if (line.indexOf("#") != -1) { // TODO: also detect EOF
-                        IRCode code(protocol, address, command, value, bits);
-                        sendIRCommand(&code, hideDefaultUI);
-
-                        protocol = "";
-                        address = "";
-                        command = "";
-                        value = "";
-                        bits = 32;
-                        type = "";
-                        line = "";
-                        break;
-                    }
-                }
-            }
-        }
         // if user is pushing (holding down) TRIGGER button, stop transmission early
         if (check(SelPress)) // Pause TV-B-Gone
         {
@@ -208,19 +114,16 @@ bool txIrFile(FS *fs, const String &filepath, bool hideDefaultUI) {
             if (endingEarly) break; // Cancels  custom IR Spam
             if (!hideDefaultUI) { displayTextLine("Running, Wait"); }
         }
-    } // end while file has lines to process
+    } // end while file has codes to send
     databaseFile.close();
-    Serial.println("closed");
-    Serial.println("EXTRA finished");
+    Serial.printf("EXTRA finished, %d codes sent\n", codes_sent);
 
-    resetCodesArray();
     digitalWrite(bruceConfigPins.irTx, LED_OFF);
     return true;
 }
 
 void otherIRcodes() {
     checkIrTxPin();
-    resetCodesArray();
     String filepath;
     FS *fs = NULL;
 
@@ -288,7 +191,12 @@ void otherIRcodes() {
 void sendIRCommand(IRCode *code, bool hideDefaultUI) {
     setup_ir_pin(bruceConfigPins.irTx, OUTPUT);
     // https://developer.flipper.net/flipperzero/doxygen/infrared_file_format.html
-    if (code->type.equalsIgnoreCase("raw")) sendRawCommand(code->frequency, code->data, hideDefaultUI);
+    if (code->type.equalsIgnoreCase("raw") && !code->timings.empty())
+        sendRawTimings(
+            code->frequency, code->timings.data(), code->timings.size(), hideDefaultUI, code->repeat
+        );
+    else if (code->type.equalsIgnoreCase("raw"))
+        sendRawCommand(code->frequency, code->data, hideDefaultUI, code->repeat);
     else if (code->protocol.equalsIgnoreCase("NEC"))
         sendNECCommand(code->address, code->command, hideDefaultUI);
     else if (code->protocol.equalsIgnoreCase("NECext"))
@@ -603,7 +511,23 @@ bool sendDecodedCommand(String protocol, String value, uint8_t bits, bool hideDe
 #endif
 }
 
-void sendRawCommand(uint16_t frequency, String rawData, bool hideDefaultUI) {
+// Reused by every raw transmit that was not parsed on load.
+static std::vector<uint16_t> rawTxBuffer;
+
+void sendRawCommand(uint16_t frequency, const String &rawData, bool hideDefaultUI, uint8_t repeat) {
+    if (rawTxBuffer.capacity() < IR_RAW_RESERVE) rawTxBuffer.reserve(IR_RAW_RESERVE);
+    if (!ir_raw_parse(rawData.c_str(), rawTxBuffer) || rawTxBuffer.size() > 0xFFFF) {
+        Serial.println("Invalid raw data.");
+        return;
+    }
+    sendRawTimings(frequency, rawTxBuffer.data(), rawTxBuffer.size(), hideDefaultUI, repeat);
+}
+
+// A learned frame (repeat > 1) ends with its repeat gap, so it is sent back to
+// back `repeat` times per transmission.
+void sendRawTimings(
+    uint16_t frequency, const uint16_t *timings, uint16_t count, bool hideDefaultUI, uint8_t repeat
+) {
 #ifdef USE_BOOST /// ENABLE 5V OUTPUT
     PPM.enableOTG();
 #endif
@@ -612,38 +536,17 @@ void sendRawCommand(uint16_t frequency, String rawData, bool hideDefaultUI) {
     irsend.begin();
     if (!hideDefaultUI) { displayTextLine("Sending.."); }
 
-    uint16_t dataBufferSize = 1;
-    for (int i = 0; i < rawData.length(); i++) {
-        if (rawData[i] == ' ') dataBufferSize += 1;
-    }
-    uint16_t *dataBuffer = (uint16_t *)malloc((dataBufferSize) * sizeof(uint16_t));
-
-    uint16_t count = 0;
-    // Parse raw data string
-    while (rawData.length() > 0 && count < dataBufferSize) {
-        int delimiterIndex = rawData.indexOf(' ');
-        if (delimiterIndex == -1) { delimiterIndex = rawData.length(); }
-        String dataChunk = rawData.substring(0, delimiterIndex);
-        rawData.remove(0, delimiterIndex + 1);
-        dataBuffer[count++] = (dataChunk.toInt());
-    }
-
-    Serial.println("Parsing raw data complete.");
-    // Serial.println(count);
-    // Serial.println(dataBuffer[count-1]);
-    // Serial.println(dataBuffer[0]);
+    if (!repeat) repeat = 1;
 
     // Send raw command
-    irsend.sendRaw(dataBuffer, count, frequency);
+    for (uint8_t r = 0; r < repeat; r++) irsend.sendRaw(timings, count, frequency);
 
     if (bruceConfigPins.irTxRepeats > 0) {
         for (uint8_t i = 1; i <= bruceConfigPins.irTxRepeats; i++) {
-            irsend.sendRaw(dataBuffer, count, frequency);
+            for (uint8_t r = 0; r < repeat; r++) irsend.sendRaw(timings, count, frequency);
         }
     }
 
-    free(dataBuffer);
-
     Serial.println(
         "Sent Raw Command" + (bruceConfigPins.irTxRepeats > 0
                                   ? " (1 initial + " + String(bruceConfigPins.irTxRepeats) + " repeats)"
@@ -654,79 +557,61 @@ void sendRawCommand(uint16_t frequency, String rawData, bool hideDefaultUI) {
 
 bool chooseCmdIrFile(FS *fs, const String &filepath) {
     checkIrTxPin();
-    resetCodesArray();
-    int total_codes = 0;
-    File databaseFile;
 
     returnToMenu = true;
-
-    databaseFile = fs->open(filepath, FILE_READ);
     drawMainBorder();
-
-    if (!databaseFile) {
-        Serial.println("Failed to open IR file.");
-        return false;
-    }
-    Serial.println("Opened IR file.");
-
     setup_ir_pin(bruceConfigPins.irTx, OUTPUT);
 
-    // Mode to choose and send command by command (limitted to 100 commands)
-    String line;
-    String txt;
-    codes.push_back(new IRCode());
-
-    while (databaseFile.available() && total_codes < 100) {
-        line = databaseFile.readStringUntil('\n');
-        txt = line.substring(line.indexOf(":") + 1);
-        txt.trim();
-
-        if (line.startsWith("name:")) {
-            if (codes[total_codes]->name != "") {
-                total_codes++;
-                codes.push_back(new IRCode());
-            }
-            // save signal name
-            codes[total_codes]->name = txt;
-            codes[total_codes]->filepath = txt + " " + filepath.substring(1 + filepath.lastIndexOf("/"));
-        }
-
-        if (line.startsWith("type:")) codes[total_codes]->type = txt;
-        if (line.startsWith("protocol:")) codes[total_codes]->protocol = txt;
-        if (line.startsWith("address:")) codes[total_codes]->address = txt;
-        if (line.startsWith("frequency:")) codes[total_codes]->frequency = txt.toInt();
-        if (line.startsWith("bits:")) codes[total_codes]->bits = txt.toInt();
-        if (line.startsWith("command:")) codes[total_codes]->command = txt;
-        if (line.startsWith("data:") || line.startsWith("value:") || line.startsWith("state:")) {
-            codes[total_codes]->data = txt;
-        }
-
-        if (line.startsWith("#") && total_codes < codes.size() && codes[total_codes]->name != "") {
-            total_codes++;
-            codes.push_back(new IRCode());
-        }
-    }
-
+    // Buttons come from the file's .irx index (built on the first open), a
+    // picked one is read back with a single seek.
+    struct IrButton {
+        uint32_t offset;
+        uint32_t length;
+    };
+    std::vector<IrButton> buttons;
+    const size_t maxButtons = psramFound() ? IR_DB_MENU_MAX_PSRAM : IR_DB_MENU_MAX_SRAM;
+    const String fileName = filepath.substring(1 + filepath.lastIndexOf("/"));
     options = {};
     bool exit = false;
     bool goToMainMenu = false;
     bool actionTaken = false;
 
-    for (auto code : codes) {
-        if (code->name != "") {
-            options.push_back({code->name.c_str(), [code, &actionTaken]() {
-                                   actionTaken = true;
-                                   sendIRCommand(code);
-                                   addToRecentCodes(code);
-                               }});
+    auto sendButton = [&](size_t i) {
+        File databaseFile = fs->open(filepath, FILE_READ);
+        IrIndexEntry entry = {};
+        entry.offset = buttons[i].offset;
+        entry.length = buttons[i].length;
+        IRCode code;
+        if (!databaseFile || !ir_db_read_entry(databaseFile, entry, code)) {
+            displayError("Fail to read code");
+            return;
         }
+        code.filepath = code.name + " " + fileName;
+        sendIRCommand(&code);
+        addToRecentCodes(&code);
+    };
+    bool opened = ir_db_for_each(fs, filepath, [&](const IrIndexEntry &e) {
+        if (!e.name[0]) return true;
+        size_t i = buttons.size();
+        buttons.push_back({e.offset, e.length});
+        options.push_back({e.name, [&, i]() {
+                               actionTaken = true;
+                               sendButton(i);
+                           }});
+        return buttons.size() < maxButtons;
+    });
+    if (!opened) {
+        Serial.println("Failed to open IR file.");
+        options.clear();
+        return false;
     }
+    Serial.printf("Opened IR file, %u commands.\n", (unsigned)buttons.size());
+
     options.push_back({"Main Menu", [&]() {
                            actionTaken = true;
                            exit = true;
                            goToMainMenu = true;
                        }});
-    databaseFile.close();
 
 #ifdef USE_BOOST /// DISABLE 5V OUTPUT
     PPM.disableOTG();
@@ -761,7 +646,6 @@ bool chooseCmdIrFile(FS *fs, const String &filepath) {
         }
     }
     options.clear();
-    resetCodesArray();
     // Flush any residual EscPress
     delay(100);
     while (check(EscPress)) delay(10);
@@ -5,6 +5,7 @@
 #include <IRsend.h>
 #include <SD.h>
 #include <globals.h>
+#include <vector>
 
 struct IRCode {
     IRCode(
@@ -23,6 +24,8 @@ struct IRCode {
         // duty_cycle = code->duty_cycle;
         data = String(code->data);
         filepath = String(code->filepath);
+        timings = code->timings;
+        repeat = code->repeat;
     }
 
     String protocol = "";
@@ -35,11 +38,21 @@ struct IRCode {
     uint16_t frequency = 0;
     // float duty_cycle;
     String filepath = "";
+    // Raw codes read from a file: `data` already parsed (ir_raw.h), empty
+    // when it still has to be parsed at transmit time.
+    std::vector<uint16_t> timings;
+    // Raw codes: times the frame is sent (`repeat:` key, written by IR auto-learn).
+    uint8_t repeat = 1;
 };
 
 // Custom IR
 void sendIRCommand(IRCode *code, bool hideDefaultUI = false);
-void sendRawCommand(uint16_t frequency, String rawData, bool hideDefaultUI = false);
+void sendRawCommand(
+    uint16_t frequency, const String &rawData, bool hideDefaultUI = false, uint8_t repeat = 1
+);
+void sendRawTimings(
+    uint16_t frequency, const uint16_t *timings, uint16_t count, bool hideDefaultUI = false, uint8_t repeat = 1
+);
 void sendNECCommand(String address, String command, bool hideDefaultUI = false);
 void sendNECextCommand(String address, String command, bool hideDefaultUI = false);
 void sendRC5Command(String address, String command, bool hideDefaultUI = false);
@@ -0,0 +1,289 @@
+#include "ir_db.h"
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+IrTokenizer::~IrTokenizer() { free(_line); }
+
+bool IrTokenizer::begin(IrSource &src, size_t lineMax, uint32_t start, uint32_t end) {
+    if (!_line || _lineCap != lineMax) {
+        free(_line);
+        _line = (char *)malloc(lineMax + 1);
+        _lineCap = _line ? lineMax : 0;
+        if (!_line) return false;
+    }
+    _src = &src;
+    _ioLen = _ioPos = 0;
+    _pos = start;
+    _end = end;
+    return src.seek(start);
+}
+
+bool IrTokenizer::fill() {
+    _ioPos = 0;
+    _ioLen = _src->read(_io, IR_DB_IO_BUF);
+    return _ioLen > 0;
+}
+
+bool IrTokenizer::next(IrLine &line) {
+    for (;;) {
+        if (_pos >= _end) return false;
+        if (_ioPos >= _ioLen && !fill()) return false;
+
+        // Copy up to '\n' into the line buffer, dropping what does not fit.
+        const uint32_t start = _pos;
+        size_t n = 0;
+        bool truncated = false;
+        for (;;) {
+            if (_ioPos >= _ioLen && !fill()) break;
+            const uint8_t *p = _io + _ioPos;
+            size_t avail = _ioLen - _ioPos;
+            if (avail > _end - _pos) avail = _end - _pos;
+            const uint8_t *nl = (const uint8_t *)memchr(p, '\n', avail);
+            size_t take = nl ? (size_t)(nl - p) : avail;
+            size_t copy = take < _lineCap - n ? take : _lineCap - n;
+            memcpy(_line + n, p, copy);
+            n += copy;
+            truncated |= copy < take;
+            size_t used = take + (nl ? 1 : 0);
+            _ioPos += used;
+            _pos += used;
+            if (nl || _pos >= _end) break;
+        }
+
+        while (n && isspace((unsigned char)_line[n - 1])) n--; // also drops '\r'
+        _line[n] = '\0';
+        char *s = _line;
+        while (*s == ' ' || *s == '\t') s++;
+        if (!*s) continue;
+
+        line.offset = start;
+        line.truncated = truncated;
+        line.separator = *s == '#';
+        if (line.separator) {
+            line.key = "";
+            line.value = s + 1;
+            line.valueLen = _line + n - (s + 1);
+            return true;
+        }
+        char *colon = strchr(s, ':');
+        if (!colon) { // not "key: value", reported with an empty value
+            line.key = s;
+            line.value = _line + n;
+            line.valueLen = 0;
+            return true;
+        }
+        char *keyEnd = colon;
+        while (keyEnd > s && isspace((unsigned char)keyEnd[-1])) keyEnd--;
+        *keyEnd = '\0';
+        char *v = colon + 1;
+        while (*v == ' ' || *v == '\t') v++;
+        line.key = s;
+        line.value = v;
+        line.valueLen = _line + n - v;
+        return true;
+    }
+}
+
+bool ir_db_is_header_key(const char *key) { return !strcmp(key, "Filetype") || !strcmp(key, "Version"); }
+
+uint8_t ir_db_entry_type(const char *value) {
+    if (!*value) return IR_ENTRY_UNKNOWN;
+    return strcasecmp(value, "raw") == 0 ? IR_ENTRY_RAW : IR_ENTRY_PARSED;
+}
+
+static void ir_db_copy(char *dst, size_t cap, const char *src) {
+    size_t n = strlen(src);
+    if (n >= cap) n = cap - 1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+}
+
+void IrEntryScanner::start(const IrLine &line) {
+    memset(&_cur, 0, sizeof(_cur));
+    _cur.offset = line.offset;
+    _open = true;
+}
+
+void IrEntryScanner::field(const IrLine &line) {
+    if (!strcmp(line.key, "name")) ir_db_copy(_cur.name, sizeof(_cur.name), line.value);
+    else if (!strcmp(line.key, "type")) _cur.type = ir_db_entry_type(line.value);
+    else if (!strcmp(line.key, "protocol")) ir_db_copy(_cur.protocol, sizeof(_cur.protocol), line.value);
+}
+
+bool IrEntryScanner::next(IrIndexEntry &entry) {
+    IrLine line;
+    for (;;) {
+        bool more = _tok.next(line);
+        // An entry ends at a "#" line, at the end of the file, or at a
+        // second "name:" (files without separators).
+        bool ends = !more || line.separator || (_open && _cur.name[0] && !strcmp(line.key, "name"));
+        if (ends && _open) {
+            _open = false;
+            bool typed = _cur.type != IR_ENTRY_UNKNOWN;
+            if (typed) {
+                entry = _cur;
+                entry.length = (more ? line.offset : _tok.position()) - _cur.offset;
+            }
+            if (more && !line.separator) {
+                start(line);
+                field(line);
+            }
+            if (typed) return true;
+        } else if (more && !line.separator && !ir_db_is_header_key(line.key)) {
+            if (!_open) start(line);
+            field(line);
+        }
+        if (!more) return false;
+    }
+}
+
+#ifdef ARDUINO
+#include "custom_ir.h"
+#include "ir_raw.h"
+
+String ir_db_index_path(const String &irPath) { return irPath + "x"; }
+
+static void ir_db_clear(IRCode &code) {
+    // Assigning "" keeps the String buffers for the next entry.
+    code.name = "";
+    code.type = "";
+    code.protocol = "";
+    code.address = "";
+    code.command = "";
+    code.data = "";
+    code.filepath = "";
+    code.frequency = 0;
+    code.bits = 32;
+    code.timings.clear();
+    code.repeat = 1;
+}
+
+static void ir_db_apply(IRCode &code, const IrLine &line) {
+    const char *k = line.key;
+    if (!strcmp(k, "name")) code.name = line.value;
+    else if (!strcmp(k, "type")) code.type = line.value;
+    else if (!strcmp(k, "protocol")) code.protocol = line.value;
+    else if (!strcmp(k, "address")) code.address = line.value;
+    else if (!strcmp(k, "command")) code.command = line.value;
+    else if (!strcmp(k, "frequency")) code.frequency = strtoul(line.value, nullptr, 10);
+    else if (!strcmp(k, "bits")) code.bits = atoi(line.value);
+    else if (!strcmp(k, "repeat")) code.repeat = constrain(atoi(line.value), 1, 255);
+    else if (!strcmp(k, "data") || !strcmp(k, "value") || !strcmp(k, "state")) {
+        code.data = line.value;
+        // Raw timings are parsed here, straight from the line buffer, so the
+        // transmit does not have to (type comes before data in .ir files).
+        if (!strcmp(k, "data") && code.type.equalsIgnoreCase("raw") && !line.truncated)
+            ir_raw_parse(line.value, code.timings);
+    }
+}
+
+static bool ir_db_read_header(File &f, IrIndexHeader &hdr) {
+    return f.read((uint8_t *)&hdr, sizeof(hdr)) == sizeof(hdr) && hdr.magic == IR_DB_MAGIC &&
+           hdr.version == IR_DB_VERSION && hdr.entry_size == sizeof(IrIndexEntry);
+}
+
+bool ir_db_for_each(FS *fs, const String &irPath, const std::function<bool(const IrIndexEntry &)> &fn) {
+    if (!fs) return false;
+    File src = fs->open(irPath, FILE_READ);
+    if (!src) return false;
+    const uint32_t size = src.size();
+    const uint32_t mtime = (uint32_t)src.getLastWrite();
+    const String idxPath = ir_db_index_path(irPath);
+
+    File idx = fs->open(idxPath, FILE_READ);
+    if (idx) {
+        IrIndexHeader hdr;
+        if (ir_db_read_header(idx, hdr) && hdr.src_size == size && hdr.src_mtime == mtime) {
+            IrIndexEntry e;
+            for (uint32_t i = 0; i < hdr.count; i++) {
+                if (idx.read((uint8_t *)&e, sizeof(e)) != sizeof(e) || !fn(e)) break;
+            }
+            return true;
+        }
+        idx.close();
+    }
+
+    // Stale or missing: one pass over the file, writing the index meanwhile.
+    IrIndexHeader hdr = {};
+    hdr.version = IR_DB_VERSION;
+    hdr.entry_size = sizeof(IrIndexEntry);
+    hdr.src_size = size;
+    hdr.src_mtime = mtime;
+    File out;
+    if (irPath.indexOf("tmpramfile") < 0) out = fs->open(idxPath, FILE_WRITE);
+    const bool opened = out;
+    bool writing = opened && out.write((const uint8_t *)&hdr, sizeof(hdr)) == sizeof(hdr); // magic still 0
+
+    IrFileSource source(src);
+    IrEntryScanner scanner;
+    if (!scanner.begin(source)) {
+        if (opened) {
+            out.close();
+            fs->remove(idxPath);
+        }
+        return false;
+    }
+    IrIndexEntry e;
+    bool wanted = true;
+    while ((wanted || writing) && scanner.next(e)) {
+        hdr.count++;
+        if (writing) writing = out.write((const uint8_t *)&e, sizeof(e)) == sizeof(e);
+        if (wanted) wanted = fn(e); // keep scanning for a complete index
+    }
+    if (writing) {
+        hdr.magic = IR_DB_MAGIC;
+        writing = out.seek(0) && out.write((const uint8_t *)&hdr, sizeof(hdr)) == sizeof(hdr);
+    }
+    if (opened) {
+        out.close();
+        if (!writing) fs->remove(idxPath);
+    }
+    return true;
+}
+
+bool ir_db_read_entry(File &file, const IrIndexEntry &entry, IRCode &code) {
+    IrFileSource source(file);
+    IrTokenizer tok;
+    ir_db_clear(code);
+    if (!tok.begin(source, IR_DB_LINE_MAX, entry.offset, entry.offset + entry.length)) return false;
+    IrLine line;
+    while (tok.next(line)) {
+        if (!line.separator) ir_db_apply(code, line);
+    }
+    return code.type.length() > 0;
+}
+
+bool IrFileReader::next(IRCode &code) {
+    ir_db_clear(code);
+    bool open = false;
+    if (_pending) { // "name:" that ended the previous entry
+        _pending = false;
+        open = true;
+        ir_db_apply(code, _line);
+    }
+    IrLine line;
+    for (;;) {
+        bool more = _tok.next(line);
+        bool ends = !more || line.separator || (open && code.name.length() && !strcmp(line.key, "name"));
+        if (ends && open) {
+            bool startsNext = more && !line.separator;
+            if (code.type.length()) {
+                if (startsNext) {
+                    _line = line; // still in the tokenizer buffer until the next read
+                    _pending = true;
+                }
+                return true;
+            }
+            ir_db_clear(code);
+            open = startsNext;
+            if (open) ir_db_apply(code, line);
+        } else if (more && !line.separator && !ir_db_is_header_key(line.key)) {
+            open = true;
+            ir_db_apply(code, line);
+        }
+        if (!more) return false;
+    }
+}
+#endif
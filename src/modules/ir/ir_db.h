@@ -0,0 +1,161 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// ===========================================================================
+// Streaming `.ir` (Flipper infrared signals) file engine.
+//
+// IrTokenizer reads the file once through a small I/O block and hands out
+// "key: value" lines from one fixed line buffer; no String per line.
+// IrEntryScanner groups lines into entries (one per button: name, type,
+// protocol, ... up to the next "#" or "name:") and reports each entry's byte
+// range, so a button can later be re-read with a single seek.
+//
+// `<file>.irx` (next to the source) caches that index:
+//   IrIndexHeader, then IrIndexEntry[count] (native little endian)
+// It records the size/mtime of the `.ir` it was built from; any mismatch
+// makes it stale and it is rebuilt on the next open. The magic is written
+// last, so an interrupted build never looks valid.
+//
+// The tokenizer and scanner build on the host too (tools/ir_db_bench.cpp).
+// ===========================================================================
+
+#define IR_DB_IO_BUF 512      // file read block
+#define IR_DB_LINE_MAX 8192   // longest line kept whole (raw data: ~1500 timings)
+#define IR_DB_SCAN_LINE 96    // indexing only needs the short values
+#define IR_DB_NAME_MAX 39
+#define IR_DB_PROTO_MAX 15
+#define IR_DB_MAGIC 0x58524942 // "BIRX"
+#define IR_DB_VERSION 1
+#define IR_DB_MENU_MAX_PSRAM 4000 // buttons listed by chooseCmdIrFile()
+#define IR_DB_MENU_MAX_SRAM 250
+
+enum IrEntryType : uint8_t {
+    IR_ENTRY_UNKNOWN = 0,
+    IR_ENTRY_PARSED,
+    IR_ENTRY_RAW,
+};
+
+// Byte source of a tokenizer (an FS File on the device, FILE* on the host).
+class IrSource {
+public:
+    virtual ~IrSource() {}
+    virtual size_t read(uint8_t *buf, size_t len) = 0;
+    virtual bool seek(uint32_t pos) = 0;
+};
+
+struct IrLine {
+    uint32_t offset;   // first byte of the line
+    const char *key;   // trimmed, "" for a separator
+    const char *value; // trimmed, NUL terminated; valid until the next call
+    size_t valueLen;
+    bool separator; // "#" comment line, ends an entry
+    bool truncated; // longer than the line buffer, value cut
+};
+
+class IrTokenizer {
+public:
+    ~IrTokenizer();
+    // Reads `src` from `start` up to `end` (exclusive); lines longer than
+    // `lineMax` are truncated. False if the line buffer cannot be allocated.
+    bool begin(
+        IrSource &src, size_t lineMax = IR_DB_LINE_MAX, uint32_t start = 0, uint32_t end = UINT32_MAX
+    );
+    // Next non-empty line; false at the end of the range.
+    bool next(IrLine &line);
+    // Offset of the next unread byte.
+    uint32_t position() const { return _pos; }
+
+private:
+    bool fill();
+
+    IrSource *_src = nullptr;
+    uint8_t _io[IR_DB_IO_BUF];
+    size_t _ioLen = 0, _ioPos = 0;
+    uint32_t _pos = 0, _end = 0;
+    char *_line = nullptr;
+    size_t _lineCap = 0;
+};
+
+struct IrIndexEntry {
+    uint32_t offset; // first line of the entry
+    uint32_t length; // bytes up to the separator / next entry
+    char name[IR_DB_NAME_MAX + 1];
+    char protocol[IR_DB_PROTO_MAX + 1]; // "" for raw
+    uint8_t type;                        // IrEntryType
+    uint8_t reserved[3];
+};
+
+struct IrIndexHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t entry_size; // sizeof(IrIndexEntry)
+    uint32_t src_size;   // `.ir` size at build time
+    uint32_t src_mtime;  // `.ir` last write at build time
+    uint32_t count;
+};
+
+// Groups the lines of a whole file into entries; only entries with a
+// `type:` are reported (the same ones the transmit loop sends).
+class IrEntryScanner {
+public:
+    bool begin(IrSource &src) { return _tok.begin(src, IR_DB_SCAN_LINE); }
+    bool next(IrIndexEntry &entry);
+
+private:
+    void start(const IrLine &line);
+    void field(const IrLine &line);
+
+    IrTokenizer _tok;
+    IrIndexEntry _cur = {};
+    bool _open = false;
+};
+
+// Entry key helpers shared with the IRCode filler.
+bool ir_db_is_header_key(const char *key);
+uint8_t ir_db_entry_type(const char *value);
+
+#ifdef ARDUINO
+#include <FS.h>
+#include <functional>
+
+struct IRCode;
+
+// Index path of a `.ir` file ("/BruceIR/tv.ir" -> "/BruceIR/tv.irx").
+String ir_db_index_path(const String &irPath);
+
+// Calls `fn` for each entry of `irPath` in file order, from the `.irx` when
+// fresh, otherwise scanning the file once and rewriting the index (skipped
+// on /tmpramfile and unwritable filesystems). `fn` returns false to stop.
+bool ir_db_for_each(FS *fs, const String &irPath, const std::function<bool(const IrIndexEntry &)> &fn);
+
+// Seeks to `entry` in the open `.ir` and fills `code` from its lines.
+bool ir_db_read_entry(File &file, const IrIndexEntry &entry, IRCode &code);
+
+class IrFileSource : public IrSource {
+public:
+    explicit IrFileSource(File &file) : _file(file) {}
+    size_t read(uint8_t *buf, size_t len) override { return _file.read(buf, len); }
+    bool seek(uint32_t pos) override { return _file.seek(pos); }
+
+private:
+    File &_file;
+};
+
+// Sequential reader for transmitting a whole file in one pass.
+class IrFileReader {
+public:
+    explicit IrFileReader(File &file) : _src(file) {}
+    // False if the line buffer cannot be allocated.
+    bool begin() { return _tok.begin(_src); }
+    // Next entry with a type; false at the end of the file.
+    bool next(IRCode &code);
+    uint32_t position() const { return _tok.position(); }
+
+private:
+    IrFileSource _src;
+    IrTokenizer _tok;
+    bool _pending = false; // _line holds the "name:" of the next entry
+    IrLine _line = {};
+};
+#endif
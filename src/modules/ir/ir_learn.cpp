@@ -0,0 +1,167 @@
+#include "ir_learn.h"
+#include <algorithm>
+#include <stdlib.h>
+
+namespace {
+
+typedef std::vector<uint8_t> Symbols;
+
+struct Frame {
+    std::vector<uint16_t> t; // mark ... mark
+    uint32_t gap;            // space after it, 0 for the last one
+    Symbols sym;
+};
+
+struct Press {
+    std::vector<Frame> frames;
+    size_t period; // frames in the repeated group
+    size_t reps;   // whole groups in the press
+};
+
+// Sorted durations -> cluster centres (medians). A cluster ends at a jump of
+// more than the tolerance between neighbours (receiver lag moves whole presses,
+// so one duration spreads wider than a fixed window), and is capped at twice
+// the tolerance above its shortest value so it cannot creep along a slope.
+void cluster(std::vector<uint16_t> v, std::vector<uint16_t> &centers) {
+    std::sort(v.begin(), v.end());
+    centers.clear();
+    for (size_t i = 0; i < v.size();) {
+        uint32_t span = (uint32_t)v[i] * IR_LEARN_TOL_PCT * 2 / 100;
+        size_t j = i + 1;
+        for (; j < v.size(); j++) {
+            uint32_t tol = (uint32_t)v[j - 1] * IR_LEARN_TOL_PCT / 100;
+            if (tol < IR_LEARN_TOL_MIN_US) tol = IR_LEARN_TOL_MIN_US;
+            if ((uint32_t)(v[j] - v[j - 1]) > tol || (uint32_t)(v[j] - v[i]) > span) break;
+        }
+        centers.push_back(v[i + (j - i) / 2]);
+        i = j;
+    }
+}
+
+uint8_t nearest(const std::vector<uint16_t> &centers, uint16_t d) {
+    uint8_t best = 0;
+    for (uint8_t k = 1; k < centers.size(); k++) {
+        if (abs((int)centers[k] - d) < abs((int)centers[best] - d)) best = k;
+    }
+    return best;
+}
+
+void split(const std::vector<uint16_t> &t, Press &p) {
+    p.frames.clear();
+    Frame f = {};
+    for (size_t i = 0; i < t.size(); i++) {
+        if ((i & 1) && t[i] >= IR_LEARN_FRAME_GAP_US) {
+            f.gap = t[i];
+            p.frames.push_back(f);
+            f = Frame();
+            continue;
+        }
+        f.t.push_back(t[i]);
+    }
+    if (!f.t.empty()) {
+        if (!(f.t.size() & 1)) f.t.pop_back(); // trailing space: no mark after it
+        if (!f.t.empty()) p.frames.push_back(f);
+    }
+    if (!p.frames.empty()) p.frames.back().gap = 0;
+}
+
+// Drop trailing hold frames (much shorter than the first), then find the
+// shortest group of frames the press is made of.
+void find_period(Press &p) {
+    std::vector<Frame> &f = p.frames;
+    while (f.size() > 1 && f.back().sym.size() * 2 <= f[0].sym.size()) f.pop_back();
+    const size_t n = f.size();
+    p.period = n;
+    for (size_t per = 1; per < n; per++) {
+        bool ok = true;
+        for (size_t i = per; i < n && ok; i++) ok = f[i].sym == f[i % per].sym;
+        if (ok) {
+            p.period = per;
+            break;
+        }
+    }
+    p.reps = n / p.period;
+}
+
+bool same_group(const Press &a, const Press &b) {
+    if (a.period != b.period) return false;
+    for (size_t i = 0; i < a.period; i++)
+        if (a.frames[i].sym != b.frames[i].sym) return false;
+    return true;
+}
+
+uint32_t median(std::vector<uint32_t> v) {
+    if (v.empty()) return 0;
+    std::sort(v.begin(), v.end());
+    return v[v.size() / 2];
+}
+
+} // namespace
+
+bool IrLearner::add(const uint16_t *timings, size_t count) {
+    if (!count) return false;
+    _presses.emplace_back(timings, timings + count);
+    return true;
+}
+
+bool IrLearner::learn(IrLearnResult &out) const {
+    std::vector<Press> presses(_presses.size());
+    std::vector<uint16_t> marks, spaces;
+    for (size_t i = 0; i < _presses.size(); i++) {
+        split(_presses[i], presses[i]);
+        for (const Frame &f : presses[i].frames)
+            for (size_t k = 0; k < f.t.size(); k++) (k & 1 ? spaces : marks).push_back(f.t[k]);
+    }
+    if (marks.empty()) return false;
+
+    std::vector<uint16_t> markC, spaceC;
+    cluster(marks, markC);
+    cluster(spaces, spaceC);
+    if (markC.size() + spaceC.size() > IR_LEARN_MAX_SYMBOLS) return false;
+
+    for (Press &p : presses) {
+        for (Frame &f : p.frames) {
+            f.sym.resize(f.t.size());
+            for (size_t k = 0; k < f.t.size(); k++)
+                f.sym[k] = k & 1 ? markC.size() + nearest(spaceC, f.t[k]) : nearest(markC, f.t[k]);
+        }
+        if (!p.frames.empty()) find_period(p);
+    }
+
+    // The group most presses share; a strict majority is required.
+    size_t best = 0, bestVotes = 0;
+    for (size_t i = 0; i < presses.size(); i++) {
+        if (presses[i].frames.empty()) continue;
+        size_t votes = 0;
+        for (const Press &q : presses) votes += !q.frames.empty() && same_group(presses[i], q);
+        if (votes > bestVotes) {
+            best = i;
+            bestVotes = votes;
+        }
+    }
+    if (!bestVotes || bestVotes * 2 <= presses.size()) return false;
+    const Press &ref = presses[best];
+
+    size_t reps = 255;
+    std::vector<std::vector<uint32_t>> gaps(ref.period); // after each frame of the group
+    for (const Press &q : presses) {
+        if (q.frames.empty() || !same_group(ref, q)) continue;
+        reps = std::min(reps, q.reps);
+        for (size_t k = 0; k < ref.period; k++)
+            if (q.frames[k].gap) gaps[k].push_back(q.frames[k].gap);
+    }
+
+    out.frame.clear();
+    for (size_t k = 0; k < ref.period; k++) {
+        for (uint8_t s : ref.frames[k].sym)
+            out.frame.push_back(s < markC.size() ? markC[s] : spaceC[s - markC.size()]);
+        uint32_t gap = median(gaps[k]);
+        bool last = k + 1 == ref.period;
+        if (!last || reps > 1) out.frame.push_back(gap > 0xFFFF ? 0xFFFF : gap ? gap : IR_LEARN_FRAME_GAP_US);
+    }
+    out.repeats = reps;
+    out.symbols = markC.size() + spaceC.size();
+    out.agreeing = bestVotes;
+    out.presses = presses.size();
+    return true;
+}
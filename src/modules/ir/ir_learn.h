@@ -0,0 +1,49 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// ===========================================================================
+// IR auto-learn: several captures of one button -> one canonical frame.
+//
+// A raw capture differs a little on every press (receiver lag, remote clock)
+// and holds the same frame several times. The learner:
+//   1. clusters the mark and the space durations of all presses into a small
+//      alphabet (like find_pulse_index() for RF, with a relative tolerance),
+//   2. splits each press at long spaces into frames of alphabet symbols,
+//      drops trailing "hold" frames (NEC-style ditto codes) and finds the
+//      shortest group of frames the press repeats,
+//   3. keeps the group most presses agree on, rebuilt from the cluster
+//      centres, plus the lowest repeat count seen and the median gaps.
+// Replay sends the frame `repeats` times (Bruce's `repeat:` key in `.ir`).
+//
+// Builds on the host too (tools/ir_learn_test.cpp).
+// ===========================================================================
+
+#define IR_LEARN_PRESSES 3         // captures asked for by IrRead
+#define IR_LEARN_MAX_SYMBOLS 16    // marks + spaces; more is noise, keep raw
+#define IR_LEARN_TOL_PCT 25        // a jump of 25% between durations starts a cluster
+#define IR_LEARN_TOL_MIN_US 80     // ... and at least this much
+#define IR_LEARN_FRAME_GAP_US 9000 // a space this long ends a frame
+
+struct IrLearnResult {
+    std::vector<uint16_t> frame; // mark first; ends with the repeat gap when repeats > 1
+    uint8_t repeats;             // times the frame is sent per press
+    uint8_t symbols;             // alphabet size
+    uint8_t agreeing;            // presses that matched the frame
+    uint8_t presses;
+};
+
+class IrLearner {
+public:
+    void reset() { _presses.clear(); }
+    // One press as captured (mark first, us). False when empty.
+    bool add(const uint16_t *timings, size_t count);
+    size_t presses() const { return _presses.size(); }
+    // False when the presses do not cluster into a small alphabet or no
+    // frame is shared by a majority of them (keep the raw capture then).
+    bool learn(IrLearnResult &out) const;
+
+private:
+    std::vector<std::vector<uint16_t>> _presses;
+};
@@ -0,0 +1,40 @@
+#include "ir_raw.h"
+
+bool ir_raw_push(uint32_t us, uint16_t *out, size_t &n, size_t cap) {
+    size_t need = 1 + 2 * ((us ? us - 1 : 0) / IR_RAW_MAX);
+    if (n > cap || cap - n < need) return false;
+    while (us > IR_RAW_MAX) {
+        out[n++] = IR_RAW_MAX;
+        out[n++] = 0; // zero-length space (mark) keeps the polarity
+        us -= IR_RAW_MAX;
+    }
+    out[n++] = (uint16_t)us;
+    return true;
+}
+
+size_t ir_raw_parse(const char *text, uint16_t *out, size_t cap) {
+    size_t n = 0;
+    const char *p = text;
+    for (;;) {
+        while (*p && (*p < '0' || *p > '9')) p++; // separators, stray signs
+        if (!*p) return n;
+        uint32_t v = 0;
+        for (; *p >= '0' && *p <= '9'; p++) {
+            if (v < 100000000) v = v * 10 + (*p - '0'); // saturate absurd values
+        }
+        if (!ir_raw_push(v, out, n, cap)) return cap + 1;
+    }
+}
+
+bool ir_raw_parse(const char *text, std::vector<uint16_t> &out) {
+    size_t cap = out.capacity() > IR_RAW_RESERVE ? out.capacity() : IR_RAW_RESERVE;
+    for (;;) {
+        out.resize(cap);
+        size_t n = ir_raw_parse(text, out.data(), cap);
+        if (n <= cap) {
+            out.resize(n);
+            return n > 0;
+        }
+        cap *= 2;
+    }
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// ===========================================================================
+// Raw IR timings, parsed in one pass.
+//
+// A Flipper raw "data:" line (alternating mark/space microseconds, mark
+// first) is read digit by digit straight into a uint16_t buffer: no
+// substring per value and no buffer per code. The vector flavour reuses the
+// capacity it already has, so a code transmitted from a file costs no
+// allocation once IR_RAW_RESERVE timings are reserved.
+//
+// IRsend::sendRaw() takes 16-bit durations; a longer mark or space is split
+// into IR_RAW_MAX, a zero-length opposite timing and the rest, which keeps
+// the total duration and the mark/space parity instead of wrapping around.
+// ===========================================================================
+
+#define IR_RAW_RESERVE 1024 // timings preallocated for a transmit (AC remotes: 500+)
+#define IR_RAW_MAX 0xFFFF   // longest single mark/space sendRaw() takes
+
+// Appends `us` at `out[n]`, split as described above. False (nothing
+// written) when it does not fit in `cap`.
+bool ir_raw_push(uint32_t us, uint16_t *out, size_t &n, size_t cap);
+
+// Parses the durations of `text` into `out`. Returns the count, or cap + 1
+// when `out` is too small.
+size_t ir_raw_parse(const char *text, uint16_t *out, size_t cap);
+
+// Same into `out`, growing it only when its capacity is not enough.
+// False when `text` holds no timing.
+bool ir_raw_parse(const char *text, std::vector<uint16_t> &out);
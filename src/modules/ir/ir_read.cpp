@@ -126,6 +126,14 @@ void IrRead::setup() {
     options = {
         {"Custom Read",
          [&]() {
+             _learn = false;
+             begin();
+             return loop();
+         }                            },
+        {"Auto Learn",
+         [&]() {
+             _learn = true;
+             _learner.reset();
              begin();
              return loop();
          }                            },
@@ -191,6 +199,9 @@ void IrRead::begin() {
     if (quickloop) {
         padprintln("Waiting for signal of button: " + String(quickButtons[button_pos]));
         padprintln("Button " + String(button_pos + 1) + " of " + String(quickButtons.size()));
+    } else if (_learn) {
+        padprintln("Waiting for signal (auto learn)...");
+        padprintln("Hold the remote close, press once");
     } else {
         padprintln("Waiting for signal...");
     }
@@ -242,6 +253,8 @@ void IrRead::read_signal() {
     _read_signal = true;
 
     raw = (results.decode_type == decode_type_t::UNKNOWN) || hasACState(results.decode_type);
+    _learned_repeats = 1;
+    if (_learn && raw && !learn_signal()) return;
 
     display_banner();
 
@@ -251,19 +264,69 @@ void IrRead::read_signal() {
         padprintln("Bits: " + String(results.bits));
     }
 
-    padprint("RAW Data Captured:");
-    String raw_signal = parse_raw_signal();
-    _captured_raw_signal = raw_signal;
+    String raw_signal = _captured_raw_signal;
+    if (_learned_repeats > 1) padprintln("Frame repeats: " + String(_learned_repeats));
+    padprint(_learn && raw ? "Learned Data:" : "RAW Data Captured:");
+    if (!(_learn && raw)) raw_signal = _captured_raw_signal = parse_raw_signal();
     tft.println(raw_signal.substring(0, 45) + (raw_signal.length() > 45 ? "..." : ""));
 
     display_btn_options();
     delay(500);
 }
 
+// Adds the capture in `results` to the learner. False while more presses are
+// needed; then the learned frame (or, when the presses do not agree, the last
+// raw capture) is left in _captured_raw_signal.
+bool IrRead::learn_signal() {
+    rawcode = resultToRawArray(&results);
+    raw_data_len = getCorrectedRawLength(&results);
+    _learner.add(rawcode, raw_data_len);
+    delete[] rawcode;
+    rawcode = nullptr;
+
+    if (_learner.presses() < IR_LEARN_PRESSES) {
+        _read_signal = false;
+        display_banner();
+        padprintln("Press " + String(_learner.presses()) + " of " + String(IR_LEARN_PRESSES) + " captured");
+        padprintln("Press the same button again");
+        tft.println("");
+        display_btn_options();
+        delay(300);
+        irrecv.resume();
+        return false;
+    }
+
+    IrLearnResult learned;
+    bool ok = _learner.learn(learned);
+    _learner.reset();
+    if (!ok) {
+        displayWarning("Presses differ, saving raw", true);
+        _captured_raw_signal = parse_raw_signal();
+        return true;
+    }
+
+    String signal_code = "";
+    for (uint16_t t : learned.frame) signal_code += String(t) + " ";
+    signal_code.trim();
+    _captured_raw_signal = signal_code;
+    _learned_repeats = learned.repeats;
+    Serial.printf(
+        "IR learn: %u symbols, %u timings x%u, %u/%u presses agree\n",
+        learned.symbols,
+        (unsigned)learned.frame.size(),
+        learned.repeats,
+        learned.agreeing,
+        learned.presses
+    );
+    return true;
+}
+
 void IrRead::discard_signal() {
     if (!_read_signal) return;
     _emulate_mode = false;
     _captured_raw_signal = "";
+    _learned_repeats = 1;
+    _learner.reset();
     irrecv.resume();
     begin();
 }
@@ -274,6 +337,7 @@ void IrRead::emulate_signal() {
         code.type = "raw";
         code.frequency = IR_FREQUENCY;
         code.data = _captured_raw_signal;
+        code.repeat = _learned_repeats;
     } else {
         code.type = "parsed";
         code.protocol = getParsedProtocolName(results);
@@ -351,7 +415,10 @@ void IrRead::append_to_file_str(const String &btn_name) {
         strDeviceContent += "type: raw\n";
         strDeviceContent += "frequency: " + String(IR_FREQUENCY) + "\n";
         strDeviceContent += "duty_cycle: " + String(DUTY_CYCLE) + "\n";
-        strDeviceContent += "data: " + parse_raw_signal() + "\n";
+        // The captured (or learned) timings; headless reads never set them.
+        strDeviceContent +=
+            "data: " + (_captured_raw_signal.length() ? _captured_raw_signal : parse_raw_signal()) + "\n";
+        if (_learned_repeats > 1) strDeviceContent += "repeat: " + String(_learned_repeats) + "\n";
     } else {
         strDeviceContent += "type: parsed\n";
         switch (results.decode_type) {
@@ -1,3 +1,4 @@
+#include "ir_learn.h"
 #include <IRrecv.h>
 #include <globals.h>
 
@@ -17,6 +18,11 @@ private:
     bool _read_signal = false;
     bool _emulate_mode = false;
     String _captured_raw_signal = "";
+    // Auto learn: unknown signals are captured IR_LEARN_PRESSES times and
+    // saved as one canonical frame sent `_learned_repeats` times.
+    bool _learn = false;
+    IrLearner _learner;
+    uint8_t _learned_repeats = 1;
     decode_results results;
     uint16_t *rawcode;
     uint16_t raw_data_len;
@@ -32,6 +38,7 @@ private:
 
     void begin();
     void read_signal();
+    bool learn_signal();
     void emulate_signal();
     void save_device();
     void save_signal();
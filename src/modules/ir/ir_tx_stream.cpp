@@ -0,0 +1,119 @@
+#include "ir_tx_stream.h"
+#include <globals.h> // LED_ON
+
+// 15-bit RMT duration fields: at 1 MHz one half-symbol holds up to 32767 us,
+// longer marks/spaces take several same-level halves.
+#define IR_RMT_MAX_DUR 32767
+
+bool IRAM_ATTR IrTxStream::on_done(rmt_channel_handle_t, const rmt_tx_done_event_data_t *, void *ctx) {
+    static_cast<IrTxStream *>(ctx)->_done++;
+    return false;
+}
+
+bool IrTxStream::begin(int pin) {
+    if (_ch) return true;
+    _queued = 0;
+    _done = 0;
+    _khz = -1;
+
+    rmt_tx_channel_config_t tx_cfg = {};
+    tx_cfg.gpio_num = gpio_num_t(pin);
+    tx_cfg.clk_src = RMT_CLK_SRC_DEFAULT;
+    tx_cfg.resolution_hz = 1 * 1000 * 1000; // 1 tick = 1 us
+    tx_cfg.mem_block_symbols = 64;
+    tx_cfg.trans_queue_depth = IR_TX_SLOTS;
+    tx_cfg.flags.invert_out = LED_ON == 0;
+    tx_cfg.flags.with_dma = false;
+    if (rmt_new_tx_channel(&tx_cfg, &_ch) != ESP_OK) {
+        _ch = nullptr;
+        return false;
+    }
+
+    rmt_copy_encoder_config_t copy_cfg = {};
+    rmt_tx_event_callbacks_t cbs = {};
+    cbs.on_trans_done = on_done;
+    if (rmt_new_copy_encoder(&copy_cfg, &_enc) != ESP_OK ||
+        rmt_tx_register_event_callbacks(_ch, &cbs, this) != ESP_OK || rmt_enable(_ch) != ESP_OK) {
+        end();
+        return false;
+    }
+    _enabled = true;
+    return true;
+}
+
+bool IrTxStream::setCarrier(uint16_t khz) {
+    if (khz == _khz) return true;
+    // The carrier applies to the whole channel: let the codes already queued
+    // finish with their own frequency first.
+    if (!flush()) return false;
+    rmt_carrier_config_t carrier = {};
+    carrier.frequency_hz = (uint32_t)khz * 1000;
+    carrier.duty_cycle = IR_TX_DUTY;
+    if (rmt_apply_carrier(_ch, khz ? &carrier : NULL) != ESP_OK) return false;
+    _khz = khz;
+    return true;
+}
+
+// Append one level held for `us`, as one or more half-symbols.
+static void ir_push_half(std::vector<rmt_symbol_word_t> &syms, bool &half, uint8_t level, uint32_t us) {
+    while (us > 0) {
+        uint16_t chunk = us > IR_RMT_MAX_DUR ? IR_RMT_MAX_DUR : (uint16_t)us;
+        us -= chunk;
+        if (!half) {
+            rmt_symbol_word_t s = {};
+            s.level0 = level;
+            s.duration0 = chunk;
+            syms.push_back(s);
+        } else {
+            syms.back().level1 = level;
+            syms.back().duration1 = chunk;
+        }
+        half = !half;
+    }
+}
+
+bool IrTxStream::queue(const uint16_t *timings, size_t count, uint16_t khz, uint32_t gapUs) {
+    if (!_enabled || !count) return false;
+    if (!setCarrier(khz)) return false;
+
+    // The slot about to be refilled may still be read by the driver.
+    uint32_t t0 = millis();
+    while (_queued - _done >= IR_TX_SLOTS) {
+        if (millis() - t0 > IR_TX_WAIT_MS) return false;
+        vTaskDelay(1);
+    }
+    std::vector<rmt_symbol_word_t> &syms = _slots[_queued % IR_TX_SLOTS];
+    syms.clear();
+    bool half = false;
+    for (size_t i = 0; i < count; i++) ir_push_half(syms, half, (i & 1) ? 0 : 1, timings[i]);
+    // Trailing silence; at least one tick so the last symbol is complete.
+    ir_push_half(syms, half, 0, gapUs ? gapUs : 1);
+    if (half) ir_push_half(syms, half, 0, 1);
+
+    rmt_transmit_config_t txc = {};
+    txc.loop_count = 0;
+    txc.flags.eot_level = 0; // LED off when done
+    if (rmt_transmit(_ch, _enc, syms.data(), syms.size() * sizeof(rmt_symbol_word_t), &txc) != ESP_OK)
+        return false;
+    _queued++;
+    return true;
+}
+
+bool IrTxStream::flush() {
+    if (!_enabled) return true;
+    return rmt_tx_wait_all_done(_ch, IR_TX_WAIT_MS * IR_TX_SLOTS) == ESP_OK;
+}
+
+bool IrTxStream::end() {
+    bool ok = true;
+    if (_enabled) {
+        ok = flush();
+        rmt_disable(_ch);
+        _enabled = false;
+    }
+    if (_enc) rmt_del_encoder(_enc);
+    if (_ch) rmt_del_channel(_ch);
+    _enc = nullptr;
+    _ch = nullptr;
+    return ok;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <Arduino.h>
+#include <driver/rmt_tx.h>
+#include <vector>
+
+// ===========================================================================
+// Back-to-back IR transmit on an RMT channel.
+//
+// The RMT peripheral generates the carrier and the mark/space timing, so a
+// queued code goes out without the CPU; meanwhile the caller prepares the
+// next one. Each code is followed by its inter-code silence in the same RMT
+// frame, so gaps need no CPU timing either.
+//   IrTxStream tx;
+//   if (tx.begin(pin)) while (...) tx.queue(timings, n, khz, gapUs);
+//   tx.end();
+// Up to IR_TX_SLOTS codes are in flight, each in a slot owned by the stream.
+// ===========================================================================
+
+#define IR_TX_SLOTS 2      // one on the air, one ready behind it
+#define IR_TX_DUTY 0.33f   // carrier duty cycle (Flipper/IRremote default)
+#define IR_TX_WAIT_MS 2000 // max wait for a slot / the queue to drain
+
+class IrTxStream {
+public:
+    ~IrTxStream() { end(); }
+    // Takes `pin` over from GPIO; false when no RMT TX channel is free.
+    bool begin(int pin);
+    // Copies `timings` (mark first, us; 0 = no change of level) followed by
+    // `gapUs` of silence into a free slot and queues it with a `khz`
+    // carrier (0: unmodulated). Waits only while all slots are still in flight.
+    bool queue(const uint16_t *timings, size_t count, uint16_t khz, uint32_t gapUs);
+    // True once everything queued so far has gone out.
+    bool idle() const { return _done == _queued; }
+    // Waits for the queue to drain (false on timeout).
+    bool flush();
+    // Flushes and releases the channel; the pin is left to the caller.
+    bool end();
+
+private:
+    bool setCarrier(uint16_t khz);
+
+    rmt_channel_handle_t _ch = nullptr;
+    rmt_encoder_handle_t _enc = nullptr;
+    bool _enabled = false;
+    int32_t _khz = -1; // carrier applied to the channel, -1: none yet
+    std::vector<rmt_symbol_word_t> _slots[IR_TX_SLOTS];
+    uint32_t _queued = 0;
+    volatile uint32_t _done = 0; // bumped from the RMT done ISR
+
+    static bool on_done(rmt_channel_handle_t ch, const rmt_tx_done_event_data_t *ev, void *ctx);
+};
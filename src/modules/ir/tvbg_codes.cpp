@@ -0,0 +1,86 @@
+#include "tvbg_codes.h"
+#include "ir_raw.h"
+#include "world_ir_codes_blob.h"
+
+static const uint16_t tvbg_gaps[TVBG_SET_COUNT] = {
+    TVBG_GAP_NA_MS,
+    TVBG_GAP_EU_MS,
+    TVBG_GAP_UNIVERSAL_MS,
+    TVBG_GAP_RAW_MS,
+};
+
+uint16_t tvbg_gap_ms(uint8_t set) { return set < TVBG_SET_COUNT ? tvbg_gaps[set] : TVBG_LEGACY_GAP_MS; }
+
+uint32_t tvbg_gap_after_us(const uint16_t *timings, size_t count, uint8_t set) {
+    // Trailing space: the odd positions after the last non-zero mark (a
+    // split raw space is "65535, 0, rest").
+    uint32_t tail = 0;
+    for (size_t i = count; i > 0; i--) {
+        if ((i - 1) & 1) tail += timings[i - 1];
+        else if (timings[i - 1]) break;
+    }
+    uint32_t gap = (uint32_t)tvbg_gap_ms(set) * 1000;
+    return gap > tail ? gap - tail : 0;
+}
+
+// Blob header: version, set count, first code of each set, record offsets.
+#define TVBG_FIRST_OFF 2
+#define TVBG_SETS (tvbg_blob[1])
+#define TVBG_RECORD_OFF (TVBG_FIRST_OFF + 2 * (TVBG_SETS + 1))
+
+static uint16_t tvbg_u16(size_t off) { return tvbg_blob[off] | (tvbg_blob[off + 1] << 8); }
+
+static uint32_t tvbg_varint(const uint8_t *&p) {
+    uint32_t v = 0;
+    for (uint8_t shift = 0; shift < 32; shift += 7) {
+        uint8_t b = *p++;
+        v |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) break;
+    }
+    return v;
+}
+
+uint16_t tvbg_count(uint8_t set) {
+    if (tvbg_blob[0] != TVBG_BLOB_VERSION || set >= TVBG_SETS) return 0;
+    return tvbg_u16(TVBG_FIRST_OFF + 2 * (set + 1)) - tvbg_u16(TVBG_FIRST_OFF + 2 * set);
+}
+
+size_t tvbg_decode(uint8_t set, uint16_t i, uint16_t *out, size_t cap, uint8_t &khz) {
+    if (i >= tvbg_count(set)) return 0;
+    const uint16_t code = tvbg_u16(TVBG_FIRST_OFF + 2 * set) + i;
+    const uint8_t *p = tvbg_blob + tvbg_u16(TVBG_RECORD_OFF + 2 * code);
+    khz = *p++;
+    const uint8_t bits = *p++;
+    size_t n = 0;
+
+    if (!bits) { // raw: the timings themselves
+        for (uint32_t count = tvbg_varint(p); count; count--) {
+            if (!ir_raw_push(tvbg_varint(p), out, n, cap)) return 0;
+        }
+        return n;
+    }
+
+    // Each pair is a `bits`-bit index (MSB first) into the shared table of
+    // mark/space pairs, stored in tens of microseconds.
+    const uint8_t *t = tvbg_blob + tvbg_varint(p);
+    uint32_t table[TVBG_MAX_TABLE];
+    uint8_t values = *t++;
+    if (values > TVBG_MAX_TABLE) return 0;
+    for (uint8_t v = 0; v < values; v++) table[v] = tvbg_varint(t) * 10;
+
+    uint8_t byte = 0, left = 0;
+    for (uint32_t pairs = tvbg_varint(p); pairs; pairs--) {
+        uint8_t idx = 0;
+        for (uint8_t b = bits; b; b--) {
+            if (!left) {
+                byte = *p++;
+                left = 8;
+            }
+            idx = (idx << 1) | ((byte >> --left) & 1);
+        }
+        if (2 * idx + 1 >= values) return 0;
+        if (!ir_raw_push(table[2 * idx], out, n, cap) || !ir_raw_push(table[2 * idx + 1], out, n, cap))
+            return 0;
+    }
+    return n;
+}
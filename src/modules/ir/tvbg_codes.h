@@ -0,0 +1,63 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// ===========================================================================
+// TV-B-Gone codes and inter-code gaps.
+//
+// The power codes live in one flash blob (world_ir_codes_blob.h, generated
+// from WORLD_IR_CODES.h by tools/gen_world_ir_codes.py): shared timing
+// tables, varint timings, and an index from (set, code) to its record.
+// tvbg_decode() writes a code's mark/space microseconds straight into the
+// transmit buffer; it keeps no state between calls, so the next code can be
+// decoded while the previous one is on the air.
+//
+// Between two codes the receiver needs some silence to take the next frame
+// as a new command. The original firmware waited a fixed 205 ms after every
+// code; the gap is now the silence wanted after the last mark, per code set
+// from the frame spacing of the protocols in it (NEC/Sony: 40-65 ms between
+// frames; RC5/RC6 in the EU set: ~90 ms), and a code's own trailing space
+// counts towards it. Each value can be overridden at build time.
+//
+// Builds on the host too (tools/tvbg_airtime.cpp).
+// ===========================================================================
+
+#define TVBG_MAX_TIMINGS 512 // longest code, split raw timings included
+#define TVBG_MAX_TABLE 32    // timing table values (4-bit indexes)
+#define TVBG_LEGACY_GAP_MS 205
+
+#ifndef TVBG_GAP_NA_MS
+#define TVBG_GAP_NA_MS 65
+#endif
+#ifndef TVBG_GAP_EU_MS
+#define TVBG_GAP_EU_MS 90
+#endif
+#ifndef TVBG_GAP_UNIVERSAL_MS
+#define TVBG_GAP_UNIVERSAL_MS 90
+#endif
+#ifndef TVBG_GAP_RAW_MS
+#define TVBG_GAP_RAW_MS 120 // captures, trailing silence often cut off
+#endif
+
+enum TvbgSet : uint8_t {
+    TVBG_SET_NA = 0,
+    TVBG_SET_EU,
+    TVBG_SET_UNIVERSAL,     // UniversalParsedCodes
+    TVBG_SET_UNIVERSAL_RAW, // UniversalRawCodes
+    TVBG_SET_COUNT,
+};
+
+// Silence wanted after each code of `set`, in ms.
+uint16_t tvbg_gap_ms(uint8_t set);
+
+// Extra silence to add after `timings` (mark first) so that the code of
+// `set` is followed by tvbg_gap_ms(set) without a mark, in us.
+uint32_t tvbg_gap_after_us(const uint16_t *timings, size_t count, uint8_t set);
+
+// Number of codes in `set`.
+uint16_t tvbg_count(uint8_t set);
+
+// Writes the timings of code `i` of `set` to `out` and its carrier (kHz, 0
+// for unmodulated) to `khz`; returns their count, 0 when the code does not
+// fit in `cap`. Times above 65535 us are split (ir_raw_push).
+size_t tvbg_decode(uint8_t set, uint16_t i, uint16_t *out, size_t cap, uint8_t &khz);
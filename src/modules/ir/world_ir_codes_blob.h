@@ -0,0 +1,794 @@
+// Generated by tools/gen_world_ir_codes.py from WORLD_IR_CODES.h - do not edit.
+// 338 codes, 283 distinct, 175 timing tables, 12557 bytes.
+#pragma once
+#include <stdint.h>
+
+#define TVBG_BLOB_VERSION 1
+
+static const uint8_t tvbg_blob[12557] = {
+    0x01, 0x04, 0x00, 0x00, 0x89, 0x00, 0x14, 0x01, 0x45, 0x01, 0x52, 0x01, 0xBF, 0x0C, 0xCB, 0x0C,
+    0xDD, 0x0C, 0x08, 0x0D, 0x1D, 0x0D, 0x31, 0x0D, 0x3F, 0x0D, 0x5E, 0x0D, 0x70, 0x0D, 0x8F, 0x0D,
+    0xA3, 0x0D, 0xB5, 0x0D, 0xC9, 0x0D, 0xE2, 0x0D, 0xF9, 0x0D, 0x0D, 0x0E, 0x21, 0x0E, 0x2F, 0x0E,
+    0x43, 0x0E, 0x7C, 0x0E, 0xA7, 0x0E, 0xBB, 0x0E, 0xCF, 0x0E, 0xE3, 0x0E, 0xF3, 0x0E, 0x02, 0x0F,
+    0x1B, 0x0F, 0x2D, 0x0F, 0x3F, 0x0F, 0x4D, 0x0F, 0x5B, 0x0F, 0x6F, 0x0F, 0x7D, 0x0F, 0x91, 0x0F,
+    0xBC, 0x0F, 0xD0, 0x0F, 0xDB, 0x0F, 0xE3, 0x0F, 0xEB, 0x0F, 0xFF, 0x0F, 0x05, 0x10, 0x0C, 0x10,
+    0x18, 0x10, 0x2C, 0x10, 0x37, 0x10, 0x4B, 0x10, 0x5F, 0x10, 0x6D, 0x10, 0x81, 0x10, 0x95, 0x10,
+    0x9D, 0x10, 0xAE, 0x10, 0xC2, 0x10, 0xD6, 0x10, 0xE3, 0x10, 0xEF, 0x10, 0xFB, 0x10, 0x02, 0x11,
+    0x0B, 0x11, 0x17, 0x11, 0x2B, 0x11, 0x3F, 0x11, 0x53, 0x11, 0x67, 0x11, 0x7B, 0x11, 0x8D, 0x11,
+    0xB0, 0x11, 0xBE, 0x11, 0xD2, 0x11, 0xDD, 0x11, 0xF1, 0x11, 0xFF, 0x11, 0x06, 0x12, 0x1A, 0x12,
+    0x2E, 0x12, 0x42, 0x12, 0x5B, 0x12, 0x6F, 0x12, 0x7D, 0x12, 0x8B, 0x12, 0x9F, 0x12, 0xAB, 0x12,
+    0xBA, 0x12, 0xC8, 0x12, 0xD6, 0x12, 0x01, 0x13, 0x17, 0x13, 0x42, 0x13, 0x56, 0x13, 0x6A, 0x13,
+    0x7E, 0x13, 0x8B, 0x13, 0x9D, 0x13, 0xB3, 0x13, 0xD2, 0x13, 0xE0, 0x13, 0xF4, 0x13, 0x08, 0x14,
+    0x1C, 0x14, 0x30, 0x14, 0x44, 0x14, 0x52, 0x14, 0x66, 0x14, 0x7F, 0x14, 0x93, 0x14, 0xA7, 0x14,
+    0xBB, 0x14, 0xCF, 0x14, 0xE3, 0x14, 0xF7, 0x14, 0x0B, 0x15, 0x1F, 0x15, 0x33, 0x15, 0x47, 0x15,
+    0x66, 0x15, 0x7A, 0x15, 0x93, 0x15, 0xA7, 0x15, 0xBB, 0x15, 0xCF, 0x15, 0xE3, 0x15, 0xF7, 0x15,
+    0x0B, 0x16, 0x22, 0x16, 0x36, 0x16, 0x4A, 0x16, 0x5E, 0x16, 0x72, 0x16, 0x79, 0x16, 0x92, 0x16,
+    0xA6, 0x16, 0xBF, 0x16, 0xD3, 0x16, 0xE0, 0x16, 0xEE, 0x16, 0x0D, 0x17, 0x33, 0x17, 0x59, 0x17,
+    0x6D, 0x17, 0x7E, 0x17, 0xBF, 0x0C, 0x8A, 0x17, 0xB5, 0x17, 0xD2, 0x17, 0xF1, 0x17, 0x03, 0x18,
+    0x31, 0x0D, 0x1D, 0x0D, 0x17, 0x18, 0x2B, 0x18, 0x37, 0x18, 0xBB, 0x0E, 0x52, 0x18, 0x8B, 0x18,
+    0x99, 0x18, 0xA4, 0x18, 0xB8, 0x18, 0xCC, 0x18, 0xDA, 0x18, 0xEE, 0x18, 0xCF, 0x0E, 0x02, 0x19,
+    0x16, 0x19, 0x23, 0x19, 0x2E, 0x19, 0x44, 0x19, 0x58, 0x19, 0x69, 0x19, 0x80, 0x19, 0x94, 0x19,
+    0xA6, 0x19, 0xB2, 0x19, 0xBB, 0x19, 0xCF, 0x19, 0xE3, 0x19, 0xEE, 0x19, 0xF6, 0x19, 0x01, 0x1A,
+    0x1A, 0x1A, 0x2A, 0x1A, 0x3E, 0x1A, 0x44, 0x1A, 0x58, 0x1A, 0x60, 0x1A, 0x69, 0x1A, 0x73, 0x1A,
+    0x87, 0x1A, 0x9B, 0x1A, 0xB2, 0x1A, 0xCB, 0x1A, 0xD6, 0x1A, 0xDF, 0x1A, 0xEA, 0x1A, 0xFE, 0x1A,
+    0x04, 0x1B, 0x18, 0x1B, 0x1E, 0x1B, 0x2C, 0x1B, 0x3A, 0x1B, 0x48, 0x1B, 0x5C, 0x1B, 0x6C, 0x1B,
+    0x7D, 0x1B, 0x91, 0x1B, 0x99, 0x1B, 0xAA, 0x1B, 0xB5, 0x1B, 0xC0, 0x1B, 0xCB, 0x1B, 0xD6, 0x1B,
+    0xDF, 0x1B, 0xEE, 0x1B, 0xF9, 0x1B, 0x04, 0x1C, 0x15, 0x1C, 0x1D, 0x1C, 0x3C, 0x1C, 0x5B, 0x1C,
+    0x74, 0x1C, 0x93, 0x1C, 0xA1, 0x1C, 0xAC, 0x1C, 0xC0, 0x1C, 0xCE, 0x1C, 0xD9, 0x1C, 0xE4, 0x1C,
+    0xF8, 0x1C, 0x08, 0x1D, 0x15, 0x1D, 0x20, 0x1D, 0x28, 0x1D, 0x38, 0x1D, 0x41, 0x1D, 0x52, 0x1D,
+    0x5B, 0x1D, 0x67, 0x1D, 0x7E, 0x1D, 0x8A, 0x1D, 0x95, 0x1D, 0xA0, 0x1D, 0xAB, 0x1D, 0xB6, 0x1D,
+    0xCA, 0x1D, 0xE6, 0x1D, 0xF4, 0x1D, 0xFF, 0x1D, 0x0A, 0x1E, 0x29, 0x1E, 0x36, 0x1E, 0x4A, 0x1E,
+    0x55, 0x1E, 0x66, 0x1E, 0x88, 0x1E, 0x95, 0x1E, 0xA0, 0x1E, 0xAB, 0x1E, 0xB6, 0x1E, 0xDA, 0x1E,
+    0xF3, 0x1E, 0x17, 0x1F, 0x22, 0x1F, 0x36, 0x1F, 0x55, 0x1F, 0x69, 0x1F, 0x74, 0x1F, 0x7C, 0x1F,
+    0x92, 0x1F, 0xA8, 0x1F, 0xB3, 0x1F, 0xBE, 0x1F, 0xC9, 0x1F, 0xD4, 0x1F, 0xDF, 0x1F, 0xF3, 0x1F,
+    0x01, 0x20, 0x09, 0x20, 0xCB, 0x0C, 0x59, 0x17, 0x59, 0x17, 0x31, 0x0D, 0x59, 0x17, 0xA0, 0x1D,
+    0x59, 0x17, 0xA0, 0x1D, 0xA0, 0x1D, 0x59, 0x17, 0xA0, 0x1D, 0x59, 0x17, 0xA0, 0x1D, 0xA0, 0x1D,
+    0xA0, 0x1D, 0xA0, 0x1D, 0xA0, 0x1D, 0xA0, 0x1D, 0xA0, 0x1D, 0xA0, 0x1D, 0xA0, 0x1D, 0x59, 0x17,
+    0x59, 0x17, 0x59, 0x17, 0x59, 0x17, 0xA0, 0x1D, 0xA0, 0x1D, 0x59, 0x17, 0x59, 0x17, 0x59, 0x17,
+    0x59, 0x17, 0x59, 0x17, 0x59, 0x17, 0x59, 0x17, 0x59, 0x17, 0x59, 0x17, 0x59, 0x17, 0x59, 0x17,
+    0x59, 0x17, 0x59, 0x17, 0x59, 0x17, 0x59, 0x17, 0x59, 0x17, 0x59, 0x17, 0xCB, 0x0C, 0xCB, 0x0C,
+    0xA0, 0x1D, 0xA0, 0x1D, 0xA0, 0x1D, 0x1A, 0x20, 0xE4, 0x20, 0x40, 0x23, 0x4F, 0x24, 0xD1, 0x25,
+    0xA7, 0x26, 0x7D, 0x27, 0x4E, 0x28, 0x3A, 0x29, 0x50, 0x2A, 0xB2, 0x2D, 0xB2, 0x2D, 0x6E, 0x30,
+    0x08, 0x3C, 0x3C, 0x3C, 0x8C, 0x15, 0x78, 0x3C, 0xF0, 0x01, 0x3C, 0x08, 0x32, 0x64, 0x32, 0xC8,
+    0x01, 0x32, 0xA0, 0x06, 0x90, 0x03, 0x90, 0x03, 0x0A, 0x2A, 0x2E, 0x2A, 0x85, 0x01, 0x2A, 0xDF,
+    0x3A, 0xDB, 0x02, 0xB0, 0x01, 0xDB, 0x02, 0xB1, 0x01, 0x08, 0x1A, 0xB9, 0x01, 0x1B, 0x50, 0x1B,
+    0xB9, 0x01, 0x1B, 0xC5, 0x23, 0x0E, 0x37, 0x39, 0x37, 0xAA, 0x01, 0x37, 0xED, 0x1E, 0x37, 0x97,
+    0x4B, 0x38, 0x00, 0x82, 0x07, 0xC5, 0x03, 0x84, 0x07, 0xE2, 0x01, 0x0A, 0x58, 0x5A, 0x58, 0x5B,
+    0x58, 0xB5, 0x01, 0x58, 0x90, 0x46, 0xB1, 0x01, 0x5B, 0x0A, 0x32, 0x3E, 0x32, 0xAC, 0x01, 0x32,
+    0xBD, 0x23, 0xC0, 0x03, 0xD2, 0x03, 0xC2, 0x03, 0xD1, 0x03, 0x0A, 0x31, 0x31, 0x31, 0x32, 0x31,
+    0x9A, 0x03, 0x31, 0xFE, 0x03, 0x31, 0xCB, 0x5E, 0x0A, 0x38, 0x3A, 0x38, 0xAA, 0x01, 0x38, 0xAB,
+    0x1F, 0x82, 0x07, 0xC2, 0x03, 0x84, 0x07, 0xC1, 0x03, 0x0C, 0x35, 0x38, 0x35, 0xAB, 0x01, 0x35,
+    0xEE, 0x1E, 0x35, 0xFF, 0x4A, 0x82, 0x07, 0xC3, 0x03, 0x84, 0x07, 0xE2, 0x01, 0x08, 0x33, 0x37,
+    0x33, 0x9E, 0x01, 0x33, 0xEE, 0x11, 0xC9, 0x06, 0xA3, 0x03, 0x0E, 0x37, 0x37, 0x37, 0xAC, 0x01,
+    0x37, 0xC7, 0x1F, 0x37, 0x84, 0x49, 0x38, 0x00, 0xF4, 0x06, 0xBA, 0x03, 0xF5, 0x06, 0xE1, 0x01,
+    0x0A, 0x51, 0x57, 0x51, 0xFE, 0x01, 0x51, 0xD0, 0x19, 0xCB, 0x02, 0xD0, 0x02, 0xCB, 0x02, 0xD1,
+    0x02, 0x0C, 0x35, 0x37, 0x35, 0xA7, 0x01, 0x35, 0x80, 0x12, 0x35, 0x99, 0x49, 0xFD, 0x06, 0xC0,
+    0x03, 0xFF, 0x06, 0xBF, 0x03, 0x06, 0x1C, 0x5A, 0x1C, 0xD3, 0x01, 0x1C, 0xCB, 0x13, 0x0C, 0x38,
+    0x39, 0x38, 0xAF, 0x01, 0x38, 0xB6, 0x20, 0x38, 0x9B, 0x4A, 0x82, 0x07, 0xE3, 0x01, 0x82, 0x07,
+    0xC1, 0x03, 0x0A, 0x33, 0x37, 0x33, 0xA1, 0x01, 0x33, 0x86, 0x14, 0xD1, 0x06, 0xAD, 0x03, 0xD1,
+    0x06, 0xAE, 0x03, 0x0A, 0x28, 0x2A, 0x28, 0x7C, 0x28, 0xF9, 0x23, 0xC5, 0x02, 0xA3, 0x01, 0xC6,
+    0x02, 0xA3, 0x01, 0x0E, 0x3C, 0x37, 0x3C, 0xA3, 0x01, 0x3C, 0x83, 0x20, 0x3C, 0xE2, 0x4B, 0x3D,
+    0x00, 0x82, 0x07, 0xCD, 0x03, 0x84, 0x07, 0xE6, 0x01, 0x0A, 0x30, 0x34, 0x30, 0xA0, 0x01, 0x30,
+    0x90, 0x03, 0x30, 0x9F, 0x12, 0x9F, 0x06, 0x90, 0x03, 0x0C, 0x35, 0x3C, 0x35, 0xAF, 0x01, 0x35,
+    0xEF, 0x22, 0x35, 0xED, 0x49, 0xFC, 0x06, 0xC2, 0x03, 0xFF, 0x06, 0xE1, 0x01, 0x08, 0x30, 0x34,
+    0x30, 0x99, 0x03, 0x30, 0xF8, 0x03, 0x30, 0xDD, 0x51, 0x0A, 0x3A, 0x3C, 0x3A, 0x89, 0x14, 0x76,
+    0x3C, 0xED, 0x01, 0x3C, 0xEE, 0x01, 0x3C, 0x0A, 0x54, 0x5A, 0x54, 0x88, 0x02, 0x54, 0x8E, 0x1B,
+    0xDA, 0x02, 0xDE, 0x02, 0xDB, 0x02, 0xDE, 0x02, 0x0A, 0x31, 0x31, 0x31, 0x32, 0x31, 0x9A, 0x03,
+    0x31, 0xFE, 0x03, 0x31, 0xA6, 0x62, 0x08, 0x76, 0x79, 0x76, 0x8F, 0x02, 0x76, 0x8E, 0x25, 0x82,
+    0x02, 0x8F, 0x02, 0x0A, 0x58, 0x5A, 0x58, 0x5B, 0x58, 0xB5, 0x01, 0xB1, 0x01, 0x5B, 0xB1, 0x01,
+    0x90, 0x46, 0x0A, 0x58, 0x59, 0x58, 0x5A, 0x58, 0xB3, 0x01, 0x58, 0x91, 0x46, 0xB1, 0x01, 0x5A,
+    0x0A, 0x28, 0x2B, 0x28, 0x7A, 0x28, 0xB1, 0x29, 0xCE, 0x02, 0x9C, 0x01, 0xD0, 0x02, 0x9B, 0x01,
+    0x08, 0x60, 0x5D, 0x61, 0x5D, 0x61, 0x9F, 0x02, 0x61, 0xE7, 0x1A, 0x08, 0x52, 0xC5, 0x04, 0x54,
+    0xFA, 0x01, 0x54, 0xC4, 0x04, 0x55, 0x00, 0x06, 0x27, 0x87, 0x02, 0xA4, 0x01, 0xA3, 0x01, 0x82,
+    0x04, 0xA4, 0x01, 0x04, 0x71, 0x65, 0xB0, 0x05, 0x93, 0x15, 0x06, 0x71, 0x65, 0x71, 0xC9, 0x01,
+    0x71, 0x93, 0x15, 0x08, 0x3A, 0x3E, 0x3A, 0xBA, 0x15, 0x75, 0x3E, 0xF2, 0x01, 0x3E, 0x0C, 0x36,
+    0x41, 0x36, 0xAA, 0x01, 0x36, 0x83, 0x20, 0x36, 0xDC, 0x43, 0x83, 0x07, 0xE2, 0x01, 0x83, 0x07,
+    0xA5, 0x03, 0x08, 0x2B, 0x78, 0x2B, 0x79, 0x2B, 0xA3, 0x1B, 0x83, 0x01, 0x2D, 0x0C, 0x33, 0x33,
+    0x33, 0xA0, 0x01, 0x33, 0x80, 0x20, 0x33, 0xA9, 0x4A, 0xAF, 0x03, 0xB4, 0x03, 0xF3, 0x06, 0xDB,
+    0x01, 0x0C, 0x3A, 0x35, 0x3A, 0xA7, 0x01, 0x3A, 0x8E, 0x23, 0x3A, 0xCF, 0x4B, 0xC7, 0x03, 0xC1,
+    0x03, 0xC8, 0x03, 0xC1, 0x03, 0x0E, 0x33, 0x95, 0x02, 0x34, 0x35, 0x34, 0x69, 0x34, 0x95, 0x02,
+    0x34, 0xDF, 0x13, 0x34, 0x89, 0x64, 0x67, 0x36, 0x04, 0x92, 0x02, 0xD6, 0x06, 0x92, 0x02, 0xC2,
+    0x0F, 0x08, 0x50, 0x58, 0x50, 0xFE, 0x01, 0x50, 0xA6, 0x1D, 0xE7, 0x02, 0xCB, 0x02, 0x08, 0x33,
+    0xE8, 0x01, 0x33, 0x80, 0x04, 0x33, 0x98, 0x06, 0x33, 0xC3, 0x16, 0x08, 0x03, 0x0A, 0x03, 0x14,
+    0x03, 0x1E, 0x03, 0xEA, 0x63, 0x08, 0x37, 0xC1, 0x01, 0x39, 0xC0, 0x01, 0x39, 0x80, 0x03, 0x3A,
+    0x00, 0x08, 0x2D, 0x94, 0x01, 0x2E, 0x94, 0x01, 0x2E, 0xDF, 0x02, 0x2E, 0xDD, 0x15, 0x0A, 0x16,
+    0x65, 0x16, 0xDB, 0x01, 0x17, 0x65, 0x17, 0xDB, 0x01, 0x1F, 0xDA, 0x01, 0x0A, 0x30, 0x62, 0x30,
+    0xC5, 0x01, 0x62, 0xCE, 0x06, 0x8B, 0x03, 0x88, 0x03, 0xA1, 0x0F, 0x88, 0x03, 0x08, 0x26, 0x94,
+    0x02, 0xA5, 0x01, 0x9A, 0x01, 0x9F, 0x03, 0x9B, 0x01, 0xE6, 0x05, 0x9A, 0x01, 0x08, 0x2B, 0x79,
+    0x2B, 0xDD, 0x49, 0x82, 0x01, 0x2D, 0x83, 0x01, 0x2D, 0x08, 0x1B, 0x4C, 0x1B, 0xB6, 0x01, 0x1B,
+    0xB7, 0x01, 0x1B, 0xFF, 0x18, 0x04, 0x25, 0xB5, 0x01, 0x25, 0x90, 0x02, 0x0A, 0x33, 0x62, 0x33,
+    0xC2, 0x01, 0x66, 0xA3, 0x07, 0x86, 0x03, 0x86, 0x03, 0x86, 0x03, 0x87, 0x03, 0x06, 0x28, 0x93,
+    0x02, 0xA0, 0x01, 0x9A, 0x01, 0xE0, 0x03, 0x9B, 0x01, 0x08, 0x30, 0x34, 0x30, 0x99, 0x03, 0x30,
+    0xF8, 0x03, 0x30, 0xFA, 0x4D, 0x0C, 0x58, 0x59, 0x58, 0x5A, 0x58, 0xB3, 0x01, 0x58, 0xB8, 0x45,
+    0xB1, 0x01, 0x5A, 0xB1, 0x01, 0xB3, 0x01, 0x0A, 0x29, 0x2B, 0x29, 0x80, 0x01, 0x29, 0xB4, 0x3A,
+    0xD0, 0x02, 0xAB, 0x01, 0xD2, 0x02, 0xA9, 0x01, 0x0A, 0x37, 0x3C, 0x37, 0xA5, 0x01, 0x37, 0xEC,
+    0x11, 0xBD, 0x03, 0xB5, 0x03, 0xC0, 0x03, 0xB4, 0x03, 0x0A, 0x2A, 0x2E, 0x2A, 0x7E, 0x2A, 0xCD,
+    0x36, 0xDB, 0x02, 0xB0, 0x01, 0xDB, 0x02, 0xB1, 0x01, 0x0C, 0x38, 0x45, 0x38, 0xAE, 0x01, 0x38,
+    0xC5, 0x20, 0x38, 0xF1, 0x4A, 0xF0, 0x06, 0xDE, 0x01, 0xF0, 0x06, 0xB3, 0x03, 0x0C, 0x58, 0x5A,
+    0x58, 0x5B, 0x58, 0xB5, 0x01, 0x58, 0x90, 0x46, 0xB1, 0x01, 0x5B, 0xB1, 0x01, 0xB5, 0x01, 0x08,
+    0x30, 0x64, 0x30, 0xC8, 0x01, 0x30, 0x9A, 0x08, 0x90, 0x03, 0x90, 0x03, 0x08, 0x36, 0x38, 0x36,
+    0xAA, 0x01, 0x36, 0xBF, 0x26, 0xC3, 0x03, 0xBF, 0x03, 0x0A, 0x37, 0x39, 0x37, 0xA7, 0x01, 0x37,
+    0xB0, 0x22, 0xFF, 0x06, 0xC0, 0x03, 0x81, 0x07, 0xBF, 0x03, 0x0A, 0x38, 0x3A, 0x38, 0xAE, 0x01,
+    0x38, 0xC5, 0x23, 0x38, 0xE8, 0x49, 0xB8, 0x03, 0xBE, 0x03, 0x08, 0x2B, 0xAB, 0x01, 0x2D, 0x3C,
+    0x2D, 0xAA, 0x01, 0x36, 0xFD, 0x11, 0x0A, 0x56, 0x57, 0x56, 0x82, 0x02, 0x56, 0x8A, 0x1A, 0xDA,
+    0x02, 0xDC, 0x02, 0xDC, 0x02, 0xDB, 0x02, 0x0C, 0x3A, 0x3D, 0x3A, 0xD3, 0x01, 0x3A, 0xEE, 0x4A,
+    0x49, 0xC4, 0x20, 0xF3, 0x06, 0xD3, 0x01, 0x9A, 0x08, 0xEE, 0x03, 0x0A, 0x38, 0x36, 0x38, 0xA6,
+    0x01, 0x38, 0xE9, 0x1E, 0x80, 0x07, 0xBA, 0x03, 0x80, 0x07, 0xBB, 0x03, 0x0C, 0x2C, 0x32, 0x2C,
+    0x93, 0x01, 0x2C, 0xBF, 0x03, 0x2C, 0xBC, 0x11, 0x97, 0x06, 0x8E, 0x03, 0x99, 0x06, 0x8D, 0x03,
+    0x0A, 0x51, 0x56, 0x51, 0xA8, 0x02, 0x51, 0x95, 0x1A, 0xC8, 0x02, 0xCB, 0x02, 0xC9, 0x02, 0xCB,
+    0x02, 0x0C, 0x31, 0x36, 0x31, 0x9E, 0x01, 0x31, 0xA4, 0x03, 0x31, 0x8E, 0x13, 0xB3, 0x06, 0xA4,
+    0x03, 0xB5, 0x06, 0xA3, 0x03, 0x0C, 0x37, 0x3F, 0x37, 0xAB, 0x01, 0x37, 0xFE, 0x1F, 0x37, 0xA4,
+    0x4A, 0xF1, 0x06, 0xDB, 0x01, 0xF1, 0x06, 0xB6, 0x03, 0x0A, 0x50, 0x5F, 0x50, 0xF9, 0x01, 0x50,
+    0x9B, 0x1E, 0x51, 0x00, 0xC9, 0x02, 0xC2, 0x02, 0x0C, 0x36, 0x38, 0x36, 0x97, 0x01, 0x36, 0xFC,
+    0x1F, 0x36, 0xE5, 0x43, 0x84, 0x07, 0xA5, 0x03, 0x85, 0x07, 0xE2, 0x01, 0x08, 0x72, 0x64, 0x73,
+    0x64, 0x73, 0xC8, 0x01, 0x73, 0x92, 0x15, 0x0A, 0x58, 0x5A, 0x58, 0x82, 0x02, 0x58, 0xC7, 0x11,
+    0xE6, 0x02, 0xDD, 0x02, 0xE6, 0x02, 0xDE, 0x02, 0x08, 0x1C, 0x6A, 0x1C, 0xEE, 0x01, 0x1C, 0xF2,
+    0x02, 0x1C, 0x95, 0x09, 0x0A, 0x0D, 0xE5, 0x05, 0x0F, 0xE9, 0x03, 0x0F, 0xE4, 0x05, 0x11, 0xA1,
+    0x24, 0x12, 0x00, 0x0A, 0x35, 0x3B, 0x35, 0xAB, 0x01, 0x35, 0xFD, 0x11, 0xFC, 0x06, 0xC2, 0x03,
+    0xFF, 0x06, 0xC0, 0x03, 0x0C, 0x35, 0x3B, 0x35, 0xAB, 0x01, 0x35, 0xFD, 0x11, 0x37, 0x00, 0xFC,
+    0x06, 0xC2, 0x03, 0xFF, 0x06, 0xC0, 0x03, 0x0E, 0x2B, 0x2F, 0x2B, 0x5B, 0x2B, 0x84, 0x41, 0x58,
+    0x2F, 0x85, 0x01, 0x85, 0x01, 0x88, 0x02, 0x5A, 0x88, 0x02, 0x5B, 0x0E, 0x2F, 0x89, 0x02, 0x33,
+    0x36, 0x33, 0x6C, 0x33, 0x87, 0x02, 0x33, 0x85, 0x10, 0x33, 0xFF, 0x5A, 0x64, 0x6D, 0x08, 0x2B,
+    0xCE, 0x01, 0x2E, 0xCC, 0x01, 0x2E, 0xC8, 0x03, 0x2E, 0xA0, 0x1B, 0x0A, 0x2C, 0x2D, 0x2C, 0x83,
+    0x01, 0x2C, 0xA6, 0x3A, 0xDA, 0x02, 0xB0, 0x01, 0xDA, 0x02, 0xB2, 0x01, 0x0A, 0x18, 0xBE, 0x01,
+    0x19, 0x50, 0x19, 0xBE, 0x01, 0x19, 0xE7, 0x20, 0x19, 0xBF, 0x25, 0x0A, 0x35, 0x3F, 0x35, 0xAC,
+    0x01, 0x35, 0xF8, 0x22, 0x36, 0x00, 0xC7, 0x03, 0xD4, 0x03, 0x08, 0x32, 0x36, 0x32, 0x9F, 0x01,
+    0x32, 0x83, 0x12, 0xC6, 0x06, 0xA6, 0x03, 0x06, 0x2E, 0xCE, 0x01, 0x2E, 0xCB, 0x03, 0x2E, 0xF7,
+    0x1A, 0x08, 0x35, 0x3B, 0x35, 0xAB, 0x01, 0x35, 0xFE, 0x11, 0xFF, 0x06, 0xC1, 0x03, 0x0A, 0x35,
+    0x36, 0x35, 0x9C, 0x01, 0x35, 0xEE, 0x13, 0xD3, 0x06, 0xA9, 0x03, 0xD5, 0x06, 0xA8, 0x03, 0x08,
+    0x1C, 0x5C, 0x1C, 0xD5, 0x01, 0x1C, 0xD6, 0x01, 0x1C, 0xD3, 0x15, 0x08, 0x0F, 0xCC, 0x06, 0x10,
+    0xAD, 0x04, 0x10, 0xCC, 0x06, 0x10, 0xE8, 0x28, 0x0A, 0x32, 0x36, 0x32, 0x9E, 0x01, 0x32, 0xA2,
+    0x03, 0x32, 0x8B, 0x13, 0xCB, 0x06, 0xA2, 0x03, 0x08, 0x30, 0xAD, 0x02, 0x30, 0x8B, 0x05, 0x30,
+    0xE9, 0x07, 0x30, 0xB9, 0x17, 0x10, 0x31, 0x34, 0x31, 0x66, 0x31, 0xFA, 0x01, 0x31, 0xFC, 0x01,
+    0x31, 0xC9, 0x12, 0x31, 0xE9, 0x5D, 0x64, 0x34, 0x64, 0x66, 0x06, 0x0E, 0xEB, 0x03, 0x0E, 0xE7,
+    0x05, 0x0E, 0xBE, 0x26, 0x08, 0xC0, 0x03, 0xC0, 0x03, 0x38, 0xA8, 0x01, 0x38, 0x38, 0x38, 0xAE,
+    0x23, 0x0E, 0x2F, 0x8B, 0x02, 0x32, 0x37, 0x32, 0x6E, 0x32, 0x89, 0x02, 0x32, 0x87, 0x10, 0x32,
+    0xD5, 0x5E, 0x64, 0x39, 0x10, 0x32, 0x32, 0x32, 0x63, 0x32, 0xFB, 0x01, 0x32, 0xFC, 0x01, 0x32,
+    0xA5, 0x0B, 0x32, 0x86, 0x56, 0x66, 0x31, 0x66, 0x62, 0x08, 0x35, 0x35, 0x35, 0xA0, 0x01, 0x35,
+    0xA1, 0x0D, 0xC6, 0x06, 0xA6, 0x03, 0x08, 0x31, 0xCD, 0x01, 0x31, 0xCE, 0x01, 0x31, 0xC8, 0x03,
+    0x31, 0xEA, 0x1C, 0x08, 0x30, 0x96, 0x01, 0x32, 0x95, 0x01, 0x32, 0xDB, 0x02, 0x32, 0xF8, 0x16,
+    0x06, 0x0E, 0xEB, 0x03, 0x0E, 0xE7, 0x05, 0x0E, 0xBA, 0x28, 0x06, 0x03, 0xEA, 0x07, 0x03, 0xD7,
+    0x0B, 0x03, 0xF3, 0x17, 0x08, 0x0D, 0xBD, 0x03, 0x0D, 0xA2, 0x05, 0x0D, 0xA3, 0x05, 0x0D, 0xE7,
+    0x23, 0x0A, 0x55, 0x59, 0x55, 0x88, 0x02, 0x55, 0xCA, 0x1A, 0xDB, 0x02, 0xDE, 0x02, 0xDC, 0x02,
+    0xDE, 0x02, 0x0A, 0x2E, 0xAC, 0x02, 0x31, 0xAA, 0x02, 0x31, 0x88, 0x05, 0x31, 0xE5, 0x07, 0x31,
+    0xF0, 0x17, 0x04, 0x8D, 0x08, 0xF8, 0x20, 0x90, 0x08, 0x00, 0x08, 0x98, 0x01, 0xD7, 0x03, 0x9A,
+    0x01, 0x9C, 0x01, 0x9A, 0x01, 0xD5, 0x03, 0x9A, 0x01, 0x83, 0x17, 0x08, 0x0F, 0xED, 0x03, 0x10,
+    0xED, 0x03, 0x10, 0xBA, 0x05, 0x10, 0x86, 0x0B, 0x06, 0x03, 0xF0, 0x03, 0x03, 0xE9, 0x05, 0x03,
+    0xD0, 0x0B, 0x0C, 0x37, 0x37, 0x37, 0xA7, 0x01, 0x37, 0xE1, 0x23, 0x37, 0xA2, 0x4A, 0xC0, 0x03,
+    0xBD, 0x03, 0xC2, 0x03, 0xBC, 0x03, 0x0A, 0x5B, 0x58, 0x5B, 0x8B, 0x02, 0x5B, 0xA5, 0x1C, 0xE9,
+    0x02, 0xE6, 0x02, 0xE9, 0x02, 0xE7, 0x02, 0x0A, 0x54, 0x58, 0x54, 0x85, 0x02, 0x54, 0xA0, 0x1A,
+    0xDB, 0x02, 0xDB, 0x02, 0xDB, 0x02, 0xDC, 0x02, 0x08, 0x10, 0xC6, 0x06, 0x11, 0xAE, 0x04, 0x11,
+    0xC7, 0x06, 0x11, 0xB8, 0x31, 0x0C, 0x31, 0x35, 0x31, 0x68, 0x31, 0x86, 0x02, 0x31, 0x88, 0x02,
+    0x31, 0xDE, 0x3E, 0x64, 0x67, 0x06, 0x70, 0x6B, 0x71, 0x6B, 0xA5, 0x05, 0xCE, 0x15, 0x06, 0xB6,
+    0x02, 0xE5, 0x04, 0xB6, 0x02, 0xE6, 0x04, 0xEE, 0x04, 0xF8, 0x40, 0x08, 0x32, 0x9E, 0x01, 0x35,
+    0x33, 0x35, 0x9C, 0x01, 0x35, 0x84, 0x11, 0x10, 0x2F, 0x8B, 0x02, 0x32, 0x37, 0x32, 0x6E, 0x32,
+    0x89, 0x02, 0x32, 0x87, 0x10, 0x32, 0xD5, 0x5E, 0x64, 0x39, 0x64, 0x70, 0x0E, 0x2F, 0x8B, 0x02,
+    0x32, 0x37, 0x32, 0x6E, 0x32, 0x89, 0x02, 0x32, 0x87, 0x10, 0x32, 0xD5, 0x5E, 0x64, 0x70, 0x06,
+    0x5E, 0xD9, 0x03, 0x5E, 0xD8, 0x05, 0x66, 0xE5, 0x0C, 0x0E, 0x31, 0x87, 0x02, 0x32, 0x36, 0x32,
+    0x6C, 0x32, 0x87, 0x02, 0x32, 0xED, 0x0F, 0x32, 0xD7, 0x4F, 0x64, 0x6E, 0x06, 0x04, 0xF3, 0x03,
+    0x04, 0xEE, 0x05, 0x04, 0x87, 0x27, 0x06, 0x0E, 0xEB, 0x03, 0x0E, 0xE7, 0x05, 0x0E, 0xC6, 0x22,
+    0x06, 0x05, 0xB8, 0x04, 0x05, 0xD6, 0x06, 0x05, 0x87, 0x27, 0x06, 0x06, 0xB6, 0x04, 0x06, 0xD3,
+    0x06, 0x06, 0xE2, 0x2A, 0x08, 0x0E, 0xCB, 0x06, 0x10, 0xAB, 0x04, 0x10, 0xC9, 0x06, 0x10, 0xAF,
+    0x26, 0x08, 0x06, 0x9D, 0x07, 0x06, 0xBB, 0x0A, 0x06, 0xB2, 0x10, 0x06, 0xE3, 0x15, 0x0A, 0x35,
+    0x3B, 0x35, 0xAA, 0x01, 0x35, 0x87, 0x22, 0xFC, 0x06, 0xC0, 0x03, 0xFD, 0x06, 0xC0, 0x03, 0x0A,
+    0x37, 0x39, 0x37, 0xA7, 0x01, 0x37, 0xC0, 0x22, 0xFF, 0x06, 0xC0, 0x03, 0x81, 0x07, 0xBF, 0x03,
+    0x08, 0x1A, 0xB9, 0x01, 0x1B, 0x50, 0x1B, 0xB9, 0x01, 0x1B, 0x99, 0x21, 0x0A, 0x33, 0x38, 0x33,
+    0xA2, 0x01, 0x33, 0x9A, 0x16, 0xD0, 0x06, 0xAE, 0x03, 0xD2, 0x06, 0xAD, 0x03, 0x0A, 0x10, 0xAF,
+    0x04, 0x10, 0xCF, 0x06, 0x10, 0x8C, 0x2E, 0x11, 0xAF, 0x04, 0x11, 0xCF, 0x06, 0x08, 0x10, 0xE4,
+    0x03, 0x10, 0xE2, 0x05, 0x10, 0xE3, 0x05, 0x10, 0xBB, 0x25, 0x0A, 0x30, 0x34, 0x30, 0xA0, 0x01,
+    0x30, 0x90, 0x03, 0x30, 0xC8, 0x10, 0x9F, 0x06, 0x90, 0x03, 0x0A, 0x10, 0xD3, 0x06, 0x11, 0xAA,
+    0x04, 0x11, 0xD2, 0x06, 0x11, 0xD3, 0x06, 0x11, 0xEF, 0x25, 0x06, 0x0E, 0xEB, 0x03, 0x0E, 0xE7,
+    0x05, 0x0E, 0x86, 0x28, 0x06, 0x0E, 0xEB, 0x03, 0x0E, 0xE7, 0x05, 0x0E, 0x8A, 0x26, 0x0A, 0x03,
+    0x09, 0x03, 0x13, 0x03, 0x1D, 0x03, 0x27, 0x03, 0xF0, 0x4D, 0x08, 0x0F, 0x8A, 0x01, 0x0F, 0xBE,
+    0x03, 0x0F, 0xDD, 0x04, 0x0F, 0xA5, 0x33, 0x08, 0x30, 0x32, 0x30, 0x94, 0x01, 0x30, 0x95, 0x01,
+    0x30, 0x90, 0x0B, 0x06, 0x57, 0xFF, 0x04, 0x58, 0x93, 0x02, 0x58, 0xFF, 0x04, 0x0A, 0x03, 0x08,
+    0x03, 0x12, 0x03, 0x18, 0x03, 0x26, 0x03, 0xF1, 0x4D, 0x0E, 0x0D, 0xE0, 0x04, 0x0E, 0x8D, 0x01,
+    0x0E, 0xA8, 0x02, 0x0E, 0xC3, 0x03, 0x0E, 0xDE, 0x04, 0x0E, 0xE0, 0x04, 0x0E, 0xBF, 0x30, 0x08,
+    0x03, 0x08, 0x03, 0x12, 0x03, 0x1C, 0x03, 0xBB, 0x63, 0x0E, 0x2E, 0x35, 0x2E, 0x6A, 0x2E, 0x84,
+    0x02, 0x2E, 0xDE, 0x0B, 0x2E, 0xD2, 0x55, 0x5D, 0x35, 0x5D, 0x6A, 0x06, 0x0E, 0xEB, 0x03, 0x0E,
+    0xE7, 0x05, 0x0E, 0xC2, 0x24, 0x08, 0x2C, 0xAF, 0x06, 0x2D, 0x90, 0x04, 0x2D, 0xAF, 0x06, 0x2D,
+    0x88, 0x27, 0x06, 0x0E, 0xEB, 0x03, 0x0E, 0xE7, 0x05, 0x0E, 0xF9, 0x2D, 0x10, 0x30, 0xF6, 0x01,
+    0x32, 0x2F, 0x32, 0x5E, 0x32, 0xF5, 0x01, 0x32, 0xD0, 0x0B, 0x32, 0xDA, 0x55, 0x64, 0x2F, 0x64,
+    0x5E, 0x0A, 0x10, 0xCF, 0x06, 0x10, 0x8C, 0x2E, 0x11, 0xAF, 0x04, 0x11, 0xCE, 0x06, 0x11, 0xCF,
+    0x06, 0x06, 0x0E, 0xEB, 0x03, 0x0E, 0xE7, 0x05, 0x0E, 0x8E, 0x24, 0x08, 0x18, 0xB9, 0x01, 0x1B,
+    0x4E, 0x1B, 0xB7, 0x01, 0x1B, 0x86, 0x0C, 0x0A, 0x38, 0x37, 0x38, 0xA8, 0x01, 0x38, 0xF2, 0x25,
+    0xBF, 0x03, 0xC5, 0x03, 0xC0, 0x03, 0xC5, 0x03, 0x0E, 0x31, 0x34, 0x31, 0xFA, 0x01, 0x31, 0xFC,
+    0x01, 0x31, 0xC9, 0x12, 0x31, 0xE9, 0x5D, 0x64, 0x34, 0x64, 0x66, 0x0C, 0x37, 0x37, 0x37, 0xA7,
+    0x01, 0x37, 0x9F, 0x27, 0x37, 0xA2, 0x4A, 0xC0, 0x03, 0xBD, 0x03, 0xC2, 0x03, 0xBC, 0x03, 0x0A,
+    0x30, 0x62, 0x30, 0xC4, 0x01, 0x61, 0xC4, 0x06, 0x8B, 0x03, 0x84, 0x03, 0x8B, 0x0F, 0x85, 0x03,
+    0x08, 0x03, 0x09, 0x03, 0x1F, 0x03, 0x2A, 0x03, 0xCD, 0x55, 0x0A, 0x31, 0x35, 0x31, 0x86, 0x02,
+    0x31, 0x88, 0x02, 0x31, 0xDE, 0x3E, 0x64, 0x67, 0x08, 0x2C, 0xAF, 0x06, 0x2D, 0x90, 0x04, 0x2D,
+    0xAF, 0x06, 0x2D, 0xE9, 0x24, 0x06, 0x0E, 0xEB, 0x03, 0x0E, 0xE7, 0x05, 0x0E, 0xB6, 0x2A, 0x0A,
+    0x13, 0x4E, 0x15, 0x1B, 0x15, 0x4D, 0x15, 0xC9, 0x1D, 0x16, 0x00, 0x08, 0x0D, 0xEA, 0x03, 0x0D,
+    0xE5, 0x05, 0x0D, 0xE6, 0x05, 0x0D, 0xC3, 0x2A, 0x0A, 0x32, 0x36, 0x32, 0x9E, 0x01, 0x32, 0x97,
+    0x03, 0x32, 0xE9, 0x10, 0xCB, 0x06, 0x97, 0x03, 0x0C, 0x37, 0x38, 0x37, 0xA8, 0x01, 0x37, 0xD9,
+    0x1E, 0x38, 0x00, 0xF2, 0x06, 0xC6, 0x03, 0xF4, 0x06, 0xC4, 0x03, 0x0A, 0x98, 0x01, 0xD7, 0x03,
+    0x9A, 0x01, 0x9C, 0x01, 0x9A, 0x01, 0xD5, 0x03, 0x9A, 0x01, 0x8E, 0x06, 0x9A, 0x01, 0x83, 0x17,
+    0x10, 0x32, 0x32, 0x32, 0x63, 0x32, 0xFB, 0x01, 0x32, 0xFC, 0x01, 0x32, 0xA9, 0x0B, 0x32, 0x86,
+    0x56, 0x66, 0x31, 0x66, 0x62, 0x06, 0x0E, 0xEB, 0x03, 0x0E, 0xE7, 0x05, 0x0E, 0xCA, 0x20, 0x08,
+    0x0D, 0xEA, 0x03, 0x0D, 0xE5, 0x05, 0x0D, 0xE6, 0x05, 0x0D, 0xB3, 0x2E, 0x06, 0x06, 0xB6, 0x04,
+    0x06, 0xD3, 0x06, 0x06, 0xC4, 0x28, 0x0C, 0x56, 0x5B, 0x57, 0x5A, 0x57, 0xB4, 0x01, 0x57, 0xA4,
+    0x45, 0x58, 0x00, 0xAE, 0x01, 0x5A, 0x06, 0x04, 0x8C, 0x08, 0x04, 0xE3, 0x0B, 0x04, 0xBD, 0x17,
+    0x0A, 0x00, 0x00, 0x0E, 0x8D, 0x01, 0x0E, 0xC4, 0x03, 0x0E, 0xDF, 0x04, 0x0E, 0xA6, 0x31, 0x26,
+    0x02, 0xB0, 0x05, 0x1A, 0xE2, 0x20, 0x80, 0x78, 0x88, 0x20, 0x10, 0x39, 0x02, 0xBB, 0x05, 0x34,
+    0xD5, 0x41, 0x11, 0x00, 0x14, 0x44, 0x6D, 0x54, 0x11, 0x10, 0x01, 0x44, 0x45, 0x25, 0x03, 0xC8,
+    0x05, 0x64, 0x60, 0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x04, 0x12,
+    0x48, 0x04, 0x12, 0x48, 0x2A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x80, 0x00,
+    0x00, 0x10, 0x49, 0x20, 0x10, 0x49, 0x20, 0x80, 0x26, 0x02, 0xD9, 0x05, 0x40, 0x15, 0x5A, 0x65,
+    0x67, 0x95, 0x65, 0x9A, 0x9B, 0x95, 0x5A, 0x65, 0x67, 0x95, 0x65, 0x9A, 0x99, 0x26, 0x03, 0xE5,
+    0x05, 0x26, 0xA0, 0x00, 0x01, 0x04, 0x92, 0x48, 0x20, 0x80, 0x40, 0x04, 0x12, 0x09, 0x2B, 0x3D,
+    0x00, 0x23, 0x03, 0xFB, 0x05, 0x18, 0x10, 0x92, 0x49, 0x46, 0x33, 0x09, 0x24, 0x94, 0x60, 0x26,
+    0x03, 0x89, 0x06, 0x44, 0x64, 0x90, 0x00, 0x04, 0x90, 0x00, 0x00, 0x80, 0x00, 0x04, 0x12, 0x49,
+    0x2A, 0x12, 0x40, 0x00, 0x12, 0x40, 0x00, 0x02, 0x00, 0x00, 0x10, 0x49, 0x24, 0x90, 0x27, 0x03,
+    0x9A, 0x06, 0x22, 0x09, 0x94, 0x53, 0x29, 0x94, 0xD9, 0x85, 0x32, 0x8A, 0x65, 0x32, 0x9B, 0x20,
+    0x26, 0x03, 0xA8, 0x06, 0x44, 0x64, 0x00, 0x49, 0x00, 0x92, 0x00, 0x20, 0x82, 0x01, 0x04, 0x10,
+    0x48, 0x2A, 0x10, 0x01, 0x24, 0x02, 0x48, 0x00, 0x82, 0x08, 0x04, 0x10, 0x41, 0x20, 0x90, 0x26,
+    0x03, 0xB9, 0x06, 0x26, 0x84, 0x90, 0x00, 0x20, 0x80, 0x08, 0x00, 0x00, 0x09, 0x24, 0x92, 0x40,
+    0x0A, 0xBA, 0x40, 0x26, 0x02, 0xCD, 0x06, 0x34, 0xD4, 0x00, 0x15, 0x10, 0x25, 0x00, 0x05, 0x44,
+    0x09, 0x40, 0x01, 0x51, 0x01, 0x26, 0x03, 0xDA, 0x06, 0x26, 0xA0, 0x00, 0x41, 0x04, 0x92, 0x08,
+    0x24, 0x90, 0x40, 0x00, 0x02, 0x09, 0x2B, 0x3D, 0x00, 0x26, 0x03, 0xF0, 0x06, 0x34, 0x64, 0x12,
+    0x08, 0x24, 0x00, 0x08, 0x20, 0x10, 0x09, 0x2A, 0x10, 0x48, 0x20, 0x90, 0x00, 0x20, 0x80, 0x40,
+    0x24, 0x90, 0x26, 0x03, 0x81, 0x07, 0x30, 0x80, 0x12, 0x40, 0x04, 0x00, 0x09, 0x00, 0x12, 0x41,
+    0x24, 0x82, 0x01, 0x00, 0x10, 0x48, 0x24, 0xAA, 0xE8, 0x26, 0x03, 0xE5, 0x05, 0x26, 0xA0, 0x00,
+    0x09, 0x04, 0x92, 0x40, 0x24, 0x80, 0x00, 0x00, 0x12, 0x49, 0x2B, 0x3D, 0x00, 0x26, 0x03, 0xE5,
+    0x05, 0x26, 0xA0, 0x80, 0x01, 0x04, 0x12, 0x48, 0x24, 0x00, 0x00, 0x00, 0x92, 0x49, 0x2B, 0x3D,
+    0x00, 0x22, 0x02, 0x95, 0x07, 0x22, 0x54, 0x04, 0x10, 0x00, 0x95, 0x01, 0x04, 0x00, 0x10, 0x28,
+    0x03, 0x9E, 0x07, 0x26, 0xA0, 0x02, 0x48, 0x04, 0x90, 0x01, 0x20, 0x80, 0x40, 0x04, 0x12, 0x09,
+    0x2A, 0x38, 0x00, 0x26, 0x03, 0xB2, 0x07, 0x88, 0x01, 0x60, 0x82, 0x08, 0x24, 0x10, 0x41, 0x00,
+    0x12, 0x40, 0x04, 0x80, 0x09, 0x2A, 0x02, 0x08, 0x20, 0x90, 0x41, 0x04, 0x00, 0x49, 0x00, 0x12,
+    0x00, 0x24, 0xA8, 0x08, 0x20, 0x82, 0x41, 0x04, 0x10, 0x01, 0x24, 0x00, 0x48, 0x00, 0x92, 0xA0,
+    0x20, 0x82, 0x09, 0x04, 0x10, 0x40, 0x04, 0x90, 0x01, 0x20, 0x02, 0x48, 0x26, 0x03, 0xC3, 0x07,
+    0x64, 0x60, 0x10, 0x40, 0x04, 0x80, 0x09, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x10, 0x00,
+    0x20, 0x80, 0x00, 0x0A, 0x00, 0x41, 0x00, 0x12, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x80, 0x40, 0x00, 0x82, 0x00, 0x00, 0x00, 0x26, 0x03, 0xD3, 0x07, 0x26, 0xA0, 0x10, 0x00, 0x04,
+    0x82, 0x49, 0x20, 0x02, 0x00, 0x04, 0x90, 0x49, 0x2B, 0x3D, 0x00, 0x26, 0x03, 0xE9, 0x07, 0x26,
+    0x80, 0x10, 0x40, 0x08, 0x82, 0x08, 0x01, 0xC0, 0x08, 0x20, 0x04, 0x41, 0x04, 0x00, 0x00, 0x26,
+    0x03, 0xF9, 0x07, 0x26, 0x80, 0x02, 0x40, 0x00, 0x02, 0x40, 0x00, 0x00, 0x01, 0x24, 0x92, 0x48,
+    0x0A, 0xBA, 0x00, 0x28, 0x02, 0x8D, 0x08, 0x2C, 0xA1, 0x18, 0x61, 0xA1, 0x18, 0x7A, 0x11, 0x86,
+    0x1A, 0x11, 0x86, 0x26, 0x03, 0x99, 0x08, 0x1A, 0x69, 0x24, 0x10, 0x40, 0x03, 0x12, 0x48, 0x20,
+    0x80, 0x00, 0x26, 0x03, 0xA7, 0x08, 0x34, 0x64, 0x92, 0x49, 0x00, 0x00, 0x00, 0x00, 0x02, 0x49,
+    0x2A, 0x12, 0x49, 0x24, 0x00, 0x00, 0x00, 0x00, 0x09, 0x24, 0x90, 0x27, 0x03, 0xB8, 0x08, 0x22,
+    0x09, 0x94, 0x53, 0x65, 0x32, 0x99, 0x85, 0x32, 0x8A, 0x6C, 0xA6, 0x53, 0x20, 0x39, 0x02, 0xBB,
+    0x05, 0x34, 0xC5, 0x41, 0x11, 0x10, 0x14, 0x44, 0x6C, 0x54, 0x11, 0x11, 0x01, 0x44, 0x44, 0x26,
+    0x02, 0xC6, 0x08, 0x24, 0xC4, 0x45, 0x14, 0x04, 0x6C, 0x44, 0x51, 0x40, 0x44, 0x23, 0x03, 0xD3,
+    0x08, 0x16, 0x0C, 0x92, 0x53, 0x46, 0x16, 0x49, 0x29, 0xA2, 0xC0, 0x26, 0x03, 0xB9, 0x06, 0x26,
+    0x80, 0x00, 0x41, 0x04, 0x12, 0x08, 0x20, 0x00, 0x00, 0x04, 0x92, 0x49, 0x2A, 0xBA, 0x00, 0x23,
+    0x03, 0xE2, 0x08, 0x18, 0x06, 0x12, 0x49, 0x46, 0x32, 0x61, 0x24, 0x94, 0x60, 0x26, 0x03, 0xB9,
+    0x06, 0x26, 0x80, 0x00, 0x41, 0x04, 0x12, 0x08, 0x20, 0x80, 0x00, 0x04, 0x12, 0x49, 0x2A, 0xBA,
+    0x00, 0x26, 0x03, 0xF0, 0x08, 0x64, 0x60, 0x10, 0x40, 0x04, 0x80, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x20, 0x82, 0x00, 0x20, 0x00, 0x00, 0x0A, 0x00, 0x41, 0x00, 0x12, 0x00, 0x24, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x82, 0x08, 0x00, 0x80, 0x00, 0x00, 0x00, 0x26, 0x03, 0xE5, 0x05,
+    0x26, 0xA0, 0x00, 0x41, 0x04, 0x92, 0x08, 0x24, 0x92, 0x48, 0x00, 0x00, 0x01, 0x2B, 0x3D, 0x00,
+    0x29, 0x02, 0x80, 0x09, 0x16, 0x16, 0x66, 0x5D, 0x59, 0x99, 0x50, 0x25, 0x02, 0x8B, 0x09, 0x0B,
+    0x15, 0x9A, 0x9C, 0x29, 0x02, 0x97, 0x09, 0x0B, 0x80, 0x45, 0x00, 0x28, 0x03, 0x9E, 0x07, 0x26,
+    0xA4, 0x10, 0x40, 0x00, 0x82, 0x09, 0x20, 0x80, 0x40, 0x04, 0x12, 0x09, 0x2A, 0x38, 0x40, 0x28,
+    0x02, 0xA3, 0x09, 0x04, 0x11, 0x28, 0x02, 0xAA, 0x09, 0x08, 0x06, 0x04, 0x4C, 0x02, 0xB3, 0x09,
+    0x1A, 0xE2, 0x20, 0x80, 0x78, 0x88, 0x20, 0x00, 0x28, 0x03, 0xBE, 0x09, 0x26, 0xA4, 0x80, 0x00,
+    0x20, 0x82, 0x49, 0x00, 0x02, 0x00, 0x04, 0x90, 0x49, 0x2A, 0x38, 0x40, 0x28, 0x02, 0xD2, 0x09,
+    0x18, 0x15, 0x75, 0x56, 0x55, 0x75, 0x54, 0x28, 0x03, 0xDD, 0x09, 0x26, 0x84, 0x90, 0x00, 0x00,
+    0x02, 0x49, 0x20, 0x80, 0x00, 0x04, 0x12, 0x49, 0x2A, 0xBA, 0x40, 0x26, 0x03, 0xF1, 0x09, 0x28,
+    0x80, 0x90, 0x00, 0x00, 0x90, 0x00, 0x04, 0x92, 0x00, 0x00, 0x00, 0x49, 0x2A, 0x97, 0x48, 0x1D,
+    0x03, 0x85, 0x0A, 0x17, 0x0B, 0x12, 0x63, 0x44, 0x92, 0x6B, 0x44, 0x92, 0x50, 0x28, 0x03, 0x9E,
+    0x07, 0x26, 0xA0, 0x00, 0x40, 0x04, 0x92, 0x09, 0x24, 0x92, 0x09, 0x20, 0x00, 0x40, 0x0A, 0x38,
+    0x00, 0x28, 0x03, 0xDD, 0x09, 0x26, 0x80, 0x00, 0x00, 0x04, 0x92, 0x49, 0x24, 0x92, 0x00, 0x00,
+    0x00, 0x49, 0x2A, 0xBA, 0x00, 0x2D, 0x02, 0x98, 0x0A, 0x0B, 0x14, 0x11, 0x40, 0x37, 0x02, 0xA1,
+    0x0A, 0x30, 0xC0, 0x00, 0x01, 0x55, 0x55, 0x52, 0xC0, 0x00, 0x01, 0x55, 0x55, 0x50, 0x28, 0x03,
+    0x9E, 0x07, 0x26, 0xA0, 0x10, 0x01, 0x24, 0x82, 0x48, 0x00, 0x02, 0x40, 0x04, 0x90, 0x09, 0x2A,
+    0x38, 0x00, 0x28, 0x03, 0x9E, 0x07, 0x26, 0xA4, 0x90, 0x48, 0x00, 0x02, 0x01, 0x20, 0x80, 0x40,
+    0x04, 0x12, 0x09, 0x2A, 0x38, 0x40, 0x37, 0x02, 0xAE, 0x0A, 0x1E, 0x22, 0x21, 0x40, 0x1C, 0x88,
+    0x85, 0x00, 0x40, 0x37, 0x02, 0xAE, 0x0A, 0x1C, 0x22, 0x20, 0x15, 0x72, 0x22, 0x01, 0x54, 0x00,
+    0x02, 0xBB, 0x0A, 0x1B, 0x81, 0x51, 0x14, 0xB8, 0x15, 0x11, 0x44, 0x25, 0x02, 0xC5, 0x0A, 0x08,
+    0x2A, 0x57, 0x28, 0x02, 0xD1, 0x0A, 0x0E, 0x2A, 0x5D, 0xA9, 0x60, 0x21, 0x03, 0xDE, 0x0A, 0x12,
+    0x8D, 0xA4, 0x08, 0x04, 0x04, 0x92, 0x4C, 0x28, 0x03, 0x9E, 0x07, 0x26, 0xA4, 0x12, 0x09, 0x00,
+    0x80, 0x40, 0x20, 0x10, 0x40, 0x04, 0x82, 0x09, 0x2A, 0x38, 0x40, 0x28, 0x03, 0x9E, 0x07, 0x26,
+    0xA0, 0x00, 0x08, 0x04, 0x92, 0x41, 0x24, 0x00, 0x40, 0x00, 0x92, 0x09, 0x2A, 0x38, 0x00, 0x28,
+    0x03, 0x9E, 0x07, 0x26, 0xA0, 0x00, 0x08, 0x24, 0x92, 0x41, 0x04, 0x82, 0x00, 0x00, 0x10, 0x49,
+    0x2A, 0x38, 0x00, 0x28, 0x03, 0x9E, 0x07, 0x26, 0xA0, 0x02, 0x08, 0x04, 0x90, 0x41, 0x24, 0x82,
+    0x00, 0x00, 0x10, 0x49, 0x2A, 0x38, 0x00, 0x28, 0x03, 0x9E, 0x07, 0x26, 0xA4, 0x92, 0x49, 0x20,
+    0x00, 0x00, 0x04, 0x92, 0x48, 0x00, 0x00, 0x01, 0x2A, 0x38, 0x40, 0x39, 0x02, 0xBB, 0x05, 0x34,
+    0xC0, 0x01, 0x51, 0x55, 0x54, 0x04, 0x2C, 0x00, 0x15, 0x15, 0x55, 0x40, 0x40, 0x3B, 0x03, 0xEC,
+    0x0A, 0x4E, 0x84, 0x92, 0x01, 0x24, 0x12, 0x00, 0x04, 0x80, 0x08, 0x09, 0x92, 0x48, 0x04, 0x90,
+    0x48, 0x00, 0x12, 0x00, 0x20, 0x26, 0x49, 0x20, 0x12, 0x41, 0x20, 0x00, 0x48, 0x00, 0x80, 0x80,
+    0x26, 0x02, 0xFD, 0x0A, 0x21, 0xC0, 0x45, 0x02, 0x01, 0x14, 0x08, 0x04, 0x50, 0x00, 0x28, 0x03,
+    0xDD, 0x09, 0x26, 0x80, 0x02, 0x49, 0x24, 0x90, 0x00, 0x00, 0x80, 0x00, 0x04, 0x12, 0x49, 0x2A,
+    0xBA, 0x00, 0x28, 0x02, 0x8D, 0x0B, 0x18, 0x8C, 0x30, 0x0D, 0xCC, 0x30, 0x0C, 0x28, 0x03, 0x9E,
+    0x07, 0x26, 0xA0, 0x00, 0x00, 0x04, 0x92, 0x49, 0x24, 0x82, 0x00, 0x00, 0x10, 0x49, 0x2A, 0x38,
+    0x00, 0x26, 0x02, 0x99, 0x0B, 0x21, 0x40, 0x02, 0x08, 0xA2, 0xE0, 0x00, 0x82, 0x28, 0x40, 0x37,
+    0x02, 0xA5, 0x0B, 0x08, 0x11, 0x40, 0x28, 0x03, 0xBE, 0x09, 0x26, 0xA0, 0x90, 0x00, 0x00, 0x90,
+    0x00, 0x00, 0x10, 0x40, 0x04, 0x82, 0x09, 0x2A, 0x38, 0x00, 0x28, 0x03, 0x9E, 0x07, 0x26, 0xA0,
+    0x82, 0x08, 0x24, 0x10, 0x41, 0x00, 0x00, 0x00, 0x24, 0x92, 0x49, 0x0A, 0x38, 0x00, 0x28, 0x03,
+    0x9E, 0x07, 0x26, 0xA4, 0x00, 0x41, 0x00, 0x92, 0x08, 0x20, 0x02, 0x00, 0x04, 0x90, 0x49, 0x2A,
+    0x38, 0x40, 0x29, 0x03, 0xAC, 0x0B, 0x34, 0x60, 0x00, 0x01, 0x04, 0x10, 0x49, 0x24, 0x82, 0x08,
+    0x2A, 0x00, 0x00, 0x04, 0x10, 0x41, 0x24, 0x92, 0x08, 0x20, 0xA0, 0x28, 0x03, 0x9E, 0x07, 0x26,
+    0xA0, 0x92, 0x09, 0x04, 0x00, 0x40, 0x20, 0x10, 0x40, 0x04, 0x82, 0x09, 0x2A, 0x38, 0x00, 0x23,
+    0x03, 0xE2, 0x08, 0x16, 0x10, 0xA2, 0x62, 0x31, 0x98, 0x51, 0x31, 0x18, 0x00, 0x26, 0x02, 0xBD,
+    0x0B, 0x22, 0x80, 0x45, 0x04, 0x01, 0x14, 0x10, 0x04, 0x50, 0x40, 0x28, 0x03, 0x9E, 0x07, 0x26,
+    0xA0, 0x82, 0x08, 0x24, 0x10, 0x41, 0x04, 0x90, 0x08, 0x20, 0x02, 0x41, 0x0A, 0x38, 0x00, 0x00,
+    0x02, 0xBB, 0x0A, 0x1B, 0x81, 0x50, 0x40, 0xB8, 0x15, 0x04, 0x08, 0x28, 0x02, 0xC9, 0x0B, 0x28,
+    0x18, 0x46, 0x18, 0x68, 0x47, 0x18, 0x46, 0x18, 0x68, 0x44, 0x23, 0x03, 0xD5, 0x0B, 0x18, 0x0A,
+    0x12, 0x49, 0x2A, 0xB2, 0xA1, 0x24, 0x92, 0xA8, 0x23, 0x03, 0xE2, 0x08, 0x18, 0x10, 0x92, 0x49,
+    0x46, 0x33, 0x09, 0x24, 0x94, 0x60, 0x25, 0x03, 0xE7, 0x0B, 0x64, 0x60, 0x80, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x40, 0x20, 0x00, 0x00, 0x04, 0x12, 0x48, 0x04, 0x12, 0x08, 0x2A, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x80, 0x00, 0x00, 0x10, 0x49, 0x20, 0x10, 0x48, 0x20,
+    0x80, 0x26, 0x03, 0xF8, 0x0B, 0x2C, 0x64, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x80, 0xA1, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x10, 0x25, 0x03, 0x89, 0x0C, 0x64, 0x60, 0x82, 0x08, 0x20,
+    0x82, 0x41, 0x04, 0x92, 0x00, 0x20, 0x80, 0x40, 0x00, 0x90, 0x40, 0x04, 0x00, 0x41, 0x2A, 0x02,
+    0x08, 0x20, 0x82, 0x09, 0x04, 0x12, 0x48, 0x00, 0x82, 0x01, 0x00, 0x02, 0x41, 0x00, 0x10, 0x01,
+    0x04, 0x80, 0x26, 0x03, 0x99, 0x0C, 0x26, 0xA0, 0x02, 0x40, 0x04, 0x90, 0x09, 0x20, 0x02, 0x00,
+    0x04, 0x90, 0x49, 0x2A, 0x38, 0x00, 0x26, 0x03, 0xB9, 0x06, 0x26, 0x80, 0x00, 0x40, 0x04, 0x12,
+    0x08, 0x04, 0x92, 0x40, 0x00, 0x00, 0x09, 0x2A, 0xBA, 0x00, 0x26, 0x03, 0xE5, 0x05, 0x26, 0xA0,
+    0x02, 0x00, 0x04, 0x90, 0x49, 0x20, 0x80, 0x40, 0x04, 0x12, 0x09, 0x2B, 0x3D, 0x00, 0x23, 0x03,
+    0xAD, 0x0C, 0x14, 0x10, 0xAB, 0x11, 0x8C, 0xC2, 0xAC, 0x46, 0x00, 0x3A, 0x02, 0xBF, 0x0C, 0x34,
+    0xD5, 0x41, 0x51, 0x40, 0x14, 0x04, 0x2D, 0x54, 0x15, 0x14, 0x01, 0x40, 0x41, 0x26, 0x02, 0xCC,
+    0x0C, 0x44, 0xD1, 0x00, 0x11, 0x00, 0x04, 0x00, 0x11, 0x55, 0x6D, 0x10, 0x01, 0x10, 0x00, 0x40,
+    0x01, 0x15, 0x55, 0x26, 0x03, 0xD9, 0x0C, 0x44, 0x60, 0x90, 0x00, 0x20, 0x80, 0x00, 0x04, 0x02,
+    0x01, 0x00, 0x90, 0x48, 0x2A, 0x02, 0x40, 0x00, 0x82, 0x00, 0x00, 0x10, 0x08, 0x04, 0x02, 0x41,
+    0x20, 0x80, 0x23, 0x03, 0xFB, 0x05, 0x16, 0x10, 0x94, 0x62, 0x31, 0x98, 0x4A, 0x31, 0x18, 0x00,
+    0x26, 0x03, 0xEA, 0x0C, 0x28, 0x80, 0x02, 0x00, 0x00, 0x02, 0x00, 0x04, 0x82, 0x00, 0x00, 0x10,
+    0x49, 0x2A, 0x17, 0x08, 0x26, 0x03, 0xB9, 0x06, 0x26, 0x80, 0x80, 0x40, 0x04, 0x92, 0x49, 0x20,
+    0x92, 0x00, 0x04, 0x00, 0x49, 0x2A, 0xBA, 0x00, 0x26, 0x03, 0xB9, 0x06, 0x26, 0x84, 0x80, 0x00,
+    0x24, 0x10, 0x41, 0x00, 0x80, 0x01, 0x24, 0x12, 0x48, 0x0A, 0xBA, 0x40, 0x26, 0x03, 0xE5, 0x05,
+    0x26, 0xA0, 0x00, 0x00, 0x04, 0x92, 0x49, 0x24, 0x00, 0x41, 0x00, 0x92, 0x08, 0x2B, 0x3D, 0x00,
+    0x26, 0x03, 0xB9, 0x06, 0x26, 0x80, 0x00, 0x00, 0x04, 0x12, 0x48, 0x24, 0x00, 0x00, 0x00, 0x92,
+    0x49, 0x2A, 0xBA, 0x00, 0x23, 0x02, 0xFA, 0x0C, 0x22, 0x29, 0x59, 0x65, 0x55, 0xEA, 0x56, 0x59,
+    0x55, 0x70, 0x26, 0x03, 0xE5, 0x05, 0x26, 0xA0, 0x00, 0x09, 0x04, 0x92, 0x40, 0x20, 0x00, 0x00,
+    0x04, 0x92, 0x49, 0x2B, 0x3D, 0x00, 0x28, 0x03, 0x86, 0x0D, 0x34, 0x64, 0x02, 0x08, 0x00, 0x02,
+    0x09, 0x04, 0x12, 0x49, 0x0A, 0x10, 0x08, 0x20, 0x00, 0x08, 0x24, 0x10, 0x49, 0x24, 0x10, 0x26,
+    0x03, 0xF1, 0x09, 0x28, 0x80, 0x02, 0x00, 0x00, 0x02, 0x00, 0x04, 0x92, 0x00, 0x00, 0x00, 0x49,
+    0x2A, 0x97, 0x48, 0x28, 0x03, 0x9E, 0x07, 0x26, 0xA4, 0x00, 0x49, 0x00, 0x92, 0x00, 0x20, 0x02,
+    0x00, 0x04, 0x90, 0x49, 0x2A, 0x38, 0x40, 0x28, 0x03, 0x9E, 0x07, 0x26, 0xA4, 0x80, 0x00, 0x20,
+    0x12, 0x49, 0x04, 0x92, 0x49, 0x20, 0x00, 0x00, 0x0A, 0x38, 0x40, 0x28, 0x03, 0xDD, 0x09, 0x26,
+    0x80, 0x02, 0x00, 0x04, 0x90, 0x49, 0x24, 0x92, 0x00, 0x00, 0x00, 0x49, 0x2A, 0xBA, 0x00, 0x26,
+    0x03, 0xF1, 0x09, 0x28, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x92, 0x00, 0x00, 0x00, 0x49,
+    0x2A, 0x97, 0x48, 0x26, 0x03, 0xF1, 0x09, 0x28, 0x80, 0x90, 0x40, 0x00, 0x90, 0x40, 0x04, 0x92,
+    0x00, 0x00, 0x00, 0x49, 0x2A, 0x97, 0x48, 0x28, 0x03, 0x97, 0x0D, 0x26, 0xA0, 0x00, 0x08, 0x24,
+    0x92, 0x41, 0x00, 0x82, 0x00, 0x04, 0x10, 0x49, 0x2E, 0x28, 0x00, 0x28, 0x03, 0x9E, 0x07, 0x26,
+    0xA4, 0x80, 0x00, 0x20, 0x12, 0x49, 0x00, 0x02, 0x00, 0x04, 0x90, 0x49, 0x2A, 0x38, 0x40, 0x28,
+    0x03, 0xDD, 0x09, 0x26, 0x84, 0x92, 0x49, 0x20, 0x00, 0x00, 0x04, 0x92, 0x00, 0x00, 0x00, 0x49,
+    0x2A, 0xBA, 0x40, 0x26, 0x03, 0xE5, 0x05, 0x26, 0xA4, 0x00, 0x00, 0x00, 0x92, 0x49, 0x24, 0x00,
+    0x00, 0x00, 0x92, 0x49, 0x2B, 0x3D, 0x00, 0x28, 0x03, 0xAB, 0x0D, 0x44, 0x60, 0x00, 0x00, 0x20,
+    0x02, 0x09, 0x04, 0x02, 0x01, 0x00, 0x90, 0x48, 0x2A, 0x00, 0x00, 0x00, 0x80, 0x08, 0x24, 0x10,
+    0x08, 0x04, 0x02, 0x41, 0x20, 0x80, 0x28, 0x03, 0xBC, 0x0D, 0x26, 0x84, 0x10, 0x40, 0x08, 0x82,
+    0x08, 0x01, 0xD2, 0x08, 0x20, 0x04, 0x41, 0x04, 0x00, 0x40, 0x28, 0x03, 0xD0, 0x0D, 0x34, 0x60,
+    0x82, 0x00, 0x20, 0x80, 0x41, 0x04, 0x90, 0x41, 0x2A, 0x02, 0x08, 0x00, 0x82, 0x01, 0x04, 0x12,
+    0x41, 0x04, 0x80, 0x28, 0x03, 0x9E, 0x07, 0x26, 0xA0, 0x00, 0x40, 0x04, 0x92, 0x09, 0x24, 0x00,
+    0x40, 0x00, 0x92, 0x09, 0x2A, 0x38, 0x00, 0x29, 0x03, 0xE1, 0x0D, 0x26, 0x84, 0x00, 0x00, 0x08,
+    0x12, 0x40, 0x01, 0xD2, 0x00, 0x00, 0x04, 0x09, 0x20, 0x00, 0x40, 0x28, 0x03, 0xDD, 0x09, 0x26,
+    0x84, 0x90, 0x49, 0x20, 0x02, 0x00, 0x04, 0x92, 0x00, 0x00, 0x00, 0x49, 0x2A, 0xBA, 0x40, 0x37,
+    0x03, 0xF5, 0x0D, 0x26, 0xA0, 0x10, 0x00, 0x04, 0x82, 0x49, 0x20, 0x02, 0x00, 0x04, 0x90, 0x49,
+    0x2A, 0x38, 0x00, 0x28, 0x03, 0x9E, 0x07, 0x26, 0xA0, 0x12, 0x00, 0x04, 0x80, 0x49, 0x24, 0x92,
+    0x40, 0x00, 0x00, 0x09, 0x2A, 0x38, 0x00, 0x28, 0x03, 0x9E, 0x07, 0x26, 0xA0, 0x00, 0x40, 0x04,
+    0x92, 0x09, 0x20, 0x02, 0x00, 0x04, 0x90, 0x49, 0x2A, 0x38, 0x00, 0x34, 0x03, 0x89, 0x0E, 0x30,
+    0x80, 0x00, 0x00, 0x00, 0x12, 0x49, 0x24, 0x90, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x12, 0x49, 0x24,
+    0x90, 0x0B, 0x28, 0x03, 0x9E, 0x07, 0x26, 0xA0, 0x02, 0x48, 0x04, 0x90, 0x01, 0x20, 0x12, 0x40,
+    0x04, 0x80, 0x09, 0x2A, 0x38, 0x00, 0x28, 0x03, 0x98, 0x0E, 0x26, 0x80, 0x00, 0x48, 0x04, 0x92,
+    0x01, 0x20, 0x00, 0x00, 0x04, 0x92, 0x49, 0x2A, 0xBA, 0x00, 0x37, 0x03, 0xF5, 0x0D, 0x26, 0xA0,
+    0x02, 0x48, 0x04, 0x90, 0x01, 0x20, 0x80, 0x40, 0x04, 0x12, 0x09, 0x2A, 0x38, 0x00, 0x28, 0x03,
+    0x9E, 0x07, 0x26, 0xA4, 0x10, 0x00, 0x20, 0x82, 0x49, 0x00, 0x02, 0x00, 0x04, 0x90, 0x49, 0x2A,
+    0x38, 0x40, 0x19, 0x02, 0xAC, 0x0E, 0x08, 0x1B, 0x59, 0x28, 0x03, 0x86, 0x0D, 0x34, 0x60, 0x02,
+    0x08, 0x00, 0x02, 0x49, 0x04, 0x12, 0x49, 0x0A, 0x00, 0x08, 0x20, 0x00, 0x09, 0x24, 0x10, 0x49,
+    0x24, 0x00, 0x28, 0x03, 0x9E, 0x07, 0x26, 0xA4, 0x92, 0x49, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x04, 0x90, 0x49, 0x2A, 0x38, 0x40, 0x25, 0x03, 0xB7, 0x0E, 0x34, 0x64, 0x00, 0x08, 0x24, 0x82,
+    0x09, 0x24, 0x10, 0x01, 0x0A, 0x10, 0x00, 0x20, 0x92, 0x08, 0x24, 0x90, 0x40, 0x04, 0x10, 0x28,
+    0x03, 0xBE, 0x09, 0x26, 0xA0, 0x10, 0x40, 0x04, 0x82, 0x09, 0x24, 0x82, 0x40, 0x00, 0x10, 0x09,
+    0x2A, 0x38, 0x00, 0x53, 0x02, 0xC8, 0x0E, 0x20, 0x22, 0x20, 0x00, 0x17, 0x22, 0x20, 0x00, 0x14,
+    0x29, 0x03, 0xD4, 0x0E, 0x18, 0x09, 0x24, 0x49, 0x48, 0xB4, 0x92, 0x44, 0x94, 0x8C, 0x28, 0x03,
+    0xAB, 0x0D, 0x44, 0x60, 0x90, 0x00, 0x24, 0x10, 0x00, 0x04, 0x92, 0x00, 0x00, 0x00, 0x49, 0x2A,
+    0x02, 0x40, 0x00, 0x90, 0x40, 0x00, 0x12, 0x48, 0x00, 0x00, 0x01, 0x24, 0x80, 0x26, 0x03, 0xE3,
+    0x0E, 0x58, 0x60, 0x12, 0x49, 0x00, 0x00, 0x09, 0x00, 0x00, 0x49, 0x24, 0x80, 0x00, 0x00, 0x12,
+    0x49, 0x24, 0xA8, 0x01, 0x24, 0x90, 0x00, 0x00, 0x90, 0x00, 0x04, 0x92, 0x48, 0x00, 0x00, 0x01,
+    0x24, 0x92, 0x48, 0x26, 0x03, 0xF4, 0x0E, 0x58, 0x84, 0x82, 0x49, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x49, 0x24, 0x80, 0x00, 0x00, 0x12, 0x49, 0x24, 0xAA, 0x48, 0x24, 0x90, 0x00, 0x00, 0x02, 0x00,
+    0x04, 0x92, 0x48, 0x00, 0x00, 0x01, 0x24, 0x92, 0x4B, 0x23, 0x03, 0x87, 0x0F, 0x28, 0xA4, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x64, 0x2C, 0x40, 0x80, 0x00, 0x00, 0x00, 0x06, 0x41, 0x1E, 0x03, 0x9B,
+    0x0F, 0x1F, 0x04, 0x92, 0x49, 0x26, 0x35, 0x89, 0x24, 0x9A, 0xD6, 0x24, 0x92, 0x48, 0x21, 0x02,
+    0xAE, 0x0F, 0x1A, 0x1A, 0x56, 0xA6, 0xD6, 0x95, 0xA9, 0x90, 0x25, 0x03, 0xBB, 0x0F, 0x64, 0x60,
+    0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x04, 0x12, 0x48, 0x04, 0x12,
+    0x48, 0x2A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x10, 0x49,
+    0x20, 0x10, 0x49, 0x20, 0x80, 0x26, 0x03, 0xCC, 0x0F, 0x40, 0x04, 0x92, 0x52, 0x28, 0x92, 0x8C,
+    0x44, 0x92, 0x89, 0x45, 0x24, 0x53, 0x44, 0x92, 0x52, 0x28, 0x92, 0x8C, 0x44, 0x92, 0x89, 0x45,
+    0x24, 0x51, 0x26, 0x03, 0xDB, 0x0F, 0x44, 0x84, 0x90, 0x00, 0x04, 0x90, 0x00, 0x00, 0x80, 0x00,
+    0x04, 0x12, 0x49, 0x2A, 0x12, 0x40, 0x00, 0x12, 0x40, 0x00, 0x02, 0x00, 0x00, 0x10, 0x49, 0x24,
+    0xB0, 0x26, 0x02, 0xEA, 0x0F, 0x34, 0xD4, 0x00, 0x15, 0x10, 0x25, 0x00, 0x05, 0x44, 0x09, 0x40,
+    0x01, 0x51, 0x01, 0x26, 0x03, 0xE5, 0x05, 0x26, 0xA0, 0x00, 0x41, 0x04, 0x92, 0x08, 0x24, 0x90,
+    0x40, 0x00, 0x02, 0x09, 0x2B, 0x3D, 0x00, 0x26, 0x03, 0xB9, 0x06, 0x26, 0x84, 0x00, 0x48, 0x04,
+    0x02, 0x01, 0x04, 0x80, 0x09, 0x00, 0x12, 0x40, 0x2A, 0xBA, 0x40, 0x21, 0x02, 0xF7, 0x0F, 0x1A,
+    0x05, 0x01, 0x51, 0x81, 0x40, 0x54, 0x40, 0x26, 0x02, 0x81, 0x10, 0x58, 0xD4, 0x55, 0x00, 0x00,
+    0x40, 0x15, 0x54, 0x00, 0x01, 0x55, 0x56, 0xD4, 0x55, 0x00, 0x00, 0x40, 0x15, 0x54, 0x00, 0x01,
+    0x55, 0x55, 0x26, 0x03, 0x8E, 0x10, 0x88, 0x01, 0x60, 0x82, 0x08, 0x24, 0x10, 0x41, 0x00, 0x12,
+    0x40, 0x04, 0x80, 0x09, 0x2A, 0x02, 0x08, 0x20, 0x90, 0x41, 0x04, 0x00, 0x49, 0x00, 0x12, 0x00,
+    0x24, 0xA8, 0x08, 0x20, 0x82, 0x41, 0x04, 0x10, 0x01, 0x24, 0x00, 0x48, 0x00, 0x92, 0xA0, 0x20,
+    0x82, 0x09, 0x04, 0x10, 0x40, 0x04, 0x90, 0x01, 0x20, 0x02, 0x48, 0x21, 0x02, 0x9F, 0x10, 0x22,
+    0x68, 0x08, 0x20, 0x00, 0xEA, 0x02, 0x08, 0x00, 0x10, 0x21, 0x02, 0xAB, 0x10, 0x18, 0x1A, 0x9A,
+    0x9B, 0x9A, 0x9A, 0x99, 0x26, 0x03, 0xE5, 0x05, 0x26, 0xA0, 0x02, 0x48, 0x04, 0x90, 0x01, 0x20,
+    0x12, 0x40, 0x04, 0x80, 0x09, 0x2B, 0x3D, 0x00, 0x26, 0x03, 0xB8, 0x10, 0x26, 0x80, 0x80, 0x00,
+    0x08, 0x12, 0x40, 0x01, 0xC0, 0x40, 0x00, 0x04, 0x09, 0x20, 0x00, 0x00, 0x23, 0x02, 0xC8, 0x10,
+    0x22, 0x22, 0x20, 0x00, 0x01, 0xC8, 0x88, 0x00, 0x00, 0x40, 0x26, 0x03, 0xB9, 0x06, 0x26, 0x84,
+    0x80, 0x00, 0x20, 0x82, 0x49, 0x00, 0x02, 0x00, 0x04, 0x90, 0x49, 0x2A, 0xBA, 0x40, 0x26, 0x03,
+    0xE5, 0x05, 0x26, 0xA4, 0x80, 0x41, 0x00, 0x12, 0x08, 0x24, 0x90, 0x40, 0x00, 0x02, 0x09, 0x2B,
+    0x3D, 0x00, 0x26, 0x03, 0xE5, 0x05, 0x26, 0xA0, 0x02, 0x48, 0x04, 0x90, 0x01, 0x20, 0x00, 0x40,
+    0x04, 0x92, 0x09, 0x2B, 0x3D, 0x00, 0x1F, 0x03, 0xD5, 0x10, 0x15, 0x47, 0x00, 0x23, 0x3C, 0x01,
+    0x59, 0xE0, 0x04, 0x26, 0x02, 0xEA, 0x10, 0x18, 0x55, 0x40, 0x42, 0x55, 0x40, 0x41, 0x26, 0x02,
+    0xF4, 0x10, 0x44, 0x15, 0xAA, 0x95, 0xAA, 0xAA, 0x5A, 0x55, 0xA5, 0xB1, 0x5A, 0xA9, 0x5A, 0xAA,
+    0xA5, 0xA5, 0x5A, 0x5B, 0x26, 0x03, 0xE5, 0x05, 0x26, 0xA0, 0x82, 0x08, 0x24, 0x10, 0x41, 0x04,
+    0x10, 0x01, 0x20, 0x82, 0x48, 0x0B, 0x3D, 0x00, 0x1E, 0x03, 0x81, 0x11, 0x1F, 0x04, 0x92, 0x49,
+    0x26, 0x34, 0x72, 0x24, 0x9A, 0xD1, 0xC8, 0x92, 0x48, 0x22, 0x03, 0x94, 0x11, 0x2E, 0x47, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x64, 0x62, 0x00, 0xE0, 0x00, 0x2B, 0x23, 0x10, 0x07, 0x00, 0x00, 0x80,
+    0x26, 0x03, 0xE5, 0x05, 0x26, 0xA0, 0x10, 0x00, 0x04, 0x82, 0x49, 0x20, 0x02, 0x00, 0x04, 0x90,
+    0x49, 0x2B, 0x3D, 0x00, 0x26, 0x02, 0xA9, 0x11, 0x34, 0xD5, 0x50, 0x15, 0x11, 0x65, 0x54, 0x05,
+    0x44, 0x59, 0x55, 0x01, 0x51, 0x15, 0x21, 0x02, 0xB6, 0x11, 0x1A, 0x1A, 0x56, 0xA5, 0xD6, 0x95,
+    0xA9, 0x40, 0x26, 0x02, 0xC3, 0x11, 0x0E, 0x2A, 0x5D, 0xA9, 0x60, 0x26, 0x03, 0xE5, 0x05, 0x26,
+    0xA0, 0x02, 0x40, 0x04, 0x90, 0x09, 0x20, 0x02, 0x00, 0x04, 0x90, 0x49, 0x2B, 0x3D, 0x00, 0x26,
+    0x03, 0xE5, 0x05, 0x26, 0xA4, 0x00, 0x49, 0x00, 0x92, 0x00, 0x20, 0x02, 0x00, 0x04, 0x90, 0x49,
+    0x2B, 0x3D, 0x00, 0x26, 0x02, 0xD0, 0x11, 0x18, 0x45, 0x50, 0x02, 0x45, 0x50, 0x01, 0x00, 0x02,
+    0xDA, 0x11, 0x0B, 0x05, 0x60, 0x54, 0x28, 0x02, 0xE4, 0x11, 0x18, 0x6A, 0x82, 0x83, 0xAA, 0x82,
+    0x81, 0x23, 0x03, 0xF1, 0x11, 0x34, 0x60, 0x90, 0x40, 0x20, 0x80, 0x40, 0x20, 0x90, 0x41, 0x2A,
+    0x02, 0x41, 0x00, 0x82, 0x01, 0x00, 0x82, 0x41, 0x04, 0x80, 0x21, 0x03, 0x82, 0x12, 0x1C, 0x0C,
+    0xB2, 0xCA, 0x49, 0x13, 0x0B, 0x2C, 0xB2, 0x92, 0x44, 0xB0, 0x26, 0x03, 0xB9, 0x06, 0x26, 0x80,
+    0x00, 0x00, 0x24, 0x92, 0x09, 0x00, 0x82, 0x00, 0x04, 0x10, 0x49, 0x2A, 0xBA, 0x00, 0x29, 0x02,
+    0x92, 0x12, 0x02, 0x10, 0x26, 0x03, 0xE5, 0x05, 0x26, 0xA0, 0x02, 0x01, 0x04, 0x90, 0x48, 0x20,
+    0x00, 0x00, 0x04, 0x92, 0x49, 0x2B, 0x3D, 0x00, 0x29, 0x02, 0x9A, 0x12, 0x0A, 0x16, 0xE5, 0x90,
+    0x22, 0x02, 0xAB, 0x12, 0x10, 0x16, 0xAB, 0x56, 0xA9, 0x00, 0x02, 0xB8, 0x12, 0x11, 0x41, 0x24,
+    0x12, 0x41, 0x00, 0x26, 0x03, 0xB9, 0x06, 0x26, 0x80, 0x00, 0x00, 0x24, 0x82, 0x49, 0x04, 0x80,
+    0x40, 0x00, 0x12, 0x09, 0x2A, 0xBA, 0x00, 0x26, 0x03, 0xC2, 0x12, 0x28, 0x80, 0x92, 0x00, 0x00,
+    0x92, 0x00, 0x00, 0x10, 0x40, 0x04, 0x82, 0x09, 0x2A, 0x97, 0x48, 0x21, 0x03, 0xD6, 0x12, 0x30,
+    0x60, 0x00, 0x00, 0x00, 0x12, 0x49, 0x24, 0x92, 0x42, 0x80, 0x00, 0x00, 0x00, 0x12, 0x49, 0x24,
+    0x92, 0x40, 0x26, 0x03, 0xE7, 0x12, 0x34, 0x60, 0x82, 0x00, 0x20, 0x80, 0x41, 0x04, 0x90, 0x41,
+    0x2A, 0x02, 0x08, 0x00, 0x82, 0x01, 0x04, 0x12, 0x41, 0x04, 0x80, 0x1F, 0x02, 0xF8, 0x12, 0x18,
+    0x1A, 0x9A, 0x9B, 0x9A, 0x9A, 0x99, 0x22, 0x02, 0xAB, 0x12, 0x10, 0x26, 0xAB, 0x66, 0xAA, 0x1F,
+    0x03, 0x85, 0x13, 0x0E, 0x40, 0x1A, 0x23, 0x00, 0xD0, 0x80, 0x26, 0x03, 0xB9, 0x06, 0x26, 0x80,
+    0x00, 0x00, 0x20, 0x92, 0x49, 0x00, 0x02, 0x40, 0x04, 0x90, 0x09, 0x2A, 0xBA, 0x00, 0x26, 0x02,
+    0x95, 0x13, 0x04, 0x26, 0x26, 0x03, 0xB9, 0x06, 0x26, 0x80, 0x00, 0x00, 0x24, 0x10, 0x49, 0x00,
+    0x82, 0x00, 0x04, 0x10, 0x49, 0x2A, 0xBA, 0x00, 0x29, 0x02, 0x9E, 0x13, 0x04, 0x26, 0x26, 0x02,
+    0xAB, 0x13, 0x22, 0x25, 0x59, 0x9A, 0x5A, 0xE9, 0x56, 0x66, 0x96, 0xA0, 0x23, 0x03, 0xFB, 0x05,
+    0x18, 0x10, 0x92, 0x54, 0x24, 0xB3, 0x09, 0x25, 0x42, 0x48, 0x26, 0x02, 0xAB, 0x13, 0x22, 0x25,
+    0x99, 0x9A, 0x5A, 0xE9, 0x66, 0x66, 0x96, 0xA0, 0x26, 0x03, 0xB9, 0x06, 0x26, 0x80, 0x00, 0x00,
+    0x24, 0x90, 0x41, 0x00, 0x82, 0x00, 0x04, 0x10, 0x49, 0x2A, 0xBA, 0x00, 0x1E, 0x03, 0xB7, 0x13,
+    0x1D, 0x04, 0x92, 0x49, 0x26, 0x32, 0x51, 0xCB, 0xD6, 0x4A, 0x39, 0x72, 0x1E, 0x03, 0xCC, 0x13,
+    0x1F, 0x04, 0x92, 0x49, 0x26, 0x32, 0x4A, 0x38, 0x9A, 0xC9, 0x28, 0xE2, 0x48, 0x26, 0x03, 0xC2,
+    0x12, 0x28, 0x84, 0x82, 0x00, 0x04, 0x82, 0x00, 0x00, 0x82, 0x00, 0x04, 0x10, 0x49, 0x2A, 0x87,
+    0x41, 0x26, 0x02, 0xDF, 0x13, 0x0C, 0x41, 0x24, 0x12, 0x26, 0x03, 0xE9, 0x13, 0x1F, 0x04, 0x92,
+    0x49, 0x26, 0x34, 0x49, 0x38, 0x9A, 0xD1, 0x24, 0xE2, 0x48, 0x00, 0x02, 0xFC, 0x13, 0x17, 0x05,
+    0x54, 0x06, 0x05, 0x54, 0x04, 0x00, 0x02, 0xFC, 0x13, 0x17, 0x14, 0x54, 0x06, 0x14, 0x54, 0x04,
+    0x26, 0x02, 0x86, 0x14, 0x18, 0x45, 0x44, 0x56, 0x45, 0x44, 0x55, 0x00, 0x02, 0x90, 0x14, 0x17,
+    0x55, 0x45, 0x46, 0x55, 0x45, 0x44, 0x22, 0x02, 0xAB, 0x12, 0x10, 0x19, 0x57, 0x59, 0x55, 0x23,
+    0x03, 0xE2, 0x08, 0x1A, 0x04, 0x92, 0x49, 0x28, 0xC6, 0x49, 0x24, 0x92, 0x51, 0x80, 0x00, 0x02,
+    0x9A, 0x14, 0x17, 0x05, 0x45, 0x46, 0x05, 0x45, 0x44, 0x26, 0x02, 0xA4, 0x14, 0x18, 0x2A, 0x9A,
+    0x9B, 0xAA, 0x9A, 0x9A, 0x1E, 0x03, 0x81, 0x11, 0x1F, 0x04, 0x92, 0x49, 0x26, 0x32, 0x51, 0xC8,
+    0x9A, 0xC9, 0x47, 0x22, 0x48, 0x00, 0x02, 0xB1, 0x14, 0x0C, 0x90, 0x0D, 0x00, 0x26, 0x03, 0xBE,
+    0x14, 0x44, 0x60, 0x00, 0x00, 0x24, 0x80, 0x09, 0x04, 0x92, 0x00, 0x00, 0x00, 0x49, 0x2A, 0x00,
+    0x00, 0x00, 0x92, 0x00, 0x24, 0x12, 0x48, 0x00, 0x00, 0x01, 0x24, 0x80, 0x26, 0x03, 0xCF, 0x14,
+    0x44, 0x60, 0x00, 0x00, 0x20, 0x10, 0x09, 0x04, 0x02, 0x01, 0x00, 0x90, 0x48, 0x2A, 0x00, 0x00,
+    0x00, 0x80, 0x40, 0x24, 0x10, 0x08, 0x04, 0x02, 0x41, 0x20, 0x80, 0x26, 0x02, 0xE0, 0x14, 0x50,
+    0x1A, 0x5A, 0x65, 0x67, 0x9A, 0x65, 0x9A, 0x9B, 0x9A, 0x5A, 0x65, 0x67, 0x9A, 0x65, 0x9A, 0x9B,
+    0x9A, 0x5A, 0x65, 0x65, 0x28, 0x03, 0xEC, 0x14, 0x44, 0x60, 0x82, 0x08, 0x24, 0x10, 0x41, 0x04,
+    0x82, 0x40, 0x00, 0x10, 0x09, 0x2A, 0x02, 0x08, 0x20, 0x90, 0x41, 0x04, 0x12, 0x09, 0x00, 0x00,
+    0x40, 0x24, 0x80, 0x21, 0x03, 0xFD, 0x14, 0x18, 0x0E, 0x38, 0x21, 0x82, 0x26, 0x20, 0x82, 0x48,
+    0x23, 0x26, 0x02, 0x8D, 0x15, 0x18, 0x6A, 0xA0, 0x03, 0xAA, 0xA0, 0x01, 0x26, 0x03, 0x9A, 0x15,
+    0x26, 0x84, 0x82, 0x40, 0x08, 0x92, 0x48, 0x01, 0xC2, 0x41, 0x20, 0x04, 0x49, 0x24, 0x00, 0x40,
+    0x21, 0x03, 0xAA, 0x15, 0x18, 0x45, 0x86, 0x5B, 0x05, 0xC6, 0x5B, 0x05, 0xB0, 0x42, 0x26, 0x02,
+    0xBA, 0x15, 0x18, 0x55, 0x50, 0x02, 0x55, 0x50, 0x01, 0x26, 0x02, 0xC4, 0x15, 0x18, 0x45, 0x54,
+    0x42, 0x45, 0x54, 0x41, 0x26, 0x03, 0xE9, 0x07, 0x26, 0x84, 0x10, 0x40, 0x08, 0x82, 0x08, 0x01,
+    0xC2, 0x08, 0x20, 0x04, 0x41, 0x04, 0x00, 0x40, 0x00, 0x03, 0xCE, 0x15, 0x1D, 0x60, 0x00, 0x88,
+    0x00, 0x02, 0xE3, 0x00, 0x04, 0x40, 0x00, 0x16, 0x26, 0x02, 0xDA, 0x15, 0x1E, 0x80, 0x01, 0x00,
+    0x2E, 0x00, 0x04, 0x00, 0xA0, 0x28, 0x02, 0xE7, 0x15, 0x16, 0x48, 0x80, 0x0E, 0x22, 0x00, 0x10,
+    0x23, 0x02, 0xF3, 0x15, 0x0B, 0x15, 0x9A, 0x94, 0x00, 0x03, 0xFD, 0x15, 0x1D, 0x60, 0x80, 0x88,
+    0x00, 0x00, 0xE3, 0x04, 0x04, 0x40, 0x00, 0x06, 0x22, 0x02, 0xAB, 0x12, 0x10, 0x2A, 0xAB, 0x6A,
+    0xAA, 0x26, 0x03, 0x89, 0x16, 0x1E, 0x04, 0x94, 0x4B, 0x24, 0x95, 0x35, 0x24, 0xA2, 0x59, 0x24,
+    0xA8, 0x40, 0x22, 0x02, 0xAB, 0x12, 0x10, 0x19, 0xAB, 0x59, 0xA9, 0x00, 0x02, 0x9F, 0x16, 0x1B,
+    0x80, 0x01, 0x00, 0xB8, 0x55, 0x10, 0x08, 0x23, 0x03, 0xA9, 0x16, 0x2E, 0x46, 0x80, 0x00, 0x00,
+    0x00, 0x03, 0x44, 0x52, 0x00, 0x00, 0x0C, 0x22, 0x22, 0x90, 0x00, 0x00, 0x60, 0x80, 0x00, 0x02,
+    0x9F, 0x16, 0x1B, 0x80, 0x04, 0x00, 0xB8, 0x55, 0x40, 0x08, 0x26, 0x02, 0xBB, 0x16, 0x18, 0x55,
+    0x50, 0x06, 0x55, 0x50, 0x05, 0x26, 0x02, 0xBA, 0x15, 0x18, 0x45, 0x54, 0x02, 0x45, 0x54, 0x01,
+    0x22, 0x02, 0xC5, 0x16, 0x18, 0x29, 0x9A, 0x9B, 0xA9, 0x9A, 0x9A, 0x26, 0x02, 0xD2, 0x16, 0x18,
+    0x44, 0x40, 0x02, 0x44, 0x40, 0x01, 0x26, 0x03, 0xB9, 0x06, 0x26, 0x84, 0x10, 0x00, 0x20, 0x90,
+    0x01, 0x00, 0x80, 0x40, 0x04, 0x12, 0x09, 0x2A, 0xBA, 0x40, 0x26, 0x03, 0xDC, 0x16, 0x3B, 0x0B,
+    0x12, 0x49, 0x24, 0x92, 0x49, 0x8D, 0x1C, 0x89, 0x27, 0xFC, 0xAB, 0x47, 0x22, 0x49, 0xFF, 0x2A,
+    0xD1, 0xC8, 0x92, 0x7F, 0xC9, 0x00, 0x21, 0x03, 0xF1, 0x16, 0x18, 0x62, 0x08, 0xA0, 0x8A, 0x19,
+    0x04, 0x08, 0x40, 0x83, 0x26, 0x02, 0x81, 0x17, 0x18, 0x45, 0x54, 0x16, 0x45, 0x54, 0x15, 0x26,
+    0x02, 0x8B, 0x17, 0x16, 0x19, 0x95, 0x5E, 0x66, 0x55, 0x50, 0x26, 0x03, 0x97, 0x17, 0x44, 0x64,
+    0x10, 0x00, 0x04, 0x10, 0x00, 0x00, 0x80, 0x00, 0x04, 0x12, 0x49, 0x2A, 0x10, 0x40, 0x00, 0x10,
+    0x40, 0x00, 0x02, 0x00, 0x00, 0x10, 0x49, 0x24, 0x90, 0x1F, 0x03, 0xA8, 0x17, 0x15, 0x22, 0x80,
+    0x1A, 0x18, 0x01, 0x10, 0xC0, 0x02, 0x26, 0x03, 0xBB, 0x17, 0x28, 0x80, 0x02, 0x00, 0x00, 0x02,
+    0x00, 0x04, 0x92, 0x00, 0x00, 0x00, 0x49, 0x2A, 0x97, 0x48, 0x1F, 0x03, 0x85, 0x13, 0x0E, 0x46,
+    0x80, 0x23, 0x34, 0x00, 0x80, 0x1E, 0x03, 0x81, 0x11, 0x1F, 0x04, 0x92, 0x49, 0x26, 0x34, 0x71,
+    0x44, 0x9A, 0xD1, 0xC5, 0x12, 0x48, 0x3A, 0x03, 0xCF, 0x17, 0x4D, 0x84, 0x92, 0x01, 0x24, 0x12,
+    0x00, 0x04, 0x80, 0x08, 0x09, 0x92, 0x48, 0x04, 0x90, 0x48, 0x00, 0x12, 0x00, 0x20, 0x26, 0x49,
+    0x20, 0x12, 0x41, 0x20, 0x00, 0x48, 0x00, 0x82, 0x00, 0x02, 0xE0, 0x17, 0x1D, 0x80, 0x01, 0x00,
+    0x2E, 0x00, 0x04, 0x00, 0x80, 0x1F, 0x03, 0xEA, 0x17, 0x0E, 0x22, 0x00, 0x1A, 0x10, 0x00, 0x40,
+    0x22, 0x02, 0xF8, 0x17, 0x18, 0x2A, 0x9A, 0x9B, 0xAA, 0x9A, 0x9A, 0x26, 0x02, 0x85, 0x18, 0x18,
+    0x44, 0x44, 0x02, 0x44, 0x44, 0x01, 0x26, 0x03, 0x8F, 0x18, 0x52, 0x09, 0x24, 0x92, 0x49, 0x12,
+    0x4A, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x94, 0x89, 0x69, 0x24, 0x92, 0x49, 0x22, 0x49,
+    0x44, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x91, 0x30, 0x26, 0x03, 0xE7, 0x12, 0x34, 0x64,
+    0x00, 0x09, 0x24, 0x00, 0x09, 0x24, 0x00, 0x09, 0x2A, 0x10, 0x00, 0x24, 0x90, 0x00, 0x24, 0x90,
+    0x00, 0x24, 0x90, 0x26, 0x03, 0x8F, 0x18, 0x52, 0x04, 0xA4, 0x92, 0x49, 0x22, 0x49, 0x48, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x94, 0x89, 0x68, 0x94, 0x92, 0x49, 0x24, 0x49, 0x29, 0x12, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x91, 0x30, 0x28, 0x02, 0x9B, 0x18, 0x18, 0x6A, 0xA0, 0x0B, 0xAA,
+    0xA0, 0x09, 0x26, 0x03, 0xA8, 0x18, 0x26, 0x80, 0x10, 0x40, 0x08, 0x92, 0x48, 0x01, 0xC0, 0x08,
+    0x20, 0x04, 0x49, 0x24, 0x00, 0x00, 0x26, 0x03, 0xB8, 0x18, 0x44, 0x84, 0x80, 0x00, 0x20, 0x82,
+    0x49, 0x00, 0x02, 0x00, 0x04, 0x90, 0x49, 0x2A, 0x92, 0x00, 0x00, 0x82, 0x09, 0x24, 0x00, 0x08,
+    0x00, 0x12, 0x41, 0x24, 0xB0, 0x26, 0x03, 0xE5, 0x05, 0x26, 0xA0, 0x00, 0x00, 0x04, 0x92, 0x49,
+    0x20, 0x00, 0x00, 0x04, 0x92, 0x49, 0x2B, 0x3D, 0x00, 0x26, 0x02, 0xBA, 0x15, 0x18, 0x44, 0x40,
+    0x56, 0x44, 0x40, 0x55, 0x29, 0x03, 0xCB, 0x18, 0x08, 0x05, 0xC4, 0x59, 0x26, 0x03, 0xE0, 0x18,
+    0x2D, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0x8C, 0x40, 0x03, 0xF1, 0xEB, 0x23, 0x10, 0x00,
+    0xFC, 0x74, 0x26, 0x03, 0xE0, 0x18, 0x2D, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0x8C, 0x40,
+    0x03, 0xE3, 0xEB, 0x23, 0x10, 0x00, 0xF8, 0xF4, 0x26, 0x02, 0xF5, 0x18, 0x18, 0x55, 0x55, 0x42,
+    0x55, 0x55, 0x41, 0x00, 0x02, 0xFC, 0x13, 0x17, 0x05, 0x50, 0x06, 0x05, 0x50, 0x04, 0x26, 0x02,
+    0x86, 0x14, 0x18, 0x55, 0x54, 0x12, 0x55, 0x54, 0x11, 0x28, 0x02, 0xFF, 0x18, 0x18, 0x40, 0x0A,
+    0x83, 0x80, 0x0A, 0x81, 0x00, 0x02, 0x8C, 0x19, 0x17, 0x54, 0x45, 0x46, 0x54, 0x45, 0x44, 0x26,
+    0x03, 0xE5, 0x05, 0x26, 0xA0, 0x00, 0x00, 0x04, 0x92, 0x49, 0x24, 0x00, 0x00, 0x00, 0x92, 0x49,
+    0x2B, 0x3D, 0x00, 0x23, 0x03, 0x96, 0x19, 0x16, 0x14, 0x95, 0x4A, 0x35, 0x9A, 0x4A, 0xA5, 0x1B,
+    0x00, 0x00, 0x02, 0xA6, 0x19, 0x0B, 0x05, 0x60, 0x54, 0x00, 0x03, 0xB0, 0x19, 0x1E, 0x64, 0x92,
+    0x4A, 0x24, 0x92, 0xE3, 0x24, 0x92, 0x51, 0x24, 0x96, 0x00, 0x26, 0x00, 0x63, 0xCA, 0x15, 0x99,
+    0x06, 0x96, 0x04, 0xE6, 0x02, 0x92, 0x04, 0xE6, 0x02, 0x92, 0x04, 0x9A, 0x06, 0x96, 0x04, 0x9A,
+    0x06, 0xD5, 0x07, 0xFB, 0x02, 0x95, 0x04, 0xE2, 0x02, 0x94, 0x04, 0xE4, 0x02, 0x92, 0x04, 0xE5,
+    0x02, 0xF9, 0x03, 0xFF, 0x02, 0xF9, 0x03, 0xFE, 0x02, 0xFA, 0x03, 0xFE, 0x02, 0xFA, 0x03, 0xFF,
+    0x02, 0xF9, 0x03, 0xFF, 0x02, 0xF9, 0x03, 0x80, 0x03, 0xF7, 0x03, 0x81, 0x03, 0xF6, 0x03, 0x82,
+    0x03, 0xF5, 0x03, 0x84, 0x03, 0xF3, 0x03, 0x85, 0x03, 0xF2, 0x03, 0x86, 0x03, 0xF1, 0x03, 0x87,
+    0x03, 0xAF, 0x07, 0x85, 0x03, 0xEF, 0x03, 0xC2, 0x06, 0xEF, 0x03, 0x8A, 0x03, 0xEE, 0x03, 0x99,
+    0xBB, 0x07, 0xC8, 0x15, 0x9C, 0x06, 0x91, 0x04, 0x80, 0x03, 0xF7, 0x03, 0x81, 0x03, 0xF6, 0x03,
+    0xB9, 0x06, 0xF6, 0x03, 0xBA, 0x06, 0xB3, 0x07, 0x81, 0x03, 0xF2, 0x03, 0x87, 0x03, 0xF0, 0x03,
+    0x88, 0x03, 0xF0, 0x03, 0x88, 0x03, 0xF0, 0x03, 0x88, 0x03, 0xF0, 0x03, 0x89, 0x03, 0xEF, 0x03,
+    0x89, 0x03, 0xEF, 0x03, 0x89, 0x03, 0xEF, 0x03, 0x89, 0x03, 0xEF, 0x03, 0x89, 0x03, 0xEF, 0x03,
+    0x89, 0x03, 0xEF, 0x03, 0x89, 0x03, 0xEF, 0x03, 0x89, 0x03, 0xEF, 0x03, 0x89, 0x03, 0xEF, 0x03,
+    0x89, 0x03, 0xEF, 0x03, 0x89, 0x03, 0xAE, 0x07, 0x85, 0x03, 0xEF, 0x03, 0xC2, 0x06, 0xEF, 0x03,
+    0x8A, 0x03, 0xEE, 0x03, 0x26, 0x00, 0xAB, 0x02, 0x99, 0x1B, 0xB3, 0x0D, 0xC9, 0x03, 0xBA, 0x03,
+    0xAC, 0x03, 0x84, 0x0A, 0xC9, 0x03, 0xBA, 0x03, 0xAC, 0x03, 0xBB, 0x03, 0xAB, 0x03, 0xBB, 0x03,
+    0xAB, 0x03, 0xBB, 0x03, 0xAB, 0x03, 0xBA, 0x03, 0xAC, 0x03, 0xBA, 0x03, 0xAC, 0x03, 0xBA, 0x03,
+    0xC5, 0x03, 0xA1, 0x03, 0xC5, 0x03, 0xA1, 0x03, 0xC5, 0x03, 0xA1, 0x03, 0xC4, 0x03, 0xA2, 0x03,
+    0xC3, 0x03, 0x89, 0x0A, 0xC3, 0x03, 0xA6, 0x03, 0xC0, 0x03, 0xBF, 0x03, 0xA6, 0x03, 0xA8, 0x03,
+    0xBF, 0x03, 0xBF, 0x03, 0xA7, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xA8, 0x03, 0xBE, 0x03, 0xC0, 0x03,
+    0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xA7, 0x0A, 0xA6, 0x03, 0xC0, 0x03,
+    0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xC0, 0x03,
+    0xA7, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xA7, 0x0A, 0xA6, 0x03, 0xC0, 0x03,
+    0xA6, 0x03, 0xA7, 0x0A, 0xA6, 0x03, 0xA7, 0x0A, 0xA6, 0x03, 0xA7, 0x0A, 0xA6, 0x03, 0xA7, 0x0A,
+    0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xC1, 0x03, 0xA5, 0x03, 0xA7, 0x0A, 0xA6, 0x03, 0xC0, 0x03,
+    0xA6, 0x03, 0xA8, 0x0A, 0xA5, 0x03, 0xA7, 0x0A, 0xA6, 0x03, 0xA8, 0x0A, 0xA5, 0x03, 0xA7, 0x0A,
+    0xA6, 0x03, 0xC1, 0x03, 0xA6, 0x03, 0xA7, 0x0A, 0xA6, 0x03, 0xEC, 0xC7, 0x04, 0x93, 0x1B, 0xD6,
+    0x0D, 0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xA7, 0x0A, 0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xC0,
+    0x03, 0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xC0,
+    0x03, 0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xC0,
+    0x03, 0xA6, 0x03, 0xC1, 0x03, 0xA6, 0x03, 0xA7, 0x0A, 0xA6, 0x03, 0xC1, 0x03, 0xA5, 0x03, 0xC1,
+    0x03, 0xA5, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xC1, 0x03, 0xA5, 0x03, 0xC1, 0x03, 0xA5, 0x03, 0xC1,
+    0x03, 0xA5, 0x03, 0xC1, 0x03, 0xA5, 0x03, 0xC1, 0x03, 0xA5, 0x03, 0xC1, 0x03, 0xA5, 0x03, 0xA8,
+    0x0A, 0xA5, 0x03, 0xC1, 0x03, 0xA5, 0x03, 0xC1, 0x03, 0xA5, 0x03, 0xC1, 0x03, 0xA5, 0x03, 0xC1,
+    0x03, 0xA5, 0x03, 0xC1, 0x03, 0xA6, 0x03, 0xC1, 0x03, 0xA5, 0x03, 0xC1, 0x03, 0xA5, 0x03, 0xC1,
+    0x03, 0xA6, 0x03, 0xC1, 0x03, 0xA5, 0x03, 0xA8, 0x0A, 0xA5, 0x03, 0xC1, 0x03, 0xA5, 0x03, 0xA8,
+    0x0A, 0xA5, 0x03, 0xA8, 0x0A, 0xA5, 0x03, 0xA8, 0x0A, 0xA5, 0x03, 0xA8, 0x0A, 0xA5, 0x03, 0xC1,
+    0x03, 0xA5, 0x03, 0xC1, 0x03, 0xA5, 0x03, 0xA8, 0x0A, 0xA5, 0x03, 0xC1, 0x03, 0xA5, 0x03, 0xA8,
+    0x0A, 0xA5, 0x03, 0xA8, 0x0A, 0xA5, 0x03, 0xA8, 0x0A, 0xA5, 0x03, 0xA8, 0x0A, 0xA5, 0x03, 0xC2,
+    0x03, 0xA4, 0x03, 0xA9, 0x0A, 0xA4, 0x03, 0xEC, 0xC7, 0x04, 0x93, 0x1B, 0xD6, 0x0D, 0xA6, 0x03,
+    0xC0, 0x03, 0xA6, 0x03, 0xA7, 0x0A, 0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xC0, 0x03, 0xA7, 0x03,
+    0xC0, 0x03, 0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03,
+    0xC0, 0x03, 0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03,
+    0xC0, 0x03, 0xA6, 0x03, 0xA7, 0x0A, 0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03,
+    0xC0, 0x03, 0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xC1, 0x03, 0xA5, 0x03,
+    0xC1, 0x03, 0xA5, 0x03, 0xC1, 0x03, 0xA5, 0x03, 0xC0, 0x03, 0xA6, 0x03, 0xA8, 0x0A, 0xA5, 0x03,
+    0xC1, 0x03, 0xA5, 0x03, 0xC1, 0x03, 0xA5, 0x03, 0xC1, 0x03, 0xA6, 0x03, 0xC1, 0x03, 0xA5, 0x03,
+    0xC1, 0x03, 0xA5, 0x03, 0xC1, 0x03, 0xA6, 0x03, 0xC1, 0x03, 0xA5, 0x03, 0xC1, 0x03, 0xA5, 0x03,
+    0xA8, 0x0A, 0xA5, 0x03, 0xC1, 0x03, 0xA5, 0x03, 0xA8, 0x0A, 0xA5, 0x03, 0xA8, 0x0A, 0xA5, 0x03,
+    0xA8, 0x0A, 0xA5, 0x03, 0xA8, 0x0A, 0xA5, 0x03, 0xC1, 0x03, 0xA5, 0x03, 0xC1, 0x03, 0xA5, 0x03,
+    0xA8, 0x0A, 0xA5, 0x03, 0xC1, 0x03, 0xA5, 0x03, 0xA8, 0x0A, 0xA5, 0x03, 0xA8, 0x0A, 0xA5, 0x03,
+    0xA8, 0x0A, 0xA5, 0x03, 0xA8, 0x0A, 0xA5, 0x03, 0xC1, 0x03, 0xA5, 0x03, 0xA8, 0x0A, 0xA5, 0x03,
+    0x26, 0x00, 0x83, 0x01, 0x90, 0x04, 0xCE, 0x0E, 0xB1, 0x03, 0xFC, 0x02, 0xB0, 0x03, 0x82, 0x03,
+    0xAA, 0x03, 0x88, 0x03, 0xAF, 0x03, 0x8C, 0x06, 0xAC, 0x03, 0x86, 0x03, 0xB1, 0x03, 0x82, 0x03,
+    0xAA, 0x03, 0x88, 0x03, 0xAF, 0x03, 0x83, 0x03, 0xA9, 0x03, 0x88, 0x03, 0xAF, 0x03, 0xD1, 0xEA,
+    0x05, 0x98, 0x04, 0xC6, 0x0E, 0xAE, 0x03, 0xFE, 0x02, 0xAF, 0x03, 0x85, 0x03, 0xA7, 0x03, 0xA5,
+    0x03, 0x92, 0x03, 0x8F, 0x06, 0xA9, 0x03, 0x8A, 0x03, 0xAD, 0x03, 0x85, 0x03, 0xB2, 0x03, 0x82,
+    0x03, 0xAA, 0x03, 0xA2, 0x03, 0x95, 0x03, 0x83, 0x03, 0xA9, 0x03, 0xD6, 0xEA, 0x05, 0x93, 0x04,
+    0xCC, 0x0E, 0xA8, 0x03, 0x85, 0x03, 0xB2, 0x03, 0x82, 0x03, 0xAA, 0x03, 0x88, 0x03, 0xAF, 0x03,
+    0x8D, 0x06, 0xAB, 0x03, 0x88, 0x03, 0xAF, 0x03, 0x84, 0x03, 0xA8, 0x03, 0x8B, 0x03, 0xAC, 0x03,
+    0xA0, 0x03, 0x97, 0x03, 0x9B, 0x03, 0x92, 0x03, 0xD5, 0xEA, 0x05, 0x94, 0x04, 0xCB, 0x0E, 0xA9,
+    0x03, 0x84, 0x03, 0xA8, 0x03, 0x8B, 0x03, 0xAC, 0x03, 0x87, 0x03, 0xB0, 0x03, 0x8B, 0x06, 0xAE,
+    0x03, 0x86, 0x03, 0xB1, 0x03, 0x9C, 0x03, 0x90, 0x03, 0xA2, 0x03, 0x95, 0x03, 0x85, 0x03, 0xA7,
+    0x03, 0xA3, 0x03, 0x94, 0x03, 0xD3, 0xEA, 0x05, 0x95, 0x04, 0xCA, 0x0E, 0xAA, 0x03, 0x83, 0x03,
+    0xA9, 0x03, 0x8A, 0x03, 0xAD, 0x03, 0x9F, 0x03, 0x98, 0x03, 0xA4, 0x06, 0x94, 0x03, 0x86, 0x03,
+    0xA7, 0x03, 0xA5, 0x03, 0x92, 0x03, 0x88, 0x03, 0xAF, 0x03, 0x84, 0x03, 0xA8, 0x03, 0xA3, 0x03,
+    0x94, 0x03, 0xD3, 0xEA, 0x05, 0x96, 0x04, 0xC8, 0x0E, 0xAC, 0x03, 0x81, 0x03, 0xAB, 0x03, 0x88,
+    0x03, 0xAF, 0x03, 0x84, 0x03, 0xA8, 0x03, 0x93, 0x06, 0xB0, 0x03, 0x84, 0x03, 0xA8, 0x03, 0x8B,
+    0x03, 0xAC, 0x03, 0x88, 0x03, 0xAF, 0x03, 0x84, 0x03, 0xA8, 0x03, 0x8A, 0x03, 0xAD, 0x03, 0x26,
+    0x00, 0xBF, 0x01, 0xDA, 0x0A, 0xBA, 0x02, 0xDF, 0x0A, 0xC0, 0x02, 0x87, 0x04, 0x8F, 0x09, 0xDA,
+    0x0A, 0xC2, 0x02, 0xBB, 0x0A, 0xDE, 0x02, 0xD1, 0x03, 0xC5, 0x09, 0xD3, 0x03, 0xC6, 0x09, 0xD3,
+    0x03, 0xC6, 0x09, 0xD2, 0x03, 0xC5, 0x09, 0xD3, 0x03, 0xC5, 0x09, 0xD3, 0x03, 0xC5, 0x09, 0xA5,
+    0x0A, 0x9B, 0x37, 0xA5, 0x0A, 0xF4, 0x02, 0xBD, 0x0A, 0xDD, 0x02, 0xEB, 0x03, 0xAE, 0x09, 0xBC,
+    0x0A, 0xE0, 0x02, 0xB9, 0x0A, 0xE1, 0x02, 0xE6, 0x03, 0xB2, 0x09, 0xE6, 0x03, 0xCA, 0x09, 0xCE,
+    0x03, 0xCA, 0x09, 0xCE, 0x03, 0xCB, 0x09, 0xCD, 0x03, 0xCB, 0x09, 0xCE, 0x03, 0xCB, 0x09, 0x9F,
+    0x0A, 0xA1, 0x37, 0xA0, 0x0A, 0xFA, 0x02, 0x9F, 0x0A, 0xFA, 0x02, 0xCE, 0x03, 0xCB, 0x09, 0x9F,
+    0x0A, 0xFA, 0x02, 0xA0, 0x0A, 0xFA, 0x02, 0xCE, 0x03, 0xCB, 0x09, 0xCE, 0x03, 0xCB, 0x09, 0xCD,
+    0x03, 0xCB, 0x09, 0xCE, 0x03, 0xCB, 0x09, 0xCD, 0x03, 0xCB, 0x09, 0xCD, 0x03, 0xCB, 0x09, 0x9F,
+    0x0A, 0xA2, 0x37, 0x9F, 0x0A, 0xFA, 0x02, 0x9F, 0x0A, 0xFA, 0x02, 0xCE, 0x03, 0xCB, 0x09, 0x9F,
+    0x0A, 0xFB, 0x02, 0x9E, 0x0A, 0xFB, 0x02, 0xCD, 0x03, 0xCC, 0x09, 0xCD, 0x03, 0xCC, 0x09, 0xCC,
+    0x03, 0xCC, 0x09, 0xCC, 0x03, 0xCC, 0x09, 0xCC, 0x03, 0xCD, 0x09, 0xCB, 0x03, 0xCC, 0x09, 0x9E,
+    0x0A, 0xA4, 0x37, 0x9D, 0x0A, 0xFD, 0x02, 0x9D, 0x0A, 0xFC, 0x02, 0xCC, 0x03, 0xCD, 0x09, 0x9E,
+    0x0A, 0xFD, 0x02, 0x9D, 0x0A, 0xFD, 0x02, 0xCA, 0x03, 0xCE, 0x09, 0xCA, 0x03, 0xCE, 0x09, 0xCB,
+    0x03, 0xCE, 0x09, 0xCB, 0x03, 0xCE, 0x09, 0xCB, 0x03, 0xCE, 0x09, 0xCA, 0x03, 0xCE, 0x09, 0x9D,
+    0x0A, 0xA5, 0x37, 0x9D, 0x0A, 0xFC, 0x02, 0x9E, 0x0A, 0xFC, 0x02, 0xCC, 0x03, 0xCD, 0x09, 0x9E,
+    0x0A, 0xFC, 0x02, 0x9E, 0x0A, 0xFC, 0x02, 0xCB, 0x03, 0xCD, 0x09, 0xCC, 0x03, 0xCD, 0x09, 0xCB,
+    0x03, 0xCD, 0x09, 0xCC, 0x03, 0xCD, 0x09, 0xCB, 0x03, 0xCD, 0x09, 0xCB, 0x03, 0xCD, 0x09, 0x9E,
+    0x0A, 0xA3, 0x37, 0x9E, 0x0A, 0xFB, 0x02, 0x9E, 0x0A, 0xFC, 0x02, 0xCB, 0x03, 0xCD, 0x09, 0x9E,
+    0x0A, 0xFC, 0x02, 0x9E, 0x0A, 0xFB, 0x02, 0xCC, 0x03, 0xCD, 0x09, 0xCC, 0x03, 0xCD, 0x09, 0xCB,
+    0x03, 0xCD, 0x09, 0xCC, 0x03, 0xCC, 0x09, 0xCC, 0x03, 0xCD, 0x09, 0xCB, 0x03, 0xCD, 0x09, 0x9E,
+    0x0A, 0xA2, 0x37, 0x9E, 0x0A, 0xFC, 0x02, 0x9E, 0x0A, 0xFB, 0x02, 0xCC, 0x03, 0xCD, 0x09, 0x9E,
+    0x0A, 0xFB, 0x02, 0x9E, 0x0A, 0xFB, 0x02, 0xCC, 0x03, 0xCD, 0x09, 0xCB, 0x03, 0xCD, 0x09, 0xCB,
+    0x03, 0xCD, 0x09, 0xCC, 0x03, 0xCD, 0x09, 0xCC, 0x03, 0xCD, 0x09, 0xCC, 0x03, 0xCC, 0x09, 0x9F,
+    0x0A, 0x26, 0x00, 0x69, 0x97, 0x01, 0xA9, 0xB6, 0x03, 0xCD, 0x46, 0xD5, 0x22, 0xC9, 0x04, 0x8D,
+    0x04, 0xB4, 0x04, 0x87, 0x04, 0xE8, 0x04, 0xF2, 0x03, 0xD2, 0x04, 0x89, 0x0D, 0xCA, 0x04, 0xD3,
+    0x0C, 0xE5, 0x04, 0xCB, 0x03, 0x8C, 0x05, 0x8C, 0x04, 0xCB, 0x04, 0x91, 0x04, 0xCB, 0x04, 0xED,
+    0x0C, 0xCA, 0x04, 0x8D, 0x04, 0xCB, 0x04, 0x90, 0x04, 0xCB, 0x04, 0xEE, 0x0C, 0xCA, 0x04, 0x91,
+    0x04, 0xCB, 0x04, 0xF1, 0x0C, 0xCB, 0x04, 0xF2, 0x0C, 0xCA, 0x04, 0xED, 0x0C, 0xC9, 0x04, 0x8F,
+    0x04, 0xCA, 0x04, 0x91, 0x04, 0xCA, 0x04, 0xF2, 0x0C, 0xCA, 0x04, 0xED, 0x0C, 0xB3, 0x04, 0x86,
+    0x04, 0xD1, 0x04, 0x8D, 0x04, 0xCE, 0x04, 0x84, 0x0D, 0xB4, 0x04, 0xA9, 0x04, 0xB3, 0x04, 0x88,
+    0x0D, 0xB4, 0x04, 0x84, 0x0D, 0xB3, 0x04, 0xA5, 0x04, 0xB2, 0x04, 0x89, 0x04, 0xD3, 0x04, 0xEB,
+    0x0C, 0xD1, 0x04, 0x84, 0x0D, 0xB3, 0x04, 0xA8, 0x04, 0xB4, 0x04, 0x85, 0x0D, 0xB3, 0x04, 0xA4,
+    0x04, 0xB3, 0x04, 0x88, 0x04, 0xCF, 0x04, 0xA4, 0x04, 0xB3, 0x04, 0xA4, 0x04, 0xB3, 0x04, 0xA4,
+    0x04, 0xB3, 0x04, 0xA4, 0x04, 0xB9, 0x05, 0x9E, 0x03, 0xB9, 0x05, 0xA3, 0x03, 0xB7, 0x05, 0x85,
+    0x0C, 0xB3, 0x04, 0x89, 0x0D, 0xB3, 0x04, 0x89, 0x0D, 0xB3, 0x04, 0x89, 0x0D, 0xB3, 0x04, 0x89,
+    0x0D, 0xB3, 0x04, 0x89, 0x0D, 0xB3, 0x04, 0x89, 0x0D, 0xB3, 0x04, 0x92, 0x0D, 0xCB, 0x04, 0xC5,
+    0x70, 0xC6, 0x46, 0x86, 0x11, 0xCB, 0x04, 0x26, 0x00, 0x69, 0x88, 0x47, 0xD4, 0x22, 0xEC, 0x04,
+    0xF9, 0x03, 0x87, 0x05, 0xDE, 0x03, 0x88, 0x05, 0xF5, 0x03, 0xEF, 0x04, 0xBF, 0x0C, 0x87, 0x05,
+    0xD8, 0x0C, 0xEF, 0x04, 0xF6, 0x03, 0xEF, 0x04, 0xF7, 0x03, 0xED, 0x04, 0xF8, 0x03, 0xEB, 0x04,
+    0xDC, 0x0C, 0xEA, 0x04, 0xFB, 0x03, 0xE9, 0x04, 0xFB, 0x03, 0xE9, 0x04, 0xDE, 0x0C, 0xE9, 0x04,
+    0xFC, 0x03, 0xE8, 0x04, 0xDE, 0x0C, 0xE9, 0x04, 0xDE, 0x0C, 0xE9, 0x04, 0xDF, 0x0C, 0xE8, 0x04,
+    0xFC, 0x03, 0xE8, 0x04, 0xFC, 0x03, 0xE9, 0x04, 0xFC, 0x03, 0xE8, 0x04, 0xDF, 0x0C, 0xE8, 0x04,
+    0xFC, 0x03, 0xE9, 0x04, 0xFC, 0x03, 0xE9, 0x04, 0xFC, 0x03, 0xE8, 0x04, 0xFC, 0x03, 0xE8, 0x04,
+    0xDE, 0x0C, 0xE8, 0x04, 0xDE, 0x0C, 0xE8, 0x04, 0xDF, 0x0C, 0xE8, 0x04, 0xFC, 0x03, 0xE8, 0x04,
+    0xDE, 0x0C, 0xE9, 0x04, 0xDE, 0x0C, 0xE9, 0x04, 0xDE, 0x0C, 0xE9, 0x04, 0xDF, 0x0C, 0xE9, 0x04,
+    0xFD, 0x03, 0xE8, 0x04, 0xFC, 0x03, 0xE8, 0x04, 0xFD, 0x03, 0xE8, 0x04, 0xFD, 0x03, 0xE8, 0x04,
+    0xFD, 0x03, 0xE8, 0x04, 0xFD, 0x03, 0xE7, 0x04, 0xFD, 0x03, 0xE8, 0x04, 0xFC, 0x03, 0xE9, 0x04,
+    0xDF, 0x0C, 0xE8, 0x04, 0xDF, 0x0C, 0xE7, 0x04, 0xDF, 0x0C, 0xE8, 0x04, 0xDF, 0x0C, 0xE8, 0x04,
+    0xDF, 0x0C, 0xE8, 0x04, 0xDF, 0x0C, 0xE7, 0x04, 0xDF, 0x0C, 0xE8, 0x04, 0xE3, 0x70, 0x85, 0x47,
+    0x8A, 0x11, 0xE7, 0x04, 0xE7, 0xF0, 0x05, 0x87, 0x47, 0x88, 0x11, 0xE9, 0x04, 0x26, 0x00, 0x67,
+    0xF3, 0x46, 0xD3, 0x21, 0xA5, 0x05, 0xB1, 0x03, 0xA3, 0x05, 0xC8, 0x03, 0x8B, 0x05, 0xCD, 0x03,
+    0x8B, 0x05, 0xAB, 0x0C, 0x8A, 0x05, 0xA8, 0x0C, 0x89, 0x05, 0xCB, 0x03, 0x89, 0x05, 0xCC, 0x03,
+    0x88, 0x05, 0xD1, 0x03, 0x88, 0x05, 0xAA, 0x0C, 0x87, 0x05, 0xCD, 0x03, 0xEE, 0x04, 0xEB, 0x03,
+    0xEE, 0x04, 0xC4, 0x0C, 0x87, 0x05, 0xD1, 0x03, 0x87, 0x05, 0xAF, 0x0C, 0xEE, 0x04, 0xC8, 0x0C,
+    0x87, 0x05, 0xAB, 0x0C, 0x87, 0x05, 0xCD, 0x03, 0x87, 0x05, 0xD2, 0x03, 0xEE, 0x04, 0xC4, 0x0C,
+    0x87, 0x05, 0xD1, 0x03, 0x87, 0x05, 0xAB, 0x0C, 0x87, 0x05, 0xCD, 0x03, 0x85, 0x05, 0xCF, 0x03,
+    0x88, 0x05, 0xD1, 0x03, 0x88, 0x05, 0xAF, 0x0C, 0x86, 0x05, 0xAC, 0x0C, 0x86, 0x05, 0xD2, 0x03,
+    0x87, 0x05, 0xAB, 0x0C, 0xEE, 0x04, 0xEB, 0x03, 0x87, 0x05, 0xAF, 0x0C, 0xEE, 0x04, 0xC8, 0x0C,
+    0x87, 0x05, 0xAB, 0x0C, 0x87, 0x05, 0xCD, 0x03, 0x87, 0x05, 0xCD, 0x03, 0xEE, 0x04, 0xE6, 0x03,
+    0xEE, 0x04, 0xE6, 0x03, 0x87, 0x05, 0xCD, 0x03, 0x87, 0x05, 0xCE, 0x03, 0x86, 0x05, 0xCE, 0x03,
+    0xEE, 0x04, 0xEB, 0x03, 0x86, 0x05, 0xB0, 0x0C, 0xEE, 0x04, 0xC8, 0x0C, 0x87, 0x05, 0xB0, 0x0C,
+    0xED, 0x04, 0xC8, 0x0C, 0x87, 0x05, 0xAF, 0x0C, 0x86, 0x05, 0xB0, 0x0C, 0x87, 0x05, 0xB0, 0x0C,
+    0x86, 0x05, 0xB8, 0x0C, 0xEE, 0x04, 0xFA, 0x6F, 0xD7, 0x46, 0xD9, 0x10, 0xED, 0x04, 0x26, 0x00,
+    0x73, 0xCC, 0x46, 0xFD, 0x22, 0xD6, 0x04, 0xAD, 0x04, 0xB5, 0x04, 0xB5, 0x04, 0xB7, 0x04, 0xB2,
+    0x04, 0xBA, 0x04, 0x9A, 0x0D, 0xB4, 0x04, 0x84, 0x0D, 0xD5, 0x04, 0xAF, 0x04, 0xB3, 0x04, 0xB7,
+    0x04, 0xB5, 0x04, 0xB4, 0x04, 0xB8, 0x04, 0x9C, 0x0D, 0xB2, 0x04, 0x9D, 0x04, 0xCF, 0x04, 0xB5,
+    0x04, 0xB7, 0x04, 0x82, 0x0D, 0xCC, 0x04, 0x9D, 0x04, 0xCF, 0x04, 0x9F, 0x0D, 0xBA, 0x04, 0xFF,
+    0x0C, 0xCF, 0x04, 0x9E, 0x0D, 0xBB, 0x04, 0xAF, 0x04, 0xB3, 0x04, 0x87, 0x0D, 0xD2, 0x04, 0x9B,
+    0x0D, 0xB3, 0x04, 0x9C, 0x04, 0xD0, 0x04, 0xB4, 0x04, 0xB8, 0x04, 0x97, 0x04, 0xD5, 0x04, 0xFF,
+    0x0C, 0xCF, 0x04, 0xB4, 0x04, 0xB8, 0x04, 0x9B, 0x0D, 0xB3, 0x04, 0x9C, 0x04, 0xD0, 0x04, 0x99,
+    0x04, 0xD3, 0x04, 0x9B, 0x0D, 0xB3, 0x04, 0xA0, 0x0D, 0xB9, 0x04, 0x81, 0x0D, 0xCD, 0x04, 0xB6,
+    0x04, 0xB6, 0x04, 0x83, 0x0D, 0xD6, 0x04, 0xAE, 0x04, 0xB4, 0x04, 0xB6, 0x04, 0xB6, 0x04, 0xB3,
+    0x04, 0xB9, 0x04, 0x96, 0x04, 0xD6, 0x04, 0xAE, 0x04, 0xB4, 0x04, 0x9C, 0x04, 0xD0, 0x04, 0xB4,
+    0x04, 0xB8, 0x04, 0xB1, 0x04, 0xBB, 0x04, 0x99, 0x0D, 0xB5, 0x04, 0x9E, 0x0D, 0xBB, 0x04, 0xFE,
+    0x0C, 0xD0, 0x04, 0x83, 0x0D, 0xD5, 0x04, 0x98, 0x0D, 0xB6, 0x04, 0x83, 0x0D, 0xD5, 0x04, 0x97,
+    0x0D, 0xB7, 0x04, 0x9C, 0x0D, 0xB2, 0x04, 0xA6, 0x6D, 0xC6, 0x46, 0xAD, 0x11, 0xCD, 0x04, 0xE8,
+    0xEF, 0x05, 0xC7, 0x46, 0xAB, 0x11, 0xCF, 0x04, 0xE3, 0xEF, 0x05, 0xC2, 0x46, 0xAF, 0x11, 0xD5,
+    0x04, 0xDF, 0xEF, 0x05, 0xC6, 0x46, 0xAC, 0x11, 0xCE, 0x04, 0x26, 0x00, 0x88, 0x01, 0xB5, 0x45,
+    0xE7, 0x22, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xE9, 0x0C, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04,
+    0xE9, 0x0C, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xE9, 0x0C, 0xBD, 0x04, 0xE9, 0x0C, 0xBD, 0x04,
+    0xE9, 0x0C, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xE9, 0x0C, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04,
+    0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xE9, 0x0C, 0xBD, 0x04,
+    0xE9, 0x0C, 0xBD, 0x04, 0xE9, 0x0C, 0xBD, 0x04, 0xE9, 0x0C, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04,
+    0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04,
+    0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xE9, 0x0C, 0xBD, 0x04,
+    0xE9, 0x0C, 0xBD, 0x04, 0xE9, 0x0C, 0xBD, 0x04, 0xE9, 0x0C, 0xBD, 0x04, 0xE9, 0x0C, 0xBD, 0x04,
+    0xE9, 0x0C, 0xBD, 0x04, 0xB4, 0xAA, 0x02, 0xB5, 0x45, 0x9B, 0x23, 0xBD, 0x04, 0xBD, 0x04, 0xBD,
+    0x04, 0xE9, 0x0C, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xE9, 0x0C, 0xBD, 0x04, 0xBD, 0x04, 0xBD,
+    0x04, 0xE9, 0x0C, 0xBD, 0x04, 0xE9, 0x0C, 0xBD, 0x04, 0xE9, 0x0C, 0xBD, 0x04, 0xBD, 0x04, 0xBD,
+    0x04, 0xE9, 0x0C, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD,
+    0x04, 0xBD, 0x04, 0xBD, 0x04, 0xE9, 0x0C, 0xBD, 0x04, 0xE9, 0x0C, 0xBD, 0x04, 0xE9, 0x0C, 0xBD,
+    0x04, 0xE9, 0x0C, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD,
+    0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xE9, 0x0C, 0xBD, 0x04, 0xBD, 0x04, 0xBD,
+    0x04, 0xBD, 0x04, 0xBD, 0x04, 0xE9, 0x0C, 0xBD, 0x04, 0xE9, 0x0C, 0xBD, 0x04, 0xE9, 0x0C, 0xBD,
+    0x04, 0xE9, 0x0C, 0xBD, 0x04, 0xE9, 0x0C, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xB4, 0xAA, 0x02,
+    0x26, 0x00, 0xAF, 0x03, 0xD9, 0x07, 0xDD, 0x04, 0xCB, 0x04, 0xCD, 0x04, 0xCB, 0x04, 0xBE, 0x0B,
+    0xCB, 0x04, 0xC0, 0x0B, 0xCA, 0x04, 0xCD, 0x04, 0xCB, 0x04, 0xBF, 0x0B, 0xCA, 0x04, 0xCD, 0x04,
+    0xCA, 0x04, 0xBE, 0x0B, 0xCB, 0x04, 0xCD, 0x04, 0xCA, 0x04, 0xC0, 0x0B, 0xCA, 0x04, 0xC0, 0x0B,
+    0xC9, 0x04, 0x8D, 0x54, 0xDB, 0x07, 0xE2, 0x04, 0xC9, 0x04, 0xCD, 0x04, 0xCB, 0x04, 0xC0, 0x0B,
+    0xC9, 0x04, 0xBF, 0x0B, 0xCB, 0x04, 0xCD, 0x04, 0xCB, 0x04, 0xBE, 0x0B, 0xCC, 0x04, 0xCC, 0x04,
+    0xCB, 0x04, 0xBF, 0x0B, 0xCA, 0x04, 0xCD, 0x04, 0xCA, 0x04, 0xBF, 0x0B, 0xCB, 0x04, 0xC0, 0x0B,
+    0xC9, 0x04, 0x8D, 0x54, 0xDB, 0x07, 0xE1, 0x04, 0xCA, 0x04, 0xCE, 0x04, 0xC9, 0x04, 0xBF, 0x0B,
+    0xCA, 0x04, 0xC1, 0x0B, 0xC9, 0x04, 0xCD, 0x04, 0xCB, 0x04, 0xBF, 0x0B, 0xCB, 0x04, 0xCD, 0x04,
+    0xCB, 0x04, 0xBF, 0x0B, 0xCA, 0x04, 0xCD, 0x04, 0xCB, 0x04, 0xC0, 0x0B, 0xCA, 0x04, 0xBF, 0x0B,
+    0xCA, 0x04, 0x8D, 0x54, 0xDB, 0x07, 0xE1, 0x04, 0xCB, 0x04, 0xCD, 0x04, 0xCA, 0x04, 0xBF, 0x0B,
+    0xCA, 0x04, 0xC0, 0x0B, 0xCA, 0x04, 0xCD, 0x04, 0xCB, 0x04, 0xBF, 0x0B, 0xCA, 0x04, 0xCD, 0x04,
+    0xCB, 0x04, 0xC0, 0x0B, 0xC9, 0x04, 0xCD, 0x04, 0xCA, 0x04, 0xC0, 0x0B, 0xCA, 0x04, 0xBF, 0x0B,
+    0xCB, 0x04, 0x8C, 0x54, 0xDC, 0x07, 0xE1, 0x04, 0xCA, 0x04, 0xCD, 0x04, 0xCB, 0x04, 0xBF, 0x0B,
+    0xCA, 0x04, 0xBF, 0x0B, 0xCB, 0x04, 0xCC, 0x04, 0xCC, 0x04, 0xBF, 0x0B, 0xCA, 0x04, 0xCC, 0x04,
+    0xCB, 0x04, 0xBE, 0x0B, 0xCB, 0x04, 0xCC, 0x04, 0xCB, 0x04, 0xBF, 0x0B, 0xCB, 0x04, 0xBF, 0x0B,
+    0xCA, 0x04, 0x8D, 0x54, 0xDB, 0x07, 0xE1, 0x04, 0xCA, 0x04, 0xCD, 0x04, 0xCB, 0x04, 0xBE, 0x0B,
+    0xCB, 0x04, 0xBF, 0x0B, 0xCB, 0x04, 0xCD, 0x04, 0xCB, 0x04, 0xBE, 0x0B, 0xCB, 0x04, 0xCE, 0x04,
+    0xCA, 0x04, 0xBF, 0x0B, 0xCA, 0x04, 0xCD, 0x04, 0xCB, 0x04, 0xBE, 0x0B, 0xCC, 0x04, 0xC0, 0x0B,
+    0xC9, 0x04, 0x8C, 0x54, 0xDC, 0x07, 0xE0, 0x04, 0xCB, 0x04, 0xCC, 0x04, 0xCB, 0x04, 0xBF, 0x0B,
+    0xCB, 0x04, 0xC0, 0x0B, 0xCA, 0x04, 0xCE, 0x04, 0xC9, 0x04, 0xBE, 0x0B, 0xCB, 0x04, 0xCD, 0x04,
+    0xCB, 0x04, 0xBF, 0x0B, 0xCA, 0x04, 0xCD, 0x04, 0xCB, 0x04, 0xC0, 0x0B, 0xCA, 0x04, 0xBF, 0x0B,
+    0xCA, 0x04, 0x8D, 0x54, 0xDB, 0x07, 0xE1, 0x04, 0xCA, 0x04, 0xCD, 0x04, 0xCB, 0x04, 0xBE, 0x0B,
+    0xCB, 0x04, 0xC0, 0x0B, 0xCA, 0x04, 0xCD, 0x04, 0xCA, 0x04, 0xBF, 0x0B, 0xCA, 0x04, 0xCD, 0x04,
+    0xCB, 0x04, 0xC0, 0x0B, 0xC9, 0x04, 0xCE, 0x04, 0xC9, 0x04, 0xC0, 0x0B, 0xCA, 0x04, 0xBE, 0x0B,
+    0xCB, 0x04, 0x8D, 0x54, 0xDB, 0x07, 0xE1, 0x04, 0xCA, 0x04, 0xCD, 0x04, 0xCA, 0x04, 0xBF, 0x0B,
+    0xCA, 0x04, 0xBF, 0x0B, 0xCB, 0x04, 0xCD, 0x04, 0xCB, 0x04, 0xBF, 0x0B, 0xCA, 0x04, 0xCD, 0x04,
+    0xCA, 0x04, 0xBF, 0x0B, 0xCB, 0x04, 0xCC, 0x04, 0xCB, 0x04, 0xBE, 0x0B, 0xCC, 0x04, 0xC0, 0x0B,
+    0xCA, 0x04, 0x8D, 0x54, 0xDB, 0x07, 0xE1, 0x04, 0xCA, 0x04, 0xCD, 0x04, 0xCB, 0x04, 0xBE, 0x0B,
+    0xCB, 0x04, 0xBF, 0x0B, 0xCB, 0x04, 0xCD, 0x04, 0xCA, 0x04, 0xBF, 0x0B, 0xCA, 0x04, 0xCD, 0x04,
+    0xCA, 0x04, 0xBF, 0x0B, 0xCA, 0x04, 0xCD, 0x04, 0xCA, 0x04, 0xBF, 0x0B, 0xCB, 0x04, 0xBF, 0x0B,
+    0xCA, 0x04, 0x8C, 0x54, 0xDB, 0x07, 0xE1, 0x04, 0xCB, 0x04, 0xCE, 0x04, 0xC9, 0x04, 0xBE, 0x0B,
+    0xCB, 0x04, 0xC0, 0x0B, 0xCA, 0x04, 0xCD, 0x04, 0xCB, 0x04, 0xBE, 0x0B, 0xCB, 0x04, 0xCE, 0x04,
+    0xCA, 0x04, 0xBF, 0x0B, 0xCA, 0x04, 0xCD, 0x04, 0xCA, 0x04, 0xC0, 0x0B, 0xCA, 0x04, 0xBF, 0x0B,
+    0xCA, 0x04, 0x8C, 0x54, 0xDC, 0x07, 0xE1, 0x04, 0xCA, 0x04, 0xCC, 0x04, 0xCC, 0x04, 0xBF, 0x0B,
+    0xCA, 0x04, 0xBF, 0x0B, 0xCB, 0x04, 0xCD, 0x04, 0xCA, 0x04, 0xBF, 0x0B, 0xCA, 0x04, 0xCD, 0x04,
+    0xCB, 0x04, 0xBF, 0x0B, 0xCA, 0x04, 0xCD, 0x04, 0xCB, 0x04, 0xBF, 0x0B, 0xCB, 0x04, 0xBF, 0x0B,
+    0xCA, 0x04, 0x8C, 0x54, 0xDC, 0x07, 0xE1, 0x04, 0xCA, 0x04, 0xCD, 0x04, 0xCB, 0x04, 0xBE, 0x0B,
+    0xCB, 0x04, 0xBF, 0x0B, 0xCB, 0x04, 0xCD, 0x04, 0xCB, 0x04, 0xBF, 0x0B, 0xCB, 0x04, 0xCD, 0x04,
+    0xCA, 0x04, 0xBE, 0x0B, 0xCB, 0x04, 0xCD, 0x04, 0xCB, 0x04, 0xC0, 0x0B, 0xCA, 0x04, 0xBF, 0x0B,
+    0xCA, 0x04, 0x8C, 0x54, 0xDC, 0x07, 0xE1, 0x04, 0xCA, 0x04, 0xCD, 0x04, 0xCA, 0x04, 0xBF, 0x0B,
+    0xCA, 0x04, 0xBF, 0x0B, 0xCB, 0x04, 0xCD, 0x04, 0xCB, 0x04, 0xC0, 0x0B, 0xC9, 0x04, 0xCD, 0x04,
+    0xCB, 0x04, 0xC0, 0x0B, 0xC9, 0x04, 0xCC, 0x04, 0xCB, 0x04, 0xC0, 0x0B, 0xCA, 0x04, 0xBE, 0x0B,
+    0xCB, 0x04, 0x8C, 0x54, 0xDC, 0x07, 0xE1, 0x04, 0xCA, 0x04, 0xCC, 0x04, 0xCC, 0x04, 0xBF, 0x0B,
+    0xCA, 0x04, 0xBF, 0x0B, 0xCB, 0x04, 0xCD, 0x04, 0xCA, 0x04, 0xBE, 0x0B, 0xCB, 0x04, 0xCD, 0x04,
+    0xCB, 0x04, 0xBD, 0x0B, 0xCC, 0x04, 0xCC, 0x04, 0xCB, 0x04, 0xBF, 0x0B, 0xCB, 0x04, 0xBF, 0x0B,
+    0xCA, 0x04, 0x8C, 0x54, 0xDC, 0x07, 0xE0, 0x04, 0xCB, 0x04, 0xCD, 0x04, 0xCB, 0x04, 0xBE, 0x0B,
+    0xCB, 0x04, 0xBF, 0x0B, 0xCB, 0x04, 0xCC, 0x04, 0xCB, 0x04, 0xBF, 0x0B, 0xCA, 0x04, 0xCC, 0x04,
+    0xCB, 0x04, 0xBF, 0x0B, 0xCB, 0x04, 0xCD, 0x04, 0xCA, 0x04, 0xBF, 0x0B, 0xCB, 0x04, 0xBF, 0x0B,
+    0xCA, 0x04, 0x8D, 0x54, 0xDB, 0x07, 0xE0, 0x04, 0xCB, 0x04, 0xCC, 0x04, 0xCC, 0x04, 0xBE, 0x0B,
+    0xCB, 0x04, 0xC2, 0x0B, 0xC8, 0x04, 0xCE, 0x04, 0xC9, 0x04, 0xBF, 0x0B, 0xCA, 0x04, 0xCC, 0x04,
+    0xCC, 0x04, 0xBF, 0x0B, 0xCA, 0x04, 0xCB, 0x04, 0xCD, 0x04, 0xBE, 0x0B, 0xCC, 0x04, 0xBF, 0x0B,
+    0xCA, 0x04, 0x8C, 0x54, 0xDC, 0x07, 0xE1, 0x04, 0xCA, 0x04, 0xCC, 0x04, 0xCC, 0x04, 0xBF, 0x0B,
+    0xCB, 0x04, 0xBE, 0x0B, 0xCC, 0x04, 0xCC, 0x04, 0xCC, 0x04, 0xBE, 0x0B, 0xCB, 0x04, 0xCC, 0x04,
+    0xCB, 0x04, 0xBF, 0x0B, 0xCA, 0x04, 0xCB, 0x04, 0xCC, 0x04, 0xBF, 0x0B, 0xCB, 0x04, 0xBF, 0x0B,
+    0xCA, 0x04, 0x26, 0x00, 0xDB, 0x02, 0xC3, 0x1B, 0xA5, 0x0D, 0xD8, 0x03, 0xAA, 0x03, 0xBC, 0x03,
+    0xF5, 0x09, 0xD8, 0x03, 0xAA, 0x03, 0xBC, 0x03, 0xAA, 0x03, 0xBA, 0x03, 0xAD, 0x03, 0xBB, 0x03,
+    0xAB, 0x03, 0xBB, 0x03, 0xAA, 0x03, 0xBC, 0x03, 0xAA, 0x03, 0xBC, 0x03, 0xAA, 0x03, 0xBB, 0x03,
+    0xAB, 0x03, 0xBA, 0x03, 0xAD, 0x03, 0xB8, 0x03, 0xAE, 0x03, 0xB7, 0x03, 0xB0, 0x03, 0xB6, 0x03,
+    0x98, 0x0A, 0xB5, 0x03, 0xB1, 0x03, 0xB5, 0x03, 0xB0, 0x03, 0xB6, 0x03, 0xB0, 0x03, 0xB6, 0x03,
+    0xB1, 0x03, 0xB5, 0x03, 0xB1, 0x03, 0xB5, 0x03, 0xB1, 0x03, 0xB5, 0x03, 0xB1, 0x03, 0xB5, 0x03,
+    0xB1, 0x03, 0xB5, 0x03, 0xB1, 0x03, 0xB5, 0x03, 0x98, 0x0A, 0xB5, 0x03, 0xB1, 0x03, 0xB5, 0x03,
+    0xB1, 0x03, 0xB5, 0x03, 0xB1, 0x03, 0xB5, 0x03, 0x98, 0x0A, 0xB5, 0x03, 0xB1, 0x03, 0xB5, 0x03,
+    0xB1, 0x03, 0xB5, 0x03, 0x98, 0x0A, 0xB5, 0x03, 0xB1, 0x03, 0xB5, 0x03, 0xB2, 0x03, 0xB4, 0x03,
+    0xB1, 0x03, 0xB5, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB2, 0x03, 0xB4, 0x03,
+    0xB1, 0x03, 0xB5, 0x03, 0xB1, 0x03, 0xB5, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0x98, 0x0A, 0xB5, 0x03,
+    0x99, 0x0A, 0xB4, 0x03, 0x99, 0x0A, 0xB4, 0x03, 0x99, 0x0A, 0xB4, 0x03, 0x99, 0x0A, 0xB4, 0x03,
+    0x99, 0x0A, 0xB4, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0x99, 0x0A, 0xB4, 0x03,
+    0x99, 0x0A, 0xB4, 0x03, 0x99, 0x0A, 0xB4, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0x99, 0x0A, 0xB4, 0x03,
+    0x99, 0x0A, 0xB4, 0x03, 0x9A, 0x0A, 0xB3, 0x03, 0x9A, 0x0A, 0xB3, 0x03, 0x99, 0xC5, 0x04, 0xBB,
+    0x1B, 0xC8, 0x0D, 0xB5, 0x03, 0xB1, 0x03, 0xB5, 0x03, 0x98, 0x0A, 0xB5, 0x03, 0xB1, 0x03, 0xB5,
+    0x03, 0xB1, 0x03, 0xB5, 0x03, 0xB1, 0x03, 0xB5, 0x03, 0xB1, 0x03, 0xB5, 0x03, 0xB1, 0x03, 0xB5,
+    0x03, 0xB1, 0x03, 0xB5, 0x03, 0xB1, 0x03, 0xB5, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB1, 0x03, 0xB5,
+    0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0x98, 0x0A, 0xB5, 0x03, 0xB2, 0x03, 0xB4,
+    0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB2, 0x03, 0xB4,
+    0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB2, 0x03, 0xB4,
+    0x03, 0x99, 0x0A, 0xB4, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB2, 0x03, 0xB4,
+    0x03, 0x99, 0x0A, 0xB4, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0x9A, 0x0A, 0xB3,
+    0x03, 0xB3, 0x03, 0xB3, 0x03, 0xB3, 0x03, 0xB3, 0x03, 0xB3, 0x03, 0xB3, 0x03, 0xB3, 0x03, 0xB3,
+    0x03, 0xB3, 0x03, 0xB3, 0x03, 0xB3, 0x03, 0xB3, 0x03, 0xB3, 0x03, 0xB3, 0x03, 0xB4, 0x03, 0xB2,
+    0x03, 0xB3, 0x03, 0xB3, 0x03, 0x9B, 0x0A, 0xB2, 0x03, 0xB3, 0x0A, 0x9A, 0x03, 0x9B, 0x0A, 0xB2,
+    0x03, 0x9B, 0x0A, 0xB2, 0x03, 0xB2, 0x0A, 0x9B, 0x03, 0x9B, 0x0A, 0xB2, 0x03, 0xCC, 0x03, 0x9A,
+    0x03, 0xCC, 0x03, 0x9A, 0x03, 0xB3, 0x0A, 0x9A, 0x03, 0xB3, 0x0A, 0x9A, 0x03, 0xB3, 0x0A, 0x9A,
+    0x03, 0xCC, 0x03, 0x9A, 0x03, 0xB3, 0x0A, 0x9A, 0x03, 0xB3, 0x0A, 0x9A, 0x03, 0xB3, 0x0A, 0x9A,
+    0x03, 0xB3, 0x0A, 0x9A, 0x03, 0x99, 0xC5, 0x04, 0xBB, 0x1B, 0xC8, 0x0D, 0xB5, 0x03, 0xB1, 0x03,
+    0xB5, 0x03, 0x98, 0x0A, 0xB5, 0x03, 0xB1, 0x03, 0xB5, 0x03, 0xB1, 0x03, 0xB5, 0x03, 0xB1, 0x03,
+    0xB5, 0x03, 0xB1, 0x03, 0xB5, 0x03, 0xB1, 0x03, 0xB5, 0x03, 0xB1, 0x03, 0xB5, 0x03, 0xB1, 0x03,
+    0xB5, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB1, 0x03, 0xB5, 0x03, 0xB1, 0x03,
+    0xB5, 0x03, 0x98, 0x0A, 0xB5, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB2, 0x03,
+    0xB5, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB2, 0x03,
+    0xB4, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0x99, 0x0A, 0xB4, 0x03, 0xB2, 0x03,
+    0xB4, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0x99, 0x0A, 0xB4, 0x03, 0xB3, 0x03,
+    0xB3, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0x99, 0x0A, 0xB4, 0x03, 0xB2, 0x03, 0xB4, 0x03, 0xB3, 0x03,
+    0xB3, 0x03, 0xB3, 0x03, 0xB3, 0x03, 0xB3, 0x03, 0xB3, 0x03, 0xB3, 0x03, 0xB3, 0x03, 0xB3, 0x03,
+    0xB3, 0x03, 0xB3, 0x03, 0xB3, 0x03, 0xB3, 0x03, 0xB3, 0x03, 0xB3, 0x03, 0xB3, 0x03, 0x9B, 0x0A,
+    0xB2, 0x03, 0x9A, 0x0A, 0xB3, 0x03, 0x9B, 0x0A, 0xB2, 0x03, 0x9B, 0x0A, 0xB2, 0x03, 0x9B, 0x0A,
+    0xB2, 0x03, 0xB3, 0x0A, 0x9A, 0x03, 0xCC, 0x03, 0x9A, 0x03, 0xCC, 0x03, 0x9A, 0x03, 0xB3, 0x0A,
+    0x9A, 0x03, 0xB3, 0x0A, 0x9A, 0x03, 0xB3, 0x0A, 0x9A, 0x03, 0xCC, 0x03, 0x9A, 0x03, 0xB3, 0x0A,
+    0x9A, 0x03, 0xB3, 0x0A, 0x9A, 0x03, 0xB3, 0x0A, 0x9A, 0x03, 0xB3, 0x0A, 0x9A, 0x03, 0x26, 0x00,
+    0x4D, 0xC5, 0x09, 0x93, 0x09, 0xB1, 0x03, 0xB6, 0x04, 0xB1, 0x03, 0xF1, 0x06, 0xB1, 0x03, 0xCD,
+    0x12, 0xB1, 0x03, 0xCE, 0x0B, 0xB2, 0x03, 0xB5, 0x04, 0xB2, 0x03, 0xCE, 0x0B, 0xB1, 0x03, 0xF0,
+    0x0D, 0xB1, 0x03, 0xCC, 0x12, 0xB1, 0x03, 0xB5, 0x04, 0xB2, 0x03, 0xCD, 0x12, 0xB1, 0x03, 0x92,
+    0x09, 0xB2, 0x03, 0xBE, 0xAA, 0x05, 0xC4, 0x09, 0x93, 0x09, 0xB1, 0x03, 0xB6, 0x04, 0xB1, 0x03,
+    0xF3, 0x06, 0xAF, 0x03, 0xCD, 0x12, 0xB1, 0x03, 0xCE, 0x0B, 0xB1, 0x03, 0xB7, 0x04, 0xB0, 0x03,
+    0xCF, 0x0B, 0xB0, 0x03, 0xEF, 0x0D, 0xB2, 0x03, 0xCD, 0x12, 0xB0, 0x03, 0xB6, 0x04, 0xB1, 0x03,
+    0xCC, 0x12, 0xB2, 0x03, 0x93, 0x09, 0xB1, 0x03, 0xEC, 0xA1, 0x05, 0xC5, 0x09, 0x94, 0x09, 0xB0,
+    0x03, 0xB5, 0x04, 0xB2, 0x03, 0xF0, 0x06, 0xB3, 0x03, 0xCD, 0x12, 0xB1, 0x03, 0xCE, 0x0B, 0xB1,
+    0x03, 0xB5, 0x04, 0xB2, 0x03, 0xCF, 0x0B, 0xB0, 0x03, 0xF0, 0x0D, 0xB1, 0x03, 0xCC, 0x12, 0xB2,
+    0x03, 0xB6, 0x04, 0xB1, 0x03, 0xCB, 0x12, 0xB2, 0x03, 0x92, 0x09, 0xB2, 0x03,
+};
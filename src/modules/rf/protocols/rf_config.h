@@ -12,6 +12,13 @@
 #define RF_SUB_LEGACY_MIGRATION 1
 #endif
 
+// RF_SUB_TX_CACHE: when enabled, transmitting a `.sub` compiles its codes once
+// into a packed RMT-symbol blob (`<file>.subc`, see rf_subc.{h,cpp}) that later
+// transmissions stream back-to-back instead of re-parsing every code.
+#ifndef RF_SUB_TX_CACHE
+#define RF_SUB_TX_CACHE 1
+#endif
+
 // RF_DEBUG: when set to 1, the RF decode/capture path prints diagnostic
 // traces to Serial (capture sizes, separation gaps, decode matches, RAW
 // classification). Intended for bring-up / hardware validation only — leave
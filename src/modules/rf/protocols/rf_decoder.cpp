@@ -10,15 +10,8 @@
 #include "rf_decoder.h"
 #include "../rf_utils.h" // setup_rf_rx, find_pulse_index, crc64_ecma, RMT defines
 #include "rf_config.h"   // RF_DBG
-#include "rf_registry.h"
 #include <globals.h>
 
-// --- Decode tuning (mirrors the classic OOK receiver) ----------------------
-#define RF_SEPARATION_LIMIT 4300 // µs: a longer low is treated as an inter-frame gap
-#define RF_RECEIVE_TOLERANCE 60  // % tolerance on pulse-length matching
-#define RF_NOMINAL_TE_TOLERANCE 20
-#define RF_MAX_CHANGES 131       // max transitions kept per frame
-
 // --- RX noise rejection ----------------------------------------------------
 // In RX the CC1101 OOK slicer outputs random hash when there is no real signal.
 // Without these filters every noise burst becomes a "phantom" capture, flooding
@@ -30,11 +23,6 @@
 // NOTE: signal_range_min_ns is kept at the framework-proven 3µs; larger values
 // (e.g. 100µs) were observed to stop the RMT receive from completing at all.
 
-static inline unsigned int rf_udiff(int a, int b) { return (unsigned int)abs(a - b); }
-static inline unsigned int rf_udiff_u(unsigned int a, unsigned int b) {
-    return (a > b) ? (a - b) : (b - a);
-}
-
 static int rf_push_duration_merge(std::vector<int> &out, int d) {
     if (!out.empty() && ((out.back() > 0) == (d > 0))) {
         out.back() += d;
@@ -275,52 +263,6 @@ void rf_symbols_to_durations(const rmt_symbol_word_t *symbols, size_t count, std
 // ---------------------------------------------------------------------------
 // OOK decode (faithful port of the classic receiveProtocol state machine)
 // ---------------------------------------------------------------------------
-static bool rf_match_protocol(
-    const RfProtocolDef *pro, unsigned int changeCount, const unsigned int *timings, RfCodes &out
-) {
-    if (pro == nullptr) return false;
-    uint64_t code = 0;
-    // The longer sync factor maps to the captured inter-frame gap in timings[0].
-    unsigned int syncLen = (pro->sync.low > pro->sync.high) ? pro->sync.low : pro->sync.high;
-    if (syncLen == 0) return false;
-    unsigned int delay = timings[0] / syncLen;
-    if (delay == 0) return false;
-    unsigned int teTol = pro->te * RF_NOMINAL_TE_TOLERANCE / 100;
-    if (teTol < 80) teTol = 80;
-    if (rf_udiff_u(delay, pro->te) > teTol) return false;
-
-    unsigned int tol = delay * RF_RECEIVE_TOLERANCE / 100;
-    // Protocols that start high have their first data timing filtered out.
-    unsigned int first = pro->inverted ? 2 : 1;
-
-    for (unsigned int i = first; i + 1 < changeCount; i += 2) {
-        code <<= 1;
-        if (rf_udiff(timings[i], delay * pro->zero.high) < tol &&
-            rf_udiff(timings[i + 1], delay * pro->zero.low) < tol) {
-            // zero bit
-        } else if (rf_udiff(timings[i], delay * pro->one.high) < tol &&
-                   rf_udiff(timings[i + 1], delay * pro->one.low) < tol) {
-            code |= 1; // one bit
-        } else {
-            return false;
-        }
-    }
-
-    if (changeCount > 7) { // ignore very short bursts: that would be noise
-        int nbits = (changeCount - 1) / 2;
-        // Fixed-length protocols only match a frame of exactly their length. This
-        // keeps a 12-bit CAME frame from being claimed by a longer/shorter code
-        // with otherwise-compatible timings (the M3 cross-match ambiguity).
-        if ((pro->flags & RF_PF_FIXED_LEN) && nbits != pro->bits) return false;
-        out.key = code;
-        out.Bit = nbits;
-        out.te = delay;
-        out.protocol = pro->name;
-        return true;
-    }
-    return false;
-}
-
 static bool rf_decode_chamberlain_9bit(const std::vector<int> &durations, RfCodes &out) {
     const unsigned int te = 430;
     const unsigned int dataTol = 260;
@@ -361,78 +303,45 @@ static bool rf_decode_chamberlain_9bit(const std::vector<int> &durations, RfCode
     return false;
 }
 
+static bool rf_ook_codes(const RfOokFrame &f, RfCodes &out) {
+    out.key = f.key;
+    out.Bit = f.bits;
+    out.te = f.te;
+    out.protocol = f.pro->name;
+    out.preset = "Ook270Async";
+    return true;
+}
+
 bool rf_decode_ook(const std::vector<int> &durations, RfCodes &out) {
     if (rf_decode_chamberlain_9bit(durations, out)) return true;
 
-    unsigned int timings[RF_MAX_CHANGES];
-    unsigned int changeCount = 0;
-    unsigned int repeatCount = 0;
-    const int protoCount = rf_protocol_count();
-
-    for (int d : durations) {
-        unsigned int dur = (d < 0) ? (unsigned int)(-d) : (unsigned int)d;
-
-        if (dur > RF_SEPARATION_LIMIT) {
-            // A long stretch without a level change: likely the gap between two
-            // repeated transmissions. Two similar gaps bracket a full frame.
-            if (repeatCount == 0 || rf_udiff(dur, timings[0]) < 200) {
-                repeatCount++;
-                if (repeatCount == 2) {
-                    RF_DBG("decode attempt: changeCount=%u gap=%u", changeCount, dur);
-                    for (int p = 0; p < protoCount; p++) {
-                        if (rf_match_protocol(rf_protocol_at(p), changeCount, timings, out)) {
-                            out.preset = "Ook270Async";
-                            RF_DBG(
-                                "decode MATCH proto=%s key=%llX bits=%d te=%d",
-                                out.protocol.c_str(),
-                                (unsigned long long)out.key,
-                                out.Bit,
-                                out.te
-                            );
-                            return true;
-                        }
-                    }
-                    RF_DBG("decode: no protocol matched (changeCount=%u)", changeCount);
-                    repeatCount = 0;
-                }
-            }
-            changeCount = 0;
-        }
-
-        if (changeCount >= RF_MAX_CHANGES) {
-            changeCount = 0;
-            repeatCount = 0;
-        }
-        timings[changeCount++] = dur;
-    }
-
-    return false;
+    RfOokFrame f;
+    return rf_ook_decode(durations, f) && rf_ook_codes(f, out);
 }
 
 // ---------------------------------------------------------------------------
 // RAW builder (port of RFScan::read_raw inner loop)
 // ---------------------------------------------------------------------------
-int rf_build_raw(
-    const std::vector<int> &durations, String &dataOut, bool &hasCrc, uint64_t &crcOut,
-    std::vector<int> &indexedOut, int &bitsOut, int &teOut
+int rf_raw_stats(
+    const std::vector<int> &durations, bool &hasCrc, uint64_t &crcOut, std::vector<int> &indexedOut,
+    int &bitsOut, int &teOut
 ) {
-    dataOut = "";
     hasCrc = false;
     crcOut = 0;
     indexedOut.clear();
     bitsOut = 0;
     teOut = 0;
 
-    std::vector<int> pulseIndexes; // sequence of distinct-pulse indexes, for CRC
+    // CRC of the distinct-pulse index sequence, folded in as it is walked.
+    uint64_t crc = CRC64_ECMA_INIT;
+    int indexes = 0;
     uint8_t repetition = 0;
     int transitions = 0;
 
     for (int duration : durations) {
         if (duration == 0) break;
-        if (transitions > 0) dataOut += " ";
 
         if (duration < -5000 && repetition < 2) repetition += 1;
-        dataOut += String(duration);
         if (teOut == 0 && duration > 0) teOut = duration;
 
         if (repetition == 1 && duration >= -5000) {
@@ -441,14 +350,15 @@ int rf_build_raw(
                 indexedOut.push_back(abs(duration));
                 index = indexedOut.size() - 1;
             }
-            pulseIndexes.push_back(index);
+            crc = crc64_ecma_update(crc, (uint8_t)index);
+            indexes++;
         }
         transitions++;
     }
 
-    if (repetition >= 2 && !pulseIndexes.empty()) {
-        crcOut = crc64_ecma(pulseIndexes);
-        bitsOut = pulseIndexes.size();
+    if (repetition >= 2 && indexes > 0) {
+        crcOut = crc;
+        bitsOut = indexes;
         hasCrc = true;
     } else {
         indexedOut.clear(); // only meaningful alongside a CRC
@@ -465,6 +375,24 @@ int rf_build_raw(
     return transitions;
 }
 
+void rf_raw_string(const std::vector<int> &durations, String &dataOut) {
+    dataOut = "";
+    dataOut.reserve(durations.size() * 6);
+    char buf[12];
+    for (size_t i = 0; i < durations.size() && durations[i] != 0; i++) {
+        snprintf(buf, sizeof(buf), i ? " %d" : "%d", durations[i]);
+        dataOut += buf;
+    }
+}
+
+int rf_build_raw(
+    const std::vector<int> &durations, String &dataOut, bool &hasCrc, uint64_t &crcOut,
+    std::vector<int> &indexedOut, int &bitsOut, int &teOut
+) {
+    rf_raw_string(durations, dataOut);
+    return rf_raw_stats(durations, hasCrc, crcOut, indexedOut, bitsOut, teOut);
+}
+
 // KeeLoq dedicated decoder — faithful port of the reference feed() state machine
 // (te_short=400, te_long=800, te_delta=180). Walks the signed durations,
 // resyncing on the 11-pulse header + long sync gap, then reads 64 PWM bits
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "../structs.h"
+#include "rf_ook.h"
 #include <freertos/FreeRTOS.h>
 #include <freertos/queue.h>
 #include <vector>
@@ -81,6 +82,14 @@ bool rf_decode_keeloq(const std::vector<int> &durations, RfCodes &out);
 //    `crcOut` (CRC-64 of the pulse-index sequence), `indexedOut` (distinct
 //    pulse lengths) and `bitsOut` (number of indexed transitions).
 // Returns the number of transitions written to `dataOut`.
+// rf_raw_stats() is the same without `dataOut` (no heap beyond the <= 4 entry
+// `indexedOut`), so a capture can be fingerprinted and deduped before its data
+// string is built with rf_raw_string().
+int rf_raw_stats(
+    const std::vector<int> &durations, bool &hasCrc, uint64_t &crcOut, std::vector<int> &indexedOut,
+    int &bitsOut, int &teOut
+);
+void rf_raw_string(const std::vector<int> &durations, String &dataOut);
 int rf_build_raw(
     const std::vector<int> &durations, String &dataOut, bool &hasCrc, uint64_t &crcOut,
     std::vector<int> &indexedOut, int &bitsOut, int &teOut
@@ -47,11 +47,9 @@ static void rf_push_half(std::vector<rmt_symbol_word_t> &syms, bool &pendingLow,
     }
 }
 
-bool rf_tx_durations(const std::vector<int> &durations) {
-    if (durations.empty()) return false;
-
+bool rf_pack_symbols(const std::vector<int> &durations, std::vector<rmt_symbol_word_t> &syms) {
     // Pack signed µs timings into RMT symbols (two half-pulses per symbol).
-    std::vector<rmt_symbol_word_t> syms;
+    syms.clear();
     syms.reserve(durations.size() / 2 + 1);
     bool pendingLow = false;
     for (int d : durations) {
@@ -60,9 +58,18 @@ bool rf_tx_durations(const std::vector<int> &durations) {
         long dur = (d > 0) ? d : -d;
         rf_push_half(syms, pendingLow, level, dur);
     }
-    if (syms.empty()) return false;
+    return !syms.empty();
+}
 
-    RF_DBG("tx: %u durations -> %u symbols", (unsigned)durations.size(), (unsigned)syms.size());
+bool IRAM_ATTR RfTxStream::on_done(rmt_channel_handle_t, const rmt_tx_done_event_data_t *, void *ctx) {
+    static_cast<RfTxStream *>(ctx)->_done++;
+    return false;
+}
+
+bool RfTxStream::begin() {
+    if (_ch) return true;
+    _queued = 0;
+    _done = 0;
 
     // Create the RMT TX channel on the RF output pin (1 MHz / 1 tick = 1 µs,
     // matching the RX side). The radio itself is already configured by the
@@ -72,50 +79,141 @@ bool rf_tx_durations(const std::vector<int> &durations) {
     tx_cfg.clk_src = RMT_CLK_SRC_DEFAULT;
     tx_cfg.resolution_hz = 1 * 1000 * 1000;
     tx_cfg.mem_block_symbols = 64;
-    tx_cfg.trans_queue_depth = 4;
+    tx_cfg.trans_queue_depth = RF_TX_SLOTS;
     tx_cfg.flags.invert_out = false;
     tx_cfg.flags.with_dma = false;
 
-    rmt_channel_handle_t ch = nullptr;
-    esp_err_t err = rmt_new_tx_channel(&tx_cfg, &ch);
+    esp_err_t err = rmt_new_tx_channel(&tx_cfg, &_ch);
     if (err != ESP_OK) {
         RF_DBG("rmt_new_tx_channel failed: %d", (int)err);
+        _ch = nullptr;
         return false;
     }
 
-    rmt_encoder_handle_t encoder = nullptr;
     rmt_copy_encoder_config_t copy_cfg = {};
-    err = rmt_new_copy_encoder(&copy_cfg, &encoder);
+    err = rmt_new_copy_encoder(&copy_cfg, &_enc);
     if (err != ESP_OK) {
         RF_DBG("rmt_new_copy_encoder failed: %d", (int)err);
-        rmt_del_channel(ch);
+        rmt_del_channel(_ch);
+        _ch = nullptr;
+        _enc = nullptr;
+        return false;
+    }
+
+    rmt_tx_event_callbacks_t cbs = {};
+    cbs.on_trans_done = on_done;
+    if (rmt_tx_register_event_callbacks(_ch, &cbs, this) != ESP_OK || rmt_enable(_ch) != ESP_OK) {
+        RF_DBG("rmt tx enable failed");
+        end();
         return false;
     }
+    _enabled = true;
+    return true;
+}
 
-    bool ok = (rmt_enable(ch) == ESP_OK);
-    if (ok) {
-        rmt_transmit_config_t txc = {};
-        txc.loop_count = 0;        // repetitions are already baked into `syms`
-        txc.flags.eot_level = 0;   // leave the line LOW when done
-        err = rmt_transmit(ch, encoder, syms.data(), syms.size() * sizeof(rmt_symbol_word_t), &txc);
+std::vector<rmt_symbol_word_t> *RfTxStream::next() {
+    // The slot about to be refilled may still be read by the RMT driver: wait
+    // until the frame queued RF_TX_SLOTS frames ago has gone out.
+    uint32_t t0 = millis();
+    while (_queued - _done >= RF_TX_SLOTS) {
+        if (millis() - t0 >= RF_TX_WAIT_MS) {
+            RF_DBG("tx slot wait timed out");
+            return nullptr;
+        }
+        vTaskDelay(1);
+    }
+    return &_slots[_queued % RF_TX_SLOTS];
+}
+
+bool RfTxStream::queue() {
+    const std::vector<rmt_symbol_word_t> &syms = _slots[_queued % RF_TX_SLOTS];
+    if (!_enabled || syms.empty() || _queued - _done >= RF_TX_SLOTS) return false;
+
+    rmt_transmit_config_t txc = {};
+    txc.loop_count = 0;      // repetitions are already baked into the frame
+    txc.flags.eot_level = 0; // leave the line LOW when done
+    esp_err_t err = rmt_transmit(_ch, _enc, syms.data(), syms.size() * sizeof(rmt_symbol_word_t), &txc);
+    if (err != ESP_OK) {
+        RF_DBG("rmt_transmit failed: %d", (int)err);
+        return false;
+    }
+    _queued++;
+    return true;
+}
+
+size_t IRAM_ATTR RfTxStream::on_encode(
+    const void *data, size_t, size_t written, size_t free, rmt_symbol_word_t *symbols, bool *done, void *
+) {
+    const GenJob *job = static_cast<const GenJob *>(data);
+    size_t n = job->gen(symbols, free, written == 0, job->ctx);
+    *done = (n < free);
+    return n;
+}
+
+bool RfTxStream::queue_generated(RfSymbolGen gen, void *ctx) {
+    // The job is read by the encoder for the whole transmission: only one at a time.
+    if (!_enabled || gen == nullptr || !idle()) return false;
+    if (_genEnc == nullptr) {
+        rmt_simple_encoder_config_t cfg = {};
+        cfg.callback = on_encode;
+        cfg.min_chunk_size = 1; // the generator can stop at any symbol
+        esp_err_t err = rmt_new_simple_encoder(&cfg, &_genEnc);
         if (err != ESP_OK) {
-            RF_DBG("rmt_transmit failed: %d", (int)err);
-            ok = false;
-        } else {
-            err = rmt_tx_wait_all_done(ch, 2000); // up to 2s for the frame to flush
-            if (err != ESP_OK) {
-                RF_DBG("rmt_tx_wait_all_done failed: %d", (int)err);
-                ok = false;
-            }
+            RF_DBG("rmt_new_simple_encoder failed: %d", (int)err);
+            _genEnc = nullptr;
+            return false;
         }
-        rmt_disable(ch);
     }
 
-    rmt_del_encoder(encoder);
-    rmt_del_channel(ch);
+    _job = {gen, ctx};
+    rmt_transmit_config_t txc = {};
+    txc.loop_count = 0;
+    txc.flags.eot_level = 0; // leave the line LOW when done
+    esp_err_t err = rmt_transmit(_ch, _genEnc, &_job, sizeof(_job), &txc);
+    if (err != ESP_OK) {
+        RF_DBG("rmt_transmit (generated) failed: %d", (int)err);
+        return false;
+    }
+    _queued++;
+    return true;
+}
+
+bool RfTxStream::end() {
+    bool ok = true;
+    if (_enabled) {
+        // Only the last RF_TX_SLOTS frames can still be pending.
+        esp_err_t err = rmt_tx_wait_all_done(_ch, RF_TX_WAIT_MS * RF_TX_SLOTS);
+        if (err != ESP_OK) {
+            RF_DBG("rmt_tx_wait_all_done failed: %d", (int)err);
+            ok = false;
+        }
+        rmt_disable(_ch);
+        _enabled = false;
+    }
+    if (_enc) rmt_del_encoder(_enc);
+    if (_genEnc) rmt_del_encoder(_genEnc);
+    if (_ch) rmt_del_channel(_ch);
+    _enc = nullptr;
+    _genEnc = nullptr;
+    _ch = nullptr;
     return ok;
 }
 
+bool rf_tx_durations(const std::vector<int> &durations) {
+    if (durations.empty()) return false;
+    RfTxStream tx;
+    if (!tx.begin()) return false;
+    std::vector<rmt_symbol_word_t> *syms = tx.next();
+    if (!syms || !rf_pack_symbols(durations, *syms)) {
+        tx.end();
+        return false;
+    }
+
+    RF_DBG("tx: %u durations -> %u symbols", (unsigned)durations.size(), (unsigned)syms->size());
+    bool ok = tx.queue();
+    return tx.end() && ok;
+}
+
 bool rf_encode_protocol(
     uint64_t data, unsigned int bits, int te, const RfProtocolDef *def, int repeat,
     std::vector<int> &out
@@ -225,18 +323,24 @@ bool rf_tx_raw_timings(const int *timings) {
     return rf_tx_durations(durs);
 }
 
-bool rf_tx_raw_bits(const String &bits, int te) {
+bool rf_raw_bits_durations(const String &bits, int te, std::vector<int> &out) {
+    out.clear();
     if (bits.length() == 0 || te <= 0) return false;
     // Each bit is one half-pulse of `te` µs at the matching level. Matches the
     // legacy bit sender, which walked the string from the end toward the start.
-    std::vector<int> durs;
-    durs.reserve(bits.length());
+    out.reserve(bits.length());
     for (int i = bits.length() - 1; i >= 0; i--) {
         char c = bits[i];
-        if (c == '1') durs.push_back(te);
-        else if (c == '0') durs.push_back(-te);
+        if (c == '1') out.push_back(te);
+        else if (c == '0') out.push_back(-te);
         // any other char is skipped (as before)
     }
+    return true;
+}
+
+bool rf_tx_raw_bits(const String &bits, int te) {
+    std::vector<int> durs;
+    if (!rf_raw_bits_durations(bits, te, durs)) return false;
     return rf_tx_durations(durs);
 }
 
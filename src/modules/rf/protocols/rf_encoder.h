@@ -27,6 +27,65 @@
 // hardware reports the whole frame done; leaves the line idle LOW.
 bool rf_tx_durations(const std::vector<int> &durations);
 
+// Pack signed µs durations into RMT symbols (two half-pulses per symbol, long
+// stretches split at the 15-bit field limit). Returns false when empty.
+bool rf_pack_symbols(const std::vector<int> &durations, std::vector<rmt_symbol_word_t> &syms);
+
+// Back-to-back RMT transmit session: one channel stays open while frames are
+// queued, so consecutive frames leave the pin without re-creating the channel
+// (and without the caller waiting for each one). Up to RF_TX_SLOTS frames are
+// in flight; each lives in a slot buffer owned by the stream until sent.
+//   RfTxStream tx; tx.begin();
+//   while ((buf = tx.next()) && rf_pack_symbols(durs, *buf) && tx.queue()) ...
+//   tx.end();
+#define RF_TX_SLOTS 4
+#define RF_TX_WAIT_MS 2000 // max wait for one frame to flush
+
+// On-the-fly symbol source for RfTxStream::queue_generated(). Called from the
+// RMT TX interrupt each time its memory block has room: write up to `max`
+// symbols to `out` and return how many; returning fewer than `max` ends the
+// transmission. `restart` is set on the first call of a transmission.
+typedef size_t (*RfSymbolGen)(rmt_symbol_word_t *out, size_t max, bool restart, void *ctx);
+
+class RfTxStream {
+public:
+    ~RfTxStream() { end(); }
+    bool begin();
+    // Slot buffer for the next frame; waits while all slots are still queued.
+    // nullptr when no slot came free within RF_TX_WAIT_MS (stop sending then).
+    std::vector<rmt_symbol_word_t> *next();
+    // Queue the buffer last returned by next(). Returns immediately.
+    bool queue();
+    // Queue one transmission whose symbols `gen` synthesizes while the RMT
+    // ping-pong memory drains (no buffer at all, any length). `ctx` must stay
+    // valid until idle(). Returns immediately.
+    bool queue_generated(RfSymbolGen gen, void *ctx);
+    // True once everything queued so far has gone out.
+    bool idle() const { return _done == _queued; }
+    // Wait for every queued frame to go out, then release the channel.
+    bool end();
+
+private:
+    struct GenJob {
+        RfSymbolGen gen;
+        void *ctx;
+    };
+    rmt_channel_handle_t _ch = nullptr;
+    rmt_encoder_handle_t _enc = nullptr;
+    rmt_encoder_handle_t _genEnc = nullptr; // simple (callback) encoder, created on demand
+    GenJob _job = {};
+    bool _enabled = false;
+    std::vector<rmt_symbol_word_t> _slots[RF_TX_SLOTS];
+    uint32_t _queued = 0;
+    volatile uint32_t _done = 0; // bumped from the RMT done ISR
+
+    static bool on_done(rmt_channel_handle_t ch, const rmt_tx_done_event_data_t *ev, void *ctx);
+    static size_t on_encode(
+        const void *data, size_t size, size_t written, size_t free, rmt_symbol_word_t *symbols, bool *done,
+        void *arg
+    );
+};
+
 // Build (without transmitting) the signed-µs duration list for `data`
 // (`bits` long, MSB first) under protocol `def`, repeated `repeat` times.
 // `te` overrides def->te when > 0. Pure / hardware-free: used both by
@@ -60,4 +119,6 @@ bool rf_tx_raw_timings(const int *timings);
 
 // Transmit a bit string: each '1'/'0' char is held at the matching logic level
 // for `te` µs (other chars are skipped, as in the legacy bit sender).
+// `rf_raw_bits_durations` is the pure builder.
+bool rf_raw_bits_durations(const String &bits, int te, std::vector<int> &out);
 bool rf_tx_raw_bits(const String &bits, int te);
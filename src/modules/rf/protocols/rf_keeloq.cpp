@@ -12,201 +12,106 @@
 #include "rf_keeloq_mfcodes_data.h"
 #include <Arduino.h>
 #include <LittleFS.h>
-#include <cstdlib>
 #include <cstring>
 #include <mbedtls/aes.h>
 #include <vector>
 
-uint32_t keeloq_encrypt(const uint32_t data, const uint64_t key) {
-    uint32_t x = data, r;
+// Decrypt the built-in keystore into `out` (NUL-terminated plaintext).
+static bool keeloq_embedded_plaintext(std::vector<char> &out) {
+    if (KEELOQ_MFCODES_ENC_LEN == 0 || (KEELOQ_MFCODES_ENC_LEN % 16) != 0) return false;
 
-    for (r = 0; r < 528; r++)
-        x = (x >> 1) ^ ((bitAt(x, 0) ^ bitAt(x, 16) ^ (uint32_t)bitAt(key, r & 63) ^
-                         bitAt(KEELOQ_NLF, g5(x, 1, 9, 20, 26, 31)))
-                        << 31);
-
-    return x;
-}
-
-uint32_t keeloq_decrypt(const uint32_t data, const uint64_t key) {
-    uint32_t x = data, r;
-
-    for (r = 0; r < 528; r++)
-        x = (x << 1) ^ bitAt(x, 31) ^ bitAt(x, 15) ^ (uint32_t)bitAt(key, (15 - r) & 63) ^
-            bitAt(KEELOQ_NLF, g5(x, 0, 8, 19, 25, 30));
-
-    return x;
-}
-
-uint64_t keeloq_normal_learning(uint32_t data, const uint64_t key) {
-    uint32_t k1, k2;
-
-    data &= 0x0FFFFFFF;
-    data |= 0x20000000;
-    k1 = keeloq_decrypt(data, key);
-
-    data &= 0x0FFFFFFF;
-    data |= 0x60000000;
-    k2 = keeloq_decrypt(data, key);
-
-    return ((uint64_t)k2 << 32) | k1;
-}
-
-// --- Manufacturer-specific learning schemes (ported from keeloq_common) ------
-
-uint64_t keeloq_secure_learning(uint32_t data, uint32_t seed, const uint64_t key) {
-    data &= 0x0FFFFFFF;
-    uint32_t k1 = keeloq_decrypt(data, key);
-    uint32_t k2 = keeloq_decrypt(seed, key);
-    return ((uint64_t)k1 << 32) | k2;
-}
-
-uint64_t keeloq_magic_xor_type1_learning(uint32_t data, uint64_t xorv) {
-    data &= 0x0FFFFFFF;
-    return (((uint64_t)data << 32) | data) ^ xorv;
-}
-
-uint64_t keeloq_magic_serial_type1_learning(uint32_t data, uint64_t man) {
-    return (man & 0xFFFFFFFF) | ((uint64_t)data << 40) |
-           ((uint64_t)(((data & 0xff) + ((data >> 8) & 0xFF)) & 0xFF) << 32);
-}
-
-uint64_t keeloq_magic_serial_type2_learning(uint32_t data, uint64_t man) {
-    uint8_t *p = (uint8_t *)&data;
-    uint8_t *m = (uint8_t *)&man;
-    m[7] = p[0];
-    m[6] = p[1];
-    m[5] = p[2];
-    m[4] = p[3];
-    return man;
-}
-
-uint64_t keeloq_magic_serial_type3_learning(uint32_t data, uint64_t man) {
-    return (man & 0xFFFFFFFFFF000000) | (data & 0xFFFFFF);
-}
-
-uint64_t keeloq_learning_aerf(uint32_t data, const uint64_t key) {
-    uint32_t d = data & 0x0FFFFFFFu;
-    uint32_t k1 = keeloq_decrypt(d | 0x20000000u, key);
-    uint32_t k2 = keeloq_decrypt(d | 0x60000000u, key);
-    return ((uint64_t)k2 << 32) | k1;
-}
-
-uint64_t keeloq_learning_erreka(uint32_t data, uint32_t mix, const uint64_t key) {
-    uint32_t d = data & 0x0FFFFFFFu;
-    uint32_t k1 = keeloq_decrypt(d | 0x20000000u, key);
-    uint32_t r4 = mix >> 4;
-    uint32_t r1 = (mix << 4) & 0xF000F000u;
-    r4 = (r4 & 0x0F000F00u) | r1;
-    uint32_t r5 = mix & 0x00FF00FFu;
-    uint32_t x = r4 | r5;
-    x |= 0x60000000u;
-    uint32_t k2 = keeloq_decrypt(x, key);
-    return ((uint64_t)k2 << 32) | k1;
-}
-
-uint64_t keeloq_learning_pujol(uint32_t data, const uint64_t key) {
-    uint32_t d = data & 0x0FFFFFFFu;
-    uint32_t w1 = keeloq_decrypt(d | 0x20000000u, key);
-    uint32_t w2 = keeloq_decrypt(d | 0x60000000u, key);
-    uint32_t k1 = (w1 >> 16) | (w1 << 16);
-    uint32_t k2 = (w2 >> 16) | (w2 << 16);
-    return ((uint64_t)k2 << 32) | k1;
-}
-
-uint64_t keeloq_derive_man(uint32_t type, uint32_t fix, uint32_t seed, uint64_t key) {
-    switch (type) {
-        case KEELOQ_NORMAL_LEARNING: return keeloq_normal_learning(fix, key);
-        case KEELOQ_SECURE_LEARNING: return keeloq_secure_learning(fix, seed, key);
-        case KEELOQ_MAGIC_XOR_TYPE1_LEARNING: return keeloq_magic_xor_type1_learning(fix, key);
-        case KEELOQ_MAGIC_SERIAL_TYPE1_LEARNING: return keeloq_magic_serial_type1_learning(fix, key);
-        case KEELOQ_MAGIC_SERIAL_TYPE2_LEARNING: return keeloq_magic_serial_type2_learning(fix, key);
-        case KEELOQ_MAGIC_SERIAL_TYPE3_LEARNING: return keeloq_magic_serial_type3_learning(fix, key);
-        case KEELOQ_AERF_LEARNING: return keeloq_learning_aerf(fix, key);
-        case KEELOQ_ERREKA_LEARNING: return keeloq_learning_erreka(fix, seed, key);
-        case KEELOQ_PUJOL_LEARNING: return keeloq_learning_pujol(fix, key);
-        // SIMPLE, SIMPLE_JCM, UNKNOWN and any unhandled type encrypt with the
-        // manufacturer key directly.
-        default: return key;
-    }
-}
-
-static std::vector<String> split_string(String str, char c) {
-    std::vector<String> cols{};
-    size_t start = 0;
-
-    while (start < str.length()) {
-        auto it = str.indexOf(c, start);
-
-        if (it == -1) break;
-
-        cols.emplace_back(&str[start], it - start);
-        start = it + 1;
-    }
-
-    if (start <= str.length() && !str.isEmpty()) cols.emplace_back(&str[start], str.length() - start);
-
-    return cols;
-}
-
-static void parse_keystore(const String &content, std::vector<KeeloqKey> &keys) {
-    int start = 0;
-    const int len = content.length();
-
-    while (start < len) {
-        int nl = content.indexOf('\n', start);
-        String line = (nl < 0) ? content.substring(start) : content.substring(start, nl);
-        start = (nl < 0) ? len : nl + 1;
-
-        line.trim(); // also drops a trailing '\r'
-        if (line.isEmpty()) continue;
-
-        auto cols = split_string(line, ';');
-        if (cols.size() != 3) continue; // skip malformed lines, keep the rest
-
-        keys.push_back({cols[0], std::strtoull(cols[1].c_str(), NULL, 16), (uint8_t)cols[2].toInt()});
-    }
-}
-
-static String keeloq_embedded_plaintext() {
-    if (KEELOQ_MFCODES_ENC_LEN == 0 || (KEELOQ_MFCODES_ENC_LEN % 16) != 0) return "";
-
-    std::vector<uint8_t> out(KEELOQ_MFCODES_ENC_LEN + 1, 0);
+    out.assign(KEELOQ_MFCODES_ENC_LEN + 1, 0);
     mbedtls_aes_context ctx;
     mbedtls_aes_init(&ctx);
     if (mbedtls_aes_setkey_dec(&ctx, KEELOQ_MFCODES_KEY, 256) != 0) {
         mbedtls_aes_free(&ctx);
-        return "";
+        return false;
     }
 
     uint8_t iv[16];
     memcpy(iv, KEELOQ_MFCODES_IV, sizeof(iv)); // CBC mutates the IV in place
     int rc = mbedtls_aes_crypt_cbc(
-        &ctx, MBEDTLS_AES_DECRYPT, KEELOQ_MFCODES_ENC_LEN, iv, KEELOQ_MFCODES_ENC, out.data()
+        &ctx, MBEDTLS_AES_DECRYPT, KEELOQ_MFCODES_ENC_LEN, iv, KEELOQ_MFCODES_ENC, (uint8_t *)out.data()
     );
     mbedtls_aes_free(&ctx);
-    if (rc != 0) return "";
+    if (rc != 0) return false;
 
     size_t plen = KEELOQ_MFCODES_ENC_LEN;
-    uint8_t pad = out[plen - 1];
+    uint8_t pad = (uint8_t)out[plen - 1];
     if (pad >= 1 && pad <= 16 && pad <= plen) plen -= pad;
     out[plen] = 0;
-
-    return String((const char *)out.data());
+    out.resize(plen + 1);
+    return true;
 }
 
-KeeloqKeystore::KeeloqKeystore(FS *fs) {
+void KeeloqKeystore::load(FS *fs) {
+    clear();
     if (fs) {
         File keystore = fs->open("/mfcodes");
         if (keystore) {
-            parse_keystore(keystore.readString(), keys);
+            size_t len = keystore.size();
+            std::vector<char> buf(len + 1, 0);
+            len = keystore.read((uint8_t *)buf.data(), len);
+            buf[len] = 0;
             keystore.close();
+            load_text(buf.data(), len);
         }
     }
-    if (keys.empty()) parse_keystore(keeloq_embedded_plaintext(), keys);
+    if (keys.empty()) {
+        std::vector<char> plain;
+        if (keeloq_embedded_plaintext(plain)) load_text(plain.data(), plain.size() - 1);
+    }
+}
+
+// --- Process-lifetime keystore cache -----------------------------------------
+// Rebuilt only when the `/mfcodes` stamp (filesystem, size, mtime) changes; the
+// stamp itself is re-read at most every KEELOQ_KEYSTORE_RECHECK_MS.
+struct KeeloqStamp {
+    FS *fs = nullptr;
+    size_t size = 0;
+    time_t mtime = 0;
+
+    bool operator==(const KeeloqStamp &o) const { return fs == o.fs && size == o.size && mtime == o.mtime; }
+};
+
+static KeeloqKeystore keeloq_cache;
+static KeeloqStamp keeloq_cache_stamp;
+static bool keeloq_cache_valid = false;
+static uint32_t keeloq_cache_checked = 0;
+
+static KeeloqStamp keeloq_mfcodes_stamp() {
+    KeeloqStamp st;
+    st.fs = keeloq_mfcodes_fs();
+    if (!st.fs) return st;
+    File f = st.fs->open("/mfcodes");
+    if (f) {
+        st.size = f.size();
+        st.mtime = f.getLastWrite();
+        f.close();
+    }
+    return st;
+}
+
+const KeeloqKeystore &keeloq_keystore() {
+    uint32_t now = millis();
+    if (keeloq_cache_valid && now - keeloq_cache_checked < KEELOQ_KEYSTORE_RECHECK_MS) return keeloq_cache;
+    keeloq_cache_checked = now;
+
+    KeeloqStamp st = keeloq_mfcodes_stamp();
+    if (keeloq_cache_valid && st == keeloq_cache_stamp) return keeloq_cache;
+
+    keeloq_cache.load(st.size ? st.fs : nullptr);
+    keeloq_cache_stamp = st;
+    keeloq_cache_valid = true;
+    RF_DBG(
+        "keeloq keystore loaded: %u keys, %u manufacturers",
+        (unsigned)keeloq_cache.get_keys().size(),
+        (unsigned)keeloq_cache.mf_count()
+    );
+    return keeloq_cache;
 }
 
-const std::vector<KeeloqKey> &KeeloqKeystore::get_keys() { return keys; }
+void keeloq_keystore_invalidate() { keeloq_cache_valid = false; }
 
 FS *keeloq_mfcodes_fs() {
     FS *fs = nullptr;
@@ -406,8 +311,9 @@ bool rf_keeloq_filetest() {
         RF_DBG("keeloq filetest: no storage");
         return false;
     }
-    KeeloqKeystore ks{fs};
-    const std::vector<KeeloqKey> &keys = ks.get_keys();
+    KeeloqKeystore ks;
+    ks.load(fs);
+    const std::vector<KeeloqKeyEntry> &keys = ks.get_keys();
     if (keys.empty()) {
         RF_DBG("keeloq filetest: /mfcodes missing or empty");
         return false;
@@ -421,19 +327,20 @@ bool rf_keeloq_filetest() {
 
     int pass = 0, fail = 0, unsup = 0;
     for (const auto &k : keys) {
+        String mf = ks.mf_name(k.mf_id);
         if (!kl_type_supported(k.type)) {
             unsup++;
-            RF_DBG("keeloq file %-18s type=%2u UNSUPPORTED", k.mf_name.c_str(), (unsigned)k.type);
+            RF_DBG("keeloq file %-18s type=%2u UNSUPPORTED", mf.c_str(), (unsigned)k.type);
             continue;
         }
-        uint32_t hop = keeloq_build_hop(k.mf_name, btn, serial, cnt);
+        uint32_t hop = keeloq_build_hop(mf, btn, serial, cnt);
         uint64_t man = keeloq_derive_man(k.type, fix, seed, k.key);
         uint32_t enc = keeloq_encrypt(hop, man);
         uint32_t dec = keeloq_decrypt(enc, man);
-        bool ok = kl_check(k.mf_name, dec, btn, serial, cnt);
+        bool ok = kl_check(mf, dec, btn, serial, cnt);
         if (ok) pass++;
         else fail++;
-        RF_DBG("keeloq file %-18s type=%2u %s", k.mf_name.c_str(), (unsigned)k.type, ok ? "PASS" : "FAIL");
+        RF_DBG("keeloq file %-18s type=%2u %s", mf.c_str(), (unsigned)k.type, ok ? "PASS" : "FAIL");
     }
     RF_DBG(
         "keeloq filetest: %d pass, %d fail, %d unsupported (of %u)", pass, fail, unsup, (unsigned)keys.size()
@@ -0,0 +1,234 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+//
+// Part of Bruce (AGPL-3.0-or-later). This file is DERIVED FROM and modified
+// after the Flipper Zero firmware (KeeLoq cipher + keeloq_common learning
+// schemes), Copyright (C) Flipper Devices Inc. and the flipperzero-firmware
+// contributors, licensed GPL-3.0-or-later. The encrypted built-in keystore
+// mirrors Momentum firmware's keeloq_mfcodes (GPL-3.0-or-later).
+// See THIRD_PARTY.md for full attribution.
+#include "rf_keeloq_cipher.h"
+#include <cstring>
+
+uint32_t keeloq_encrypt(const uint32_t data, const uint64_t key) {
+    uint32_t x = data, r;
+
+    for (r = 0; r < 528; r++)
+        x = (x >> 1) ^ ((bitAt(x, 0) ^ bitAt(x, 16) ^ (uint32_t)bitAt(key, r & 63) ^
+                         bitAt(KEELOQ_NLF, g5(x, 1, 9, 20, 26, 31)))
+                        << 31);
+
+    return x;
+}
+
+uint32_t keeloq_decrypt(const uint32_t data, const uint64_t key) {
+    uint32_t x = data, r;
+
+    for (r = 0; r < 528; r++)
+        x = (x << 1) ^ bitAt(x, 31) ^ bitAt(x, 15) ^ (uint32_t)bitAt(key, (15 - r) & 63) ^
+            bitAt(KEELOQ_NLF, g5(x, 0, 8, 19, 25, 30));
+
+    return x;
+}
+
+uint64_t keeloq_normal_learning(uint32_t data, const uint64_t key) {
+    uint32_t k1, k2;
+
+    data &= 0x0FFFFFFF;
+    data |= 0x20000000;
+    k1 = keeloq_decrypt(data, key);
+
+    data &= 0x0FFFFFFF;
+    data |= 0x60000000;
+    k2 = keeloq_decrypt(data, key);
+
+    return ((uint64_t)k2 << 32) | k1;
+}
+
+// --- Manufacturer-specific learning schemes (ported from keeloq_common) ------
+
+uint64_t keeloq_secure_learning(uint32_t data, uint32_t seed, const uint64_t key) {
+    data &= 0x0FFFFFFF;
+    uint32_t k1 = keeloq_decrypt(data, key);
+    uint32_t k2 = keeloq_decrypt(seed, key);
+    return ((uint64_t)k1 << 32) | k2;
+}
+
+uint64_t keeloq_magic_xor_type1_learning(uint32_t data, uint64_t xorv) {
+    data &= 0x0FFFFFFF;
+    return (((uint64_t)data << 32) | data) ^ xorv;
+}
+
+uint64_t keeloq_magic_serial_type1_learning(uint32_t data, uint64_t man) {
+    return (man & 0xFFFFFFFF) | ((uint64_t)data << 40) |
+           ((uint64_t)(((data & 0xff) + ((data >> 8) & 0xFF)) & 0xFF) << 32);
+}
+
+uint64_t keeloq_magic_serial_type2_learning(uint32_t data, uint64_t man) {
+    uint8_t *p = (uint8_t *)&data;
+    uint8_t *m = (uint8_t *)&man;
+    m[7] = p[0];
+    m[6] = p[1];
+    m[5] = p[2];
+    m[4] = p[3];
+    return man;
+}
+
+uint64_t keeloq_magic_serial_type3_learning(uint32_t data, uint64_t man) {
+    return (man & 0xFFFFFFFFFF000000) | (data & 0xFFFFFF);
+}
+
+uint64_t keeloq_learning_aerf(uint32_t data, const uint64_t key) {
+    uint32_t d = data & 0x0FFFFFFFu;
+    uint32_t k1 = keeloq_decrypt(d | 0x20000000u, key);
+    uint32_t k2 = keeloq_decrypt(d | 0x60000000u, key);
+    return ((uint64_t)k2 << 32) | k1;
+}
+
+uint32_t keeloq_erreka_mix(uint32_t mix) {
+    uint32_t r4 = mix >> 4;
+    uint32_t r1 = (mix << 4) & 0xF000F000u;
+    r4 = (r4 & 0x0F000F00u) | r1;
+    uint32_t r5 = mix & 0x00FF00FFu;
+    uint32_t x = r4 | r5;
+    return x | 0x60000000u;
+}
+
+uint64_t keeloq_learning_erreka(uint32_t data, uint32_t mix, const uint64_t key) {
+    uint32_t d = data & 0x0FFFFFFFu;
+    uint32_t k1 = keeloq_decrypt(d | 0x20000000u, key);
+    uint32_t k2 = keeloq_decrypt(keeloq_erreka_mix(mix), key);
+    return ((uint64_t)k2 << 32) | k1;
+}
+
+uint64_t keeloq_learning_pujol(uint32_t data, const uint64_t key) {
+    uint32_t d = data & 0x0FFFFFFFu;
+    uint32_t w1 = keeloq_decrypt(d | 0x20000000u, key);
+    uint32_t w2 = keeloq_decrypt(d | 0x60000000u, key);
+    uint32_t k1 = (w1 >> 16) | (w1 << 16);
+    uint32_t k2 = (w2 >> 16) | (w2 << 16);
+    return ((uint64_t)k2 << 32) | k1;
+}
+
+uint64_t keeloq_derive_man(uint32_t type, uint32_t fix, uint32_t seed, uint64_t key) {
+    switch (type) {
+        case KEELOQ_NORMAL_LEARNING: return keeloq_normal_learning(fix, key);
+        case KEELOQ_SECURE_LEARNING: return keeloq_secure_learning(fix, seed, key);
+        case KEELOQ_MAGIC_XOR_TYPE1_LEARNING: return keeloq_magic_xor_type1_learning(fix, key);
+        case KEELOQ_MAGIC_SERIAL_TYPE1_LEARNING: return keeloq_magic_serial_type1_learning(fix, key);
+        case KEELOQ_MAGIC_SERIAL_TYPE2_LEARNING: return keeloq_magic_serial_type2_learning(fix, key);
+        case KEELOQ_MAGIC_SERIAL_TYPE3_LEARNING: return keeloq_magic_serial_type3_learning(fix, key);
+        case KEELOQ_AERF_LEARNING: return keeloq_learning_aerf(fix, key);
+        case KEELOQ_ERREKA_LEARNING: return keeloq_learning_erreka(fix, seed, key);
+        case KEELOQ_PUJOL_LEARNING: return keeloq_learning_pujol(fix, key);
+        // SIMPLE, SIMPLE_JCM, UNKNOWN and any unhandled type encrypt with the
+        // manufacturer key directly.
+        default: return key;
+    }
+}
+
+// --- Bitsliced cipher core ---------------------------------------------------
+// Lane j of every word is an independent decryption: plane[i] holds bit i of
+// all 32 states, key[b] bit b of all 32 keys. One round then costs a dozen word
+// ops for all lanes instead of 32 scalar rounds.
+
+// In-place 32x32 bit-matrix transpose: bit j of a[i] <-> bit i of a[j].
+static void bs_transpose32(uint32_t a[32]) {
+    uint32_t m = 0x0000FFFFu;
+    for (int j = 16; j != 0; j >>= 1, m ^= (m << j)) {
+        for (int k = 0; k < 32; k = (k + j + 1) & ~j) {
+            uint32_t t = ((a[k] >> j) ^ a[k + j]) & m;
+            a[k] ^= t << j;
+            a[k + j] ^= t;
+        }
+    }
+}
+
+// KEELOQ_NLF (0x3A5C742E) in algebraic normal form over the g5() inputs.
+static inline uint32_t bs_nlf(uint32_t a, uint32_t b, uint32_t c, uint32_t d, uint32_t e) {
+    return a ^ b ^ (a & b) ^ (b & c) ^ (a & d) ^ (c & d) ^ (a & e) ^ (a & b & e) ^ (c & e) ^ (a & c & e) ^
+           (b & d & e) ^ (c & d & e);
+}
+
+__attribute__((optimize("O3"), hot)) void keeloq_decrypt_bs32(
+    const uint32_t data[KEELOQ_BS_LANES], const uint64_t key[KEELOQ_BS_LANES], uint32_t out[KEELOQ_BS_LANES]
+) {
+    uint32_t x[32], k[64], t[32];
+
+    memcpy(x, data, sizeof(x));
+    bs_transpose32(x);
+    for (int j = 0; j < 32; j++) t[j] = (uint32_t)key[j];
+    bs_transpose32(t);
+    memcpy(k, t, sizeof(t));
+    for (int j = 0; j < 32; j++) t[j] = (uint32_t)(key[j] >> 32);
+    bs_transpose32(t);
+    memcpy(k + 32, t, sizeof(t));
+
+    // The scalar round shifts the state left and inserts the new bit at 0.
+    // Rather than moving 32 planes per round, logical bit i lives at
+    // x[(i + off) & 31] and the shift is a decrement of `off`.
+    unsigned off = 0;
+    for (unsigned r = 0; r < 528; r++) {
+        uint32_t nb = x[(off + 31) & 31] ^ x[(off + 15) & 31] ^ k[(15 - r) & 63] ^
+                      bs_nlf(x[off & 31], x[(off + 8) & 31], x[(off + 19) & 31], x[(off + 25) & 31],
+                             x[(off + 30) & 31]);
+        off = (off - 1) & 31;
+        x[off] = nb;
+    }
+
+    for (int i = 0; i < 32; i++) t[i] = x[(i + off) & 31];
+    bs_transpose32(t);
+    memcpy(out, t, sizeof(t));
+}
+
+void keeloq_derive_man_bs32(
+    const uint8_t type[], const uint64_t key[], int n, uint32_t fix, uint32_t seed, uint64_t man[]
+) {
+    const uint32_t d = fix & 0x0FFFFFFFu;
+    uint32_t in1[KEELOQ_BS_LANES] = {0}, in2[KEELOQ_BS_LANES] = {0};
+    uint32_t k1[KEELOQ_BS_LANES], k2[KEELOQ_BS_LANES];
+    uint64_t kk[KEELOQ_BS_LANES] = {0};
+    bool need = false;
+
+    // Only the decrypt-based schemes use the bitsliced passes; the rest are
+    // cheap bit shuffles done per lane below.
+    for (int j = 0; j < n; j++) {
+        kk[j] = key[j];
+        switch (type[j]) {
+            case KEELOQ_NORMAL_LEARNING:
+            case KEELOQ_AERF_LEARNING:
+            case KEELOQ_PUJOL_LEARNING:
+                in1[j] = d | 0x20000000u;
+                in2[j] = d | 0x60000000u;
+                need = true;
+                break;
+            case KEELOQ_SECURE_LEARNING:
+                in1[j] = d;
+                in2[j] = seed;
+                need = true;
+                break;
+            case KEELOQ_ERREKA_LEARNING:
+                in1[j] = d | 0x20000000u;
+                in2[j] = keeloq_erreka_mix(seed);
+                need = true;
+                break;
+            default: break;
+        }
+    }
+    if (need) {
+        keeloq_decrypt_bs32(in1, kk, k1);
+        keeloq_decrypt_bs32(in2, kk, k2);
+    }
+
+    for (int j = 0; j < n; j++) {
+        switch (type[j]) {
+            case KEELOQ_NORMAL_LEARNING:
+            case KEELOQ_AERF_LEARNING:
+            case KEELOQ_ERREKA_LEARNING: man[j] = ((uint64_t)k2[j] << 32) | k1[j]; break;
+            case KEELOQ_PUJOL_LEARNING:
+                man[j] = ((uint64_t)((k2[j] >> 16) | (k2[j] << 16)) << 32) | ((k1[j] >> 16) | (k1[j] << 16));
+                break;
+            case KEELOQ_SECURE_LEARNING: man[j] = ((uint64_t)k1[j] << 32) | k2[j]; break;
+            default: man[j] = keeloq_derive_man(type[j], fix, seed, key[j]); break;
+        }
+    }
+}
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+//
+// Part of Bruce (AGPL-3.0-or-later). This file is DERIVED FROM and modified
+// after the Flipper Zero firmware (KeeLoq cipher + keeloq_common learning
+// schemes), Copyright (C) Flipper Devices Inc. and the flipperzero-firmware
+// contributors, licensed GPL-3.0-or-later. The encrypted built-in keystore
+// mirrors Momentum firmware's keeloq_mfcodes (GPL-3.0-or-later).
+// See THIRD_PARTY.md for full attribution.
+#pragma once
+
+#include <stdint.h>
+
+// KeeLoq block cipher, manufacturer learning schemes and the bitsliced batch
+// core. No Arduino dependencies so the host tools (tools/keeloq_bs_bench.cpp)
+// build it natively; the keystore and search engine live in
+// rf_keeloq_keystore.h.
+
+#define bitAt(x, n) (((x) >> (n)) & 1)
+#define g5(x, a, b, c, d, e)                                                                                 \
+    (bitAt(x, a) + bitAt(x, b) * 2 + bitAt(x, c) * 4 + bitAt(x, d) * 8 + bitAt(x, e) * 16)
+
+#define KEELOQ_NLF 0x3A5C742E
+
+// Learning-type ids. Values match the Flipper/SubGhz keystore `type` column so a
+// `/mfcodes` exported from there can be used verbatim. SIMPLE/NORMAL are the
+// historical ones; the rest were ported from the reference keeloq_common.
+#define KEELOQ_UNKNOWN_LEARNING 0
+#define KEELOQ_SIMPLE_LEARNING 1
+#define KEELOQ_NORMAL_LEARNING 2
+#define KEELOQ_SECURE_LEARNING 3
+#define KEELOQ_MAGIC_XOR_TYPE1_LEARNING 4
+#define KEELOQ_FAAC_LEARNING 5             // separate protocol (FAAC SLH) — not handled here
+#define KEELOQ_MAGIC_SERIAL_TYPE1_LEARNING 6
+#define KEELOQ_MAGIC_SERIAL_TYPE2_LEARNING 7
+#define KEELOQ_MAGIC_SERIAL_TYPE3_LEARNING 8
+#define KEELOQ_SIMPLE_KINGGATES_LEARNING 10 // separate protocol — not handled here
+#define KEELOQ_NORMAL_JAROLIFT_LEARNING 11  // separate protocol — not handled here
+#define KEELOQ_ERREKA_LEARNING 12
+#define KEELOQ_PUJOL_LEARNING 13
+#define KEELOQ_AERF_LEARNING 14
+#define KEELOQ_SIMPLE_JCM_LEARNING 15
+
+uint32_t keeloq_encrypt(const uint32_t data, const uint64_t key);
+uint32_t keeloq_decrypt(const uint32_t data, const uint64_t key);
+uint64_t keeloq_normal_learning(uint32_t data, const uint64_t key);
+
+// Manufacturer-specific key-derivation schemes ("learning"), ported from the
+// reference keeloq_common. Each turns the fixed part (and sometimes a seed) into
+// the 64-bit manufacturer key used to encrypt/decrypt the hopping code.
+uint64_t keeloq_secure_learning(uint32_t data, uint32_t seed, const uint64_t key);
+uint64_t keeloq_magic_xor_type1_learning(uint32_t data, uint64_t xorv);
+uint64_t keeloq_magic_serial_type1_learning(uint32_t data, uint64_t man);
+uint64_t keeloq_magic_serial_type2_learning(uint32_t data, uint64_t man);
+uint64_t keeloq_magic_serial_type3_learning(uint32_t data, uint64_t man);
+uint64_t keeloq_learning_aerf(uint32_t data, const uint64_t key);
+uint64_t keeloq_learning_erreka(uint32_t data, uint32_t mix, const uint64_t key);
+uint64_t keeloq_learning_pujol(uint32_t data, const uint64_t key);
+
+// Erreka's second-word mix of the seed (shared by the scalar and bitsliced paths).
+uint32_t keeloq_erreka_mix(uint32_t mix);
+
+// Single dispatch used by both the encoder (keeloq_step) and the decoder
+// (keeloq_identify): derive the manufacturer key for `type`. `fix` is
+// button|serial; `seed` is only consulted by secure/erreka. Unknown/simple
+// learning returns `key` unchanged.
+uint64_t keeloq_derive_man(uint32_t type, uint32_t fix, uint32_t seed, uint64_t key);
+
+// Bitsliced cipher core: KEELOQ_BS_LANES independent (data, key) decryptions in
+// one 528-round pass, one lane per bit of a 32-bit word. Same result per lane as
+// keeloq_decrypt; used to test a whole batch of keystore entries at once.
+#define KEELOQ_BS_LANES 32
+void keeloq_decrypt_bs32(
+    const uint32_t data[KEELOQ_BS_LANES], const uint64_t key[KEELOQ_BS_LANES], uint32_t out[KEELOQ_BS_LANES]
+);
+
+// Batched keeloq_derive_man for `n` (<= KEELOQ_BS_LANES) entries sharing one
+// frame's fix/seed. Decrypt-based learning types run through the bitsliced core.
+void keeloq_derive_man_bs32(
+    const uint8_t type[], const uint64_t key[], int n, uint32_t fix, uint32_t seed, uint64_t man[]
+);
+
+// Hop plausibility checks used to accept a decryption (button, serial low byte /
+// Centurion's fixed 0x1CE). RfCodes::keeloq_check_decrypt[_centurion] wrap these.
+inline bool keeloq_hop_matches(uint32_t decrypt, uint8_t btn, uint32_t serial) {
+    uint8_t s = (decrypt >> 16) & 0xFF;
+    return (decrypt >> 28 == btn) && (s == (serial & 0xFF) || s == 0);
+}
+inline bool keeloq_hop_matches_centurion(uint32_t decrypt, uint8_t btn) {
+    return (decrypt >> 28 == btn) && (((decrypt >> 16) & 0x3FF) == 0x1CE);
+}
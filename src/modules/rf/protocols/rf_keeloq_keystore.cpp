@@ -0,0 +1,209 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+//
+// Part of Bruce (AGPL-3.0-or-later). This file is DERIVED FROM and modified
+// after the Flipper Zero firmware (SubGhz keystore format), Copyright (C)
+// Flipper Devices Inc. and the flipperzero-firmware contributors, licensed
+// GPL-3.0-or-later. See THIRD_PARTY.md for full attribution.
+#include "rf_keeloq_keystore.h"
+#include <cctype>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef ARDUINO
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#endif
+
+// --- Keystore search engine --------------------------------------------------
+struct KeeloqSearchJob {
+    const KeeloqKeystore *ks;
+    uint32_t fix, seed, encrypted, serial;
+    uint8_t btn;
+    volatile int best; // lowest matching entry so far (INT32_MAX = none)
+    uint32_t hop;
+#ifdef ARDUINO
+    portMUX_TYPE lock;
+    SemaphoreHandle_t done;
+#endif
+};
+
+#ifdef ARDUINO
+static SemaphoreHandle_t keeloq_search_done = nullptr;
+#endif
+
+// Scan batches first, first + stride, ... of KEELOQ_BS_LANES entries. Stops at
+// the first match in this share, or as soon as the other worker has matched an
+// entry before the next batch.
+static void keeloq_search_batches(KeeloqSearchJob &job, size_t first, size_t stride) {
+    const std::vector<KeeloqKeyEntry> &keys = job.ks->get_keys();
+    const uint16_t centurion = job.ks->centurion_id();
+    const size_t n = keys.size();
+
+    uint8_t type[KEELOQ_BS_LANES];
+    uint64_t key[KEELOQ_BS_LANES], man[KEELOQ_BS_LANES];
+    uint32_t enc[KEELOQ_BS_LANES], dec[KEELOQ_BS_LANES];
+    for (int j = 0; j < KEELOQ_BS_LANES; j++) enc[j] = job.encrypted;
+
+    for (size_t b = first * KEELOQ_BS_LANES; b < n; b += stride * KEELOQ_BS_LANES) {
+        if ((int)b > job.best) return;
+
+        int cnt = (n - b < KEELOQ_BS_LANES) ? (int)(n - b) : KEELOQ_BS_LANES;
+        for (int j = 0; j < cnt; j++) {
+            type[j] = keys[b + j].type;
+            key[j] = keys[b + j].key;
+        }
+        for (int j = cnt; j < KEELOQ_BS_LANES; j++) man[j] = 0;
+        keeloq_derive_man_bs32(type, key, cnt, job.fix, job.seed, man);
+        keeloq_decrypt_bs32(enc, man, dec);
+
+        for (int j = 0; j < cnt; j++) {
+            bool ok = keeloq_hop_matches(dec[j], job.btn, job.serial) ||
+                      (keys[b + j].mf_id == centurion && keeloq_hop_matches_centurion(dec[j], job.btn));
+            if (!ok) continue;
+
+#ifdef ARDUINO
+            portENTER_CRITICAL(&job.lock);
+#endif
+            if ((int)(b + j) < job.best) {
+                job.best = b + j;
+                job.hop = dec[j];
+            }
+#ifdef ARDUINO
+            portEXIT_CRITICAL(&job.lock);
+#endif
+            return;
+        }
+    }
+}
+
+#if defined(ARDUINO) && SOC_CPU_CORES_NUM > 1
+static void keeloq_search_task(void *arg) {
+    KeeloqSearchJob &job = *(KeeloqSearchJob *)arg;
+    keeloq_search_batches(job, 1, 2);
+    xSemaphoreGive(job.done);
+    vTaskDelete(NULL);
+}
+#endif
+
+KeeloqMatch keeloq_search(
+    const KeeloqKeystore &ks, uint32_t fix, uint32_t seed, uint32_t encrypted, uint8_t btn, uint32_t serial
+) {
+    KeeloqSearchJob job;
+    job.ks = &ks;
+    job.fix = fix;
+    job.seed = seed;
+    job.encrypted = encrypted;
+    job.serial = serial;
+    job.btn = btn;
+    job.best = INT32_MAX;
+    job.hop = 0;
+#ifdef ARDUINO
+    job.lock = portMUX_INITIALIZER_UNLOCKED;
+    job.done = nullptr;
+#endif
+
+    bool split = false;
+#if defined(ARDUINO) && SOC_CPU_CORES_NUM > 1
+    if (ks.get_keys().size() >= KEELOQ_PARALLEL_MIN_KEYS) {
+        if (!keeloq_search_done) keeloq_search_done = xSemaphoreCreateBinary();
+        job.done = keeloq_search_done;
+        split = job.done && xTaskCreatePinnedToCore(
+                                keeloq_search_task,
+                                "keeloq_srch",
+                                4096,
+                                &job,
+                                uxTaskPriorityGet(NULL),
+                                NULL,
+                                xPortGetCoreID() ^ 1
+                            ) == pdPASS;
+    }
+    if (split) {
+        keeloq_search_batches(job, 0, 2);
+        xSemaphoreTake(job.done, portMAX_DELAY);
+    }
+#endif
+    if (!split) keeloq_search_batches(job, 0, 1);
+
+    KeeloqMatch m;
+    if (job.best != INT32_MAX) {
+        m.index = job.best;
+        m.hop = job.hop;
+    }
+    return m;
+}
+
+void KeeloqKeystore::clear() {
+    keys.clear();
+    names.clear();
+    name_offs.clear();
+    centurion = KEELOQ_MF_NONE;
+}
+
+const char *KeeloqKeystore::mf_name(uint16_t id) const {
+    if (id >= name_offs.size()) return "Unknown";
+    return &names[name_offs[id]];
+}
+
+uint16_t KeeloqKeystore::find_mf(const char *name) const {
+    for (uint16_t id = 0; id < name_offs.size(); id++) {
+        if (strcmp(&names[name_offs[id]], name) == 0) return id;
+    }
+    return KEELOQ_MF_NONE;
+}
+
+uint16_t KeeloqKeystore::intern(const char *name, size_t len) {
+    for (uint16_t id = 0; id < name_offs.size(); id++) {
+        const char *n = &names[name_offs[id]];
+        if (strncmp(n, name, len) == 0 && n[len] == 0) return id;
+    }
+    if (name_offs.size() >= KEELOQ_MF_NONE) return KEELOQ_MF_NONE;
+
+    uint16_t id = name_offs.size();
+    name_offs.push_back(names.size());
+    names.insert(names.end(), name, name + len);
+    names.push_back(0);
+    if (len == 9 && strncmp(name, "Centurion", 9) == 0) centurion = id;
+    return id;
+}
+
+// One pass over `name;key_hex;type` lines, in place (no String copies).
+// Malformed lines are skipped; `buf` must be NUL-terminated at `len`.
+void KeeloqKeystore::parse(const char *buf, size_t len) {
+    const char *p = buf;
+    const char *end = buf + len;
+
+    while (p < end) {
+        const char *eol = (const char *)memchr(p, '\n', end - p);
+        if (!eol) eol = end;
+        const char *next = (eol < end) ? eol + 1 : end;
+
+        // trim (also drops a trailing '\r')
+        while (p < eol && isspace((unsigned char)*p)) p++;
+        const char *q = eol;
+        while (q > p && isspace((unsigned char)q[-1])) q--;
+
+        const char *sc1 = (const char *)memchr(p, ';', q - p);
+        const char *sc2 = sc1 ? (const char *)memchr(sc1 + 1, ';', q - sc1 - 1) : nullptr;
+        if (p < q && sc2 && !memchr(sc2 + 1, ';', q - sc2 - 1)) {
+            uint16_t id = intern(p, sc1 - p);
+            if (id != KEELOQ_MF_NONE) {
+                KeeloqKeyEntry e;
+                e.key = std::strtoull(sc1 + 1, NULL, 16);
+                e.mf_id = id;
+                e.type = (uint8_t)std::strtol(sc2 + 1, NULL, 10);
+                keys.push_back(e);
+            }
+        }
+        p = next;
+    }
+}
+
+void KeeloqKeystore::load_text(const char *buf, size_t len) {
+    clear();
+    parse(buf, len);
+    keys.shrink_to_fit();
+    names.shrink_to_fit();
+    name_offs.shrink_to_fit();
+}
@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+//
+// Part of Bruce (AGPL-3.0-or-later). This file is DERIVED FROM and modified
+// after the Flipper Zero firmware (SubGhz keystore format), Copyright (C)
+// Flipper Devices Inc. and the flipperzero-firmware contributors, licensed
+// GPL-3.0-or-later. See THIRD_PARTY.md for full attribution.
+#pragma once
+
+#include "rf_keeloq_cipher.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#ifdef ARDUINO
+#include <FS.h>
+#endif
+
+// Packed KeeLoq keystore table and the search keeloq_identify runs over it.
+// Only load(FS *) needs Arduino, so the host tools
+// (tools/keeloq_identify_bench.cpp) build the rest natively; the cached
+// process-wide keystore lives in rf_keeloq.h.
+
+// Sentinel manufacturer id (no such manufacturer in the keystore).
+#define KEELOQ_MF_NONE 0xFFFF
+
+// One keystore entry, packed (11 bytes). The manufacturer name is interned in
+// the keystore and referenced by `mf_id`, so the per-key loop compares ints.
+struct __attribute__((packed)) KeeloqKeyEntry {
+    uint64_t key;
+    uint16_t mf_id;
+    uint8_t type;
+};
+
+class KeeloqKeystore {
+public:
+#ifdef ARDUINO
+    // Parse `/mfcodes` from `fs`; falls back to the encrypted built-in keys when
+    // the file is missing or has no valid entry. A null fs is fine.
+    void load(FS *fs);
+#endif
+
+    // Replace the table with the `name;key_hex;type` lines of `buf` (malformed
+    // lines are skipped). `buf` must be NUL-terminated at `len`.
+    void load_text(const char *buf, size_t len);
+
+    const std::vector<KeeloqKeyEntry> &get_keys() const { return keys; }
+    const char *mf_name(uint16_t id) const;
+    uint16_t find_mf(const char *name) const; // KEELOQ_MF_NONE when absent
+    uint16_t centurion_id() const { return centurion; }
+    size_t mf_count() const { return name_offs.size(); }
+
+private:
+    std::vector<KeeloqKeyEntry> keys{};
+    std::vector<char> names{};         // interned names, NUL-separated
+    std::vector<uint16_t> name_offs{}; // mf_id -> offset into `names`
+    uint16_t centurion = KEELOQ_MF_NONE;
+
+    void clear();
+    void parse(const char *buf, size_t len);
+    uint16_t intern(const char *name, size_t len);
+};
+
+// Keystore search result: first matching entry in keystore order, or -1.
+struct KeeloqMatch {
+    int index = -1;
+    uint32_t hop = 0;
+};
+
+// Keystores with at least this many entries are split across both cores.
+#ifndef KEELOQ_PARALLEL_MIN_KEYS
+#define KEELOQ_PARALLEL_MIN_KEYS 256
+#endif
+
+// Find the keystore entry whose derived manufacturer key decrypts `encrypted`
+// into a plausible hop. Entries are tested KEELOQ_BS_LANES at a time; on
+// dual-core chips large keystores are interleaved by batch between the caller
+// and a helper task on the other core, and both stop once a lower-indexed
+// match is known. Returns the same entry the sequential loop would. Off-device
+// the search always runs on the calling thread.
+KeeloqMatch keeloq_search(
+    const KeeloqKeystore &ks, uint32_t fix, uint32_t seed, uint32_t encrypted, uint8_t btn, uint32_t serial
+);
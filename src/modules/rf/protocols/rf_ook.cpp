@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+//
+// Part of Bruce (AGPL-3.0-or-later). This file contains code DERIVED FROM and
+// modified after rc-switch (LGPL-2.1-or-later), (C) 2011 Suat Ozgur and
+// contributors — the classic OOK protocol capture/decode state machine.
+// See THIRD_PARTY.md for full attribution.
+#include "rf_ook.h"
+#include "rf_config.h" // RF_DBG
+
+// ---------------------------------------------------------------------------
+// Protocol timing envelope and the opening-gap pre-filter
+// ---------------------------------------------------------------------------
+// Nominal te window of a protocol, widened like the classic receiver.
+static unsigned int rf_te_tolerance(const RfProtocolDef *pro) {
+    unsigned int teTol = pro->te * RF_NOMINAL_TE_TOLERANCE / 100;
+    return teTol < 80 ? 80 : teTol;
+}
+
+static unsigned int rf_sync_len(const RfProtocolDef *pro) {
+    return (pro->sync.low > pro->sync.high) ? pro->sync.low : pro->sync.high;
+}
+
+// Pre-filter index: opening gaps quantized to RF_GAP_BUCKET_US buckets, each
+// holding the mask of protocols whose gap envelope (sync factor x te window)
+// overlaps it. A gap then only has to be checked against 1-3 candidates
+// instead of the whole registry. Built on first use; gaps past the table
+// fall back to every protocol.
+#define RF_GAP_BUCKET_SHIFT 8 // 256 µs buckets
+#define RF_GAP_BUCKETS 128    // up to ~32.7 ms
+static uint32_t rf_gap_index[RF_GAP_BUCKETS];
+static bool rf_gap_index_ready = false;
+
+static uint32_t rf_all_protocols() {
+    int count = rf_protocol_count();
+    return (count >= RF_MAX_PROTOCOLS) ? 0xFFFFFFFFu : ((1u << count) - 1);
+}
+
+static uint32_t rf_gap_candidates(unsigned int gap) {
+    int count = rf_protocol_count();
+    if (!rf_gap_index_ready) {
+        for (int p = 0; p < count; p++) {
+            const RfProtocolDef *pro = rf_protocol_at(p);
+            unsigned int syncLen = rf_sync_len(pro);
+            if (syncLen == 0) continue;
+            unsigned int teTol = rf_te_tolerance(pro);
+            unsigned int teMin = pro->te > teTol ? pro->te - teTol : 0;
+            // delay = gap / syncLen lands in [teMin, te + teTol]
+            unsigned int lo = syncLen * teMin;
+            unsigned int hi = syncLen * (pro->te + teTol + 1) - 1;
+            for (unsigned int b = lo >> RF_GAP_BUCKET_SHIFT;
+                 b <= (hi >> RF_GAP_BUCKET_SHIFT) && b < RF_GAP_BUCKETS; b++)
+                rf_gap_index[b] |= 1u << p;
+        }
+        rf_gap_index_ready = true;
+    }
+    unsigned int b = gap >> RF_GAP_BUCKET_SHIFT;
+    return (b < RF_GAP_BUCKETS) ? rf_gap_index[b] : rf_all_protocols();
+}
+
+// ---------------------------------------------------------------------------
+// OOK decode (faithful port of the classic receiveProtocol state machine)
+// ---------------------------------------------------------------------------
+static bool rf_match_protocol(
+    const RfProtocolDef *pro, unsigned int changeCount, const unsigned int *timings, RfOokFrame &out
+) {
+    if (pro == nullptr) return false;
+    uint64_t code = 0;
+    // The longer sync factor maps to the captured inter-frame gap in timings[0].
+    unsigned int syncLen = rf_sync_len(pro);
+    if (syncLen == 0) return false;
+    unsigned int delay = timings[0] / syncLen;
+    if (delay == 0) return false;
+    if (rf_udiff_u(delay, pro->te) > rf_te_tolerance(pro)) return false;
+
+    unsigned int tol = delay * RF_RECEIVE_TOLERANCE / 100;
+    // Protocols that start high have their first data timing filtered out.
+    unsigned int first = pro->inverted ? 2 : 1;
+
+    for (unsigned int i = first; i + 1 < changeCount; i += 2) {
+        code <<= 1;
+        if (rf_udiff(timings[i], delay * pro->zero.high) < tol &&
+            rf_udiff(timings[i + 1], delay * pro->zero.low) < tol) {
+            // zero bit
+        } else if (rf_udiff(timings[i], delay * pro->one.high) < tol &&
+                   rf_udiff(timings[i + 1], delay * pro->one.low) < tol) {
+            code |= 1; // one bit
+        } else {
+            return false;
+        }
+    }
+
+    if (changeCount > 7) { // ignore very short bursts: that would be noise
+        int nbits = (changeCount - 1) / 2;
+        // Fixed-length protocols only match a frame of exactly their length. This
+        // keeps a 12-bit CAME frame from being claimed by a longer/shorter code
+        // with otherwise-compatible timings (the M3 cross-match ambiguity).
+        if ((pro->flags & RF_PF_FIXED_LEN) && nbits != pro->bits) return false;
+        out.key = code;
+        out.bits = nbits;
+        out.te = delay;
+        out.pro = pro;
+        return true;
+    }
+    return false;
+}
+
+bool rf_ook_decode(const std::vector<int> &durations, RfOokFrame &out, bool indexed, uint32_t *trials) {
+    unsigned int timings[RF_MAX_CHANGES];
+    unsigned int changeCount = 0;
+    unsigned int repeatCount = 0;
+
+    for (int d : durations) {
+        unsigned int dur = (d < 0) ? (unsigned int)(-d) : (unsigned int)d;
+
+        if (dur > RF_SEPARATION_LIMIT) {
+            // A long stretch without a level change: likely the gap between two
+            // repeated transmissions. Two similar gaps bracket a full frame.
+            if (repeatCount == 0 || rf_udiff(dur, timings[0]) < 200) {
+                repeatCount++;
+                if (repeatCount == 2) {
+                    RF_DBG("decode attempt: changeCount=%u gap=%u", changeCount, dur);
+                    // Only the protocols whose timing can produce the opening gap;
+                    // registry order breaks ties.
+                    uint32_t m = indexed ? rf_gap_candidates(timings[0]) : rf_all_protocols();
+                    for (; m; m &= m - 1) {
+                        if (trials) (*trials)++;
+                        const RfProtocolDef *pro = rf_protocol_at(__builtin_ctz(m));
+                        if (rf_match_protocol(pro, changeCount, timings, out)) return true;
+                    }
+                    RF_DBG("decode: no protocol matched (changeCount=%u)", changeCount);
+                    repeatCount = 0;
+                }
+            }
+            changeCount = 0;
+        }
+
+        if (changeCount >= RF_MAX_CHANGES) {
+            changeCount = 0;
+            repeatCount = 0;
+        }
+        timings[changeCount++] = dur;
+    }
+
+    return false;
+}
@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+//
+// Part of Bruce (AGPL-3.0-or-later). This file contains code DERIVED FROM and
+// modified after rc-switch (LGPL-2.1-or-later), (C) 2011 Suat Ozgur and
+// contributors — the classic OOK protocol capture/decode state machine.
+// See THIRD_PARTY.md for full attribution.
+#pragma once
+
+#include "rf_registry.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <vector>
+
+// Generic OOK decode over the protocol registry. No Arduino dependencies so the
+// replay harness (tools/ook_replay.cpp) builds it natively; rf_decoder wraps the
+// result into RfCodes.
+
+// --- Decode tuning (mirrors the classic OOK receiver) ----------------------
+#define RF_SEPARATION_LIMIT 4300 // µs: a longer low is treated as an inter-frame gap
+#define RF_RECEIVE_TOLERANCE 60  // % tolerance on pulse-length matching
+#define RF_NOMINAL_TE_TOLERANCE 20
+#define RF_MAX_CHANGES 131       // max transitions kept per frame
+
+static inline unsigned int rf_udiff(int a, int b) { return (unsigned int)abs(a - b); }
+static inline unsigned int rf_udiff_u(unsigned int a, unsigned int b) {
+    return (a > b) ? (a - b) : (b - a);
+}
+
+// One decoded OOK frame.
+struct RfOokFrame {
+    uint64_t key = 0;
+    int bits = 0;
+    int te = 0;
+    const RfProtocolDef *pro = nullptr;
+};
+
+// Whole-capture decoder: two similar gaps bracket a frame of at most
+// RF_MAX_CHANGES transitions, then the protocols the opening gap admits are
+// tried over the buffered timings (registry order breaks ties). `indexed` =
+// false tries the whole registry instead (the replay harness checks both
+// agree); `trials` (optional) is incremented per protocol tried.
+bool rf_ook_decode(
+    const std::vector<int> &durations, RfOokFrame &out, bool indexed = true, uint32_t *trials = nullptr
+);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "rf_protocol.h"
+#include <Arduino.h> // String
 
 // Radio preset registry. Single place where the `.sub` "Preset:" names map
 // to concrete transceiver parameters.
@@ -1,6 +1,5 @@
 #pragma once
 
-#include "../structs.h" // HighLow
 #include <stdint.h>
 
 // Single source of truth for static OOK protocol definitions and radio
@@ -23,6 +22,12 @@ struct RfPreset {
                           //  irrelevant for FSK/MSK/GFSK presets)
 };
 
+// Pulse as multiples of a protocol's `te`: HIGH for `high`, LOW for `low`.
+struct HighLow {
+    uint8_t high; // 1
+    uint8_t low;  // 31
+};
+
 // ---------------------------------------------------------------------------
 // Static OOK protocol definition. Timings follow the classic factor model:
 // every pulse is a multiple of `te` µs, expressed as {high, low} counts.
@@ -61,7 +61,18 @@ static const RfProtocolDef rf_protocols[] = {
 #undef FIXED
 
 static const int rf_protocols_count = sizeof(rf_protocols) / sizeof(rf_protocols[0]);
+static_assert(
+    sizeof(rf_protocols) / sizeof(rf_protocols[0]) <= RF_MAX_PROTOCOLS, "registry exceeds RF_MAX_PROTOCOLS"
+);
 
+const RfProtocolDef *rf_protocol_at(int index) {
+    if (index < 0 || index >= rf_protocols_count) return nullptr;
+    return &rf_protocols[index];
+}
+
+int rf_protocol_count() { return rf_protocols_count; }
+
+#ifdef ARDUINO
 // Flipper Zero protocol name <-> Bruce canonical registry name. Only the entries
 // that differ in spelling are listed; names that already match (Princeton, CAME,
 // Linear, Clemsa, Mastercode, Ansonic, GateTX, Holtek, KeeLoq...) need no alias.
@@ -112,10 +123,4 @@ const RfProtocolDef *rf_protocol_for_number(int proto_no) {
     if (p) return p;
     return rf_find_protocol("RcSwitch_1"); // safe default (never null)
 }
-
-const RfProtocolDef *rf_protocol_at(int index) {
-    if (index < 0 || index >= rf_protocols_count) return nullptr;
-    return &rf_protocols[index];
-}
-
-int rf_protocol_count() { return rf_protocols_count; }
+#endif
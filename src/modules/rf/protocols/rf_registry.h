@@ -11,6 +11,16 @@
 // Static OOK protocol registry. Lookup + iteration used by the decoder (M2)
 // and the replay dispatch (M3).
 
+// The streaming decoder tracks candidate protocols in a 32-bit mask.
+#define RF_MAX_PROTOCOLS 32
+
+// Iteration helpers (e.g. for the generic decoder to try every protocol).
+const RfProtocolDef *rf_protocol_at(int index);
+int rf_protocol_count();
+
+#ifdef ARDUINO
+#include <Arduino.h> // String
+
 // Find a protocol definition by name. Flipper Zero protocol names (as written in
 // standard `.sub` files, e.g. "Nice FLO", "Holtek_HT12X", "Phoenix_V2") are
 // accepted and resolved to the canonical registry entry. Returns nullptr if none.
@@ -27,7 +37,4 @@ String rf_flipper_protocol_name(const String &canonical);
 // transmit contract is external and must survive removal of the legacy module.
 // Falls back to RcSwitch_1 for unknown numbers; never returns nullptr.
 const RfProtocolDef *rf_protocol_for_number(int proto_no);
-
-// Iteration helpers (e.g. for the generic decoder to try every protocol).
-const RfProtocolDef *rf_protocol_at(int index);
-int rf_protocol_count();
+#endif
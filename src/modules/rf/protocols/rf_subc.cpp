@@ -0,0 +1,115 @@
+#include "rf_subc.h"
+
+#if RF_SUB_TX_CACHE
+
+String rf_subc_path(const String &subPath) { return subPath + "c"; }
+
+// Size + last write of the source `.sub` (the cache key).
+static bool rf_subc_stamp(FS *fs, const String &subPath, uint32_t &size, uint32_t &mtime) {
+    File f = fs->open(subPath, FILE_READ);
+    if (!f) return false;
+    size = f.size();
+    mtime = (uint32_t)f.getLastWrite();
+    f.close();
+    return true;
+}
+
+static bool rf_subc_read_header(File &f, RfSubcHeader &hdr) {
+    return f.read((uint8_t *)&hdr, sizeof(hdr)) == sizeof(hdr) && hdr.magic == RF_SUBC_MAGIC &&
+           hdr.version == RF_SUBC_VERSION;
+}
+
+bool rf_subc_fresh(FS *fs, const String &subPath, int repeat) {
+    if (!fs) return false;
+    uint32_t size, mtime;
+    if (!rf_subc_stamp(fs, subPath, size, mtime)) return false;
+
+    File f = fs->open(rf_subc_path(subPath), FILE_READ);
+    if (!f) return false;
+    RfSubcHeader hdr;
+    bool ok = rf_subc_read_header(f, hdr);
+    f.close();
+    return ok && hdr.src_size == size && hdr.src_mtime == mtime && hdr.repeat == (uint16_t)repeat;
+}
+
+bool RfSubcWriter::begin(FS *fs, const String &subPath, int repeat) {
+    abort();
+    // RAM-backed temporary files (serial / JSON transmit) are read only once.
+    if (!fs || subPath.indexOf("tmpramfile") >= 0) return false;
+
+    _hdr = {};
+    _hdr.version = RF_SUBC_VERSION;
+    _hdr.repeat = (uint16_t)repeat;
+    if (!rf_subc_stamp(fs, subPath, _hdr.src_size, _hdr.src_mtime)) return false;
+
+    _fs = fs;
+    _path = rf_subc_path(subPath);
+    _f = fs->open(_path, FILE_WRITE);
+    if (!_f || _f.write((const uint8_t *)&_hdr, sizeof(_hdr)) != sizeof(_hdr)) { // magic still 0
+        abort();
+        return false;
+    }
+    return true;
+}
+
+bool RfSubcWriter::add(const std::vector<rmt_symbol_word_t> &syms) {
+    if (!_f) return false;
+    uint32_t n = syms.size();
+    size_t bytes = n * sizeof(rmt_symbol_word_t);
+    if (_f.write((const uint8_t *)&n, sizeof(n)) != sizeof(n) ||
+        _f.write((const uint8_t *)syms.data(), bytes) != bytes) {
+        abort();
+        return false;
+    }
+    _hdr.frames++;
+    return true;
+}
+
+bool RfSubcWriter::finish() {
+    if (!_f) return false;
+    _hdr.magic = RF_SUBC_MAGIC;
+    bool ok = _f.seek(0) && _f.write((const uint8_t *)&_hdr, sizeof(_hdr)) == sizeof(_hdr);
+    _f.close();
+    if (!ok) {
+        abort();
+        return false;
+    }
+    _fs = nullptr;
+    return true;
+}
+
+void RfSubcWriter::abort() {
+    if (_f) _f.close();
+    if (_fs) _fs->remove(_path);
+    _fs = nullptr;
+}
+
+bool RfSubcReader::open(FS *fs, const String &subPath, int repeat) {
+    close();
+    if (!rf_subc_fresh(fs, subPath, repeat)) return false;
+    _f = fs->open(rf_subc_path(subPath), FILE_READ);
+    if (!_f || !rf_subc_read_header(_f, _hdr)) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool RfSubcReader::next(std::vector<rmt_symbol_word_t> &syms) {
+    if (!_f || _read >= _hdr.frames) return false;
+    uint32_t n = 0;
+    if (_f.read((uint8_t *)&n, sizeof(n)) != sizeof(n) || n == 0 || n > RF_SUBC_MAX_SYMBOLS) return false;
+    syms.resize(n);
+    size_t bytes = n * sizeof(rmt_symbol_word_t);
+    if (_f.read((uint8_t *)syms.data(), bytes) != bytes) return false;
+    _read++;
+    return true;
+}
+
+void RfSubcReader::close() {
+    if (_f) _f.close();
+    _hdr = {};
+    _read = 0;
+}
+
+#endif // RF_SUB_TX_CACHE
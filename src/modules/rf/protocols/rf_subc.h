@@ -0,0 +1,81 @@
+#pragma once
+
+#include "rf_config.h"
+
+#if RF_SUB_TX_CACHE
+
+#include "../structs.h"
+#include <FS.h>
+#include <vector>
+
+// ===========================================================================
+// Pre-compiled `.sub` transmit cache.
+//
+// `<file>.subc` (next to the source) holds every code of `<file>` already
+// packed as RMT symbols, so a replay streams the frames straight into an
+// RfTxStream instead of parsing and encoding each code between transmissions.
+//
+// Layout (native little endian):
+//   RfSubcHeader
+//   per frame: uint32_t symbol count, then rmt_symbol_word_t[count]
+//
+// The header records the size/mtime of the `.sub` it was compiled from and
+// the repeat count baked into the frames; any mismatch makes it stale and it
+// is rebuilt on the next transmission. The magic is written last, so an
+// interrupted compile never looks valid.
+// ===========================================================================
+
+#define RF_SUBC_MAGIC 0x43425553 // "SUBC"
+#define RF_SUBC_VERSION 1
+#define RF_SUBC_MAX_SYMBOLS 65536 // per-frame sanity bound when reading
+
+struct RfSubcHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t repeat;    // repeat count the protocol frames were encoded with
+    uint32_t src_size;  // `.sub` size at compile time
+    uint32_t src_mtime; // `.sub` last write at compile time
+    uint32_t frames;
+};
+
+// Cache path of a `.sub` file ("/BruceRF/x.sub" -> "/BruceRF/x.subc").
+String rf_subc_path(const String &subPath);
+
+// True when the cache of `subPath` exists and was compiled from the current
+// file with the same `repeat`.
+bool rf_subc_fresh(FS *fs, const String &subPath, int repeat);
+
+// Builds the cache frame by frame (in transmit order). Nothing is valid until
+// finish(); abort() (or a failed add) removes the partial file.
+class RfSubcWriter {
+public:
+    ~RfSubcWriter() { abort(); }
+    // Fails on volatile paths (/tmpramfile) and unwritable filesystems.
+    bool begin(FS *fs, const String &subPath, int repeat);
+    bool add(const std::vector<rmt_symbol_word_t> &syms);
+    bool finish();
+    void abort();
+
+private:
+    FS *_fs = nullptr;
+    String _path;
+    File _f;
+    RfSubcHeader _hdr = {};
+};
+
+// Streams the frames of a fresh cache back.
+class RfSubcReader {
+public:
+    bool open(FS *fs, const String &subPath, int repeat);
+    uint32_t frames() const { return _hdr.frames; }
+    // Read the next frame into `syms`; false at the end or on a corrupt file.
+    bool next(std::vector<rmt_symbol_word_t> &syms);
+    void close();
+
+private:
+    File _f;
+    RfSubcHeader _hdr = {};
+    uint32_t _read = 0;
+};
+
+#endif // RF_SUB_TX_CACHE
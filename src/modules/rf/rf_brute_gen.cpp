@@ -0,0 +1,93 @@
+#include "rf_brute_gen.h"
+#include <stdlib.h>
+
+static inline IRAM_ATTR rmt_symbol_word_t brute_symbol(const int *pair) {
+    rmt_symbol_word_t s = {};
+    s.level0 = pair[0] > 0;
+    s.duration0 = abs(pair[0]);
+    s.level1 = pair[1] > 0;
+    s.duration1 = abs(pair[1]);
+    return s;
+}
+
+size_t IRAM_ATTR brute_gen(rmt_symbol_word_t *out, size_t max, bool restart, void *ctx) {
+    BruteGen &g = *static_cast<BruteGen *>(ctx);
+    const BruteProtocol &p = g.proto;
+    const bool pilot = p.pilot[0] || p.pilot[1];
+    if (restart) {
+        g.code = 0;
+        g.rep = 0;
+        g.part = 0;
+        g.parts = (pilot ? 1 : 0) + p.bits + ((p.stop[0] || p.stop[1]) ? 1 : 0);
+    }
+
+    size_t n = 0;
+    while (n < max && g.code < g.total) {
+        if (g.part == 0 && g.rep == 0 && g.stop) break;
+
+        int k = g.part - (pilot ? 1 : 0);
+        const int *pair;
+        if (k < 0) pair = p.pilot;
+        else if (k < p.bits) pair = ((g.code >> (p.bits - 1 - k)) & 1) ? p.one : p.zero;
+        else pair = p.stop;
+        out[n++] = brute_symbol(pair);
+
+        if (++g.part == g.parts) {
+            g.part = 0;
+            if (++g.rep == g.repeats) {
+                g.rep = 0;
+                g.code = g.code + 1;
+            }
+        }
+    }
+    return n;
+}
+
+uint32_t brute_code_us(const BruteProtocol &p, int repeats) {
+    // Over a full sweep half of all bits are ones: average the two bit lengths.
+    uint32_t us = abs(p.pilot[0]) + abs(p.pilot[1]) + abs(p.stop[0]) + abs(p.stop[1]);
+    us += p.bits * (abs(p.zero[0]) + abs(p.zero[1]) + abs(p.one[0]) + abs(p.one[1])) / 2;
+    return us * repeats;
+}
+
+const DRAM_ATTR uint8_t debruijn_bits[3][4] = {
+    {0b0, 0b1},               // binary
+    {0b00, 0b11, 0b01},       // tri-state
+    {0b00, 0b01, 0b10, 0b11}, // quaternary
+};
+
+size_t IRAM_ATTR debruijn_gen(rmt_symbol_word_t *out, size_t max, bool restart, void *ctx) {
+    DeBruijnTx &g = *static_cast<DeBruijnTx *>(ctx);
+    const BruteProtocol &p = g.proto;
+    if (restart) {
+        g.db.reset(g.k, g.n);
+        g.phase = (p.pilot[0] || p.pilot[1]) ? 0 : 1;
+        g.left = 0;
+        g.sent = 0;
+    }
+
+    size_t n = 0;
+    while (n < max && g.phase < 3) {
+        if (g.phase == 0) {
+            out[n++] = brute_symbol(p.pilot);
+            g.phase = 1;
+        } else if (g.phase == 1) {
+            if (g.left == 0) {
+                int sym = g.stop ? -1 : g.db.next();
+                if (sym < 0) {
+                    g.phase = 2;
+                    continue;
+                }
+                g.group = debruijn_bits[g.k - 2][sym];
+                g.left = debruijn_bps(g.k);
+                g.sent = g.sent + 1;
+            }
+            g.left--;
+            out[n++] = brute_symbol(((g.group >> g.left) & 1) ? p.one : p.zero);
+        } else {
+            if (p.stop[0] || p.stop[1]) out[n++] = brute_symbol(p.stop);
+            g.phase = 3;
+        }
+    }
+    return n;
+}
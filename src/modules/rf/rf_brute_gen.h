@@ -0,0 +1,133 @@
+#pragma once
+
+#include "rf_bruteforce.h" // BruteProtocol
+#include <stddef.h>
+#include <stdint.h>
+
+// RMT symbol generators for the brute-force sweeps, fed to
+// RfTxStream::queue_generated. No Arduino dependencies so the host test
+// (tools/brute_gen_test.cpp) drains them natively.
+#ifdef ARDUINO
+#include <driver/rmt_types.h>
+#include <esp_attr.h>
+#else
+#define IRAM_ATTR
+#define DRAM_ATTR
+typedef union {
+    struct {
+        uint16_t duration0 : 15;
+        uint16_t level0 : 1;
+        uint16_t duration1 : 15;
+        uint16_t level1 : 1;
+    };
+    uint32_t val;
+} rmt_symbol_word_t;
+#endif
+
+// Keyspace sweep as an RMT symbol stream. Every {duration1, duration2} pair of
+// the former bit-banged sequence (pilot, data bits MSB first, stop; each code
+// `repeats` times) is exactly one RMT symbol, so the sweep is synthesized on
+// the fly from the TX interrupt while the CPU stays free for UI and ESC.
+// Everything the generators touch is in IRAM/DRAM (the protocol is copied out
+// of the flash table), so they keep running with CONFIG_RMT_ISR_IRAM_SAFE
+// while the flash cache is off.
+struct BruteGen {
+    BruteProtocol proto;
+    int repeats;
+    int total;          // codes to send (1 << bits for a full sweep)
+    volatile int code;  // code being sent (progress)
+    volatile bool stop; // end at the next frame boundary
+    int rep;
+    int part;           // pair index within the frame
+    int parts;          // pilot? + bits + stop?
+};
+
+size_t brute_gen(rmt_symbol_word_t *out, size_t max, bool restart, void *ctx);
+
+// Air time of one code (all repeats), in µs.
+uint32_t brute_code_us(const BruteProtocol &p, int repeats);
+
+// ---------------------------------------------------------------------------
+// De Bruijn mode.
+//
+// Receivers that clock bits into a sliding shift register and compare it on
+// every bit accept a code wherever it appears in a continuous bit stream. A
+// De Bruijn sequence B(k, n) contains every n-symbol word over a k-symbol
+// alphabet exactly once in k^n + n - 1 symbols, instead of n * k^n for sending
+// each code separately (12 bits: 4107 bits instead of 49152 plus syncs).
+//
+// Symbols are sent as bit groups: binary is one bit per symbol, tri-state is
+// the PT2262-style trit pair (0 = 00, 1 = 11, F = 01), quaternary two bits.
+// ---------------------------------------------------------------------------
+#define DEBRUIJN_MAX_N 24
+
+// Bit group of symbol `sym` for alphabet size `k` (2..4), and its width.
+extern const uint8_t debruijn_bits[3][4];
+static inline IRAM_ATTR int debruijn_bps(int k) { return k == 2 ? 1 : 2; }
+
+// Streaming FKM (Fredricksen-Kessler-Maiorana) generator: concatenates the
+// Lyndon words over k symbols whose length divides n, in lexicographic order,
+// then the n - 1 leading zeros that unroll the cyclic sequence. O(n) state.
+struct DeBruijn {
+    uint8_t k, n;
+    uint8_t a[DEBRUIJN_MAX_N + 1]; // 1-based working word
+    uint8_t len, pos;              // current Lyndon word a[1..len], next symbol
+    uint8_t tail;                  // trailing zeros still to emit
+    bool last;                     // no Lyndon word after the current one
+
+    IRAM_ATTR void reset(int k_, int n_) {
+        k = k_;
+        n = n_;
+        for (uint8_t &v : a) v = 0;
+        len = 1; // the first Lyndon word is "0"
+        pos = 1;
+        tail = n - 1;
+        last = false;
+    }
+
+    // Next symbol, or -1 at the end of the sequence.
+    IRAM_ATTR int next() {
+        while (pos > len) {
+            if (last) {
+                if (tail == 0) return -1;
+                tail--;
+                return 0;
+            }
+            int i = n;
+            while (i > 0 && a[i] == k - 1) i--;
+            if (i == 0) {
+                last = true;
+                continue;
+            }
+            a[i]++;
+            for (int j = i + 1; j <= n; j++) a[j] = a[j - i];
+            if (n % i == 0) {
+                len = i;
+                pos = 1;
+            }
+        }
+        return a[pos++];
+    }
+
+    // Sequence length in symbols.
+    static uint64_t length(int k, int n) {
+        uint64_t l = 1;
+        for (int i = 0; i < n; i++) l *= k;
+        return l + n - 1;
+    }
+};
+
+// RMT symbol source for a De Bruijn sweep: the pilot once, then the sequence
+// as one continuous data stream (one bit = one symbol), then the stop pulse.
+struct DeBruijnTx {
+    BruteProtocol proto;
+    DeBruijn db;
+    int k, n;
+    int phase;              // 0 pilot, 1 data, 2 stop, 3 done
+    uint8_t group;          // bit group of the current symbol
+    uint8_t left;           // bits of it still to send
+    volatile uint32_t sent; // symbols of the sequence consumed (progress)
+    volatile bool stop;     // ESC: end the data stream now
+};
+
+size_t debruijn_gen(rmt_symbol_word_t *out, size_t max, bool restart, void *ctx);
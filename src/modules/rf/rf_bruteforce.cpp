@@ -1,9 +1,14 @@
 #include "rf_bruteforce.h"
+#include "rf_brute_gen.h"
+#include "protocols/rf_encoder.h" // RfTxStream
 #include "rf_utils.h"
 
 static float brute_frequency = 433.92;
 static int brute_protocol_idx = 1; // Default: Nice
 static int brute_repeats = 1;
+static bool brute_debruijn = false; // De Bruijn stream instead of one frame per code
+static int brute_alphabet = 2;      // De Bruijn alphabet size (2, 3 or 4)
+static int brute_width = 0;         // De Bruijn window in symbols (0 = protocol width)
 
 static void rf_brute_frequency() {
     options = {};
@@ -33,14 +38,40 @@ static void rf_brute_repeats() {
     loopOptions(options, brute_repeats - 1);
 }
 
-static inline void sendPulse(int txpin, int duration) {
-    if (duration > 0) {
-        digitalWrite(txpin, HIGH);
-        delayMicroseconds(duration);
-    } else if (duration < 0) {
-        digitalWrite(txpin, LOW);
-        delayMicroseconds(-duration);
+static void rf_brute_mode() {
+    options = {
+        {"Codes",     [=]() { brute_debruijn = false; }},
+        {"De Bruijn", [=]() { brute_debruijn = true; }  },
+    };
+    loopOptions(options, brute_debruijn ? 1 : 0);
+}
+
+// Window width actually used: the menu value, or the protocol's code length
+// expressed in symbols.
+static int debruijn_width(const BruteProtocol &p) {
+    int w = brute_width ? brute_width : p.bits / debruijn_bps(brute_alphabet);
+    if (w > DEBRUIJN_MAX_N) w = DEBRUIJN_MAX_N;
+    return w < 1 ? 1 : w;
+}
+
+static void rf_brute_alphabet() {
+    options = {
+        {"Binary",     [=]() { brute_alphabet = 2; }},
+        {"Tri-state",  [=]() { brute_alphabet = 3; }},
+        {"Quaternary", [=]() { brute_alphabet = 4; }},
+    };
+    loopOptions(options, brute_alphabet - 2);
+    brute_width = 0; // back to the protocol width for the new alphabet
+}
+
+static void rf_brute_width() {
+    const BruteProtocol &proto = brute_protocols[brute_protocol_idx];
+    int maxw = proto.bits / debruijn_bps(brute_alphabet);
+    options = {};
+    for (int w = 1; w <= maxw; w++) {
+        options.push_back({String(w).c_str(), [=]() { brute_width = w; }});
     }
+    loopOptions(options, debruijn_width(proto) - 1);
 }
 
 static bool rf_brute_start() {
@@ -55,70 +86,84 @@ static bool rf_brute_start() {
     }
 
     const BruteProtocol &proto = brute_protocols[brute_protocol_idx];
-    const int total = 1 << proto.bits;
+    BruteGen gen = {};
+    gen.proto = proto;
+    gen.repeats = brute_repeats;
+    gen.total = 1 << proto.bits;
 
     pinMode(txpin, OUTPUT);
     setMHZ(brute_frequency);
 
-    for (int code = 0; code < total; ++code) {
-        for (int r = 0; r < brute_repeats; ++r) {
-            // Pilot/sync period
-            if (proto.pilot[0] || proto.pilot[1]) {
-                sendPulse(txpin, proto.pilot[0]);
-                sendPulse(txpin, proto.pilot[1]);
-            }
-
-            // Data bits (MSB first)
-            for (int j = proto.bits - 1; j >= 0; --j) {
-                const int *timings = ((code >> j) & 1) ? proto.one : proto.zero;
-                sendPulse(txpin, timings[0]);
-                sendPulse(txpin, timings[1]);
-            }
-
-            // Stop bit
-            if (proto.stop[0] || proto.stop[1]) {
-                sendPulse(txpin, proto.stop[0]);
-                sendPulse(txpin, proto.stop[1]);
-            }
-        }
-
-        if (check(EscPress)) break;
+    // The whole keyspace is one RMT transmission; this loop only reports.
+    // Progress is counted in codes, or in sequence symbols for De Bruijn.
+    DeBruijnTx dbt = {};
+    dbt.proto = proto;
+    dbt.k = brute_alphabet;
+    dbt.n = debruijn_width(proto);
+    uint32_t total = gen.total;
+    uint32_t unit_us = brute_code_us(proto, brute_repeats);
+    if (brute_debruijn) {
+        total = DeBruijn::length(dbt.k, dbt.n);
+        unit_us = debruijn_bps(dbt.k) * (abs(proto.zero[0]) + abs(proto.zero[1]) + abs(proto.one[0]) +
+                                         abs(proto.one[1])) / 2;
+    }
 
-        if (code % 10 == 0) {
-            displayRedStripe(
-                String(code) + "/" + String(total) + " " + proto.name,
-                getComplementaryColor2(bruceConfig.priColor),
-                bruceConfig.priColor
-            );
-        }
+    RfTxStream tx;
+    bool queued = tx.begin() && (brute_debruijn ? tx.queue_generated(debruijn_gen, &dbt)
+                                                : tx.queue_generated(brute_gen, &gen));
+    while (queued && !tx.idle()) {
+        if (check(EscPress)) gen.stop = dbt.stop = true;
+        uint32_t done = brute_debruijn ? dbt.sent : gen.code;
+        uint32_t left_s = (uint64_t)(total - done) * unit_us / 1000000;
+        displayRedStripe(
+            String(done) + "/" + String(total) + " " + proto.name + " " + String(left_s) + "s",
+            getComplementaryColor2(bruceConfig.priColor),
+            bruceConfig.priColor
+        );
+        vTaskDelay(pdMS_TO_TICKS(100));
     }
+    tx.end();
 
     digitalWrite(txpin, LOW);
     deinitRfModule();
-    return true;
+    if (!queued) displayError("RF transmit failed", true);
+    return queued;
 }
 
 void rf_bruteforce() {
     while (true) {
         const BruteProtocol &proto = brute_protocols[brute_protocol_idx];
         int option = 0;
+        static const char *alphabets[] = {"Binary", "Tri-state", "Quaternary"};
         options = {
             {"Start", [&]() { option = 4; }},
             {"Frequency: " + String(brute_frequency, 2), [&]() { option = 1; }},
             {String("Protocol: ") + proto.name, [&]() { option = 2; }},
-            {"Repeats: " + String(brute_repeats), [&]() { option = 3; }},
-            {"Main Menu", [&]() { option = 5; }},
+            {String("Mode: ") + (brute_debruijn ? "De Bruijn" : "Codes"), [&]() { option = 6; }},
         };
+        if (brute_debruijn) {
+            options.push_back({String("Alphabet: ") + alphabets[brute_alphabet - 2], [&]() { option = 7; }});
+            options.push_back({"Width: " + String(debruijn_width(proto)), [&]() { option = 8; }});
+        } else {
+            options.push_back({"Repeats: " + String(brute_repeats), [&]() { option = 3; }});
+        }
+        options.push_back({"Main Menu", [&]() { option = 5; }});
         loopOptions(options);
 
         switch (option) {
             case 1: rf_brute_frequency(); break;
-            case 2: rf_brute_protocol(); break;
+            case 2:
+                rf_brute_protocol();
+                brute_width = 0;
+                break;
             case 3: rf_brute_repeats(); break;
             case 4: rf_brute_start(); break;
-            case 5: return;
-            default: return; // EscPress
-        }
-        vTaskDelay(pdMS_TO_TICKS(1));
-    }
-}
+            case 6: rf_brute_mode(); break;
+            case 7: rf_brute_alphabet(); break;
+            case 8: rf_brute_width(); break;
+            case 5: return;
+            default: return; // EscPress
+        }
+        vTaskDelay(pdMS_TO_TICKS(1));
+    }
+}
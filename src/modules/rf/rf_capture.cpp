@@ -0,0 +1,51 @@
+#include "rf_capture.h"
+#include <stdlib.h>
+
+// CRC-64-ECMA constants
+const uint64_t CRC64_ECMA_POLY = 0x42F0E1EBA9EA3693; // Polynomial for CRC-64-ECMA
+const uint64_t CRC64_ECMA_INIT = 0xFFFFFFFFFFFFFFFF; // Initial value
+
+// Byte-at-a-time table (2 KB, built at compile time into flash).
+struct Crc64Table {
+    uint64_t v[256];
+};
+static constexpr Crc64Table crc64_make_table() {
+    Crc64Table t = {};
+    for (int b = 0; b < 256; b++) {
+        uint64_t crc = (uint64_t)b << 56;
+        for (int i = 0; i < 8; i++) {
+            crc = (crc & 0x8000000000000000) ? (crc << 1) ^ CRC64_ECMA_POLY : crc << 1;
+        }
+        t.v[b] = crc;
+    }
+    return t;
+}
+static constexpr Crc64Table crc64_table = crc64_make_table();
+const uint64_t *const crc64_ecma_table = crc64_table.v;
+
+// Function to compute CRC-64-ECMA
+uint64_t crc64_ecma(const std::vector<int> &data) {
+    uint64_t crc = CRC64_ECMA_INIT;
+    for (int value : data) crc = crc64_ecma_update(crc, (uint8_t)value); // the value is the high byte
+    return crc;
+}
+
+uint64_t RfCaptureRing::hash(const char *protocol, uint64_t key) {
+    // FNV-1a over the name, then mixed with the key.
+    uint64_t h = 0xCBF29CE484222325ULL;
+    for (const char *c = protocol; c && *c; c++) h = (h ^ (uint8_t)*c) * 0x100000001B3ULL;
+    return h ^ (key * 0x9E3779B97F4A7C15ULL);
+}
+
+bool RfCaptureRing::seen(uint64_t hash, int te, int bits, uint32_t now, uint32_t window_ms) {
+    for (uint8_t i = 0; i < _count; i++) {
+        const RfCaptureFingerprint &f = _fp[i];
+        if (f.hash != hash || f.bits != (uint16_t)bits || now - f.ms >= window_ms) continue;
+        int tol = f.te * RF_CAPTURE_TE_TOL / 100;
+        if (abs(te - (int)f.te) <= tol) return true;
+    }
+    _fp[_head] = {hash, now, (uint16_t)te, (uint16_t)bits};
+    _head = (_head + 1) % RF_CAPTURE_RING;
+    if (_count < RF_CAPTURE_RING) _count++;
+    return false;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+// Capture identity: the CRC-64 of a RAW capture's pulse-index sequence and a
+// ring of recent capture fingerprints for dedupe. No Arduino dependencies so
+// the host tool (tools/rf_capture_bench.cpp) builds it natively.
+
+// CRC-64-ECMA (MSB first, one byte per value), table driven so it can be
+// folded in as values arrive: start from CRC64_ECMA_INIT and call
+// crc64_ecma_update() per value. crc64_ecma() is the one-shot form.
+extern const uint64_t CRC64_ECMA_INIT;
+extern const uint64_t *const crc64_ecma_table;
+static inline uint64_t crc64_ecma_update(uint64_t crc, uint8_t value) {
+    return crc64_ecma_table[(crc >> 56) ^ value] ^ (crc << 8);
+}
+uint64_t crc64_ecma(const std::vector<int> &data);
+
+// Fixed-size ring of recent capture fingerprints (protocol+key hash, te, bit
+// count) for dedupe without copying RfCodes or touching the heap.
+#define RF_CAPTURE_RING 8
+#define RF_CAPTURE_TE_TOL 25 // % te difference still treated as the same capture
+
+struct RfCaptureFingerprint {
+    uint64_t hash;
+    uint32_t ms; // when it was recorded
+    uint16_t te;
+    uint16_t bits;
+};
+
+class RfCaptureRing {
+public:
+    // Hash of a capture's identity: protocol name and key/CRC (no allocation).
+    static uint64_t hash(const char *protocol, uint64_t key);
+    // True when a matching fingerprint was recorded less than `window_ms` ago;
+    // otherwise records this one (evicting the oldest) and returns false.
+    bool seen(uint64_t hash, int te, int bits, uint32_t now, uint32_t window_ms);
+    void clear() { _count = 0; }
+
+private:
+    RfCaptureFingerprint _fp[RF_CAPTURE_RING];
+    uint8_t _head = 0; // next slot to write
+    uint8_t _count = 0;
+};
@@ -150,16 +150,18 @@ void RFScan::init_freqs() {
 }
 
 bool RFScan::fast_scan() {
-
-    if (idx < range_limits[bruceConfigPins.rfScanRange][0] ||
-        idx > range_limits[bruceConfigPins.rfScanRange][1]) {
-        idx = range_limits[bruceConfigPins.rfScanRange][0];
-    }
+    _hop.range(range_limits[bruceConfigPins.rfScanRange][0], range_limits[bruceConfigPins.rfScanRange][1]);
+    uint8_t reads = 1;
+    int idx = _hop.next(reads);
     float checkFrequency = subghz_frequency_list[idx];
-    setMHZ(checkFrequency);
+    rf_hop_tune(idx);
     tft.drawPixel(0, 0, 0); // To make sure CC1101 shared with TFT works properly
-    vTaskDelay(5 / portTICK_PERIOD_MS);
-    rssi = ELECHOUSE_cc1101.getRssi();
+    rssi = -120;
+    for (uint8_t r = 0; r < reads; r++) { // longer dwell on recently active channels
+        vTaskDelay(5 / portTICK_PERIOD_MS);
+        rssi = max(rssi, ELECHOUSE_cc1101.getRssi());
+    }
+    _hop.report(idx, rssi, rssiThreshold);
     if (rssi > rssiThreshold) {
         _freqs[_try].freq = checkFrequency;
         _freqs[_try].rssi = rssi;
@@ -181,38 +183,28 @@ bool RFScan::fast_scan() {
             return true;
         }
     }
-    ++idx;
     return false;
 }
 
 void keeloq_identify(RfCodes &instance) {
-    // A null fs is fine: the keystore falls back to the encrypted built-in keys.
-    KeeloqKeystore keystore{keeloq_mfcodes_fs()};
+    // Process-lifetime keystore: only reloaded when /mfcodes changes. With no
+    // file it holds the encrypted built-in keys.
+    const KeeloqKeystore &keystore = keeloq_keystore();
 
     // Secure/Erreka need a seed; mirror the reference fallback to the
     // serial-derived seed when none was captured from the frame.
     uint32_t seed_eff = instance.seed ? instance.seed : (instance.fix & 0x0FFFFFFF);
 
-    for (const auto &key : keystore.get_keys()) {
-        // Unified derivation: every learning type turns (fix, seed, key) into the
-        // manufacturer key, then we decrypt the captured `encrypted` with it.
-        uint64_t man = keeloq_derive_man(key.type, instance.fix, seed_eff, key.key);
-        uint64_t decrypt = keeloq_decrypt(instance.encrypted, man);
-
-        if (key.mf_name == "Centurion") {
-            if (instance.keeloq_check_decrypt_centurion(decrypt)) {
-                instance.mf_name = key.mf_name;
-                instance.hop = decrypt;
-                return;
-            }
-        }
+    // Every learning type turns (fix, seed, key) into the manufacturer key and
+    // decrypts the captured `encrypted` with it; the search runs that for 32
+    // keys per bitsliced pass, split across both cores for large keystores.
+    KeeloqMatch m =
+        keeloq_search(keystore, instance.fix, seed_eff, instance.encrypted, instance.btn, instance.serial);
+    if (m.index < 0) return;
 
-        if (instance.keeloq_check_decrypt(decrypt)) {
-            instance.mf_name = key.mf_name;
-            instance.hop = decrypt;
-            return;
-        }
-    }
+    instance.mf_name = keystore.mf_name(keystore.get_keys()[m.index].mf_id);
+    instance.hop = m.hop;
+    instance.cnt = m.hop & 0xFFFF;
 }
 
 // Try to decode a KeeLoq frame and resolve its manufacturer. On success fills
@@ -266,13 +258,12 @@ bool RFScan::decode_signal(const std::vector<int> &durations) {
     }
 
     if (bruceConfigPins.rfModule == M5_RF_MODULE) {
-        String _data;
         bool hasCrc = false;
         uint64_t crc = 0;
         std::vector<int> indexed_durations;
         int rawBits = 0;
         int rawTe = 0;
-        rf_build_raw(durations, _data, hasCrc, crc, indexed_durations, rawBits, rawTe);
+        rf_raw_stats(durations, hasCrc, crc, indexed_durations, rawBits, rawTe);
         RF_DBG("m5 scan discard: crc=%d bits=%d te=%d", (int)hasCrc, rawBits, rawTe);
     }
     return false;
@@ -288,16 +279,15 @@ bool RFScan::read_raw(const std::vector<int> &durations) {
     received.mf_name = "Unknown";
     received.encrypted = 0;
 
-    // Build the RAW representation (durations string + optional CRC).
-    String _data;
+    // Fingerprint the capture (te + optional CRC); the RAW data string is only
+    // built once the capture is kept, so discarded noise costs no heap.
     bool hasCrc = false;
     uint64_t crc = 0;
     std::vector<int> indexed_durations;
     int rawBits = 0;
     int rawTe = 0;
-    rf_build_raw(durations, _data, hasCrc, crc, indexed_durations, rawBits, rawTe);
+    rf_raw_stats(durations, hasCrc, crc, indexed_durations, rawBits, rawTe);
 
-    received.data = _data;
     received.te = rawTe;
     received.filepath = "signal_" + String(signals);
     received.frequency = long(frequency * 1000000);
@@ -309,6 +299,7 @@ bool RFScan::read_raw(const std::vector<int> &durations) {
         Serial.println("Decoded signal captured: " + received.protocol);
         blinkLed();
         ++signals;
+        rf_raw_string(durations, received.data);
         received.indexed_durations = {};
 
         frequency = 0;
@@ -332,13 +323,14 @@ bool RFScan::read_raw(const std::vector<int> &durations) {
         received.preset = "Ook270Async";
         received.protocol = "RAW";
         received.key = crc;
+        received.Bit = rawBits;
         if (is_m5_duplicate_capture(received)) return false;
 
         Serial.println("Raw signal captured");
         blinkLed();
         ++signals;
+        rf_raw_string(durations, received.data);
         received.indexed_durations = indexed_durations;
-        received.Bit = rawBits;
         frequency = 0;
         display_info(received, signals, ReadRAW, codesOnly, autoSave, title);
         return true;
@@ -352,6 +344,7 @@ bool RFScan::read_raw(const std::vector<int> &durations) {
         Serial.println("Raw data captured");
         blinkLed();
         ++signals;
+        rf_raw_string(durations, received.data);
         received.preset = "Ook270Async";
         received.protocol = "RAW";
         received.key = 0;
@@ -367,22 +360,13 @@ bool RFScan::read_raw(const std::vector<int> &durations) {
 bool RFScan::is_m5_duplicate_capture(const RfCodes &data) {
     if (bruceConfigPins.rfModule != M5_RF_MODULE) return false;
 
-    unsigned long now = millis();
-    bool duplicate = data.key == lastM5CaptureKey && data.protocol == lastM5CaptureProtocol &&
-                     now - lastM5CaptureMs < RF_M5_SCAN_DUPLICATE_MS;
-    if (duplicate) {
+    uint64_t hash = RfCaptureRing::hash(data.protocol.c_str(), data.key);
+    if (m5Captures.seen(hash, data.te, data.Bit, millis(), RF_M5_SCAN_DUPLICATE_MS)) {
         RF_DBG(
-            "m5 duplicate ignored: proto=%s key=%llX age=%lums",
-            data.protocol.c_str(),
-            (unsigned long long)data.key,
-            now - lastM5CaptureMs
+            "m5 duplicate ignored: proto=%s key=%llX", data.protocol.c_str(), (unsigned long long)data.key
         );
         return true;
     }
-
-    lastM5CaptureKey = data.key;
-    lastM5CaptureProtocol = data.protocol;
-    lastM5CaptureMs = now;
     return false;
 }
 
@@ -836,18 +820,17 @@ String rfReceiveSignal(float frequency, int max_loops, bool raw, bool headless)
             bool decoded =
                 (!raw) && (rf_try_keeloq(durations, received) || rf_decode_ook(durations, received));
 
-            // Build the RAW representation (also the data string when decoded).
-            String _data;
+            // RAW fingerprint; the data string is built only for kept captures.
             bool hasCrc = false;
             uint64_t crc = 0;
             std::vector<int> indexed;
             int rawBits = 0, rawTe = 0;
-            int transitions = rf_build_raw(durations, _data, hasCrc, crc, indexed, rawBits, rawTe);
+            int transitions = rf_raw_stats(durations, hasCrc, crc, indexed, rawBits, rawTe);
 
             if (decoded) {
                 received.frequency = long(frequency * 1000000);
                 received.filepath = "unsaved";
-                received.data = _data;
+                rf_raw_string(durations, received.data);
                 decimalToHexString(received.key, hexString);
                 // Interactive: draw on screen. Headless (CLI): emit the same
                 // formatted info on Serial instead of the display.
@@ -858,7 +841,7 @@ String rfReceiveSignal(float frequency, int max_loops, bool raw, bool headless)
                 received.protocol = "RAW";
                 received.preset = "Ook270Async";
                 received.te = rawTe;
-                received.data = _data;
+                rf_raw_string(durations, received.data);
                 received.filepath = "unsaved";
                 display_info(received, 1, raw, false, false, "", headless);
             } else {
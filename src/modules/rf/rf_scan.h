@@ -39,9 +39,7 @@ private:
     String title = "RF Scan Copy";
     bool restartScan = false;
     bool exitRequested = false;
-    uint64_t lastM5CaptureKey = 0;
-    String lastM5CaptureProtocol = "";
-    unsigned long lastM5CaptureMs = 0;
+    RfCaptureRing m5Captures; // recent M5 captures, for dedupe
     bool ReadRAW = true;
     bool codesOnly = false;
     bool autoSave = false;
@@ -50,7 +48,7 @@ private:
     float frequency = 0.f;
     uint8_t _try = 0;
     FreqFound _freqs[_MAX_TRIES]; // get the best RSSI out of 5 tries
-    int idx = range_limits[bruceConfigPins.rfScanRange][0];
+    RfHopScheduler _hop; // which channel fast_scan() checks next, and for how long
     float found_freq = 0.f;
     int rssi = -80;
     int rssiThreshold = -65;
@@ -90,6 +88,10 @@ void display_signal_data(RfCodes received, bool headless = false);
 
 bool rfSaveSignal(float frequency, RfCodes codes, bool raw, char *key, bool autoSave = false);
 
+// Resolve the manufacturer of a decoded KeeLoq frame against the cached
+// keystore; sets mf_name/hop/cnt on a match.
+void keeloq_identify(RfCodes &instance);
+
 String rf_scan(float start_freq, float stop_freq, int max_loops = -1);
 String rfReceiveSignal(float frequency = 0, int max_loops = -1, bool raw = false, bool headless = false);
 
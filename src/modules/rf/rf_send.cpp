@@ -6,6 +6,7 @@
 #include "protocols/rf_legacy_migrate.h"
 #include "protocols/rf_presets.h"
 #include "protocols/rf_registry.h"
+#include "protocols/rf_subc.h"
 #include "rf_utils.h"
 
 #define CLOSE_MENU 3
@@ -21,6 +22,15 @@ uint8_t num_signal_repeat = 4;
 String filepath = "";
 FS *filesystem = NULL;
 
+#if RF_SUB_TX_CACHE
+// Source of the codes read by the last readSubFile(), for the transmit cache.
+static FS *subFs = NULL;
+static String subPath = "";
+static bool subCached = false; // fresh `.subc`: code lines were not loaded
+#endif
+
+static bool rfTxSetup(const String &preset, uint32_t frequency, int &legacy_protocol_no);
+
 void sendCustomRF() {
     // interactive menu part only
     struct RfCodes selected_code;
@@ -255,6 +265,13 @@ bool readSubFile(FS *fs, const String &filepath, RfCodes &data) {
     Serial.println("Opened sub file.");
     selected_code.filepath = filepath.substring(1 + filepath.lastIndexOf("/"));
 
+#if RF_SUB_TX_CACHE
+    subFs = fs;
+    subPath = filepath;
+    subCached = rf_subc_fresh(fs, filepath, num_signal_repeat);
+    int cachedBitRaw = -1;
+#endif
+
     if (!databaseFile) Serial.println("Fail opening file");
     // Store the code(s) in the signal
     while (databaseFile.available()) {
@@ -276,6 +293,24 @@ bool readSubFile(FS *fs, const String &filepath, RfCodes &data) {
         if (line.startsWith("Counter:")) selected_code.cnt = txt.toInt();
         if (line.startsWith("Seed:")) selected_code.seed = (uint32_t)hexStringToU64(txt.c_str());
 
+#if RF_SUB_TX_CACHE
+        // The codes are already compiled: the lists stay empty, only the last
+        // code is kept in selected_code for the Recent entry (see subLastCode).
+        if (subCached) {
+            if (line.startsWith("Bit_RAW:")) cachedBitRaw = txt.toInt();
+            if (line.startsWith("Key:")) {
+                selected_code.key = hexStringToU64(txt.c_str());
+                if (!bitList.empty()) selected_code.Bit = bitList.back();
+            }
+            if (line.startsWith("RAW_Data:") || line.startsWith("Data_RAW:")) {
+                selected_code.data = txt;
+                if (cachedBitRaw >= 0) selected_code.Bit = cachedBitRaw;
+            }
+            if (check(EscPress)) break;
+            continue;
+        }
+#endif
+
         if (line.startsWith("Bit_RAW:"))
             bitRawList.push_back(txt.toInt()); // selected_code.BitRAW = txt.toInt();
         // Keys can exceed 32 bits (Holtek 40, Mastercode 36, PhoenixV2 52,
@@ -302,14 +337,130 @@ bool readSubFile(FS *fs, const String &filepath, RfCodes &data) {
     return true;
 }
 
+#if RF_SUB_TX_CACHE
+// Codes that encode to a fixed pulse train can be compiled ahead of time.
+// KeeLoq steps its rolling counter on every send, so it is always encoded live.
+static bool subcCacheable(const RfCodes &code) {
+    if (code.protocol == "RAW" || code.protocol == "BinRAW") return true;
+    if (code.protocol == "KeeLoq") return false;
+    return rf_find_protocol(code.protocol) != nullptr;
+}
+
+// Signed-µs pulse train of one code, exactly as sendRfCommand would send it.
+static bool subcEncode(const RfCodes &code, std::vector<int> &durs) {
+    durs.clear();
+    if (code.protocol == "RAW") {
+        const char *p = code.data.c_str();
+        char *end = nullptr;
+        while (*p) {
+            long v = strtol(p, &end, 10);
+            if (end == p) break;
+            durs.push_back((int)v);
+            p = end;
+        }
+        return !durs.empty();
+    }
+    if (code.protocol == "BinRAW") {
+        String bits = hexStrToBinStr(code.data);
+        bits.trim();
+        return rf_raw_bits_durations(bits, code.te, durs);
+    }
+    const RfProtocolDef *def = rf_find_protocol(code.protocol);
+    return rf_encode_protocol(code.key, code.Bit, code.te, def, num_signal_repeat, durs);
+}
+
+// Compile the codes loaded by readSubFile() into `<file>.subc`.
+static bool subcCompile(RfCodes code) {
+    RfSubcWriter w;
+    if (!w.begin(subFs, subPath, num_signal_repeat)) return false;
+
+    std::vector<int> durs;
+    std::vector<rmt_symbol_word_t> syms;
+    for (size_t i = 0; i < keyList.size() + rawDataList.size(); i++) {
+        if (i < keyList.size()) {
+            code.key = keyList[i];
+            if (i < bitList.size()) code.Bit = bitList[i];
+        } else {
+            size_t r = i - keyList.size();
+            code.data = rawDataList[r];
+            if (r < bitRawList.size()) code.Bit = bitRawList[r];
+        }
+        if (!subcEncode(code, durs) || !rf_pack_symbols(durs, syms) || !w.add(syms)) return false;
+    }
+    return w.finish();
+}
+
+// Leave in `code` what the per-code loop of txSubFile() would have: the last
+// Key with its Bit, then the last RAW data line with its Bit_RAW. That is the
+// code a replay from Recent sends.
+static void subLastCode(RfCodes &code) {
+    if (!keyList.empty()) {
+        code.key = keyList.back();
+        if (keyList.size() <= bitList.size()) code.Bit = bitList[keyList.size() - 1];
+    }
+    if (!rawDataList.empty()) {
+        code.data = rawDataList.back();
+        if (rawDataList.size() <= bitRawList.size()) code.Bit = bitRawList[rawDataList.size() - 1];
+    }
+}
+
+// Stream a compiled `.subc` back-to-back on a single RMT session. Returns
+// false when the cache could not be opened (nothing was sent).
+static bool subcTransmit(const RfCodes &code, bool hideDefaultUI, int &sent, int &total) {
+    RfSubcReader rd;
+    if (!rd.open(subFs, subPath, num_signal_repeat)) return false;
+    total = rd.frames();
+    Serial.printf("Total signals found: %d (compiled)\n", total);
+
+    int legacy_protocol_no;
+    if (!rfTxSetup(code.preset, code.frequency, legacy_protocol_no)) return true;
+    if (!hideDefaultUI) displayTextLine("Sending..");
+
+    RfTxStream tx;
+    if (tx.begin()) {
+        std::vector<rmt_symbol_word_t> *buf;
+        while ((buf = tx.next()) && rd.next(*buf) && tx.queue()) {
+            sent++;
+            if (check(EscPress)) break;
+            // Frames keep flowing from the queue while the display updates.
+            if (!hideDefaultUI && (sent % 16) == 0)
+                displayTextLine("Sent " + String(sent) + "/" + String(total));
+        }
+        tx.end();
+    }
+    deinitRfModule();
+    return true;
+}
+
+// Compiled path: codes pre-encoded to RMT symbols and queued back-to-back (no
+// per-code parse, encode or radio re-init between them). Compiles the cache
+// first when needed. Returns false when the file has to go the per-code way.
+static bool subcSend(const RfCodes &code, bool hideDefaultUI, int &sent, int &total) {
+    if (!subFs || !subcCacheable(code)) return false;
+    if (!subCached) subCached = subcCompile(code);
+    if (!subCached) return false;
+    if (subcTransmit(code, hideDefaultUI, sent, total)) return true;
+
+    // Cache went stale after the header-only read: load the codes after all.
+    RfCodes reread;
+    readSubFile(subFs, subPath, reread);
+    total = keyList.size() + rawDataList.size();
+    return false;
+}
+#endif
+
 bool txSubFile(RfCodes &selected_code, bool hideDefaultUI) {
     int sent = 0;
 
     int total = keyList.size() + rawDataList.size();
-    Serial.printf("Total signals found: %d\n", total);
+    bool complete = selected_code.protocol != "" && selected_code.preset != "" && selected_code.frequency > 0;
+    bool compiled = false;
+#if RF_SUB_TX_CACHE
+    if (complete) compiled = subcSend(selected_code, hideDefaultUI, sent, total);
+#endif
     // If the signal is complete, send all of the code(s) that were found in it.
-    // TODO: try to minimize the overhead between codes.
-    if (selected_code.protocol != "" && selected_code.preset != "" && selected_code.frequency > 0) {
+    if (complete && !compiled) {
+        Serial.printf("Total signals found: %d\n", total);
         // A `.sub` carries a code as a Key (paired with its Bit length) or as a
         // RAW/BinRAW data stream (paired with Bit_RAW). Each code is sent ONCE:
         // earlier this looped Bit and Key separately, transmitting every code
@@ -334,8 +485,17 @@ bool txSubFile(RfCodes &selected_code, bool hideDefaultUI) {
             sent++;
             if (check(EscPress)) break;
         }
-        addToRecentCodes(selected_code);
     }
+#if RF_SUB_TX_CACHE
+    // Just compiled: the codes are in the lists (a fresh cache left the last
+    // one in selected_code already).
+    if (compiled) subLastCode(selected_code);
+#endif
+    if (complete) addToRecentCodes(selected_code);
+#if RF_SUB_TX_CACHE
+    subFs = NULL;
+    subCached = false;
+#endif
 
     Serial.printf("\nSent %d of %d signals\n", sent, total);
     if (!hideDefaultUI) { displayTextLine("Sent " + String(sent) + "/" + String(total), false); }
@@ -351,23 +511,14 @@ bool txSubFile(RfCodes &selected_code, bool hideDefaultUI) {
     return true;
 }
 
-void sendRfCommand(struct RfCodes rfcode, bool hideDefaultUI) {
-    uint32_t frequency = rfcode.frequency;
-    String protocol = rfcode.protocol;
-    String preset = rfcode.preset;
-    String data = rfcode.data;
-    uint64_t key = rfcode.key;
+// Configure and key the radio for transmitting with `preset` on `frequency`
+// (Hz). Resolves the legacy protocol number carried by numeric presets.
+// Returns false (radio untouched or not keyed) when unsupported.
+static bool rfTxSetup(const String &preset, uint32_t frequency, int &legacy_protocol_no) {
     byte modulation = 2; // possible values for CC1101: 0 = 2-FSK, 1 =GFSK, 2=ASK, 3 = 4-FSK, 4 = MSK
     float deviation = 1.58;
     float rxBW = 270.83; // Receive bandwidth
     float dataRate = 10; // Data Rate
-                         /*
-                             Serial.println("sendRawRfCommand");
-                             Serial.println(data);
-                             Serial.println(frequency);
-                             Serial.println(preset);
-                             Serial.println(protocol);
-                           */
 
     // Radio preset name (configures modulation, bandwidth, filters, etc.).
     /*  supported flipper presets:
@@ -382,7 +533,7 @@ void sendRfCommand(struct RfCodes rfcode, bool hideDefaultUI) {
     */
     // Radio preset parameters come from the central registry (protocols/).
     // A preset field at 0 means "keep the module default" (set above).
-    int legacy_protocol_no = 1;
+    legacy_protocol_no = 1;
     const RfPreset *rp = rf_find_preset(preset);
     if (rp) {
         modulation = rp->modulation;
@@ -401,12 +552,12 @@ void sendRfCommand(struct RfCodes rfcode, bool hideDefaultUI) {
         if (!found) {
             Serial.print("unsupported preset: ");
             Serial.println(preset);
-            return;
+            return false;
         }
     }
 
     // init transmitter
-    if (!initRfModule("", frequency / 1000000.0)) return;
+    if (!initRfModule("", frequency / 1000000.0)) return false;
     if (bruceConfigPins.rfModule == CC1101_SPI_MODULE) { // CC1101 in use
         // derived from
         // https://github.com/LSatan/SmartRC-CC1101-Driver-Lib/blob/master/examples/Rc-Switch%20examples%20cc1101/SendDemo_cc1101/SendDemo_cc1101.ino
@@ -430,10 +581,29 @@ void sendRfCommand(struct RfCodes rfcode, bool hideDefaultUI) {
         if (modulation != 2) {
             Serial.print("unsupported modulation: ");
             Serial.println(modulation);
-            return;
+            return false;
         }
         initRfModule("tx", frequency / 1000000.0);
     }
+    return true;
+}
+
+void sendRfCommand(struct RfCodes rfcode, bool hideDefaultUI) {
+    uint32_t frequency = rfcode.frequency;
+    String protocol = rfcode.protocol;
+    String preset = rfcode.preset;
+    String data = rfcode.data;
+    uint64_t key = rfcode.key;
+    /*
+        Serial.println("sendRawRfCommand");
+        Serial.println(data);
+        Serial.println(frequency);
+        Serial.println(preset);
+        Serial.println(protocol);
+    */
+
+    int legacy_protocol_no = 1;
+    if (!rfTxSetup(preset, frequency, legacy_protocol_no)) return;
 
     if (protocol == "RAW") {
         // count the number of elements of RAW_Data
@@ -2,10 +2,8 @@
 #include "core/bus_HAL.h"
 #include "core/sd_functions.h"
 #include "core/settings.h"
-
-// CRC-64-ECMA constants
-const uint64_t CRC64_ECMA_POLY = 0x42F0E1EBA9EA3693; // Polynomial for CRC-64-ECMA
-const uint64_t CRC64_ECMA_INIT = 0xFFFFFFFFFFFFFFFF; // Initial value
+#include "protocols/rf_config.h" // RF_DEBUG
+#include <algorithm>
 
 const int range_limits[4][2] = {
     {0,  23}, // 300-348 MHz
@@ -179,11 +177,23 @@ bool rmtInstalled = true;
 static bool cc1101_spi_ready = false;
 static uint8_t cc1101_mode_hint = 0;
 
-bool RfCodes::keeloq_check_decrypt(uint32_t decrypt) {
-    uint16_t end_serial = serial & 0xFF;
+// Synthesizer words of a subghz_frequency_list channel, read back after its
+// first full setMHZ: FSCTRL0 + FREQ2..0 (contiguous), FSCAL3..1 and TEST0.
+// Replaying them retunes in three SPI transactions, without the frequency
+// math, the calibration strobe or the wait for idle. Dropped on every
+// module init and when the calibration profile changes.
+struct RfTuneWords {
+    uint8_t fsctrl0_freq[4];
+    uint8_t fscal[3];
+    uint8_t test0;
+};
+static RfTuneWords rf_tune_cache[RF_HOP_CHANNELS];
+static uint64_t rf_tune_valid = 0;
+static_assert(RF_HOP_CHANNELS <= 64, "rf_tune_valid has one bit per subghz_frequency_list channel");
+static bool rf_tune_precise = false;
 
-    if ((decrypt >> 28 == btn) && (((((uint16_t)(decrypt >> 16)) & 0xFF) == end_serial) ||
-                                   ((((uint16_t)(decrypt >> 16)) & 0xFF) == 0))) {
+bool RfCodes::keeloq_check_decrypt(uint32_t decrypt) {
+    if (keeloq_hop_matches(decrypt, btn, serial)) {
         cnt = decrypt & 0xFFFF;
 
         return true;
@@ -193,7 +203,7 @@ bool RfCodes::keeloq_check_decrypt(uint32_t decrypt) {
 }
 
 bool RfCodes::keeloq_check_decrypt_centurion(uint32_t decrypt) {
-    if ((decrypt >> 28 == btn) && ((((uint16_t)(decrypt >> 16)) & 0x3FF) == 0x1CE)) {
+    if (keeloq_hop_matches_centurion(decrypt, btn)) {
         cnt = decrypt & 0xFFFF;
 
         return true;
@@ -209,13 +219,17 @@ void RfCodes::keeloq_step(uint16_t step) {
     // so it can be unit-tested without the SD keystore (see rf_keeloq_selftest).
     hop = keeloq_build_hop(mf_name, btn, serial, cnt);
 
-    // A null fs is fine: the keystore falls back to the encrypted built-in keys.
-    KeeloqKeystore keystore{keeloq_mfcodes_fs()};
+    // Cached keystore (built-in keys when no /mfcodes); last entry for the
+    // manufacturer wins, as before.
+    const KeeloqKeystore &keystore = keeloq_keystore();
+    const uint16_t mf_id = keystore.find_mf(mf_name.c_str());
 
-    KeeloqKey current_key;
+    KeeloqKeyEntry current_key = {0, KEELOQ_MF_NONE, 0};
 
-    for (const auto &key : keystore.get_keys()) {
-        if (key.mf_name == mf_name) { current_key = key; }
+    if (mf_id != KEELOQ_MF_NONE) {
+        for (const auto &key : keystore.get_keys()) {
+            if (key.mf_id == mf_id) { current_key = key; }
+        }
     }
 
     // Derive the manufacturer key for this learning type and encrypt the hop.
@@ -252,6 +266,7 @@ bool initRfModule(String mode, float frequency) {
             initCC1101once(NULL);
         }
         ELECHOUSE_cc1101.Init();
+        rf_tune_valid = 0; // registers were reset
         if (ELECHOUSE_cc1101.getCC1101()) { // Check the CC1101 Spi connection.
             Serial.println("cc1101 Connection OK");
         } else {
@@ -377,43 +392,47 @@ void initCC1101once(SPIClass *SSPI) {
     return;
 }
 
+// T-Embed antenna switch for the band of `frequency` (no-op elsewhere).
+static void rf_select_antenna(float frequency) {
+#if defined(T_EMBED)
+    static uint8_t antenna = 200; // 0=(<300), 1=(350-468), 2=(>778), 200=start to settle at the fisrt time
+    bool change = true;
+#if !defined(T_EMBED_1101)
+    // there's one version of T-Embed (White whith orange wheel) that has CC1101
+    // which antenna has the same circuit as the new CC1101 version with different pinouts
+    // this device uses 17 for CS
+    if (bruceConfigPins.CC1101_bus.cs != 17) change = false;
+#endif
+
+    // SW1:1  SW0:0 --- 315MHz
+    // SW1:0  SW0:1 --- 868/915MHz
+    // SW1:1  SW0:1 --- 434MHz
+    if (frequency <= 350 && antenna != 0 && change) {
+        digitalWrite(CC1101_SW1_PIN, HIGH);
+        digitalWrite(CC1101_SW0_PIN, LOW);
+        antenna = 0;
+        vTaskDelay(10 / portTICK_PERIOD_MS); // time to settle the antenna signal
+    } else if (frequency > 350 && frequency < 468 && antenna != 1 && change) {
+        digitalWrite(CC1101_SW1_PIN, HIGH);
+        digitalWrite(CC1101_SW0_PIN, HIGH);
+        antenna = 1;
+        vTaskDelay(10 / portTICK_PERIOD_MS); // time to settle the antenna signal
+    } else if (frequency > 778 && antenna != 2 && change) {
+        digitalWrite(CC1101_SW1_PIN, LOW);
+        digitalWrite(CC1101_SW0_PIN, HIGH);
+        antenna = 2;
+        vTaskDelay(10 / portTICK_PERIOD_MS); // time to settle the antenna signal
+    }
+#endif
+}
+
 void setMHZ(float frequency) {
     if (frequency > 928 || frequency < 280) {
         frequency = 433.92;
         Serial.println("Frequency out of band");
     }
     if (bruceConfigPins.rfModule == CC1101_SPI_MODULE) {
-#if defined(T_EMBED)
-        static uint8_t antenna =
-            200; // 0=(<300), 1=(350-468), 2=(>778), 200=start to settle at the fisrt time
-        bool change = true;
-#if !defined(T_EMBED_1101)
-        // there's one version of T-Embed (White whith orange wheel) that has CC1101
-        // which antenna has the same circuit as the new CC1101 version with different pinouts
-        // this device uses 17 for CS
-        if (bruceConfigPins.CC1101_bus.cs != 17) change = false;
-#endif
-
-        // SW1:1  SW0:0 --- 315MHz
-        // SW1:0  SW0:1 --- 868/915MHz
-        // SW1:1  SW0:1 --- 434MHz
-        if (frequency <= 350 && antenna != 0 && change) {
-            digitalWrite(CC1101_SW1_PIN, HIGH);
-            digitalWrite(CC1101_SW0_PIN, LOW);
-            antenna = 0;
-            vTaskDelay(10 / portTICK_PERIOD_MS); // time to settle the antenna signal
-        } else if (frequency > 350 && frequency < 468 && antenna != 1 && change) {
-            digitalWrite(CC1101_SW1_PIN, HIGH);
-            digitalWrite(CC1101_SW0_PIN, HIGH);
-            antenna = 1;
-            vTaskDelay(10 / portTICK_PERIOD_MS); // time to settle the antenna signal
-        } else if (frequency > 778 && antenna != 2 && change) {
-            digitalWrite(CC1101_SW1_PIN, LOW);
-            digitalWrite(CC1101_SW0_PIN, HIGH);
-            antenna = 2;
-            vTaskDelay(10 / portTICK_PERIOD_MS); // time to settle the antenna signal
-        }
-#endif
+        rf_select_antenna(frequency);
         const bool preciseCalibration = (bruceConfigPins.rfFxdFreq);
         const uint8_t previousMode = preciseCalibration ? ELECHOUSE_cc1101.getMode() : 0;
         const uint8_t targetMode =
@@ -433,6 +452,39 @@ void setMHZ(float frequency) {
     }
 }
 
+void rf_hop_tune(int idx) {
+    const float frequency = subghz_frequency_list[idx];
+    if (bruceConfigPins.rfModule != CC1101_SPI_MODULE) {
+        setMHZ(frequency);
+        return;
+    }
+    const bool precise = bruceConfigPins.rfFxdFreq;
+    if (precise != rf_tune_precise) {
+        rf_tune_valid = 0;
+        rf_tune_precise = precise;
+    }
+
+    RfTuneWords &w = rf_tune_cache[idx];
+    const uint64_t bit = 1ULL << idx;
+    if (!(rf_tune_valid & bit)) {
+        setMHZ(frequency);
+        ELECHOUSE_cc1101.SpiReadBurstReg(CC1101_FSCTRL0, w.fsctrl0_freq, sizeof(w.fsctrl0_freq));
+        ELECHOUSE_cc1101.SpiReadBurstReg(CC1101_FSCAL3, w.fscal, sizeof(w.fscal));
+        w.test0 = ELECHOUSE_cc1101.SpiReadReg(CC1101_TEST0);
+        rf_tune_valid |= bit;
+        return;
+    }
+
+    rf_select_antenna(frequency);
+    const uint8_t mode = ELECHOUSE_cc1101.getMode();
+    if (mode != 0) ELECHOUSE_cc1101.setSidle();
+    ELECHOUSE_cc1101.SpiWriteBurstReg(CC1101_FSCTRL0, w.fsctrl0_freq, sizeof(w.fsctrl0_freq));
+    ELECHOUSE_cc1101.SpiWriteBurstReg(CC1101_FSCAL3, w.fscal, sizeof(w.fscal));
+    ELECHOUSE_cc1101.SpiWriteReg(CC1101_TEST0, w.test0);
+    if (mode == 1) ELECHOUSE_cc1101.SetTx();
+    else if (mode == 2) ELECHOUSE_cc1101.SetRx();
+}
+
 int find_pulse_index(const std::vector<int> &indexed_durations, int duration) {
     int abs_duration = abs(duration);
     int closest_index = -1;
@@ -466,23 +518,180 @@ uint64_t reverse_bits(uint64_t num, uint8_t bits) {
     return res;
 }
 
-// Function to compute CRC-64-ECMA
-uint64_t crc64_ecma(const std::vector<int> &data) {
-    uint64_t crc = CRC64_ECMA_INIT;
-
-    for (int value : data) {
-        crc ^= (uint64_t)value << 56; // Use the value as the high byte
-        for (int i = 0; i < 8; i++) {
-            if (crc & 0x8000000000000000) {
-                crc = (crc << 1) ^ CRC64_ECMA_POLY;
-            } else {
-                crc <<= 1;
+void RfHopScheduler::range(int first, int last) {
+    if (first == _first && last == _last) return;
+    first = constrain(first, 0, RF_HOP_CHANNELS - 1);
+    last = constrain(last, first, RF_HOP_CHANNELS - 1);
+    *this = RfHopScheduler();
+    _first = _pos = first;
+    _last = last;
+}
+
+int RfHopScheduler::hottest() const {
+    int best = -1;
+    for (int i = _first; i <= _last; i++) {
+        if (_score[i] >= RF_HOP_HIT_SCORE && (best < 0 || _score[i] > _score[best])) best = i;
+    }
+    return best;
+}
+
+int RfHopScheduler::next(uint8_t &reads) {
+    int idx = (++_hops % RF_HOP_HOT_EVERY == 0) ? hottest() : -1;
+    while (idx < 0) {
+        if (_pos > _last) {
+            _pos = _first;
+            _round++;
+            for (int i = _first; i <= _last; i++) _score[i] = (_score[i] * 7) >> 3;
+        }
+        int i = _pos++;
+        if (_score[i] || _quiet[i] < RF_HOP_QUIET_VISITS || (_round + i) % RF_HOP_QUIET_PERIOD == 0) idx = i;
+    }
+    reads = 1 + min(_score[idx] / RF_HOP_READ_SCORE, RF_HOP_MAX_READS - 1);
+    return idx;
+}
+
+void RfHopScheduler::report(int idx, int rssi, int threshold) {
+    if (rssi > threshold) {
+        _score[idx] = min(_score[idx] + RF_HOP_HIT_SCORE + (rssi - threshold) * 8, RF_HOP_MAX_SCORE);
+        _quiet[idx] = 0;
+    } else if (_quiet[idx] < 255) {
+        _quiet[idx]++;
+    }
+}
+
+#if RF_DEBUG
+#define RF_HOP_SIM_READ_MS 5 // one settle + RSSI read, as in RFScan::fast_scan
+#define RF_HOP_SIM_THRESHOLD -65
+#define RF_HOP_SIM_NOISE -95
+
+struct RfHopBurst {
+    uint32_t start; // ms
+    uint16_t len;   // ms
+    uint8_t ch;     // subghz_frequency_list index
+    int8_t rssi;
+};
+
+// Nearest subghz_frequency_list index, or -1 when `mhz` is not listed.
+static int rf_hop_channel(float mhz) {
+    for (int i = 0; i < RF_HOP_CHANNELS; i++) {
+        if (fabsf(subghz_frequency_list[i] - mhz) < 0.01f) return i;
+    }
+    return -1;
+}
+
+static bool rf_hop_load_trace(FS *fs, const String &path, std::vector<RfHopBurst> &bursts) {
+    File f = fs->open(path, FILE_READ);
+    if (!f) return false;
+    while (f.available()) {
+        String line = f.readStringUntil('\n');
+        line.trim();
+        if (line.length() == 0 || line[0] == '#') continue;
+        unsigned long start = 0, len = 0;
+        float mhz = 0;
+        int rssi = 0;
+        if (sscanf(line.c_str(), "%lu,%f,%lu,%d", &start, &mhz, &len, &rssi) != 4) continue;
+        int ch = rf_hop_channel(mhz);
+        if (ch < 0 || len == 0) continue;
+        bursts.push_back({(uint32_t)start, (uint16_t)min(len, 65535UL), (uint8_t)ch, (int8_t)rssi});
+    }
+    f.close();
+    return true;
+}
+
+// A few busy channels with key-fob style bursts (60-160 ms every 0.4-3 s) and
+// rare one-off bursts anywhere, over 60 s.
+static void rf_hop_synthetic_trace(std::vector<RfHopBurst> &bursts) {
+    static const float busy[] = {433.92f, 315.0f, 868.35f, 433.42f};
+    uint32_t seed = 7;
+    auto rnd = [&seed](uint32_t n) {
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 8) % n;
+    };
+    for (float mhz : busy) {
+        int ch = rf_hop_channel(mhz);
+        for (uint32_t t = rnd(1000); t < 60000; t += 400 + rnd(2600)) {
+            bursts.push_back({t, (uint16_t)(60 + rnd(100)), (uint8_t)ch, (int8_t)(-60 + (int)rnd(20))});
+        }
+    }
+    for (int i = 0; i < 40; i++) {
+        bursts.push_back({rnd(60000), (uint16_t)(60 + rnd(100)), (uint8_t)rnd(RF_HOP_CHANNELS), -55});
+    }
+    std::sort(bursts.begin(), bursts.end(), [](const RfHopBurst &a, const RfHopBurst &b) {
+        return a.start < b.start;
+    });
+}
+
+// Sweeps [first, last] until the trace ends; returns bursts caught (an RSSI
+// read above the threshold while the burst is on air) and their mean latency.
+static int rf_hop_sim_run(
+    const std::vector<RfHopBurst> &bursts, int first, int last, bool ranked, uint32_t &latency
+) {
+    if (bursts.empty()) return 0;
+    uint32_t maxLen = 0, end = 0;
+    for (const RfHopBurst &b : bursts) {
+        maxLen = max(maxLen, (uint32_t)b.len);
+        end = max(end, b.start + b.len);
+    }
+
+    std::vector<uint8_t> caught(bursts.size(), 0);
+    RfHopScheduler hop;
+    hop.range(first, last);
+    int ch = last, hits = 0;
+    uint64_t total = 0;
+    size_t lo = 0;
+    for (uint32_t t = 0; t < end;) {
+        uint8_t reads = 1;
+        if (ranked) ch = hop.next(reads);
+        else ch = ch >= last ? first : ch + 1;
+
+        int best = RF_HOP_SIM_NOISE;
+        for (uint8_t r = 0; r < reads; r++, t += RF_HOP_SIM_READ_MS) {
+            while (lo < bursts.size() && bursts[lo].start + maxLen <= t) lo++;
+            for (size_t i = lo; i < bursts.size() && bursts[i].start <= t; i++) {
+                const RfHopBurst &b = bursts[i];
+                if (b.ch != ch || t >= b.start + b.len) continue;
+                best = max(best, (int)b.rssi);
+                if (b.rssi > RF_HOP_SIM_THRESHOLD && !caught[i]) {
+                    caught[i] = 1;
+                    hits++;
+                    total += t - b.start;
+                }
             }
         }
+        hop.report(ch, best, RF_HOP_SIM_THRESHOLD);
     }
+    latency = hits ? (uint32_t)(total / hits) : 0;
+    return hits;
+}
 
-    return crc;
+bool rf_hop_sim(FS *fs, const String &path) {
+    std::vector<RfHopBurst> bursts;
+    if (path.length()) {
+        if (!fs || !rf_hop_load_trace(fs, path, bursts)) {
+            Serial.println("hopsim: cannot read " + path);
+            return false;
+        }
+        std::sort(bursts.begin(), bursts.end(), [](const RfHopBurst &a, const RfHopBurst &b) {
+            return a.start < b.start;
+        });
+    } else {
+        rf_hop_synthetic_trace(bursts);
+    }
+    if (bursts.empty()) {
+        Serial.println("hopsim: empty trace");
+        return false;
+    }
+
+    const int first = range_limits[3][0], last = range_limits[3][1];
+    uint32_t linLatency = 0, hopLatency = 0;
+    int lin = rf_hop_sim_run(bursts, first, last, false, linLatency);
+    int hop = rf_hop_sim_run(bursts, first, last, true, hopLatency);
+    Serial.printf("hopsim: %u bursts, %d channels\n", (unsigned)bursts.size(), last - first + 1);
+    Serial.printf("hopsim: linear sweep caught %d, mean latency %ums\n", lin, (unsigned)linLatency);
+    Serial.printf("hopsim: ranked dwell caught %d, mean latency %ums\n", hop, (unsigned)hopLatency);
+    return hop >= lin;
 }
+#endif
 
 void addToRecentCodes(struct RfCodes rfcode) {
     recent_rfcodes.push_back(rfcode);
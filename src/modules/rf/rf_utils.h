@@ -2,8 +2,10 @@
 #define __RF_UTILS_H__
 
 #include "protocols/rf_keeloq.h" // KeeLoq cipher/keystore + bitAt/g5/KEELOQ_* macros
+#include "rf_capture.h"          // crc64_ecma, RfCaptureRing
 #include "structs.h"
 #include <ELECHOUSE_CC1101_SRC_DRV.h>
+#include <FS.h>
 // ESP-IDF 5.5 based framework determines the channels autommatically
 // you do not have the hability to choose the channel
 rmt_channel_handle_t setup_rf_rx();
@@ -24,8 +26,53 @@ void deinitRfModule();
 void initCC1101once(SPIClass *SSPI);
 
 void setMHZ(float frequency);
+// Tune to subghz_frequency_list[idx]. The first visit goes through setMHZ();
+// later ones replay the cached synthesizer registers in burst writes.
+void rf_hop_tune(int idx);
+
+// RSSI-ranked hop scheduler over subghz_frequency_list[first..last]. Every
+// channel keeps an activity score that rises with each RSSI peak (by its
+// margin over the threshold) and decays by 1/8 per sweep. Active channels
+// get longer dwells (more RSSI reads) and the hottest one is revisited
+// between regular hops; channels quiet for RF_HOP_QUIET_VISITS visits are
+// only swept every RF_HOP_QUIET_PERIOD rounds (staggered).
+#define RF_HOP_CHANNELS ((int)(sizeof(subghz_frequency_list) / sizeof(subghz_frequency_list[0])))
+#define RF_HOP_MAX_READS 2     // RSSI reads per visit on the busiest channels
+#define RF_HOP_READ_SCORE 1024 // score per extra RSSI read
+#define RF_HOP_HIT_SCORE 256   // score of a peak, plus 8 per dB over the threshold
+#define RF_HOP_MAX_SCORE 4096
+#define RF_HOP_HOT_EVERY 8     // every 8th hop goes to the hottest channel
+#define RF_HOP_QUIET_VISITS 2
+#define RF_HOP_QUIET_PERIOD 4
+
+class RfHopScheduler {
+public:
+    // (Re)start over [first, last]; a no-op when the range is unchanged.
+    void range(int first, int last);
+    // Channel to tune next and how many RSSI reads to take there.
+    int next(uint8_t &reads);
+    // Strongest RSSI read on `idx` during its dwell.
+    void report(int idx, int rssi, int threshold);
+    uint16_t score(int idx) const { return _score[idx]; }
+
+private:
+    uint16_t _score[RF_HOP_CHANNELS] = {};
+    uint8_t _quiet[RF_HOP_CHANNELS] = {}; // consecutive quiet visits
+    int _first = -1;
+    int _last = -1;
+    int _pos = 0;
+    uint32_t _round = 0;
+    uint32_t _hops = 0;
+
+    int hottest() const;
+};
+
+// Replays an RSSI trace through a linear sweep and the scheduler and compares
+// bursts caught and detection latency (`subghz hopsim`). Trace lines are
+// `start_ms,MHz,length_ms,rssi`; an empty path replays a synthetic trace.
+// RF_DEBUG only.
+bool rf_hop_sim(FS *fs, const String &path);
 int find_pulse_index(const std::vector<int> &indexed_durations, int duration);
-uint64_t crc64_ecma(const std::vector<int> &data);
 
 void addToRecentCodes(struct RfCodes rfcode);
 struct RfCodes selectRecentRfMenu();
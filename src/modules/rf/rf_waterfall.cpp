@@ -58,6 +58,70 @@ void rf_waterfall_boundary_freq(float &boundary) {
 
 uint16_t swapBytes(uint16_t c) { return (c >> 8) | (c << 8); }
 
+void RfWaterfallView::begin(int x, int y, int w, int h) {
+    end();
+    _x = x;
+    _y = y;
+    _w = w;
+    _h = h;
+    _line = (uint16_t *)malloc(w * sizeof(uint16_t));
+    clear();
+}
+
+void RfWaterfallView::end() {
+    free(_line);
+    _line = nullptr;
+}
+
+void RfWaterfallView::clear() {
+    _head = 0;
+    _rateStart = millis();
+    _rateCount = 0;
+    _rate = 0;
+    tft.fillRect(_x, _y, _w, _h, TFT_BLACK);
+}
+
+void RfWaterfallView::commit() {
+    uint32_t now = millis();
+    _rateCount++;
+    if (now - _rateStart >= 1000) {
+        _rate = (uint32_t)_rateCount * 1000 / (now - _rateStart);
+        _rateStart = now;
+        _rateCount = 0;
+    }
+
+    if (!_line) return;
+    tft.drawPixel(0, 0, 0); // Cardputer Case, need to call something to the tft.
+    tft.pushImage(_x, _y + _head, _w, 1, _line);
+    if (++_head >= _h) _head = 0;
+    tft.drawFastHLine(_x, _y + _head, _w, TFT_DARKGREY);
+}
+
+// Frequency labels and key hints; only redrawn when they change.
+static void rf_waterfall_header(float f_start, float f_end, int selected_item, int screen_width) {
+    tft.setTextSize(1);
+    tft.fillRect(0, 0, screen_width, 10, TFT_BLACK);
+    for (int i = 0; i < 4; i++) {
+        int x = i * (screen_width / 4);
+        float f_freq = f_start + (f_end - f_start) * i / 4.0;
+        tft.setCursor(x, 0);
+
+        if ((i == 0 && selected_item == 0) || (i == 3 && selected_item == 1)) {
+            tft.setTextColor(TFT_PINK, TFT_BLACK);
+        } else {
+            tft.setTextColor(TFT_WHITE, TFT_BLACK);
+        }
+        tft.print(String(f_freq, 1));
+    }
+
+    tft.fillRect(0, 20, screen_width, 10, TFT_BLACK);
+    tft.setCursor(3, 20);
+    tft.setTextColor(TFT_DARKCYAN, TFT_BLACK);
+    tft.print("[OK] Item [PREV/NEXT] Value ");
+    tft.setTextColor(selected_item == 2 ? TFT_RED : TFT_WHITE, TFT_BLACK);
+    tft.print("EXIT");
+}
+
 void rf_waterfall_run() {
     float f_start = m_rf_waterfall_start_freq;
     float f_end = m_rf_waterfall_end_freq;
@@ -66,39 +130,29 @@ void rf_waterfall_run() {
     const int display_top = screen_height / 5;
     float f_freq_step;
 
-    // Alloc framebuffer
-    uint16_t frameBuffer[screen_width] = {0};
-
-    int current_line = display_top;
+    RfWaterfallView view;
+    view.begin(0, display_top, screen_width, screen_height - display_top);
+    if (!view.line()) {
+        displayError("Out of memory", true);
+        return;
+    }
     initRfModule("rx", f_start);
 
     float max_freq = f_start;
     int max_rssi = -100;
     unsigned long lastMaxUpdate = millis();
+    unsigned long lastRateUpdate = millis();
 
     tft.fillRect(0, 0, screen_width, display_top, TFT_BLACK);
 
     int selected_item = 0;
-    bool exitting = false;
-    unsigned long exit_time = 0;
+    bool header = true;
+    const uint16_t grid = swapBytes(TFT_DARKGREY);
 
     while (1) {
-        for (int i = 0; i < 4; i++) {
-            int x = i * (screen_width / 4);
-            float f_freq = f_start + (f_end - f_start) * i / 4.0;
-            tft.setCursor(x, 0);
-            tft.setTextSize(1);
-
-            if (i == 0 && selected_item == 0) {
-                tft.setTextColor(TFT_PINK, TFT_BLACK);
-            } else if (i == 3 && selected_item == 1) {
-                tft.setTextColor(TFT_PINK, TFT_BLACK);
-            } else {
-                tft.setTextColor(TFT_WHITE, TFT_BLACK);
-            }
-
-            tft.drawFastVLine(x, 0, tft.height(), TFT_DARKGREY);
-            tft.print(String(f_freq, 1));
+        if (header) {
+            rf_waterfall_header(f_start, f_end, selected_item, screen_width);
+            header = false;
         }
 
         f_freq_step = (f_end - f_start) / screen_width;
@@ -115,6 +169,8 @@ void rf_waterfall_run() {
         else if (range > 0.1) step = 0.01;
         else step = 0.001;
 
+        uint16_t *frameBuffer = view.line();
+        float sweep_start = f_start, sweep_end = f_end;
         for (int i = 0; i < screen_width; ++i) {
             float f_freq = f_start + i * f_freq_step;
             setMHZ(f_freq);
@@ -149,11 +205,13 @@ void rf_waterfall_run() {
                 g = map(level, 192, 255, 255, 0);
             }
 
+            // Grid columns are part of the line, so they scroll with the history.
             uint16_t color = tft.color565(r, g, b);
-            frameBuffer[i] = swapBytes(color);
+            frameBuffer[i] = (i % (screen_width / 4) == 0) ? grid : swapBytes(color);
             if (check(SelPress)) {
                 selected_item++;
                 if (selected_item > 2) selected_item = 0;
+                header = true;
             }
 
             if (check(UpPress) || check(NextPress)) {
@@ -162,6 +220,7 @@ void rf_waterfall_run() {
                     case 1: f_end += step; break;
                     case 2: return;
                 }
+                header = true;
                 delay(100);
             } else if (check(DownPress) || check(PrevPress)) {
                 switch (selected_item) {
@@ -170,12 +229,13 @@ void rf_waterfall_run() {
                     case 2: return;
                 }
                 if (EscPress) EscPress = false; // Reset for StickCs
+                header = true;
                 delay(100);
             }
         }
-        tft.drawPixel(0, 0, 0); // Cardputer Case, need to call something to the tft.
-        tft.pushImage(0, current_line, screen_width, 1, frameBuffer);
-        tft.drawFastHLine(0, current_line + 1, screen_width, TFT_DARKGREY);
+        view.commit();
+        // History from another range no longer lines up with the labels.
+        if (f_start != sweep_start || f_end != sweep_end) view.clear();
 
         if (millis() - lastMaxUpdate >= 5000) {
             max_rssi = temp_max_rssi;
@@ -189,22 +249,14 @@ void rf_waterfall_run() {
             lastMaxUpdate = millis();
         }
 
-        tft.setCursor(3, 20);
-        tft.setTextColor(TFT_DARKCYAN);
-        tft.print("[OK] Item [PREV/NEXT] Value ");
-
-        if (selected_item == 2) {
-            tft.setTextColor(TFT_RED);
-            tft.print("EXIT");
-        } else {
-            tft.setTextColor(TFT_WHITE);
-            tft.print("EXIT");
+        if (millis() - lastRateUpdate >= 1000) {
+            tft.setTextSize(1);
+            tft.setTextColor(TFT_DARKGREY, TFT_BLACK);
+            tft.drawRightString(String(view.lines_per_sec()) + " l/s ", screen_width, 10, 1);
+            lastRateUpdate = millis();
         }
 
         if (check(EscPress)) break;
-
-        current_line++;
-        if (current_line >= screen_height) current_line = display_top;
     }
 
     returnToMenu = true;
@@ -2,6 +2,31 @@
 
 #include "rf_utils.h"
 
+// Waterfall lines on screen rows at a wrapping cursor marked by a grey line.
+// The sweep fills line() (RGB565, byte-swapped for pushImage) and commit()s
+// it: one pushImage per line instead of a pixel call per bin. The history
+// lives on the display itself, so only one line of RAM is needed.
+
+class RfWaterfallView {
+public:
+    ~RfWaterfallView() { end(); }
+    void begin(int x, int y, int w, int h);
+    void end();
+    void clear();
+    uint16_t *line() { return _line; } // next line, w pixels
+    void commit();
+    // Sweep lines committed per second, over the last full second.
+    uint16_t lines_per_sec() const { return _rate; }
+
+private:
+    int _x = 0, _y = 0, _w = 0, _h = 0;
+    uint16_t *_line = nullptr;
+    int _head = 0; // row the next line is written to
+    uint32_t _rateStart = 0;
+    uint16_t _rateCount = 0;
+    uint16_t _rate = 0;
+};
+
 void rf_waterfall_boundary_freq(float &boundary);
 void rf_waterfall_run();
 
@@ -2,6 +2,7 @@
 #define RF_STRUCTS_H
 
 #include "core/display.h"
+#include "protocols/rf_protocol.h" // HighLow
 #include <driver/rmt_rx.h>
 #include <driver/rmt_tx.h>
 
@@ -53,11 +54,6 @@ struct FreqFound {
     int rssi;
 };
 
-struct HighLow {
-    uint8_t high; // 1
-    uint8_t low;  // 31
-};
-
 struct Protocol {
     uint16_t pulseLength; // base pulse length in microseconds, e.g. 350
     HighLow syncFactor;
@@ -66,10 +62,4 @@ struct Protocol {
     bool invertedSignal;
 };
 
-struct KeeloqKey {
-    String mf_name{};
-    uint64_t key = 0;
-    uint32_t type = 0;
-};
-
 #endif
@@ -0,0 +1,227 @@
+#if !defined(LITE_VERSION)
+#include "ap_table.h"
+#include <stdlib.h>
+#include <string.h>
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+
+static bool ap_psram() { return psramFound(); }
+static void *ap_alloc(size_t n) {
+    void *p = nullptr;
+    if (psramFound()) p = heap_caps_calloc(1, n, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!p) p = heap_caps_calloc(1, n, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    return p;
+}
+static void ap_free(void *p) { heap_caps_free(p); }
+#else // host builds (tools/ap_table_bench.cpp)
+static bool ap_psram() { return true; }
+static void *ap_alloc(size_t n) { return calloc(1, n); }
+static void ap_free(void *p) { free(p); }
+#endif
+
+bool ApTable::begin(size_t slots, size_t beacons, size_t eapols) {
+    if (_slots) return true;
+    const bool big = ap_psram();
+    if (!slots) slots = big ? AP_TABLE_SLOTS_PSRAM : AP_TABLE_SLOTS_SRAM;
+    if (!beacons) beacons = big ? AP_TABLE_BEACONS_PSRAM : AP_TABLE_BEACONS_SRAM;
+    if (!eapols) eapols = big ? AP_TABLE_EAPOL_PSRAM : AP_TABLE_EAPOL_SRAM;
+    if (slots & (slots - 1) || slots > 32768) return false;
+
+    _slots = (ApSlot *)ap_alloc(slots * sizeof(ApSlot));
+    _beacons = (BeaconFrame *)ap_alloc(beacons * sizeof(BeaconFrame));
+    _beaconFree = (uint16_t *)ap_alloc(beacons * sizeof(uint16_t));
+    _eapol = (Eapol4WayBuffer *)ap_alloc(eapols * sizeof(Eapol4WayBuffer));
+    _eapolOwner = (EapolOwner *)ap_alloc(eapols * sizeof(EapolOwner));
+    if (!_slots || !_beacons || !_beaconFree || !_eapol || !_eapolOwner) {
+        end();
+        return false;
+    }
+    _cap = slots;
+    _mask = slots - 1;
+    _limit = slots * AP_TABLE_LOAD_PCT / 100;
+    _shift = 64;
+    for (size_t s = slots; s > 1; s >>= 1) _shift--;
+    _beaconCap = beacons;
+    _eapolCap = eapols;
+    clear();
+    return true;
+}
+
+void ApTable::end() {
+    if (_slots) ap_free(_slots);
+    if (_beacons) ap_free(_beacons);
+    if (_beaconFree) ap_free(_beaconFree);
+    if (_eapol) ap_free(_eapol);
+    if (_eapolOwner) ap_free(_eapolOwner);
+    _slots = nullptr;
+    _beacons = nullptr;
+    _beaconFree = nullptr;
+    _eapol = nullptr;
+    _eapolOwner = nullptr;
+    _cap = _mask = _count = _limit = 0;
+    _beaconCap = _beaconFreeCount = _eapolCap = 0;
+}
+
+void ApTable::clear() {
+    if (!_slots) return;
+    for (size_t i = 0; i < _cap; i++) _slots[i].used = 0;
+    _count = 0;
+    _head = _tail = AP_NONE;
+    _evictions = 0;
+    for (size_t i = 0; i < _beaconCap; i++) _beaconFree[i] = _beaconCap - 1 - i;
+    _beaconFreeCount = _beaconCap;
+    clearEapol();
+}
+
+size_t ApTable::home(uint64_t key) const {
+    // Fibonacci hashing: OUIs make the high BSSID bytes nearly constant.
+    return (size_t)((key * 0x9E3779B97F4A7C15ULL) >> _shift) & _mask;
+}
+
+void ApTable::linkFront(uint16_t i) {
+    ApSlot &s = _slots[i];
+    s.prev = AP_NONE;
+    s.next = _head;
+    if (_head != AP_NONE) _slots[_head].prev = i;
+    _head = i;
+    if (_tail == AP_NONE) _tail = i;
+}
+
+void ApTable::unlink(uint16_t i) {
+    ApSlot &s = _slots[i];
+    if (s.prev != AP_NONE) _slots[s.prev].next = s.next;
+    else _head = s.next;
+    if (s.next != AP_NONE) _slots[s.next].prev = s.prev;
+    else _tail = s.prev;
+}
+
+ApSlot *ApTable::find(uint64_t key) {
+    if (!_slots) return nullptr;
+    for (size_t i = home(key); _slots[i].used; i = (i + 1) & _mask) {
+        if (_slots[i].key != key) continue;
+        if (_head != i) {
+            unlink(i);
+            linkFront(i);
+        }
+        return &_slots[i];
+    }
+    return nullptr;
+}
+
+const ApSlot *ApTable::peek(uint64_t key) const {
+    if (!_slots) return nullptr;
+    for (size_t i = home(key); _slots[i].used; i = (i + 1) & _mask)
+        if (_slots[i].key == key) return &_slots[i];
+    return nullptr;
+}
+
+ApSlot *ApTable::insert(uint64_t key, bool *created) {
+    if (created) *created = false;
+    if (ApSlot *s = find(key)) return s;
+    if (!_slots) return nullptr;
+    if (_count >= _limit) {
+        // Least recently used first, but an AP whose handshake is already saved
+        // is only forgotten when the table is about to fill up: a new slot for it
+        // would count and save that handshake again.
+        uint16_t victim = _tail;
+        while (victim != AP_NONE && (_slots[victim].flags & (AP_HS_READY | AP_HS_BEACON_SAVED)))
+            victim = _slots[victim].prev;
+        if (victim == AP_NONE && _count + 1 >= _cap) victim = _tail;
+        if (victim != AP_NONE) {
+            removeAt(victim);
+            _evictions++;
+        }
+    }
+    size_t i = home(key);
+    while (_slots[i].used) i = (i + 1) & _mask;
+    ApSlot &s = _slots[i];
+    memset(&s, 0, sizeof(s));
+    s.key = key;
+    s.beacon = AP_NONE;
+    s.used = 1;
+    linkFront(i);
+    _count++;
+    if (created) *created = true;
+    return &s;
+}
+
+void ApTable::erase(uint64_t key) {
+    if (!_slots) return;
+    for (size_t i = home(key); _slots[i].used; i = (i + 1) & _mask) {
+        if (_slots[i].key == key) {
+            removeAt(i);
+            return;
+        }
+    }
+}
+
+void ApTable::removeAt(size_t i) {
+    dropBeacon(_slots[i]);
+    unlink(i);
+    _slots[i].used = 0;
+    _count--;
+    // Backward shift: pull later members of the probe run into the hole
+    // unless that would move them before their home slot.
+    for (size_t j = (i + 1) & _mask; _slots[j].used; j = (j + 1) & _mask) {
+        size_t k = home(_slots[j].key);
+        bool stay = i <= j ? (i < k && k <= j) : (i < k || k <= j);
+        if (stay) continue;
+        _slots[i] = _slots[j];
+        ApSlot &m = _slots[i];
+        if (m.prev != AP_NONE) _slots[m.prev].next = i;
+        else _head = i;
+        if (m.next != AP_NONE) _slots[m.next].prev = i;
+        else _tail = i;
+        _slots[j].used = 0;
+        i = j;
+    }
+}
+
+BeaconFrame *ApTable::beacon(ApSlot &slot, bool create) {
+    if (slot.beacon != AP_NONE) return &_beacons[slot.beacon];
+    if (!create || !_beaconFreeCount) return nullptr;
+    slot.beacon = _beaconFree[--_beaconFreeCount];
+    BeaconFrame *b = &_beacons[slot.beacon];
+    b->len = 0;
+    return b;
+}
+
+const BeaconFrame *ApTable::beacon(const ApSlot &slot) const {
+    return slot.beacon != AP_NONE ? &_beacons[slot.beacon] : nullptr;
+}
+
+void ApTable::dropBeacon(ApSlot &slot) {
+    if (slot.beacon == AP_NONE) return;
+    _beaconFree[_beaconFreeCount++] = slot.beacon;
+    slot.beacon = AP_NONE;
+}
+
+Eapol4WayBuffer *ApTable::eapol(uint64_t key, bool create) {
+    if (!_eapol) return nullptr;
+    size_t victim = 0;
+    for (size_t i = 0; i < _eapolCap; i++) {
+        EapolOwner &o = _eapolOwner[i];
+        if (o.stamp && o.key == key) {
+            o.stamp = ++_eapolClock;
+            return &_eapol[i];
+        }
+        if (_eapolOwner[victim].stamp && (!o.stamp || o.stamp < _eapolOwner[victim].stamp)) victim = i;
+    }
+    if (!create) return nullptr;
+    _eapolOwner[victim].key = key;
+    _eapolOwner[victim].stamp = ++_eapolClock;
+    memset(&_eapol[victim], 0, sizeof(Eapol4WayBuffer));
+    return &_eapol[victim];
+}
+
+void ApTable::dropEapol(uint64_t key) {
+    for (size_t i = 0; i < _eapolCap; i++)
+        if (_eapolOwner[i].stamp && _eapolOwner[i].key == key) _eapolOwner[i].stamp = 0;
+}
+
+void ApTable::clearEapol() {
+    if (_eapolOwner) memset(_eapolOwner, 0, _eapolCap * sizeof(EapolOwner));
+    _eapolClock = 0;
+}
+#endif
@@ -0,0 +1,159 @@
+#pragma once
+#if !defined(LITE_VERSION)
+#include <stddef.h>
+#include <stdint.h>
+
+// ===========================================================================
+// Per-AP state of the sniffer in one fixed-capacity open-addressing table
+// keyed by the 48-bit BSSID (macToKey()).
+//
+// Linear probing with backward-shift deletion (no tombstones). An intrusive
+// LRU list evicts the least recently touched AP once the table reaches its
+// load limit, skipping APs whose handshake is saved (AP_HS_READY,
+// AP_HS_BEACON_SAVED) until the table is full. Raw beacons and 4-way
+// handshake buffers are too big to sit in every slot, so they live in small
+// pools: a slot owns at most one beacon, handshake buffers are claimed by
+// BSSID and stolen LRU-first. Everything is allocated once in begin();
+// lookups and inserts never touch the heap.
+// Not thread safe: the sniffer guards it with apTableMux.
+// ===========================================================================
+
+#define AP_TABLE_SLOTS_PSRAM 1024 // slot counts must be powers of two
+#define AP_TABLE_SLOTS_SRAM 128
+#define AP_TABLE_BEACONS_PSRAM 128 // raw beacons kept for handshake files
+#define AP_TABLE_BEACONS_SRAM 16
+#define AP_TABLE_EAPOL_PSRAM 16 // handshakes in progress at once
+#define AP_TABLE_EAPOL_SRAM 4
+#define AP_TABLE_LOAD_PCT 75 // evict above this fill
+#define AP_NONE 0xFFFF
+
+#define AP_SSID_MAX 32
+#define AP_BEACON_BUF 512
+#define AP_EAPOL_BUF 256
+
+enum : uint8_t {
+    AP_HS_M1 = 1 << 0, // 4-way progress, M1..M4 buffered/written in order
+    AP_HS_M2 = 1 << 1,
+    AP_HS_M3 = 1 << 2,
+    AP_HS_M4 = 1 << 3,
+    AP_HS_READY = 1 << 4,        // complete handshake saved
+    AP_HS_BEACON_SAVED = 1 << 5, // beacon already in the handshake file
+};
+
+struct BeaconFrame {
+    uint8_t data[AP_BEACON_BUF];
+    uint16_t len;
+    uint32_t timestamp_sec;
+    uint32_t timestamp_usec;
+};
+
+struct EapolFrame {
+    uint8_t data[AP_EAPOL_BUF];
+    uint16_t len;
+    uint32_t timestamp_sec;
+    uint32_t timestamp_usec;
+};
+
+struct Eapol4WayBuffer {
+    EapolFrame m1;
+    EapolFrame m2;
+    EapolFrame m3;
+};
+
+struct ApSlot {
+    uint64_t key;
+    uint32_t lastSeen;   // millis() of the last beacon, 0 = none / stale
+    uint16_t prev, next; // LRU list, most recent first
+    uint16_t beacon;     // beacon pool index or AP_NONE
+    uint8_t channel;     // channel the last beacon was heard on
+    uint8_t flags;       // AP_HS_*
+    uint8_t used;
+    char ssid[AP_SSID_MAX + 1]; // NUL terminated, "" until a beacon names it
+};
+
+class ApTable {
+public:
+    ~ApTable() { end(); }
+
+    // Allocates everything (PSRAM sizes when present). 0 = default counts.
+    bool begin(size_t slots = 0, size_t beacons = 0, size_t eapols = 0);
+    void end();
+    bool ready() const { return _slots != nullptr; }
+    void clear();
+
+    // Slot of `key` (marked most recently used), nullptr when absent.
+    ApSlot *find(uint64_t key);
+    // Same without touching the LRU order.
+    const ApSlot *peek(uint64_t key) const;
+    // Slot of `key`, created (zeroed, `created` set) when absent; evicts the
+    // least recently used AP without a saved handshake when full. nullptr
+    // only before begin().
+    ApSlot *insert(uint64_t key, bool *created = nullptr);
+    void erase(uint64_t key);
+    // Erases every slot for which `pred(slot)` is true; returns how many.
+    template <typename Pred> size_t eraseIf(Pred pred) {
+        size_t n = 0;
+        for (size_t i = 0; i < _cap;) {
+            if (_slots[i].used && pred(_slots[i])) {
+                removeAt(i); // may shift a later slot into i: look again
+                n++;
+            } else {
+                i++;
+            }
+        }
+        return n;
+    }
+    // Visits every slot; `fn` may change a slot but not insert or erase.
+    template <typename Fn> void forEach(Fn fn) {
+        for (size_t i = 0; i < _cap; i++)
+            if (_slots[i].used) fn(_slots[i]);
+    }
+    template <typename Fn> void forEach(Fn fn) const {
+        for (size_t i = 0; i < _cap; i++)
+            if (_slots[i].used) fn((const ApSlot &)_slots[i]);
+    }
+
+    // Raw beacon of a slot; `create` claims a pool entry (nullptr when the
+    // pool is exhausted). dropBeacon() gives it back.
+    BeaconFrame *beacon(ApSlot &slot, bool create);
+    const BeaconFrame *beacon(const ApSlot &slot) const;
+    void dropBeacon(ApSlot &slot);
+
+    // 4-way buffer of `key`; `create` claims one, stealing the least
+    // recently used when all are taken.
+    Eapol4WayBuffer *eapol(uint64_t key, bool create);
+    void dropEapol(uint64_t key);
+    void clearEapol();
+
+    size_t size() const { return _count; }
+    size_t capacity() const { return _cap; }
+    uint32_t evictions() const { return _evictions; }
+
+private:
+    struct EapolOwner {
+        uint64_t key;
+        uint32_t stamp; // last use, 0 = free
+    };
+
+    size_t home(uint64_t key) const;
+    void linkFront(uint16_t i);
+    void unlink(uint16_t i);
+    void removeAt(size_t i);
+
+    ApSlot *_slots = nullptr;
+    size_t _cap = 0, _mask = 0, _count = 0, _limit = 0;
+    uint8_t _shift = 0;
+    uint16_t _head = AP_NONE, _tail = AP_NONE;
+    uint32_t _evictions = 0;
+
+    BeaconFrame *_beacons = nullptr;
+    uint16_t *_beaconFree = nullptr; // stack of free pool indices
+    size_t _beaconCap = 0, _beaconFreeCount = 0;
+
+    Eapol4WayBuffer *_eapol = nullptr;
+    EapolOwner *_eapolOwner = nullptr;
+    size_t _eapolCap = 0;
+    uint32_t _eapolClock = 0;
+};
+
+#endif
@@ -0,0 +1,85 @@
+#if !defined(LITE_VERSION)
+#include "channel_scheduler.h"
+#include <string.h>
+
+void ChannelScheduler::begin(const uint8_t *channels, uint8_t count, uint8_t start, uint32_t now) {
+    _channels = channels;
+    _count = count > HOP_MAX_CHANNELS ? HOP_MAX_CHANNELS : count;
+    _cur = start < _count ? start : 0;
+    _enter = now;
+    _dwell = dwell(_cur);
+    _locked = false;
+}
+
+void ChannelScheduler::reset() {
+    memset(_aps, 0, sizeof(_aps));
+    memset(_eapol, 0, sizeof(_eapol));
+    _locked = false;
+    _stats = {};
+}
+
+void ChannelScheduler::onEapol(uint8_t idx, uint64_t apKey, int msg, uint32_t now) {
+    if (idx >= _count) return;
+    if (_eapol[idx] < 0xFFFF) _eapol[idx]++;
+    if (msg == 1 && !_locked) {
+        _locked = true;
+        _lockKey = apKey;
+        _lockIdx = idx;
+        _lockStart = now;
+        _lockUntil = now + HOP_LOCK_MS;
+        _stats.locks++;
+        return;
+    }
+    if (!_locked || apKey != _lockKey) return;
+    if (msg == 4) unlock(true);
+    else if (msg >= 1) _lockUntil = now + HOP_LOCK_MS; // progress (or a retried M1)
+}
+
+void ChannelScheduler::setActiveAps(uint8_t idx, uint16_t count) {
+    if (idx < _count) _aps[idx] = count;
+}
+
+void ChannelScheduler::unlock(bool completed) {
+    _locked = false;
+    if (completed) _stats.completed++;
+    else _stats.timeouts++;
+}
+
+uint32_t ChannelScheduler::dwell(uint8_t idx) const {
+    if (idx >= _count) return HOP_MIN_DWELL_MS;
+    uint32_t d = HOP_MIN_DWELL_MS + (uint32_t)_aps[idx] * HOP_MS_PER_AP;
+    d += (uint32_t)_eapol[idx] * HOP_MS_PER_EAPOL;
+    return d > HOP_MAX_DWELL_MS ? HOP_MAX_DWELL_MS : d;
+}
+
+bool ChannelScheduler::tick(uint32_t now, uint8_t &idx) {
+    if (!_count) return false;
+    if (_locked) {
+        if ((int32_t)(now - _lockUntil) < 0 && (int32_t)(now - _lockStart) < HOP_LOCK_MAX_MS) {
+            if (_cur == _lockIdx) return false;
+            // Callback saw the M1 just before a hop: go back for the rest.
+            _cur = _lockIdx;
+            _enter = now;
+            _dwell = dwell(_cur);
+            _stats.hops++;
+            idx = _cur;
+            return true;
+        }
+        unlock(false);
+    }
+    if (now - _enter < _dwell) return false;
+
+    uint8_t next = _cur + 1;
+    if (next >= _count) {
+        next = 0;
+        _stats.rounds++;
+        for (uint8_t i = 0; i < _count; i++) _eapol[i] >>= 1;
+    }
+    _cur = next;
+    _enter = now;
+    _dwell = dwell(_cur);
+    _stats.hops++;
+    idx = _cur;
+    return true;
+}
+#endif
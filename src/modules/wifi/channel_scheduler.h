@@ -0,0 +1,83 @@
+#pragma once
+#if !defined(LITE_VERSION)
+#include <stddef.h>
+#include <stdint.h>
+
+// ===========================================================================
+// Adaptive channel hopping for the sniffer.
+//
+// Every channel of the list is visited once per round, but the dwell time is
+// weighted by its activity: HOP_MIN_DWELL_MS for a quiet channel (enough to
+// catch a beacon and discover new APs), plus HOP_MS_PER_AP per active AP and
+// HOP_MS_PER_EAPOL per recent EAPOL frame, capped at HOP_MAX_DWELL_MS. EAPOL
+// activity is halved every round so old bursts fade out.
+//
+// An M1 locks the scheduler onto its channel until that AP's M4 arrives or
+// HOP_LOCK_MS passes without progress (M2/M3 extend the lock, up to
+// HOP_LOCK_MAX_MS in total), so the rest of the 4-way is not lost to a hop.
+// Times are millis(). Not thread safe: the sniffer guards it with hopMux.
+// ===========================================================================
+
+#define HOP_MAX_CHANNELS 64
+#define HOP_MIN_DWELL_MS 120   // quiet channel: discovery only
+#define HOP_MS_PER_AP 40       // per AP with a recent beacon
+#define HOP_MS_PER_EAPOL 200   // per recent EAPOL frame
+#define HOP_MAX_DWELL_MS 1500  // cap for a busy channel
+#define HOP_LOCK_MS 1500       // wait this long for the next message of a 4-way
+#define HOP_LOCK_MAX_MS 5000   // longest lock on one handshake
+
+struct ChannelSchedulerStats {
+    uint32_t hops;
+    uint32_t rounds;
+    uint32_t locks;     // M1 seen, channel locked
+    uint32_t completed; // lock ended by M4
+    uint32_t timeouts;  // lock ended without M4
+};
+
+class ChannelScheduler {
+public:
+    // `channels` must outlive the scheduler. Starts dwelling on index
+    // `start` and drops any lock; weights and stats are kept.
+    void begin(const uint8_t *channels, uint8_t count, uint8_t start, uint32_t now);
+    // Forgets weights, lock and stats.
+    void reset();
+
+    // Promiscuous callback: EAPOL message `msg` (1..4, 0 = unknown) of AP
+    // `apKey` heard on channel index `idx`.
+    void onEapol(uint8_t idx, uint64_t apKey, int msg, uint32_t now);
+    // APs with a recent beacon on channel index `idx` (refreshed by the UI).
+    void setActiveAps(uint8_t idx, uint16_t count);
+
+    // Returns true and sets `idx` when it is time to move to another channel.
+    bool tick(uint32_t now, uint8_t &idx);
+    // Dwell the scheduler would give channel index `idx` right now.
+    uint32_t dwell(uint8_t idx) const;
+
+    uint8_t current() const { return _cur; }
+    uint8_t channel() const { return _channels ? _channels[_cur] : 0; }
+    bool locked() const { return _locked; }
+    uint8_t count() const { return _count; }
+    const ChannelSchedulerStats &stats() const { return _stats; }
+
+private:
+    void unlock(bool completed);
+
+    const uint8_t *_channels = nullptr;
+    uint8_t _count = 0;
+    uint8_t _cur = 0;
+    uint32_t _enter = 0; // millis() the current dwell started
+    uint32_t _dwell = HOP_MIN_DWELL_MS;
+
+    uint16_t _aps[HOP_MAX_CHANNELS] = {};
+    uint16_t _eapol[HOP_MAX_CHANNELS] = {}; // halved every round
+
+    bool _locked = false;
+    uint64_t _lockKey = 0;
+    uint8_t _lockIdx = 0;
+    uint32_t _lockStart = 0;
+    uint32_t _lockUntil = 0;
+
+    ChannelSchedulerStats _stats = {};
+};
+
+#endif
@@ -0,0 +1,432 @@
+#if !defined(LITE_VERSION)
+#include "pcap_writer.h"
+#include "sniffer.h"
+#include <esp_heap_caps.h>
+#include <esp_random.h>
+#include <esp_timer.h>
+
+struct PcapGlobalHeader {
+    uint32_t magic;
+    uint16_t versionMajor;
+    uint16_t versionMinor;
+    int32_t thiszone;
+    uint32_t sigfigs;
+    uint32_t snaplen;
+    uint32_t network;
+};
+
+struct PcapRecordHeader {
+    uint32_t tsSec;
+    uint32_t tsUsec;
+    uint32_t inclLen;
+    uint32_t origLen;
+};
+
+// pcapng (draft-ietf-opsawg-pcapng), little endian section.
+#define PCAPNG_SHB 0x0A0D0D0A
+#define PCAPNG_IDB 0x00000001
+#define PCAPNG_EPB 0x00000006
+#define PCAPNG_BOM 0x1A2B3C4D
+
+struct PcapNgEpbHeader {
+    uint32_t type;
+    uint32_t totalLen;
+    uint32_t interfaceId;
+    uint32_t tsHigh;
+    uint32_t tsLow;
+    uint32_t capLen;
+    uint32_t origLen;
+};
+
+// Appends one option (code, length, value padded to 32 bits) at `p`.
+static size_t pcapng_option(uint8_t *p, uint16_t code, const void *value, uint16_t len) {
+    memcpy(p, &code, 2);
+    memcpy(p + 2, &len, 2);
+    memcpy(p + 4, value, len);
+    size_t padded = (len + 3) & ~3u;
+    memset(p + 4 + len, 0, padded - len);
+    return 4 + padded;
+}
+
+static size_t pcapng_option(uint8_t *p, uint16_t code, const char *text) {
+    return pcapng_option(p, code, text, strlen(text));
+}
+
+// Closes a block built in `blk`: end-of-options, trailing length, both length fields.
+static size_t pcapng_finish(uint8_t *blk, size_t len) {
+    memset(blk + len, 0, 4); // opt_endofopt
+    len += 4;
+    uint32_t total = len + 4;
+    memcpy(blk + 4, &total, 4);
+    memcpy(blk + len, &total, 4);
+    return total;
+}
+
+static uint16_t channel_freq(uint8_t ch) {
+    if (ch == 14) return 2484;
+    if (ch < 14) return 2407 + 5 * ch;
+    return 5000 + 5 * ch;
+}
+
+// Radiotap header for `r` into `out` (PCAP_RADIOTAP_MAX bytes); returns its length.
+static size_t radiotap_build(uint8_t *out, const PcapRadio *r) {
+    memset(out, 0, PCAP_RADIOTAP_MAX);
+    size_t off = 8; // it_version, it_pad, it_len, it_present
+    uint32_t present = 0;
+    if (r) {
+        present |= 1u << 0; // TSFT, 8-byte aligned at 8
+        memcpy(out + off, &r->tsft, 8);
+        off += 8;
+        present |= 1u << 1; // Flags
+        out[off++] = 0;
+        if (r->rate) {
+            present |= 1u << 2; // Rate
+            out[off++] = r->rate;
+        }
+        if (r->channel) {
+            present |= 1u << 3; // Channel: freq, flags (2-byte aligned)
+            off = (off + 1) & ~1u;
+            uint16_t freq = channel_freq(r->channel);
+            uint16_t flags = r->channel <= 14 ? 0x0080 : 0x0100; // 2 / 5 GHz
+            // HT: dynamic CCK-OFDM, else CCK for 1-11 Mbps on 2.4 GHz, else OFDM
+            if (r->mcs != 0xFF) flags |= 0x0400;
+            else if (r->channel <= 14 && r->rate && r->rate <= 22) flags |= 0x0020;
+            else flags |= 0x0040;
+            memcpy(out + off, &freq, 2);
+            memcpy(out + off + 2, &flags, 2);
+            off += 4;
+        }
+        present |= 1u << 5; // dBm antenna signal
+        out[off++] = (uint8_t)r->rssi;
+        if (r->noise) {
+            present |= 1u << 6; // dBm antenna noise
+            out[off++] = (uint8_t)r->noise;
+        }
+        if (r->mcs != 0xFF) {
+            present |= 1u << 19;             // MCS: known, flags, index
+            out[off++] = 0x01 | 0x02 | 0x04; // bandwidth, MCS index and guard interval known
+            out[off++] = (r->ht40 ? 0x01 : 0x00) | (r->shortGi ? 0x04 : 0x00);
+            out[off++] = r->mcs;
+        }
+    }
+    uint16_t len = off;
+    memcpy(out + 2, &len, 2);
+    memcpy(out + 4, &present, 4);
+    return off;
+}
+
+bool PcapWriter::allocBuffer() {
+    if (_buf) return true;
+    // Internal DMA-capable RAM lets the SD driver skip its bounce copy;
+    // shrink before giving up on it, PSRAM is the last resort.
+    for (size_t cap = psramFound() ? PCAP_WRITER_BLOCK_PSRAM : PCAP_WRITER_BLOCK_SRAM;
+         cap >= PCAP_WRITER_BLOCK_MIN;
+         cap /= 2) {
+        _buf = (uint8_t *)heap_caps_malloc(cap, MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+        if (_buf) {
+            _cap = cap;
+            return true;
+        }
+    }
+    if (psramFound()) {
+        _buf = (uint8_t *)heap_caps_malloc(PCAP_WRITER_BLOCK_PSRAM, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (_buf) {
+            _cap = PCAP_WRITER_BLOCK_PSRAM;
+            return true;
+        }
+    }
+    _cap = 0; // unbuffered, still correct
+    return false;
+}
+
+void PcapWriter::freeBuffer() {
+    if (_buf) heap_caps_free(_buf);
+    _buf = nullptr;
+    _cap = 0;
+}
+
+bool PcapWriter::open(FS &fs, const String &prefix, int index, uint32_t rotateBytes) {
+    close();
+    _fs = &fs;
+    _prefix = prefix;
+    _rotateBytes = rotateBytes;
+    return openIndex(index);
+}
+
+bool PcapWriter::openIndex(int index) {
+    if (!_fs) return false;
+    const char *ext = _format == PcapFormat::PcapNg ? ".pcapng" : ".pcap";
+    _path = _prefix + String(index) + ext;
+    while (_fs->exists(_path)) {
+        index++;
+        _path = _prefix + String(index) + ext;
+    }
+    _index = index;
+    _file = _fs->open(_path, FILE_WRITE);
+    if (!_file) return false;
+    allocBuffer();
+    _len = 0;
+    _fileBytes = 0;
+    _unsynced = 0;
+    _lastSync = millis();
+    _open = true;
+    _stats.files++;
+    return writeFileHeader();
+}
+
+bool PcapWriter::writeFileHeader() {
+    if (_format == PcapFormat::Pcap) {
+        PcapGlobalHeader hdr = {0xa1b2c3d4, 2, 4, 0, 0, PCAP_SNAPLEN, PCAP_LINKTYPE_IEEE802_11};
+        return append(&hdr, sizeof(hdr));
+    }
+    // Section Header Block; interfaces follow lazily, one per channel.
+    memset(_ifOfChannel, 0, sizeof(_ifOfChannel));
+    _ifCount = 0;
+    uint8_t blk[128];
+    uint32_t type = PCAPNG_SHB, bom = PCAPNG_BOM;
+    uint16_t major = 1, minor = 0;
+    int64_t sectionLen = -1; // unknown, the file is streamed
+    memcpy(blk, &type, 4);
+    memcpy(blk + 8, &bom, 4);
+    memcpy(blk + 12, &major, 2);
+    memcpy(blk + 14, &minor, 2);
+    memcpy(blk + 16, &sectionLen, 8);
+    size_t len = 24;
+#ifdef CONFIG_IDF_TARGET
+    len += pcapng_option(blk + len, 2, CONFIG_IDF_TARGET); // shb_hardware
+#endif
+    len += pcapng_option(blk + len, 4, "Bruce sniffer"); // shb_userappl
+    return append(blk, pcapng_finish(blk, len));
+}
+
+int PcapWriter::interfaceFor(uint8_t channel) {
+    if (_ifOfChannel[channel]) return _ifOfChannel[channel] - 1;
+    // Interface Description Block: Radiotap link type, microsecond timestamps.
+    uint8_t blk[96];
+    uint32_t type = PCAPNG_IDB, snaplen = PCAP_SNAPLEN + PCAP_RADIOTAP_MAX;
+    uint16_t link = PCAP_LINKTYPE_RADIOTAP, reserved = 0;
+    memcpy(blk, &type, 4);
+    memcpy(blk + 8, &link, 2);
+    memcpy(blk + 10, &reserved, 2);
+    memcpy(blk + 12, &snaplen, 4);
+    size_t len = 16;
+    char desc[32];
+    if (channel) snprintf(desc, sizeof(desc), "channel %u (%u MHz)", channel, channel_freq(channel));
+    else snprintf(desc, sizeof(desc), "channel unknown");
+    uint8_t tsresol = 6; // 10^-6 s
+    len += pcapng_option(blk + len, 2, "wlan0mon"); // if_name
+    len += pcapng_option(blk + len, 3, desc);       // if_description
+    len += pcapng_option(blk + len, 9, &tsresol, 1); // if_tsresol
+    if (!append(blk, pcapng_finish(blk, len))) return -1;
+    _ifOfChannel[channel] = ++_ifCount;
+    return _ifCount - 1;
+}
+
+bool PcapWriter::addEnhanced(uint64_t ts, uint32_t len, const uint8_t *buf, const PcapRadio *radio) {
+    int ifId = interfaceFor(radio ? radio->channel : 0);
+    if (ifId < 0) return false;
+    uint8_t rt[PCAP_RADIOTAP_MAX];
+    size_t rtLen = radiotap_build(rt, radio);
+    uint32_t capLen = rtLen + len;
+    uint32_t pad = ((capLen + 3) & ~3u) - capLen;
+    uint32_t total = sizeof(PcapNgEpbHeader) + capLen + pad + 4;
+    PcapNgEpbHeader hdr = {
+        PCAPNG_EPB, total, (uint32_t)ifId, (uint32_t)(ts >> 32), (uint32_t)ts, capLen, capLen
+    };
+    static const uint8_t zeros[4] = {0};
+    return append(&hdr, sizeof(hdr)) && append(rt, rtLen) && append(buf, len) && append(zeros, pad) &&
+           append(&total, 4);
+}
+
+bool PcapWriter::rotate() {
+    if (!_open) return false;
+    int next = _index + 1;
+    sync(true);
+    _file.close();
+    _open = false;
+    return openIndex(next);
+}
+
+void PcapWriter::close() {
+    if (_open) {
+        sync(true);
+        _file.close();
+        _open = false;
+    }
+    freeBuffer();
+}
+
+bool PcapWriter::writeOut(size_t len) {
+    if (!len) return true;
+    size_t n = _file.write(_buf, len);
+    _stats.writes++;
+    _fileBytes += n;
+    _unsynced += n;
+    if (n != len) {
+        _stats.errors++;
+        _len = 0; // the file is broken (card pulled / full), don't retry forever
+        return false;
+    }
+    _len -= len;
+    if (_len) memmove(_buf, _buf + len, _len);
+    return true;
+}
+
+bool PcapWriter::append(const void *data, size_t len) {
+    if (!_cap) {
+        size_t n = _file.write((const uint8_t *)data, len);
+        _stats.writes++;
+        _fileBytes += n;
+        _unsynced += n;
+        if (n != len) _stats.errors++;
+        return n == len;
+    }
+    const uint8_t *src = (const uint8_t *)data;
+    while (len) {
+        size_t chunk = _cap - _len;
+        if (chunk > len) chunk = len;
+        memcpy(_buf + _len, src, chunk);
+        _len += chunk;
+        src += chunk;
+        len -= chunk;
+        if (_len == _cap && !writeOut(_cap)) return false;
+    }
+    return true;
+}
+
+bool PcapWriter::add(
+    uint32_t ts_sec, uint32_t ts_usec, uint32_t len, const uint8_t *buf, const PcapRadio *radio
+) {
+    if (!_open) return false;
+    if (_format == PcapFormat::PcapNg) {
+        if (!addEnhanced((uint64_t)ts_sec * 1000000ULL + ts_usec, len, buf, radio)) return false;
+    } else {
+        PcapRecordHeader hdr = {ts_sec, ts_usec, len, len};
+        if (!append(&hdr, sizeof(hdr)) || !append(buf, len)) return false;
+    }
+    _stats.records++;
+
+    if (_unsynced >= PCAP_SYNC_BYTES) {
+        _file.flush();
+        _stats.syncs++;
+        _unsynced = 0;
+        _lastSync = millis();
+    }
+    if (_rotateBytes && size() >= _rotateBytes) return rotate();
+    return true;
+}
+
+void PcapWriter::sync(bool force) {
+    if (!_open) return;
+    if (!force && millis() - _lastSync < PCAP_SYNC_MS) return;
+    // _fileBytes is always a multiple of the sector size until closing,
+    // so writing whole sectors keeps every later block write aligned.
+    size_t whole = force ? _len : _len - _len % PCAP_SECTOR;
+    if (_cap) writeOut(whole);
+    if (_unsynced) {
+        _file.flush();
+        _stats.syncs++;
+        _unsynced = 0;
+    }
+    _lastSync = millis();
+}
+
+/* ── SD throughput benchmark (serial `pcapbench`) ── */
+bool pcap_writer_bench(FS &fs, uint32_t megabytes) {
+    if (megabytes < 1) megabytes = 1;
+    const uint32_t total = megabytes * 1024 * 1024;
+    uint8_t frame[1500];
+    esp_fill_random(frame, sizeof(frame));
+    // Frame sizes of a busy channel: beacons, data, ACK-sized control frames.
+    static const uint16_t sizes[] = {260, 1500, 42, 320, 1200, 60, 580, 1500};
+    if (!fs.exists("/BrucePCAP")) fs.mkdir("/BrucePCAP");
+
+    // Legacy path: five small writes per frame.
+    const char *legacyPath = "/BrucePCAP/bench_legacy.pcap";
+    fs.remove(legacyPath);
+    File f = fs.open(legacyPath, FILE_WRITE);
+    if (!f) {
+        Serial.println("pcapbench: cannot create file");
+        return false;
+    }
+    writeHeader(f);
+    uint32_t frames = 0, bytes = 0, worst = 0;
+    int64_t t0 = esp_timer_get_time();
+    int64_t lastSync = t0;
+    while (bytes < total) {
+        uint16_t len = sizes[frames % (sizeof(sizes) / sizeof(sizes[0]))];
+        int64_t s = esp_timer_get_time();
+        newPacketSD(frames, 0, len, frame, f);
+        if (s - lastSync > 1000000) { // the sniffer used to flush once a second
+            f.flush();
+            lastSync = s;
+        }
+        uint32_t dt = esp_timer_get_time() - s;
+        if (dt > worst) worst = dt;
+        bytes += len + sizeof(PcapRecordHeader);
+        frames++;
+        if ((frames & 255) == 0) vTaskDelay(1); // TWDT
+    }
+    f.close();
+    double legacySec = (esp_timer_get_time() - t0) / 1e6;
+    uint32_t legacyFrames = frames;
+    Serial.printf(
+        "pcapbench: legacy   %.2f MB/s, %.0f frames/s, worst frame %lu us\n",
+        bytes / legacySec / 1048576.0,
+        frames / legacySec,
+        (unsigned long)worst
+    );
+    fs.remove(legacyPath);
+
+    // Same frames through PcapWriter: classic pcap, then pcapng with Radiotap.
+    bool ok = true;
+    for (PcapFormat format : {PcapFormat::Pcap, PcapFormat::PcapNg}) {
+        const bool ng = format == PcapFormat::PcapNg;
+        PcapWriter w;
+        w.setFormat(format);
+        if (!w.open(fs, "/BrucePCAP/bench_", 0, 0)) {
+            Serial.println("pcapbench: cannot create file");
+            return false;
+        }
+        PcapRadio radio = {0, 6, -60, -95, 0, 7, false, true};
+        frames = worst = 0;
+        bool run = true;
+        t0 = esp_timer_get_time();
+        while (w.size() < total && run) {
+            uint16_t len = sizes[frames % (sizeof(sizes) / sizeof(sizes[0]))];
+            int64_t s = esp_timer_get_time();
+            radio.tsft = s;
+            run = w.add(frames, 0, len, frame, &radio);
+            w.sync();
+            uint32_t dt = esp_timer_get_time() - s;
+            if (dt > worst) worst = dt;
+            frames++;
+            if ((frames & 255) == 0) vTaskDelay(1);
+        }
+        String path = w.path();
+        size_t block = w.blockSize();
+        uint32_t written = w.size();
+        w.close();
+        const PcapWriterStats &st = w.stats();
+        double sec = (esp_timer_get_time() - t0) / 1e6;
+        Serial.printf(
+            "pcapbench: %s %.2f MB/s, %.0f frames/s, worst frame %lu us (x%.2f frames/s)\n",
+            ng ? "pcapng  " : "buffered",
+            written / sec / 1048576.0,
+            frames / sec,
+            (unsigned long)worst,
+            (frames / sec) / (legacyFrames / legacySec)
+        );
+        Serial.printf(
+            "pcapbench: %lu KB block, %lu writes, %lu syncs, %lu errors\n",
+            (unsigned long)(block / 1024),
+            (unsigned long)st.writes,
+            (unsigned long)st.syncs,
+            (unsigned long)st.errors
+        );
+        fs.remove(path);
+        ok = ok && run && st.errors == 0;
+    }
+    return ok;
+}
+#endif
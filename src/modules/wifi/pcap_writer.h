@@ -0,0 +1,124 @@
+#pragma once
+#if !defined(LITE_VERSION)
+#include <Arduino.h>
+#include <FS.h>
+
+// ===========================================================================
+// Buffered pcap / pcapng file writer for the sniffer.
+//
+// Records are packed into a RAM block (global header included) and only
+// whole blocks reach the file, so every File::write() is one large write at
+// a block-aligned offset instead of five small unaligned ones per frame.
+// The file is flushed to the card when PCAP_SYNC_MS or PCAP_SYNC_BYTES is
+// reached, and a new <prefix>N.pcap is started once PCAP_ROTATE_BYTES is
+// exceeded. Not thread safe: callers serialize access (sniffer fileMutex).
+//
+// pcapng files carry one Section Header per file, one Interface
+// Description Block per channel seen (if_description "channel N (F MHz)")
+// and Enhanced Packet Blocks at microsecond resolution whose data starts
+// with a Radiotap header: TSFT, rate or MCS, channel, RSSI and noise floor.
+// ===========================================================================
+
+#define PCAP_WRITER_BLOCK_PSRAM (16 * 1024) // RAM block, multiple of 512
+#define PCAP_WRITER_BLOCK_SRAM (8 * 1024)
+#define PCAP_WRITER_BLOCK_MIN (4 * 1024)
+#define PCAP_SECTOR 512                    // partial writes keep this alignment
+#define PCAP_SYNC_MS 2000                  // flush at most this old
+#define PCAP_SYNC_BYTES (256 * 1024)       // ... or after this much data
+#define PCAP_ROTATE_BYTES (8 * 1024 * 1024) // start raw_N+1 after this size
+#define PCAP_SNAPLEN 2500
+#define PCAP_LINKTYPE_IEEE802_11 105
+#define PCAP_LINKTYPE_RADIOTAP 127
+#define PCAP_RADIOTAP_MAX 32 // longest Radiotap header add() builds
+
+enum class PcapFormat : uint8_t { Pcap, PcapNg };
+
+// Per-frame radio metadata (pcapng only, ignored for classic pcap).
+struct PcapRadio {
+    uint64_t tsft;   // receiver timestamp, us
+    uint8_t channel; // 0 = unknown
+    int8_t rssi;     // dBm
+    int8_t noise;    // dBm, 0 = unknown
+    uint8_t rate;    // legacy rate in 500 kbps units, 0 = HT frame / unknown
+    uint8_t mcs;     // HT MCS index, 0xFF = not HT
+    bool ht40;       // HT 40 MHz
+    bool shortGi;    // HT short guard interval
+};
+
+struct PcapWriterStats {
+    uint32_t records;
+    uint32_t writes; // File::write() calls
+    uint32_t syncs;  // File::flush() calls
+    uint32_t errors; // short writes
+    uint32_t files;  // files opened, rotations included
+};
+
+class PcapWriter {
+public:
+    ~PcapWriter() { close(); }
+
+    // Format of the files opened from now on (default classic pcap).
+    void setFormat(PcapFormat format) { _format = format; }
+    PcapFormat format() const { return _format; }
+
+    // Opens the first free `<prefix><index>.pcap` (.pcapng) at or after
+    // `index` and writes the file header. `rotateBytes` 0 disables rotation.
+    bool open(FS &fs, const String &prefix, int index = 0, uint32_t rotateBytes = PCAP_ROTATE_BYTES);
+    // Starts the next file of the series right away.
+    bool rotate();
+    // Writes what is buffered and closes the file.
+    void close();
+    bool isOpen() const { return _open; }
+
+    // Appends one record; false if the file is closed or a write failed.
+    // `radio` may be null (pcapng then gets an empty Radiotap header).
+    bool add(
+        uint32_t ts_sec, uint32_t ts_usec, uint32_t len, const uint8_t *buf, const PcapRadio *radio = nullptr
+    );
+    // Periodic hook: flushes once PCAP_SYNC_MS passed since the last sync
+    // (or always when `force`). Only whole sectors are written unless
+    // closing, so later block writes stay aligned.
+    void sync(bool force = false);
+
+    const String &path() const { return _path; }
+    int index() const { return _index; }
+    uint32_t size() const { return _fileBytes + _len; } // bytes incl. buffered
+    size_t blockSize() const { return _cap; }
+    const PcapWriterStats &stats() const { return _stats; }
+
+private:
+    bool openIndex(int index);
+    bool writeFileHeader();
+    bool addEnhanced(uint64_t ts, uint32_t len, const uint8_t *buf, const PcapRadio *radio);
+    int interfaceFor(uint8_t channel);
+    bool append(const void *data, size_t len);
+    bool writeOut(size_t len);
+    bool allocBuffer();
+    void freeBuffer();
+
+    FS *_fs = nullptr;
+    File _file;
+    String _prefix;
+    String _path;
+    int _index = 0;
+    uint32_t _rotateBytes = 0;
+    bool _open = false;
+    PcapFormat _format = PcapFormat::Pcap;
+    uint8_t _ifOfChannel[256]; // pcapng: interface id + 1 per channel, 0 = no IDB yet
+    uint32_t _ifCount = 0;
+
+    uint8_t *_buf = nullptr;
+    size_t _cap = 0;          // 0: no buffer, records go straight to the file
+    size_t _len = 0;          // buffered bytes
+    uint32_t _fileBytes = 0;  // bytes handed to the file
+    uint32_t _unsynced = 0;   // bytes written since the last flush
+    uint32_t _lastSync = 0;   // millis() of the last flush
+    PcapWriterStats _stats = {};
+};
+
+// Writes `megabytes` of synthetic frames to `fs` the old way (five writes
+// per frame) and through PcapWriter as pcap and pcapng, printing the
+// sustained MB/s of each (serial `pcapbench`).
+bool pcap_writer_bench(FS &fs, uint32_t megabytes);
+
+#endif
@@ -32,6 +32,10 @@
 #include "core/sd_functions.h"
 #include "core/wifi/webInterface.h"
 #include "core/wifi/wifi_common.h"
+#include "ap_table.h"
+#include "channel_scheduler.h"
+#include "pcap_writer.h"
+#include "wifi_recover.h"
 #include <Arduino.h>
 #include <globals.h>
 #if defined(ESP32)
@@ -45,18 +49,18 @@
 
 //===== SETTINGS =====//
 #define FILENAME "raw_"
-#define SAVE_INTERVAL 10            // save new file every 30s
-#define CHANNEL_HOPPING true        // if true it will scan on all channels
-#define HOP_INTERVAL 214            // in ms (only necessary if channelHopping is true)
+#define CHANNEL_HOPPING true        // start with adaptive hopping over all channels (ChannelScheduler)
 #define DEAUTH_INTERVAL (15 * 1000) // Send deauth packets every ms
 #define EAPOL_ONLY true
+#ifndef RAW_PCAPNG
+#define RAW_PCAPNG true // raw/deauth captures as pcapng with channel/RSSI/rate per frame
+#endif
 
 //===== Run-Time variables =====//
 unsigned long lastTime = 0;
-unsigned long lastChannelChange = 0;
+unsigned long lastHopRefresh = 0;
 uint32_t lastRedraw = 0;
 uint8_t ch = 0;
-bool rawFileOpen = false;
 bool isLittleFS = true;
 bool littleFsWasFull = false; // true when we exit because LittleFS ran out
 volatile bool littleFsSpaceAvailable = true;
@@ -68,14 +72,13 @@ uint32_t beacon_frames = 0;
 uint32_t start_time = 0;
 long deauth_tmp = 0;
 
-File _pcap_file;
-File _deauth_file;
-bool deauthFileOpen = false;
+PcapWriter rawWriter;   // raw_N.pcap, rotated by size
+PcapWriter deauthWriter; // deauth_N.pcap
 SnifferMode currentMode = SnifferMode::HandshakesOnly;
 bool sdDetected = false;
 FS *activeFs = &LittleFS;
 SemaphoreHandle_t fileMutex = nullptr;
-QueueHandle_t snifferQueue = nullptr;
+SnifferRing snifferRing;
 TaskHandle_t snifferWriterHandle = nullptr;
 StaticSemaphore_t fileMutexBuffer;
 SemaphoreHandle_t handshakeMutex = nullptr;
@@ -86,70 +89,47 @@ String filename = "/BrucePCAP/" + (String)FILENAME + ".pcap";
 String deauthFilename = "/BrucePCAP/deauth_0.pcap";
 int deauthFileIndex = 0;
 int rawFileIndex = 0;
-std::map<uint64_t, String> beaconSsidCache;
 const size_t MAX_CAPTURE_SSID_LEN = 32;
-const size_t SNIFFER_QUEUE_DEPTH = 48;
-std::set<uint64_t> handshakeReadyBssids;
-portMUX_TYPE handshakeReadyMux = portMUX_INITIALIZER_UNLOCKED;
-std::set<uint64_t> handshakeBeaconLogged;
-std::map<uint64_t, HandshakeTracker> perApHandshakeTracker;
-
-// --- 4-way handshake frame buffer ---
-// Buffer M1, M2, and M3 in memory; flush all 4 frames when M4 arrives.
-constexpr size_t EAPOL_BUF_SIZE = 256;
-struct EapolFrame {
-    uint8_t data[EAPOL_BUF_SIZE] = {0};
-    uint16_t len = 0;
-    uint32_t timestamp_sec = 0;
-    uint32_t timestamp_usec = 0;
-};
-struct Eapol4WayBuffer {
-    EapolFrame m1;
-    EapolFrame m2;
-    EapolFrame m3;
-};
-std::map<uint64_t, Eapol4WayBuffer> eapol4WayBuffer;
-
-// --- Raw beacon cache (per AP) ---
-// Keeps the last beacon frame seen for an AP so it can be written as the
-// FIRST record of a handshake pcap (before M1..M4). wifi_recover.cpp's
-// parser stops reading once it has M2+M3, so a beacon appended only after
-// the handshake completes would never be seen; writing it up front fixes
-// that without needing a live beacon after the handshake.
-constexpr size_t BEACON_BUF_SIZE = 512;
-// Cap on how many APs we keep raw beacons for at once. At ~570 B/entry this
-// bounds the cache to ~36 KB even in very dense environments (hundreds of
-// networks). Stale entries are also pruned by time in cleanupStaleBeacons();
-// this cap only guards against bursts of many simultaneously-active APs.
-constexpr size_t MAX_BEACON_CACHE = 64;
-struct BeaconFrame {
-    uint8_t data[BEACON_BUF_SIZE] = {0};
-    uint16_t len = 0;
-    uint32_t timestamp_sec = 0;
-    uint32_t timestamp_usec = 0;
-};
-std::map<uint64_t, BeaconFrame> beaconRawCache;
-
-// --- New globals for beacon last-seen tracking & cleanup ---
-std::map<uint64_t, uint32_t> beaconLastSeen; // key = macToKey(mac) -> last seen millis()
-const uint32_t BEACON_TIMEOUT_MS = 120000;   // 2 minutes
+const size_t SNIFFER_RELEASE_BATCH = 16; // ring records handled per tail update
+
+// --- Per-AP state ---
+// SSID, last beacon time/channel, 4-way progress (M1..M3 are buffered and
+// written together with M4) and the last raw beacon, which goes FIRST in a
+// handshake pcap: wifi_recover.cpp's parser stops reading once it has M2+M3,
+// so a beacon appended after the handshake would never be seen. One slot per
+// BSSID, allocated once (ApTable), shared by the promiscuous callback, the
+// writer task and the UI under apTableMux.
+ApTable apTable;
+portMUX_TYPE apTableMux = portMUX_INITIALIZER_UNLOCKED;
+const uint32_t BEACON_TIMEOUT_MS = 120000; // 2 minutes
 unsigned long lastBeaconCleanup = 0;
 
-struct SnifferQueueItem {
-    wifi_promiscuous_pkt_t *packet = nullptr;
-    uint32_t ts_sec = 0;
-    uint32_t ts_usec = 0;
-    uint16_t raw_len = 0;
-    wifi_promiscuous_pkt_type_t type = WIFI_PKT_MISC;
-    bool isBeacon = false;
-    bool isHandshakeFrame = false;
-    bool isDeauthFrame = false;
-    bool saveRaw = false;
-    bool saveHandshake = false;
-    bool saveDeauth = false;
-    uint8_t bssid[6] = {0};
-    char ssid[MAX_CAPTURE_SSID_LEN + 1] = {0};
+// Adaptive hopping: dwell weighted by active APs and EAPOL per channel, locked
+// on a channel from M1 until M4 (channel_scheduler.h). The callback reports
+// EAPOL, the UI loop refreshes AP counts and applies the hops. Next/Prev
+// switch to manual channel selection.
+ChannelScheduler hopScheduler;
+portMUX_TYPE hopMux = portMUX_INITIALIZER_UNLOCKED;
+bool autoHop = CHANNEL_HOPPING;
+
+// One frame in snifferRing: this header, then the wifi_promiscuous_pkt_t copy
+// (rx_ctrl + payload). The writer task uses both in place.
+enum : uint8_t {
+    SNIFF_REC_BEACON = 1 << 0,
+    SNIFF_REC_RAW = 1 << 1,
+    SNIFF_REC_HANDSHAKE = 1 << 2,
+    SNIFF_REC_DEAUTH = 1 << 3,
+};
+struct SnifferRecord {
+    uint32_t ts_sec;
+    uint32_t ts_usec;
+    uint16_t raw_len;
+    uint8_t flags; // SNIFF_REC_*
+    uint8_t reserved;
+    char ssid[MAX_CAPTURE_SSID_LEN + 4]; // NUL terminated, padded so the packet is word aligned
+    wifi_promiscuous_pkt_t *packet() { return (wifi_promiscuous_pkt_t *)(this + 1); }
 };
+static_assert(sizeof(SnifferRecord) % 4 == 0, "packet after SnifferRecord must stay word aligned");
 
 struct FrameInfo {
     bool valid = false;
@@ -159,28 +139,23 @@ struct FrameInfo {
     int eapolMsgNum = -1;
     uint8_t apAddr[6] = {0};
     uint64_t apKey = 0;
-    String ssid;
+    char ssid[MAX_CAPTURE_SSID_LEN + 1] = {0};
 };
 
 static bool ensureSnifferBackend();
 static void snifferWriterTask(void *param);
-static wifi_promiscuous_pkt_t *duplicatePacket(const wifi_promiscuous_pkt_t *pkt, uint16_t length);
-static void releasePacketCopy(wifi_promiscuous_pkt_t *packet);
 static uint64_t macToKey(const void *mac); // changed to const void *
 static void copyMac(uint8_t *dest, const uint8_t *src);
-static String extractSsid(const wifi_promiscuous_pkt_t *packet);
-static void copySsidToBuffer(const String &ssid, char *buffer, size_t len);
+static void extractSsid(const wifi_promiscuous_pkt_t *packet, char *out, size_t len);
 static String sanitizeSsid(const char *ssid);
 static String macToHex(const uint8_t *mac);
 static String buildHandshakePath(const uint8_t *mac, const char *ssid);
 static bool handshakeFileExists(const String &path);
 static bool shouldSaveBeaconForHandshake(const uint8_t *mac);
-static void resetHandshakeTracking();
+static uint8_t apFlags(uint64_t key);
+static void apSetFlags(uint64_t key, uint8_t set, uint8_t clear = 0);
 static bool handshakeRecordExists(const String &path);
 static void registerHandshakeRecord(const String &path);
-static bool handshakeBeaconRecorded(uint64_t key);
-static void registerHandshakeBeacon(uint64_t key);
-static void resetHandshakeBeaconCache();
 static void ensureDirectories(FS &Fs);
 static void openDeauthFile(FS &Fs);
 static void closeRawFile();
@@ -192,7 +167,7 @@ static bool rawCaptureEnabled();
 static bool handshakeCaptureEnabled();
 static bool deauthCaptureEnabled();
 static FrameInfo analyzeFrame(wifi_promiscuous_pkt_t *pkt);
-static String resolveSsidForFrame(FrameInfo &info, const wifi_promiscuous_pkt_t *packet);
+static void resolveSsidForFrame(FrameInfo &info, const wifi_promiscuous_pkt_t *packet);
 static void registerBeacon(const uint8_t *apAddr);
 
 // --- New helper prototypes ---
@@ -297,6 +272,60 @@ typedef struct pcaprec_hdr_s {
     uint32_t orig_len; /* longueur réelle du paquet */
 } pcaprec_hdr_t;
 
+// Writes the cached beacon (if any) as the first record of a fresh handshake
+// pcap, so the cracker learns the SSID before it stops reading.
+static void writeCachedBeacon(File &f, uint64_t apKey) {
+    static BeaconFrame beacon; // writer task only: copied out so the file write runs unlocked
+    beacon.len = 0;
+    portENTER_CRITICAL(&apTableMux);
+    const ApSlot *ap = apTable.peek(apKey);
+    const BeaconFrame *cached = ap ? apTable.beacon(*ap) : nullptr;
+    if (cached && cached->len) { memcpy(&beacon, cached, sizeof(beacon)); }
+    portEXIT_CRITICAL(&apTableMux);
+    if (beacon.len == 0) return;
+    pcaprec_hdr_t bhdr;
+    bhdr.ts_sec = beacon.timestamp_sec;
+    bhdr.ts_usec = beacon.timestamp_usec;
+    bhdr.incl_len = beacon.len;
+    bhdr.orig_len = beacon.len;
+    f.write((const byte *)&bhdr, sizeof(pcaprec_hdr_t));
+    f.write(beacon.data, beacon.len);
+    apSetFlags(apKey, AP_HS_BEACON_SAVED);
+}
+
+// An M1 carrying a PMKID is crackable on its own (no client reply needed):
+// save it right away as PMKID_{MAC}[_{SSID}].pcap, once per AP per session.
+static void savePmkidCapture(
+    const wifi_promiscuous_pkt_t *packet, const uint8_t *apAddr, uint64_t apKey, const char *ssid, FS &Fs
+) {
+    const uint8_t *payload = packet->payload;
+    size_t keyOffset = 24 + (((payload[0] & 0x0F) == 0x08) ? 2 : 0) + 8 + 4;
+    if (packet->rx_ctrl.sig_len <= keyOffset) return;
+    uint8_t pmkid[16];
+    if (!wifi_eapol_pmkid(payload + keyOffset, packet->rx_ctrl.sig_len - keyOffset, pmkid)) return;
+
+    String filePath = buildHandshakePath(apAddr, ssid);
+    filePath.replace("/HS_", "/PMKID_");
+    if (handshakeFileExists(filePath)) return;
+
+    if (!Fs.exists("/BrucePCAP")) { Fs.mkdir("/BrucePCAP"); }
+    if (!Fs.exists("/BrucePCAP/handshakes")) { Fs.mkdir("/BrucePCAP/handshakes"); }
+    File f = Fs.open(filePath, FILE_WRITE);
+    if (!f) return;
+    registerHandshakeRecord(filePath);
+    writeHeader(f);
+    writeCachedBeacon(f, apKey);
+
+    pcaprec_hdr_t hdr;
+    hdr.ts_sec = packet->rx_ctrl.timestamp / 1000000;
+    hdr.ts_usec = packet->rx_ctrl.timestamp % 1000000;
+    hdr.incl_len = packet->rx_ctrl.sig_len;
+    hdr.orig_len = packet->rx_ctrl.sig_len;
+    f.write((const byte *)&hdr, sizeof(pcaprec_hdr_t));
+    f.write(payload, packet->rx_ctrl.sig_len);
+    f.close();
+}
+
 void saveHandshake(const wifi_promiscuous_pkt_t *packet, bool beacon, FS &Fs, const char *ssidLabel) {
     const uint8_t *addr1 = packet->payload + 4;
     const uint8_t *addr2 = packet->payload + 10;
@@ -317,9 +346,8 @@ void saveHandshake(const wifi_promiscuous_pkt_t *packet, bool beacon, FS &Fs, co
     // Beacon: only save if handshake file already exists (handshake was captured)
     if (beacon) {
         if (!fichierExiste) { return; }
-        uint64_t beaconKey = apKey;
-        if (handshakeBeaconRecorded(beaconKey)) { return; }
-        registerHandshakeBeacon(beaconKey);
+        if (apFlags(apKey) & AP_HS_BEACON_SAVED) { return; }
+        apSetFlags(apKey, AP_HS_BEACON_SAVED);
 
         File f = Fs.open(filePath, FILE_APPEND);
         if (!f) { return; }
@@ -338,47 +366,68 @@ void saveHandshake(const wifi_promiscuous_pkt_t *packet, bool beacon, FS &Fs, co
     int eapolMsg = classifyEapolMessage(packet);
     if (eapolMsg < 1 || eapolMsg > 4) { return; }
 
-    auto &tracker = perApHandshakeTracker[apKey];
-    auto &buf = eapol4WayBuffer[apKey];
-    uint16_t dataLen = std::min<uint16_t>(packet->rx_ctrl.sig_len, EAPOL_BUF_SIZE);
+    // Progress lives in the AP's slot; the M1..M3 buffer comes from the
+    // table's small pool (this task is its only user) and may have been
+    // handed to a newer handshake meanwhile: start over then.
+    const uint8_t progress = apFlags(apKey);
+    uint16_t dataLen = std::min<uint16_t>(packet->rx_ctrl.sig_len, AP_EAPOL_BUF);
+    auto bufferFrame = [&](EapolFrame &frame) {
+        memcpy(frame.data, packet->payload, dataLen);
+        frame.len = dataLen;
+        frame.timestamp_sec = packet->rx_ctrl.timestamp / 1000000;
+        frame.timestamp_usec = packet->rx_ctrl.timestamp % 1000000;
+    };
+    auto claimBuffer = [&](bool create) {
+        portENTER_CRITICAL(&apTableMux);
+        Eapol4WayBuffer *b = apTable.eapol(apKey, create);
+        portEXIT_CRITICAL(&apTableMux);
+        if (!b && !create) { apSetFlags(apKey, 0, AP_HS_M1 | AP_HS_M2 | AP_HS_M3); }
+        return b;
+    };
+    auto releaseBuffer = [&]() {
+        portENTER_CRITICAL(&apTableMux);
+        apTable.dropEapol(apKey);
+        portEXIT_CRITICAL(&apTableMux);
+    };
 
     // M1: buffer — don't write to file yet
     if (eapolMsg == 1) {
-        if (tracker.msg1) { return; }
-        tracker.msg1 = true;
-        memcpy(buf.m1.data, packet->payload, dataLen);
-        buf.m1.len = dataLen;
-        buf.m1.timestamp_sec = packet->rx_ctrl.timestamp / 1000000;
-        buf.m1.timestamp_usec = packet->rx_ctrl.timestamp % 1000000;
+        savePmkidCapture(packet, apAddr, apKey, sanitizedSsid.c_str(), Fs);
+        if (progress & AP_HS_M1) { return; }
+        Eapol4WayBuffer *buf = claimBuffer(true);
+        if (!buf) { return; }
+        bufferFrame(buf->m1);
+        apSetFlags(apKey, AP_HS_M1);
         return;
     }
 
     // M2: buffer — don't write to file yet
     if (eapolMsg == 2) {
-        if (!tracker.msg1 || tracker.msg2) { return; }
-        tracker.msg2 = true;
-        memcpy(buf.m2.data, packet->payload, dataLen);
-        buf.m2.len = dataLen;
-        buf.m2.timestamp_sec = packet->rx_ctrl.timestamp / 1000000;
-        buf.m2.timestamp_usec = packet->rx_ctrl.timestamp % 1000000;
+        if (!(progress & AP_HS_M1) || (progress & AP_HS_M2)) { return; }
+        Eapol4WayBuffer *buf = claimBuffer(false);
+        if (!buf) { return; }
+        bufferFrame(buf->m2);
+        apSetFlags(apKey, AP_HS_M2);
         return;
     }
 
     // M3: buffer — don't write to file yet
     if (eapolMsg == 3) {
-        if (!tracker.msg2 || tracker.msg3) { return; }
-        tracker.msg3 = true;
-        memcpy(buf.m3.data, packet->payload, dataLen);
-        buf.m3.len = dataLen;
-        buf.m3.timestamp_sec = packet->rx_ctrl.timestamp / 1000000;
-        buf.m3.timestamp_usec = packet->rx_ctrl.timestamp % 1000000;
+        if (!(progress & AP_HS_M2) || (progress & AP_HS_M3)) { return; }
+        Eapol4WayBuffer *buf = claimBuffer(false);
+        if (!buf) { return; }
+        bufferFrame(buf->m3);
+        apSetFlags(apKey, AP_HS_M3);
         return;
     }
 
     // M4: flush all 4 frames to file, mark handshake valid
     if (eapolMsg == 4) {
-        if (!tracker.msg3 || tracker.msg4) { return; }
-        tracker.msg4 = true;
+        if (!(progress & AP_HS_M3) || (progress & AP_HS_M4)) { return; }
+        Eapol4WayBuffer *bufPtr = claimBuffer(false);
+        if (!bufPtr) { return; }
+        const Eapol4WayBuffer &buf = *bufPtr;
+        apSetFlags(apKey, AP_HS_M4);
 
         if (!Fs.exists("/BrucePCAP")) { Fs.mkdir("/BrucePCAP"); }
         if (!Fs.exists("/BrucePCAP/handshakes")) { Fs.mkdir("/BrucePCAP/handshakes"); }
@@ -387,7 +436,7 @@ void saveHandshake(const wifi_promiscuous_pkt_t *packet, bool beacon, FS &Fs, co
 
         File f = Fs.open(filePath, FILE_APPEND);
         if (!f) {
-            eapol4WayBuffer.erase(apKey);
+            releaseBuffer();
             return;
         }
 
@@ -395,17 +444,7 @@ void saveHandshake(const wifi_promiscuous_pkt_t *packet, bool beacon, FS &Fs, co
             writeHeader(f);
             // Write the last-seen beacon for this AP first, so the SSID is
             // available to the cracker before it stops reading at M2+M3.
-            auto beaconIt = beaconRawCache.find(apKey);
-            if (beaconIt != beaconRawCache.end() && beaconIt->second.len > 0) {
-                pcaprec_hdr_t bhdr;
-                bhdr.ts_sec = beaconIt->second.timestamp_sec;
-                bhdr.ts_usec = beaconIt->second.timestamp_usec;
-                bhdr.incl_len = beaconIt->second.len;
-                bhdr.orig_len = beaconIt->second.len;
-                f.write((const byte *)&bhdr, sizeof(pcaprec_hdr_t));
-                f.write(beaconIt->second.data, beaconIt->second.len);
-                registerHandshakeBeacon(apKey);
-            }
+            writeCachedBeacon(f, apKey);
         }
 
         pcaprec_hdr_t hdr;
@@ -431,9 +470,9 @@ void saveHandshake(const wifi_promiscuous_pkt_t *packet, bool beacon, FS &Fs, co
         f.write(packet->payload, m4Len);
 
         f.close();
-        eapol4WayBuffer.erase(apKey);
+        releaseBuffer();
 
-        if (handshakeReadyBssids.find(apKey) == handshakeReadyBssids.end()) { num_HS++; }
+        if (!(progress & AP_HS_READY)) { num_HS++; }
         markHandshakeReady(apKey);
         return;
     }
@@ -480,43 +519,30 @@ static String buildHandshakePath(const uint8_t *mac, const char *ssid) {
     return path;
 }
 
-static bool shouldSaveBeaconForHandshake(const uint8_t *mac) {
-    if (!mac) return false;
-    uint64_t key = macToKey(mac);
-    bool ready = false;
-    portENTER_CRITICAL(&handshakeReadyMux);
-    ready = handshakeReadyBssids.find(key) != handshakeReadyBssids.end();
-    portEXIT_CRITICAL(&handshakeReadyMux);
-    return ready;
+static uint8_t apFlags(uint64_t key) {
+    portENTER_CRITICAL(&apTableMux);
+    const ApSlot *ap = apTable.peek(key);
+    uint8_t flags = ap ? ap->flags : 0;
+    portEXIT_CRITICAL(&apTableMux);
+    return flags;
 }
 
-static bool hasCompleteHandshake(uint64_t apKey) {
-    bool ready = false;
-    portENTER_CRITICAL(&handshakeReadyMux);
-    ready = handshakeReadyBssids.find(apKey) != handshakeReadyBssids.end();
-    portEXIT_CRITICAL(&handshakeReadyMux);
-    return ready;
+static void apSetFlags(uint64_t key, uint8_t set, uint8_t clear) {
+    portENTER_CRITICAL(&apTableMux);
+    if (ApSlot *ap = apTable.insert(key)) { ap->flags = (ap->flags & ~clear) | set; }
+    portEXIT_CRITICAL(&apTableMux);
 }
 
-void markHandshakeReady(uint64_t key) {
-    portENTER_CRITICAL(&handshakeReadyMux);
-    handshakeReadyBssids.insert(key);
-    portEXIT_CRITICAL(&handshakeReadyMux);
+static bool shouldSaveBeaconForHandshake(const uint8_t *mac) {
+    if (!mac) return false;
+    return apFlags(macToKey(mac)) & AP_HS_READY;
 }
 
-bool sniffer_is_handshake_ready(uint64_t key) {
-    bool ready = false;
-    portENTER_CRITICAL(&handshakeReadyMux);
-    ready = handshakeReadyBssids.find(key) != handshakeReadyBssids.end();
-    portEXIT_CRITICAL(&handshakeReadyMux);
-    return ready;
-}
+static bool hasCompleteHandshake(uint64_t apKey) { return apFlags(apKey) & AP_HS_READY; }
 
-static void resetHandshakeTracking() {
-    portENTER_CRITICAL(&handshakeReadyMux);
-    handshakeReadyBssids.clear();
-    portEXIT_CRITICAL(&handshakeReadyMux);
-}
+void markHandshakeReady(uint64_t key) { apSetFlags(key, AP_HS_READY); }
+
+bool sniffer_is_handshake_ready(uint64_t key) { return apFlags(key) & AP_HS_READY; }
 
 static bool handshakeRecordExists(const String &path) {
     if (!handshakeMutex) { return SavedHS.find(path) != SavedHS.end(); }
@@ -541,42 +567,6 @@ static void registerHandshakeRecord(const String &path) {
     }
 }
 
-static bool handshakeBeaconRecorded(uint64_t key) {
-    if (!handshakeMutex) { return handshakeBeaconLogged.find(key) != handshakeBeaconLogged.end(); }
-    if (xSemaphoreTake(handshakeMutex, pdMS_TO_TICKS(50)) == pdTRUE) {
-        bool exists = handshakeBeaconLogged.find(key) != handshakeBeaconLogged.end();
-        xSemaphoreGive(handshakeMutex);
-        return exists;
-    }
-    return handshakeBeaconLogged.find(key) != handshakeBeaconLogged.end();
-}
-
-static void registerHandshakeBeacon(uint64_t key) {
-    if (!handshakeMutex) {
-        handshakeBeaconLogged.insert(key);
-        return;
-    }
-    if (xSemaphoreTake(handshakeMutex, pdMS_TO_TICKS(50)) == pdTRUE) {
-        handshakeBeaconLogged.insert(key);
-        xSemaphoreGive(handshakeMutex);
-    } else {
-        handshakeBeaconLogged.insert(key);
-    }
-}
-
-static void resetHandshakeBeaconCache() {
-    if (!handshakeMutex) {
-        handshakeBeaconLogged.clear();
-        return;
-    }
-    if (xSemaphoreTake(handshakeMutex, pdMS_TO_TICKS(100)) == pdTRUE) {
-        handshakeBeaconLogged.clear();
-        xSemaphoreGive(handshakeMutex);
-    } else {
-        handshakeBeaconLogged.clear();
-    }
-}
-
 static void registerBeacon(const uint8_t *apAddr) {
     if (!apAddr) return;
     BeaconList beacon;
@@ -585,31 +575,41 @@ static void registerBeacon(const uint8_t *apAddr) {
     registeredBeacons.insert(beacon);
 }
 
-static void cacheBeaconFrame(uint64_t apKey, const wifi_promiscuous_pkt_t *packet) {
+// Beacons create/refresh the AP's slot (SSID, channel, last seen, raw
+// frame); any other frame just borrows the SSID. Runs in the promiscuous
+// callback: no heap, one short critical section.
+static void resolveSsidForFrame(FrameInfo &info, const wifi_promiscuous_pkt_t *packet) {
     if (!packet) return;
-    if (beaconRawCache.find(apKey) == beaconRawCache.end() && beaconRawCache.size() >= MAX_BEACON_CACHE) {
+    if (!info.isBeacon) {
+        portENTER_CRITICAL(&apTableMux);
+        const ApSlot *ap = apTable.peek(info.apKey);
+        if (ap) { memcpy(info.ssid, ap->ssid, sizeof(info.ssid)); }
+        portEXIT_CRITICAL(&apTableMux);
         return;
     }
-    uint16_t len = std::min<uint16_t>(packet->rx_ctrl.sig_len, BEACON_BUF_SIZE);
-    BeaconFrame &frame = beaconRawCache[apKey];
-    memcpy(frame.data, packet->payload, len);
-    frame.len = len;
-    frame.timestamp_sec = packet->rx_ctrl.timestamp / 1000000;
-    frame.timestamp_usec = packet->rx_ctrl.timestamp % 1000000;
-}
-
-static String resolveSsidForFrame(FrameInfo &info, const wifi_promiscuous_pkt_t *packet) {
-    if (!packet) return "";
-    if (info.isBeacon) {
-        beacon_frames++;
-        String ssid = extractSsid(packet);
-        beaconSsidCache[info.apKey] = ssid;
-        cacheBeaconFrame(info.apKey, packet);
-        return ssid;
+    beacon_frames++;
+    extractSsid(packet, info.ssid, sizeof(info.ssid));
+    const uint8_t channel = all_wifi_channels[ch];
+    const uint16_t len = std::min<uint16_t>(packet->rx_ctrl.sig_len, AP_BEACON_BUF);
+    bool created = false;
+    bool announce = false;
+    portENTER_CRITICAL(&apTableMux);
+    if (ApSlot *ap = apTable.insert(info.apKey, &created)) {
+        announce = created || ap->channel != channel || ap->lastSeen == 0;
+        ap->channel = channel;
+        ap->lastSeen = millis() | 1; // 0 means stale
+        memcpy(ap->ssid, info.ssid, sizeof(ap->ssid));
+        if (BeaconFrame *frame = apTable.beacon(*ap, true)) {
+            memcpy(frame->data, packet->payload, len);
+            frame->len = len;
+            frame->timestamp_sec = packet->rx_ctrl.timestamp / 1000000;
+            frame->timestamp_usec = packet->rx_ctrl.timestamp % 1000000;
+        }
     }
-    auto it = beaconSsidCache.find(info.apKey);
-    if (it != beaconSsidCache.end()) { return it->second; }
-    return "";
+    portEXIT_CRITICAL(&apTableMux);
+    // registeredBeacons (deauth targets, pwnagotchi, wifi_atks) only changes
+    // for a new AP or channel, not on every beacon.
+    if (announce) { registerBeacon(info.apAddr); }
 }
 
 static FrameInfo analyzeFrame(wifi_promiscuous_pkt_t *pkt) {
@@ -647,12 +647,7 @@ static FrameInfo analyzeFrame(wifi_promiscuous_pkt_t *pkt) {
         }
     }
 
-    info.ssid = resolveSsidForFrame(info, pkt);
-    if (info.isBeacon) {
-        registerBeacon(info.apAddr);
-        // UPDATE last-seen timestamp for this beacon
-        beaconLastSeen[info.apKey] = (uint32_t)millis();
-    }
+    resolveSsidForFrame(info, pkt);
 
     return info;
 }
@@ -666,52 +661,29 @@ static uint64_t macToKey(const void *mac) {
 
 static void copyMac(uint8_t *dest, const uint8_t *src) { memcpy(dest, src, 6); }
 
-static void copySsidToBuffer(const String &ssid, char *buffer, size_t len) {
-    if (!buffer || len == 0) return;
-    size_t copyLen = std::min<size_t>(ssid.length(), len - 1);
-    memcpy(buffer, ssid.c_str(), copyLen);
-    buffer[copyLen] = '\0';
-}
-
-static String extractSsid(const wifi_promiscuous_pkt_t *packet) {
-    if (!packet) return "";
+// Printable bytes of the SSID element into `out` (NUL terminated, "" when absent).
+static void extractSsid(const wifi_promiscuous_pkt_t *packet, char *out, size_t len) {
+    out[0] = '\0';
+    if (!packet) return;
     const uint8_t *payload = packet->payload;
-    int len = packet->rx_ctrl.sig_len;
-    if (len < 36) return "";
+    int frameLen = packet->rx_ctrl.sig_len;
+    if (frameLen < 36) return;
     int offset = 36;
-    while (offset + 1 < len) {
+    while (offset + 1 < frameLen) {
         uint8_t tagNumber = payload[offset];
         uint8_t tagLength = payload[offset + 1];
-        if (offset + 2 + tagLength > len) break;
+        if (offset + 2 + tagLength > frameLen) break;
         if (tagNumber == 0x00) {
-            String ssid = "";
-            for (int i = 0; i < tagLength; ++i) {
+            size_t n = 0;
+            for (int i = 0; i < tagLength && n + 1 < len; ++i) {
                 uint8_t chValue = payload[offset + 2 + i];
-                if (isprint(chValue)) { ssid += (char)chValue; }
+                if (isprint(chValue)) { out[n++] = (char)chValue; }
             }
-            return ssid;
+            out[n] = '\0';
+            return;
         }
         offset += 2 + tagLength;
     }
-    return "";
-}
-
-static wifi_promiscuous_pkt_t *duplicatePacket(const wifi_promiscuous_pkt_t *pkt, uint16_t length) {
-    size_t total = sizeof(wifi_pkt_rx_ctrl_t) + length;
-    uint8_t *buffer = (uint8_t *)heap_caps_malloc(total, MALLOC_CAP_8BIT | MALLOC_CAP_SPIRAM);
-    if (!buffer) { buffer = (uint8_t *)heap_caps_malloc(total, MALLOC_CAP_8BIT); }
-    if (!buffer) { buffer = (uint8_t *)malloc(total); }
-    if (!buffer) { return nullptr; }
-    auto *copy = reinterpret_cast<wifi_promiscuous_pkt_t *>(buffer);
-    memcpy(copy, pkt, sizeof(wifi_pkt_rx_ctrl_t));
-    memcpy(buffer + sizeof(wifi_pkt_rx_ctrl_t), pkt->payload, length);
-    copy->rx_ctrl.sig_len = length;
-    return copy;
-}
-
-static void releasePacketCopy(wifi_promiscuous_pkt_t *packet) {
-    if (!packet) return;
-    heap_caps_free(packet);
 }
 
 static bool lockFileMutex(TickType_t ticks) {
@@ -732,45 +704,34 @@ static void ensureDirectories(FS &Fs) {
 static void openDeauthFile(FS &Fs) {
     ensureDirectories(Fs);
     closeDeauthFile();
-    deauthFilename = "/BrucePCAP/deauth_" + String(deauthFileIndex) + ".pcap";
-    while (Fs.exists(deauthFilename)) {
-        deauthFileIndex++;
-        deauthFilename = "/BrucePCAP/deauth_" + String(deauthFileIndex) + ".pcap";
-    }
     if (lockFileMutex(pdMS_TO_TICKS(200))) {
-        _deauth_file = Fs.open(deauthFilename, FILE_WRITE);
-        deauthFileOpen = _deauth_file && writeHeader(_deauth_file);
+        deauthWriter.setFormat(RAW_PCAPNG ? PcapFormat::PcapNg : PcapFormat::Pcap);
+        bool ok = deauthWriter.open(Fs, "/BrucePCAP/deauth_", deauthFileIndex);
+        deauthFileIndex = deauthWriter.index();
+        deauthFilename = deauthWriter.path();
         unlockFileMutex();
-        if (!deauthFileOpen) { Serial.println("Fail opening deauth capture file"); }
+        if (!ok) { Serial.println("Fail opening deauth capture file"); }
     }
 }
 
 static void closeRawFile() {
     if (lockFileMutex(pdMS_TO_TICKS(200))) {
-        if (_pcap_file) {
-            _pcap_file.flush();
-            _pcap_file.close();
-        }
-        rawFileOpen = false;
+        rawWriter.close();
         unlockFileMutex();
     }
 }
 
 static void closeDeauthFile() {
     if (lockFileMutex(pdMS_TO_TICKS(200))) {
-        if (_deauth_file) {
-            _deauth_file.flush();
-            _deauth_file.close();
-        }
-        deauthFileOpen = false;
+        deauthWriter.close();
         unlockFileMutex();
     }
 }
 
-static bool rawCaptureEnabled() { return currentMode == SnifferMode::Full && rawFileOpen && _pcap_file; }
+static bool rawCaptureEnabled() { return currentMode == SnifferMode::Full && rawWriter.isOpen(); }
 static bool handshakeCaptureEnabled() { return currentMode != SnifferMode::DeauthOnly; }
 static bool deauthCaptureEnabled() {
-    return currentMode == SnifferMode::DeauthOnly && deauthFileOpen && _deauth_file;
+    return currentMode == SnifferMode::DeauthOnly && deauthWriter.isOpen();
 }
 
 static String currentModeString() {
@@ -784,8 +745,8 @@ static String currentModeString() {
 static bool ensureSnifferBackend() {
     if (!fileMutex) { fileMutex = xSemaphoreCreateMutexStatic(&fileMutexBuffer); }
     if (!handshakeMutex) { handshakeMutex = xSemaphoreCreateMutexStatic(&handshakeMutexBuffer); }
-    if (!snifferQueue) { snifferQueue = xQueueCreate(SNIFFER_QUEUE_DEPTH, sizeof(SnifferQueueItem)); }
-    if (!snifferQueue) { return false; }
+    if (!snifferRing.begin()) { return false; }
+    if (!apTable.begin()) { return false; }
     if (!snifferWriterHandle) {
 #if SOC_CPU_CORES_NUM > 1
         BaseType_t res = xTaskCreatePinnedToCore(
@@ -800,40 +761,76 @@ static bool ensureSnifferBackend() {
     return snifferWriterHandle != nullptr;
 }
 
-static void handleRawWrite(const SnifferQueueItem &item) {
-    if (!rawCaptureEnabled() || !item.packet) { return; }
+// Radio metadata of a captured frame for the pcapng Radiotap header.
+static void fillRadio(const wifi_promiscuous_pkt_t *pkt, PcapRadio &radio) {
+    // wifi_phy_rate_t (non-HT rx_ctrl.rate) -> 500 kbps units
+    static const uint8_t phyRate[16] = {2, 4, 11, 22, 0, 4, 11, 22, 96, 48, 24, 12, 108, 72, 36, 18};
+    const wifi_pkt_rx_ctrl_t &ctrl = pkt->rx_ctrl;
+    radio.tsft = ctrl.timestamp;
+    radio.channel = ctrl.channel;
+    radio.rssi = ctrl.rssi;
+    radio.noise = ctrl.noise_floor;
+    radio.rate = phyRate[ctrl.rate & 0x0F];
+    radio.mcs = 0xFF;
+    radio.ht40 = false;
+    radio.shortGi = false;
+#if !CONFIG_SOC_WIFI_HE_SUPPORT
+    if (ctrl.sig_mode == 1) { // HT: MCS instead of a legacy rate
+        radio.rate = 0;
+        radio.mcs = ctrl.mcs;
+        radio.ht40 = ctrl.cwb;
+        radio.shortGi = ctrl.sgi;
+    }
+#endif
+}
+
+static void handleRawWrite(SnifferRecord &rec) {
+    if (!rawCaptureEnabled()) { return; }
+    PcapRadio radio;
+    fillRadio(rec.packet(), radio);
     if (lockFileMutex(pdMS_TO_TICKS(200))) {
-        newPacketSD(item.ts_sec, item.ts_usec, item.raw_len, item.packet->payload, _pcap_file);
+        rawWriter.add(rec.ts_sec, rec.ts_usec, rec.raw_len, rec.packet()->payload, &radio);
         unlockFileMutex();
     }
 }
 
-static void handleHandshakeWrite(const SnifferQueueItem &item) {
-    if (!handshakeCaptureEnabled() || !item.packet) { return; }
-    saveHandshake(item.packet, item.isBeacon, *activeFs, item.ssid);
+static void handleHandshakeWrite(SnifferRecord &rec) {
+    if (!handshakeCaptureEnabled()) { return; }
+    saveHandshake(rec.packet(), rec.flags & SNIFF_REC_BEACON, *activeFs, rec.ssid);
 }
 
-static void handleDeauthWrite(const SnifferQueueItem &item) {
-    if (!deauthCaptureEnabled() || !item.packet) { return; }
+static void handleDeauthWrite(SnifferRecord &rec) {
+    if (!deauthCaptureEnabled()) { return; }
+    PcapRadio radio;
+    fillRadio(rec.packet(), radio);
     if (lockFileMutex(pdMS_TO_TICKS(200))) {
-        newPacketSD(item.ts_sec, item.ts_usec, item.raw_len, item.packet->payload, _deauth_file);
+        deauthWriter.add(rec.ts_sec, rec.ts_usec, rec.raw_len, rec.packet()->payload, &radio);
         unlockFileMutex();
     }
 }
 
 static void snifferWriterTask(void *param) {
     (void)param;
-    SnifferQueueItem item;
     while (true) {
-        if (xQueueReceive(snifferQueue, &item, portMAX_DELAY) == pdTRUE) {
-            if (item.saveRaw) { handleRawWrite(item); }
-            if (item.saveHandshake) { handleHandshakeWrite(item); }
-            if (item.saveDeauth) { handleDeauthWrite(item); }
-            releasePacketCopy(item.packet);
+        // Woken by the callback when the ring turns non-empty; the timeout
+        // covers a wake-up racing with the last release.
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(20));
+        uint32_t cursor = snifferRing.readCursor();
+        size_t len;
+        size_t handled = 0;
+        while (uint8_t *data = snifferRing.next(cursor, len)) {
+            SnifferRecord &rec = *(SnifferRecord *)data;
+            if (rec.flags & SNIFF_REC_RAW) { handleRawWrite(rec); }
+            if (rec.flags & SNIFF_REC_HANDSHAKE) { handleHandshakeWrite(rec); }
+            if (rec.flags & SNIFF_REC_DEAUTH) { handleDeauthWrite(rec); }
+            if (++handled % SNIFFER_RELEASE_BATCH == 0) { snifferRing.release(cursor); }
         }
+        snifferRing.release(cursor);
     }
 }
 
+void sniffer_ring_stats(SnifferRingStats &out) { snifferRing.stats(out); }
+
 bool sniffer_prepare_storage(FS *fs, bool sdDetectedParam) {
     if (!ensureSnifferBackend()) { return false; }
     if (!fs) { fs = &LittleFS; }
@@ -869,10 +866,10 @@ SnifferMode sniffer_get_mode() { return currentMode; }
 bool sniffer_full_mode_available() { return sdDetected; }
 
 void sniffer_wait_for_flush(uint32_t timeoutMs) {
-    if (!snifferQueue) { return; }
+    if (!snifferRing.ready()) { return; }
     TickType_t start = xTaskGetTickCount();
     TickType_t deadline = pdMS_TO_TICKS(timeoutMs);
-    while (uxQueueMessagesWaiting(snifferQueue) > 0) {
+    while (!snifferRing.empty()) {
         vTaskDelay(pdMS_TO_TICKS(10));
         if (timeoutMs == 0) { continue; }
         if ((xTaskGetTickCount() - start) > deadline) { break; }
@@ -886,10 +883,10 @@ void sniffer_reset_handshake_cache() {
     } else {
         SavedHS.clear();
     }
-    resetHandshakeTracking();
-    resetHandshakeBeaconCache();
-    perApHandshakeTracker.clear();
-    eapol4WayBuffer.clear();
+    portENTER_CRITICAL(&apTableMux);
+    apTable.forEach([](ApSlot &ap) { ap.flags = 0; });
+    apTable.clearEapol();
+    portEXIT_CRITICAL(&apTableMux);
 }
 
 void printAddress(const uint8_t *addr) {
@@ -945,7 +942,7 @@ bool writeHeader(File file) {
 /* will be executed on every packet the ESP32 gets while being in promiscuous mode */
 // Sniffer callback
 void sniffer(void *buf, wifi_promiscuous_pkt_type_t type) {
-    if (!snifferQueue && !ensureSnifferBackend()) { return; }
+    if (!snifferRing.ready() && !ensureSnifferBackend()) { return; }
     // If using LittleFS to save .pcaps and storage is exhausted, stop promiscuous mode
     if (isLittleFS && !littleFsSpaceAvailable) {
         littleFsWasFull = true; // storage triggered exit
@@ -961,12 +958,19 @@ void sniffer(void *buf, wifi_promiscuous_pkt_type_t type) {
 
     FrameInfo frameInfo = analyzeFrame(pkt);
     if (!frameInfo.valid) { return; }
+    bool eapolNeeded = frameInfo.isEapol && !hasCompleteHandshake(frameInfo.apKey);
     if (frameInfo.isEapol) { num_EAPOL++; }
+    if (eapolNeeded && autoHop) {
+        int msg = classifyEapolMessage(pkt);
+        portENTER_CRITICAL(&hopMux);
+        hopScheduler.onEapol(ch, frameInfo.apKey, msg, millis());
+        portEXIT_CRITICAL(&hopMux);
+    }
 
     bool saveRaw = rawCaptureEnabled();
     bool saveHandshake = false;
     if (handshakeCaptureEnabled()) {
-        if (frameInfo.isEapol && !hasCompleteHandshake(frameInfo.apKey)) {
+        if (eapolNeeded) {
             saveHandshake = true;
         } else if (frameInfo.isBeacon && shouldSaveBeaconForHandshake(frameInfo.apAddr)) {
             saveHandshake = true;
@@ -976,35 +980,33 @@ void sniffer(void *buf, wifi_promiscuous_pkt_type_t type) {
 
     if (!saveRaw && !saveHandshake && !saveDeauth) { return; }
 
-    wifi_promiscuous_pkt_t *copy = duplicatePacket(pkt, ctrl.sig_len);
-    if (!copy) { return; }
+    // Copied straight into the ring (no heap); a full ring drops the frame
+    // and counts it (SnifferRingStats).
+    uint8_t *slot = snifferRing.reserve(sizeof(SnifferRecord) + sizeof(wifi_pkt_rx_ctrl_t) + ctrl.sig_len);
+    if (!slot) { return; }
+    SnifferRecord &rec = *(SnifferRecord *)slot;
+    wifi_promiscuous_pkt_t *copy = rec.packet();
+    memcpy(copy, pkt, sizeof(wifi_pkt_rx_ctrl_t));
+    memcpy(copy->payload, pkt->payload, ctrl.sig_len);
     if (frameInfo.isBeacon && copy->rx_ctrl.sig_len >= 4) { copy->rx_ctrl.sig_len -= 4; }
 
-    SnifferQueueItem item;
-    item.packet = copy;
     uint64_t pktTimestamp = copy->rx_ctrl.timestamp;
-    item.ts_sec = pktTimestamp / 1000000ULL;
-    item.ts_usec = pktTimestamp % 1000000ULL;
-    item.raw_len = ctrl.sig_len;
-    if (type == WIFI_PKT_MGMT && item.raw_len >= 4) { item.raw_len -= 4; }
-    item.type = type;
-    item.isBeacon = frameInfo.isBeacon;
-    item.isHandshakeFrame = frameInfo.isEapol;
-    item.isDeauthFrame = frameInfo.isDeauth;
-    item.saveRaw = saveRaw;
-    item.saveHandshake = saveHandshake;
-    item.saveDeauth = saveDeauth;
-    copyMac(item.bssid, frameInfo.apAddr);
+    rec.ts_sec = pktTimestamp / 1000000ULL;
+    rec.ts_usec = pktTimestamp % 1000000ULL;
+    rec.raw_len = ctrl.sig_len;
+    if (type == WIFI_PKT_MGMT && rec.raw_len >= 4) { rec.raw_len -= 4; }
+    rec.flags = (frameInfo.isBeacon ? SNIFF_REC_BEACON : 0) | (saveRaw ? SNIFF_REC_RAW : 0) |
+                (saveHandshake ? SNIFF_REC_HANDSHAKE : 0) | (saveDeauth ? SNIFF_REC_DEAUTH : 0);
+    rec.reserved = 0;
     // Leave empty when unresolved: saveHandshake()/buildHandshakePath() then
     // fall back to a per-AP MAC-based filename instead of forcing "UNKNOWN",
     // which would collide different APs into the same handshake pcap.
-    copySsidToBuffer(frameInfo.ssid, item.ssid, sizeof(item.ssid));
+    memcpy(rec.ssid, frameInfo.ssid, sizeof(frameInfo.ssid));
 
-    BaseType_t taskWoken = pdFALSE;
-    if (xQueueSendFromISR(snifferQueue, &item, &taskWoken) != pdTRUE) {
-        releasePacketCopy(copy);
-    } else if (taskWoken) {
-        portYIELD_FROM_ISR();
+    if (snifferRing.commit() && snifferWriterHandle) {
+        BaseType_t taskWoken = pdFALSE;
+        vTaskNotifyGiveFromISR(snifferWriterHandle, &taskWoken);
+        if (taskWoken) { portYIELD_FROM_ISR(); }
     }
 }
 
@@ -1030,83 +1032,114 @@ void event_handler(void *arg, esp_event_base_t event_base, int32_t event_id, voi
 void openFile(FS &Fs) {
     ensureDirectories(Fs);
     closeRawFile();
-    filename = "/BrucePCAP/" + (String)FILENAME + String(rawFileIndex) + ".pcap";
-    while (Fs.exists(filename)) {
-        rawFileIndex++;
-        filename = "/BrucePCAP/" + (String)FILENAME + String(rawFileIndex) + ".pcap";
-    }
     if (lockFileMutex(pdMS_TO_TICKS(200))) {
-        _pcap_file = Fs.open(filename, FILE_WRITE);
-        rawFileOpen = _pcap_file && writeHeader(_pcap_file);
+        rawWriter.setFormat(RAW_PCAPNG ? PcapFormat::PcapNg : PcapFormat::Pcap);
+        bool ok = rawWriter.open(Fs, "/BrucePCAP/" + (String)FILENAME, rawFileIndex);
+        rawFileIndex = rawWriter.index();
+        filename = rawWriter.path();
         unlockFileMutex();
-        if (!rawFileOpen) { Serial.println("Fail opening the file"); }
+        if (!ok) { Serial.println("Fail opening the file"); }
     }
 }
 
 // --- New helper implementations ---
 
+static bool beaconIsRecent(const ApSlot &ap, uint32_t now) {
+    return ap.lastSeen != 0 && (now - ap.lastSeen) <= BEACON_TIMEOUT_MS;
+}
+
 static void cleanupStaleBeacons() {
-    unsigned long now = millis();
-    std::vector<BeaconList> toRemove;
-    for (auto it = registeredBeacons.begin(); it != registeredBeacons.end(); ++it) {
-        uint64_t key = macToKey(it->MAC);
-        auto lastIt = beaconLastSeen.find(key);
-        if (lastIt == beaconLastSeen.end() || (now - (unsigned long)lastIt->second) > BEACON_TIMEOUT_MS) {
-            toRemove.push_back(*it);
-        }
-    }
-    for (const auto &b : toRemove) {
-        // erase by matching MAC bytes
-        for (auto it = registeredBeacons.begin(); it != registeredBeacons.end();) {
-            if (memcmp(it->MAC, b.MAC, 6) == 0) {
-                it = registeredBeacons.erase(it);
-            } else {
-                ++it;
-            }
-        }
-        uint64_t key = macToKey(b.MAC);
-        beaconSsidCache.erase(key);
-        beaconLastSeen.erase(key);
-        beaconRawCache.erase(key);
+    uint32_t now = millis();
+    // APs with handshake state keep their slot (so it is not captured or
+    // counted twice) and only lose the beacon data; the rest are erased.
+    portENTER_CRITICAL(&apTableMux);
+    apTable.eraseIf([now](ApSlot &ap) {
+        if (beaconIsRecent(ap, now)) return false;
+        if (ap.flags == 0) return true;
+        ap.lastSeen = 0;
+        ap.ssid[0] = '\0';
+        apTable.dropBeacon(ap);
+        return false;
+    });
+    portEXIT_CRITICAL(&apTableMux);
+
+    for (auto it = registeredBeacons.begin(); it != registeredBeacons.end();) {
+        portENTER_CRITICAL(&apTableMux);
+        const ApSlot *ap = apTable.peek(macToKey(it->MAC));
+        bool recent = ap && beaconIsRecent(*ap, now);
+        portEXIT_CRITICAL(&apTableMux);
+        if (recent) ++it;
+        else it = registeredBeacons.erase(it);
     }
 }
 
 static size_t countActiveBeaconsOnChannel(uint8_t channel) {
-    unsigned long now = millis();
+    uint32_t now = millis();
     size_t cnt = 0;
-    for (const auto &b : registeredBeacons) {
-        if (b.channel != channel) continue;
-        uint64_t key = macToKey(b.MAC);
-        auto it = beaconLastSeen.find(key);
-        if (it != beaconLastSeen.end() && (now - (unsigned long)it->second) <= BEACON_TIMEOUT_MS) { ++cnt; }
-    }
+    portENTER_CRITICAL(&apTableMux);
+    apTable.forEach([&](const ApSlot &ap) {
+        if (ap.channel == channel && beaconIsRecent(ap, now)) ++cnt;
+    });
+    portEXIT_CRITICAL(&apTableMux);
     return cnt;
 }
 
+// Feeds the hop scheduler the APs with a recent beacon on each channel, one
+// pass over the table.
+static void refreshHopWeights() {
+    const size_t n = sizeof(all_wifi_channels);
+    uint8_t idxOf[256];
+    memset(idxOf, 0xFF, sizeof(idxOf));
+    for (size_t i = 0; i < n; i++) idxOf[all_wifi_channels[i]] = i;
+    uint16_t counts[n] = {};
+    uint32_t now = millis();
+    portENTER_CRITICAL(&apTableMux);
+    apTable.forEach([&](const ApSlot &ap) {
+        if (idxOf[ap.channel] != 0xFF && beaconIsRecent(ap, now)) ++counts[idxOf[ap.channel]];
+    });
+    portEXIT_CRITICAL(&apTableMux);
+    portENTER_CRITICAL(&hopMux);
+    for (size_t i = 0; i < n; i++) hopScheduler.setActiveAps(i, counts[i]);
+    portEXIT_CRITICAL(&hopMux);
+}
+
+static void startAutoHop() {
+    autoHop = true;
+    portENTER_CRITICAL(&hopMux);
+    hopScheduler.begin(all_wifi_channels, sizeof(all_wifi_channels), ch, millis());
+    portEXIT_CRITICAL(&hopMux);
+}
+
+// Completed handshakes per hour of sniffing since start / counter reset.
+static float handshakesPerHour() {
+    uint32_t elapsed = millis() - start_time;
+    return elapsed ? num_HS * 3600000.0f / elapsed : 0;
+}
+
+void sniffer_hop_stats(ChannelSchedulerStats &out, float &handshakesHour) {
+    portENTER_CRITICAL(&hopMux);
+    out = hopScheduler.stats();
+    portEXIT_CRITICAL(&hopMux);
+    handshakesHour = handshakesPerHour();
+}
+
 static std::vector<String> recentSsidsOnChannel(uint8_t channel, size_t maxItems) {
+    // Collected into a fixed array under the lock, Strings are built after it.
+    const size_t RECENT_MAX = 8;
+    char found[RECENT_MAX][AP_SSID_MAX + 1];
+    size_t n = 0;
+    if (maxItems > RECENT_MAX) maxItems = RECENT_MAX;
+    uint32_t now = millis();
+    portENTER_CRITICAL(&apTableMux);
+    apTable.forEach([&](const ApSlot &ap) {
+        if (n >= maxItems || ap.channel != channel || !ap.ssid[0] || !beaconIsRecent(ap, now)) return;
+        for (size_t i = 0; i < n; i++)
+            if (strcmp(found[i], ap.ssid) == 0) return;
+        memcpy(found[n++], ap.ssid, sizeof(ap.ssid));
+    });
+    portEXIT_CRITICAL(&apTableMux);
     std::vector<String> out;
-    unsigned long now = millis();
-    for (const auto &b : registeredBeacons) {
-        if (b.channel != channel) continue;
-        uint64_t key = macToKey(b.MAC);
-        auto lastIt = beaconLastSeen.find(key);
-        if (lastIt == beaconLastSeen.end() || (now - (unsigned long)lastIt->second) > BEACON_TIMEOUT_MS)
-            continue;
-        auto ssidIt = beaconSsidCache.find(key);
-        if (ssidIt == beaconSsidCache.end()) continue;
-        String ss = ssidIt->second;
-        if (ss.length() == 0) continue;
-        bool dup = false;
-        for (auto &x : out)
-            if (x == ss) {
-                dup = true;
-                break;
-            }
-        if (!dup) {
-            out.push_back(ss);
-            if (out.size() >= maxItems) break;
-        }
-    }
+    for (size_t i = 0; i < n; i++) out.push_back(String(found[i]));
     return out;
 }
 
@@ -1175,9 +1208,9 @@ void sniffer_setup() {
 
     sniffer_reset_handshake_cache(); // Need to clear to restart HS count
     registeredBeacons.clear();
-    beaconSsidCache.clear();
-    beaconLastSeen.clear(); // ensure starts empty
-    beaconRawCache.clear();
+    portENTER_CRITICAL(&apTableMux);
+    apTable.clear(); // ensure starts empty
+    portEXIT_CRITICAL(&apTableMux);
 
     /* setup wifi */
     ensureWifiPlatform();
@@ -1218,6 +1251,13 @@ void sniffer_setup() {
     num_EAPOL = 0;
     num_HS = 0;
     packet_counter = 0;
+    snifferRing.resetStats();
+    portENTER_CRITICAL(&hopMux);
+    hopScheduler.reset();
+    portEXIT_CRITICAL(&hopMux);
+    if (CHANNEL_HOPPING) startAutoHop();
+    else autoHop = false;
+    lastHopRefresh = millis();
     deauth_tmp = millis();
     // Prepare deauth frame for each AP record
     memcpy(deauth_frame, deauth_frame_default, sizeof(deauth_frame_default));
@@ -1242,7 +1282,23 @@ void sniffer_setup() {
         }
 
         /* Channel Hopping */
+        if (autoHop) {
+            if ((currentTime - lastHopRefresh) > 1000) {
+                refreshHopWeights();
+                lastHopRefresh = currentTime;
+            }
+            uint8_t next;
+            portENTER_CRITICAL(&hopMux);
+            bool hop = hopScheduler.tick(currentTime, next);
+            portEXIT_CRITICAL(&hopMux);
+            if (hop) {
+                ch = next;
+                esp_wifi_set_channel(all_wifi_channels[ch], WIFI_SECOND_CHAN_NONE);
+            }
+        }
+
         if (check(NextPress)) {
+            autoHop = false; // manual channel selection
             esp_wifi_set_promiscuous(false);
             esp_wifi_set_promiscuous_rx_cb(nullptr);
             ch++; // increase channel
@@ -1275,11 +1331,11 @@ void sniffer_setup() {
             }
             if (millis() - _tmp > 700) { // longpress detected to exit
                 returnToMenu = true;
-                _pcap_file.close();
                 break;
             }
 #endif
             check(PrevPress);
+            autoHop = false;
             esp_wifi_set_promiscuous(false);
             esp_wifi_set_promiscuous_rx_cb(nullptr);
 
@@ -1297,7 +1353,6 @@ void sniffer_setup() {
         // T-Embed has a different btn for Escape, different from StickCs that uses Previous btn
         if (check(EscPress)) {
             returnToMenu = true;
-            _pcap_file.close();
             break;
         }
 #endif
@@ -1332,6 +1387,11 @@ void sniffer_setup() {
                      loopOptions(modeOptions, MENU_TYPE_SUBMENU, "Capture Mode");
                      redraw = true;
                  }                                                                                        },
+                {autoHop ? "Manual channel" : "Auto channel hop",
+                 [&]() {
+                     if (autoHop) autoHop = false;
+                     else startAutoHop();
+                 }                                                                                        },
                 {deauth ? "Disable deauth attack" : "Enable deauth attack", [&]() { deauth = !deauth; }   },
                 {"Deauth Now",                                              [&]() { sendDeauthNow(); }    },
                 {"Reset Counters",
@@ -1339,12 +1399,17 @@ void sniffer_setup() {
                      packet_counter = 0;
                      num_EAPOL = 0;
                      num_HS = 0;
+                     snifferRing.resetStats();
                      start_time = millis();
                      beacon_frames = 0;
                      registeredBeacons.clear();
-                     beaconSsidCache.clear();
-                     beaconRawCache.clear();
+                     portENTER_CRITICAL(&apTableMux);
+                     apTable.clear();
+                     portEXIT_CRITICAL(&apTableMux);
                      sniffer_reset_handshake_cache();
+                     portENTER_CRITICAL(&hopMux);
+                     hopScheduler.reset();
+                     portEXIT_CRITICAL(&hopMux);
                      deauth_tmp = millis();
                  }                                                                                        },
                 {"Exit Sniffer",                                            [&]() { returnToMenu = true; }},
@@ -1390,7 +1455,21 @@ void sniffer_setup() {
 
             } else padprintln("Silent mode.");
 
-            padprintln("Run time " + String(runtime / 60) + ":" + String(runtime % 60));
+            padprintln(
+                "Run time " + String(runtime / 60) + ":" + String(runtime % 60) + "  HS/h " +
+                String(handshakesPerHour(), 1)
+            );
+            if (autoHop) {
+                portENTER_CRITICAL(&hopMux);
+                uint32_t dwell = hopScheduler.dwell(ch);
+                bool locked = hopScheduler.locked();
+                ChannelSchedulerStats hs = hopScheduler.stats();
+                portEXIT_CRITICAL(&hopMux);
+                padprintln(
+                    "Hop: " + (locked ? String("locked on M1") : String(dwell) + "ms") + ", locks " +
+                    String(hs.completed) + "/" + String(hs.locks) + " done"
+                );
+            } else padprintln("Hop: manual");
 
             // New: show beacon counts and recent SSIDs
             size_t activeOnChannel = countActiveBeaconsOnChannel(all_wifi_channels[ch]);
@@ -1419,7 +1498,7 @@ void sniffer_setup() {
                         : all_wifi_channels[ch] < 100 ? " "
                                                       : ""
                     ) +
-                    String(all_wifi_channels[ch]) + " (Next)",
+                    String(all_wifi_channels[ch]) + (autoHop ? " (Auto)" : " (Next)"),
                 tftWidth - 10,
                 tftHeight - 18,
                 1
@@ -1427,15 +1506,31 @@ void sniffer_setup() {
             tft.drawString(
                 " EAPOL: " + String(num_EAPOL) + " HS: " + String(num_HS) + " ", 10, tftHeight - 18
             );
-            tft.drawCentreString("Packets " + String(packet_counter), tftWidth / 2, tftHeight - 26, 1);
+            SnifferRingStats rs;
+            snifferRing.stats(rs);
+            String line = "Packets " + String(packet_counter);
+            // Ring health: dropped frames / overflow episodes / peak fill.
+            if (rs.capacity) {
+                line += " D" + String(rs.drops) + " O" + String(rs.overruns) + " Hi" +
+                        String((uint32_t)((uint64_t)rs.highWater * 100 / rs.capacity)) + "%";
+            }
+            tft.drawCentreString(line, tftWidth / 2, tftHeight - 26, 1);
         }
 
         if (currentTime - lastTime > 100) tft.drawPixel(0, 0, 0);
 
         if ((rawCaptureEnabled() || deauthCaptureEnabled()) && currentTime - lastTime > 1000) {
             if (lockFileMutex(pdMS_TO_TICKS(50))) {
-                if (rawCaptureEnabled()) { _pcap_file.flush(); }
-                if (deauthCaptureEnabled()) { _deauth_file.flush(); }
+                // Writes whole sectors and flushes once PCAP_SYNC_MS passed;
+                // the writers also flush every PCAP_SYNC_BYTES on their own.
+                if (rawCaptureEnabled()) {
+                    rawWriter.sync();
+                    filename = rawWriter.path(); // follows size rotation
+                }
+                if (deauthCaptureEnabled()) {
+                    deauthWriter.sync();
+                    deauthFilename = deauthWriter.path();
+                }
                 unlockFileMutex();
             }
             lastTime = currentTime; // update time
@@ -1459,7 +1554,7 @@ void sniffer_setup() {
             redraw = true;
             lastRedraw = millis();
         }
-        vTaskDelay(100 / portTICK_PERIOD_MS);
+        vTaskDelay((autoHop ? 20 : 100) / portTICK_PERIOD_MS); // 20 ms: hop timing resolution
     }
 Exit:
     esp_wifi_set_promiscuous(false);
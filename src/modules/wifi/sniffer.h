@@ -5,6 +5,8 @@
 #include <SD.h>
 #include <WiFi.h>
 #include <set>
+#include "channel_scheduler.h"
+#include "sniffer_ring.h"
 
 struct HandshakeTracker {
     bool msg1 = false;
@@ -59,6 +61,10 @@ SnifferMode sniffer_get_mode();
 bool sniffer_full_mode_available();
 bool sniffer_prepare_storage(FS *fs, bool sdDetected);
 void sniffer_wait_for_flush(uint32_t timeoutMs = 2000);
+// Callback -> writer ring counters (drops, overruns, high watermark).
+void sniffer_ring_stats(SnifferRingStats &out);
+// Adaptive hopping counters and completed handshakes per hour of this run.
+void sniffer_hop_stats(ChannelSchedulerStats &out, float &handshakesHour);
 void sniffer_reset_handshake_cache();
 void markHandshakeReady(uint64_t key);
 bool sniffer_is_handshake_ready(uint64_t bssidKey);
@@ -0,0 +1,100 @@
+#if !defined(LITE_VERSION)
+#include "sniffer_ring.h"
+#include <esp_heap_caps.h>
+
+bool SnifferRing::begin() {
+    if (_buf) return true;
+    _size = SNIFFER_RING_PSRAM_BYTES;
+    if (psramFound()) _buf = (uint8_t *)heap_caps_malloc(_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!_buf) {
+        for (_size = SNIFFER_RING_SRAM_BYTES; _size >= SNIFFER_RING_MIN_BYTES; _size /= 2) {
+            _buf = (uint8_t *)heap_caps_malloc(_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+            if (_buf) break;
+        }
+    }
+    if (!_buf) {
+        _size = 0;
+        return false;
+    }
+    _head = _tail = _pending = 0;
+    _full = false;
+    resetStats();
+    return true;
+}
+
+uint8_t *SnifferRing::reserve(size_t len) {
+    if (!_buf) return nullptr;
+    const uint32_t need = (sizeof(Hdr) + len + 3) & ~3u;
+    uint32_t head = _head;
+    const uint32_t tail = __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+    const uint32_t off = head & (_size - 1);
+    const uint32_t contiguous = _size - off;
+    const uint32_t total = need <= contiguous ? need : contiguous + need;
+
+    if (need > 0xFFFF || head - tail + total > _size) {
+        _drops++;
+        if (!_full) _overruns++;
+        _full = true;
+        return nullptr;
+    }
+    _full = false;
+
+    if (need > contiguous) { // pad the tail end, the record starts at 0
+        ((Hdr *)(_buf + off))->size = 0;
+        head += contiguous;
+    }
+    Hdr *h = (Hdr *)(_buf + (head & (_size - 1)));
+    h->size = (uint16_t)need;
+    h->len = (uint16_t)len;
+    _pending = head + need;
+    return (uint8_t *)(h + 1);
+}
+
+bool SnifferRing::commit() {
+    const uint32_t tail = __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+    const bool wasEmpty = _head == tail;
+    __atomic_store_n(&_head, _pending, __ATOMIC_RELEASE);
+    _frames++;
+    uint32_t used = _pending - tail;
+    if (used > _highWater) _highWater = used;
+    return wasEmpty;
+}
+
+uint8_t *SnifferRing::next(uint32_t &cursor, size_t &len) const {
+    const uint32_t head = __atomic_load_n(&_head, __ATOMIC_ACQUIRE);
+    while (cursor != head) {
+        const uint32_t off = cursor & (_size - 1);
+        Hdr *h = (Hdr *)(_buf + off);
+        if (h->size == 0) { // pad: continue at offset 0
+            cursor += _size - off;
+            continue;
+        }
+        cursor += h->size;
+        len = h->len;
+        return (uint8_t *)(h + 1);
+    }
+    return nullptr;
+}
+
+void SnifferRing::release(uint32_t cursor) { __atomic_store_n(&_tail, cursor, __ATOMIC_RELEASE); }
+
+bool SnifferRing::empty() const {
+    return __atomic_load_n(&_head, __ATOMIC_ACQUIRE) == __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+}
+
+void SnifferRing::stats(SnifferRingStats &out) const {
+    out.frames = _frames;
+    out.drops = _drops;
+    out.overruns = _overruns;
+    out.highWater = _highWater;
+    out.capacity = _size;
+}
+
+void SnifferRing::resetStats() {
+    _frames = 0;
+    _drops = 0;
+    _overruns = 0;
+    _highWater = 0;
+}
+
+#endif
@@ -0,0 +1,79 @@
+#pragma once
+#if !defined(LITE_VERSION)
+#include <Arduino.h>
+
+// ===========================================================================
+// Single-producer / single-consumer byte ring between the promiscuous
+// callback (producer) and the sniffer writer task (consumer).
+//
+// Records are appended contiguously, 4-byte aligned, each prefixed by its
+// total size; a record that does not fit before the end of the buffer is
+// preceded by a pad record and starts again at offset 0. The consumer reads
+// records in place (zero copy) and releases everything it processed with a
+// single tail update. No locks: head is only written by the producer, tail
+// only by the consumer, both published with release/acquire ordering.
+// ===========================================================================
+
+// Sizes must be powers of two. Without PSRAM the ring should hold at least
+// what the former 48-deep frame queue could have in flight; when internal RAM
+// is short the size is halved down to the minimum.
+#ifndef SNIFFER_RING_PSRAM_BYTES
+#define SNIFFER_RING_PSRAM_BYTES (128 * 1024)
+#endif
+#ifndef SNIFFER_RING_SRAM_BYTES
+#define SNIFFER_RING_SRAM_BYTES (64 * 1024)
+#endif
+#define SNIFFER_RING_MIN_BYTES (8 * 1024)
+
+struct SnifferRingStats {
+    uint32_t frames;    // records appended
+    uint32_t drops;     // frames discarded because the ring was full
+    uint32_t overruns;  // times the ring went from accepting to full
+    uint32_t highWater; // most bytes ever in use
+    uint32_t capacity;  // ring size in bytes
+};
+
+class SnifferRing {
+public:
+    // Allocates the buffer (PSRAM when present, else internal RAM, halving
+    // the size on failure down to SNIFFER_RING_MIN_BYTES).
+    bool begin();
+    bool ready() const { return _buf != nullptr; }
+
+    // Producer. Space for a `len` byte record, or nullptr (counted as a
+    // drop) when full; commit() publishes it.
+    uint8_t *reserve(size_t len);
+    // Returns true when the ring was empty before this record (wake the consumer).
+    bool commit();
+
+    // Consumer. Record at `cursor` (start from readCursor()) and its length,
+    // advancing `cursor` past it; nullptr when nothing more is published.
+    // Records stay valid and in place until released.
+    uint8_t *next(uint32_t &cursor, size_t &len) const;
+    // Frees every record before `cursor` at once.
+    void release(uint32_t cursor);
+    uint32_t readCursor() const { return __atomic_load_n(&_tail, __ATOMIC_RELAXED); }
+    bool empty() const;
+
+    void stats(SnifferRingStats &out) const;
+    void resetStats();
+
+private:
+    struct Hdr {
+        uint16_t size; // whole record incl. header, multiple of 4; 0 = pad to end
+        uint16_t len;  // payload bytes
+    };
+
+    uint8_t *_buf = nullptr;
+    uint32_t _size = 0;    // power of two
+    uint32_t _head = 0;    // producer: bytes ever written (mod 2^32)
+    uint32_t _tail = 0;    // consumer: bytes ever released
+    uint32_t _pending = 0; // producer: head after the reserved record
+    bool _full = false;    // producer: last reserve() failed
+    volatile uint32_t _frames = 0;
+    volatile uint32_t _drops = 0;
+    volatile uint32_t _overruns = 0;
+    volatile uint32_t _highWater = 0;
+};
+
+#endif
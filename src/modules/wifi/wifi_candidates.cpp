@@ -0,0 +1,490 @@
+#ifndef LITE_VERSION
+// --- wifi_candidates.cpp ---
+#include "wifi_candidates.h"
+#include <string.h>
+#include <utility>
+
+/* ─────────────────────────────────────────────────────────────
+   Buffered wordlist reader
+───────────────────────────────────────────────────────────── */
+bool WordlistReader::init(File *f) {
+    file = f;
+    // Always use internal SRAM for the wordlist buffer.
+    // PSRAM (when present) causes D-cache pressure that slows
+    // the SHA1 hot path on Core 0. 8KB in internal SRAM is faster
+    // than 32KB in PSRAM for this sequential-read workload.
+    cap = 8192u;
+    buf = (uint8_t *)malloc(cap);
+    len = pos = base = 0;
+    eof = false;
+    return buf != nullptr;
+}
+
+void WordlistReader::deinit() {
+    if (buf) {
+        free(buf);
+        buf = nullptr;
+    }
+}
+
+void WordlistReader::refill() {
+    if (eof) return;
+    size_t rem = len - pos;
+    if (rem) memmove(buf, buf + pos, rem);
+    base += pos;
+    len = rem;
+    pos = 0;
+    size_t space = cap - len;
+    if (!space) return;
+    size_t rd = file->read(buf + len, space);
+    len += rd;
+    if (rd == 0) eof = true;
+}
+
+bool WordlistReader::nextLine(char *out, size_t max_len) {
+    while (true) {
+        for (size_t i = pos; i < len; i++) {
+            if (buf[i] == '\n') {
+                size_t ll = i - pos;
+                if (ll > 0 && buf[pos + ll - 1] == '\r') ll--;
+                size_t cp = (ll < max_len) ? ll : max_len;
+                memcpy(out, buf + pos, cp);
+                out[cp] = '\0';
+                pos = i + 1;
+                return true;
+            }
+        }
+        if (eof) {
+            size_t rem = len - pos;
+            if (!rem) return false;
+            if (buf[pos + rem - 1] == '\r') rem--;
+            size_t cp = (rem < max_len) ? rem : max_len;
+            memcpy(out, buf + pos, cp);
+            out[cp] = '\0';
+            pos = len;
+            return cp > 0;
+        }
+        refill();
+    }
+}
+
+bool WordlistReader::seek(size_t off) {
+    if (!file->seek(off)) return false;
+    base = off;
+    len = pos = 0;
+    eof = false;
+    return true;
+}
+
+/* ─────────────────────────────────────────────────────────────
+   Rule engine
+───────────────────────────────────────────────────────────── */
+static int rule_pos(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'Z') return c - 'A' + 10;
+    return -1;
+}
+
+static inline char to_lower(char c) { return (c >= 'A' && c <= 'Z') ? c + 32 : c; }
+static inline char to_upper(char c) { return (c >= 'a' && c <= 'z') ? c - 32 : c; }
+static inline char toggle(char c) {
+    if (c >= 'a' && c <= 'z') return c - 32;
+    if (c >= 'A' && c <= 'Z') return c + 32;
+    return c;
+}
+
+int cand_apply_rule(const char *rule, const char *word, size_t wlen, char *out, size_t cap) {
+    if (wlen > cap) return -1;
+    memcpy(out, word, wlen);
+    size_t n = wlen;
+
+    for (const char *p = rule; *p; p++) {
+        int a, b;
+        switch (*p) {
+            case ' ':
+            case ':': break;
+            case 'l':
+                for (size_t i = 0; i < n; i++) out[i] = to_lower(out[i]);
+                break;
+            case 'u':
+                for (size_t i = 0; i < n; i++) out[i] = to_upper(out[i]);
+                break;
+            case 'c':
+            case 'C':
+                for (size_t i = 0; i < n; i++) out[i] = (*p == 'c') ? to_lower(out[i]) : to_upper(out[i]);
+                if (n) out[0] = (*p == 'c') ? to_upper(out[0]) : to_lower(out[0]);
+                break;
+            case 't':
+                for (size_t i = 0; i < n; i++) out[i] = toggle(out[i]);
+                break;
+            case 'r':
+                for (size_t i = 0; i < n / 2; i++) std::swap(out[i], out[n - 1 - i]);
+                break;
+            case 'd':
+                if (2 * n > cap) return -1;
+                memcpy(out + n, out, n);
+                n *= 2;
+                break;
+            case 'f':
+                if (2 * n > cap) return -1;
+                for (size_t i = 0; i < n; i++) out[n + i] = out[n - 1 - i];
+                n *= 2;
+                break;
+            case '{':
+                if (n > 1) {
+                    char c = out[0];
+                    memmove(out, out + 1, n - 1);
+                    out[n - 1] = c;
+                }
+                break;
+            case '}':
+                if (n > 1) {
+                    char c = out[n - 1];
+                    memmove(out + 1, out, n - 1);
+                    out[0] = c;
+                }
+                break;
+            case '[':
+                if (n) memmove(out, out + 1, --n);
+                break;
+            case ']':
+                if (n) n--;
+                break;
+            case 'T':
+            case 'D':
+            case '\'':
+                if ((a = rule_pos(*++p)) < 0) return -1;
+                if (p[-1] == 'T') {
+                    if ((size_t)a < n) out[a] = toggle(out[a]);
+                } else if (p[-1] == 'D') {
+                    if ((size_t)a < n) memmove(out + a, out + a + 1, --n - a);
+                } else if ((size_t)a < n) {
+                    n = a;
+                }
+                break;
+            case '$':
+                if (!p[1] || n >= cap) return -1;
+                out[n++] = *++p;
+                break;
+            case '^':
+                if (!p[1] || n >= cap) return -1;
+                memmove(out + 1, out, n++);
+                out[0] = *++p;
+                break;
+            case '@': {
+                if (!p[1]) return -1;
+                char x = *++p;
+                size_t w = 0;
+                for (size_t i = 0; i < n; i++) {
+                    if (out[i] != x) out[w++] = out[i];
+                }
+                n = w;
+                break;
+            }
+            case 's':
+                if (!p[1] || !p[2]) return -1;
+                for (size_t i = 0; i < n; i++) {
+                    if (out[i] == p[1]) out[i] = p[2];
+                }
+                p += 2;
+                break;
+            case 'i':
+            case 'o':
+                if ((a = rule_pos(p[1])) < 0 || !p[2]) return -1;
+                b = p[2];
+                if (*p == 'i') {
+                    if ((size_t)a <= n && n < cap) {
+                        memmove(out + a + 1, out + a, n - a);
+                        out[a] = (char)b;
+                        n++;
+                    }
+                } else if ((size_t)a < n) {
+                    out[a] = (char)b;
+                }
+                p += 2;
+                break;
+            default: return -1; // unsupported function: the rule is dropped at load
+        }
+    }
+    out[n] = '\0';
+    return (int)n;
+}
+
+/* ─────────────────────────────────────────────────────────────
+   Built-in rule set (WPA: 8+ chars, so mostly suffixes)
+───────────────────────────────────────────────────────────── */
+static const char *const BUILTIN_RULES[] = {
+    // as is / case / shape
+    ":", "c", "u", "l", "r", "d",
+    // short suffixes and prefixes
+    "$1", "$2", "$3", "$7", "$!", "$.", "c$1", "c$!", "$1$!", "c$1$!", "^1", "^!",
+    // digit runs
+    "$1$2", "$1$2$3", "c$1$2$3", "$1$2$3$4", "$0$1", "$1$1", "$2$3", "$6$9", "$9$9", "$0$0$7",
+    // leetspeak
+    "sa4", "se3", "si1", "so0", "ss5", "sa@", "sa4se3so0", "csa4se3so0", "sa@se3si1so0ss$",
+    // years
+    "$1$9$9$0", "$1$9$9$5", "$1$9$9$9", "$2$0$0$0", "$2$0$1$0", "$2$0$1$5", "$2$0$1$9", "$2$0$2$0",
+    "$2$0$2$1", "$2$0$2$2", "$2$0$2$3", "$2$0$2$4", "$2$0$2$5", "$2$0$2$6", "c$2$0$2$4", "c$2$0$2$5",
+};
+
+bool CandidateGen::addRule(const char *rule) {
+    if (!*rule || *rule == '#' || _rules.size() >= CAND_MAX_RULES) return false;
+    char probe[2 * CAND_WORD_MAX + 1];
+    if (cand_apply_rule(rule, "password", 8, probe, 2 * CAND_WORD_MAX) < 0) {
+        // Rejecting "password" can also mean a syntax error; check a neutral word too.
+        if (cand_apply_rule(rule, "p4ssw0rd1234", 12, probe, 2 * CAND_WORD_MAX) < 0) return false;
+    }
+    _rules.emplace_back(rule);
+    return true;
+}
+
+/* ─────────────────────────────────────────────────────────────
+   Sources
+───────────────────────────────────────────────────────────── */
+bool CandidateGen::beginWordlist(File *wordlist, File *rules) {
+    end();
+    if (!_reader.init(wordlist)) return false;
+    _mode = WORDLIST;
+    if (!rules) return true;
+
+    WordlistReader rr = {};
+    if (!rr.init(rules)) {
+        end();
+        return false;
+    }
+    char line[CAND_RULE_MAX_LEN + 1];
+    while (rr.nextLine(line, CAND_RULE_MAX_LEN)) addRule(line);
+    rr.deinit();
+    if (_rules.empty()) {
+        end();
+        return false;
+    }
+    _mode = RULES;
+    return true;
+}
+
+bool CandidateGen::beginBuiltinRules(File *wordlist) {
+    end();
+    if (!_reader.init(wordlist)) return false;
+    for (const char *r : BUILTIN_RULES) addRule(r);
+    _mode = RULES;
+    return true;
+}
+
+static const char CS_LOWER[] = "abcdefghijklmnopqrstuvwxyz";
+static const char CS_UPPER[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+static const char CS_DIGIT[] = "0123456789";
+static const char CS_SYMBOL[] = " !\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~";
+static const char CS_ALL[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+                             " !\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~";
+static const char CS_HEX[] = "0123456789abcdef";
+static const char CS_HEXU[] = "0123456789ABCDEF";
+// Literal positions point into this table (one entry per byte value).
+static char cs_literal[256][2];
+
+bool CandidateGen::beginMask(const char *mask) {
+    end();
+    uint64_t space = 1;
+    for (const char *p = mask; *p; p++) {
+        const char *set;
+        if (*p == '?' && p[1]) {
+            switch (*++p) {
+                case 'l': set = CS_LOWER; break;
+                case 'u': set = CS_UPPER; break;
+                case 'd': set = CS_DIGIT; break;
+                case 's': set = CS_SYMBOL; break;
+                case 'a': set = CS_ALL; break;
+                case 'h': set = CS_HEX; break;
+                case 'H': set = CS_HEXU; break;
+                case '?':
+                default: set = nullptr; break;
+            }
+            if (!set && *p != '?') {
+                end();
+                return false;
+            }
+        } else {
+            set = nullptr;
+        }
+        if (!set) {
+            uint8_t c = (uint8_t)*p;
+            cs_literal[c][0] = (char)c;
+            set = cs_literal[c];
+        }
+        uint8_t n = (uint8_t)strlen(set);
+        _sets.push_back(set);
+        _setLen.push_back(n);
+        _odo.push_back(0);
+        space = (space > UINT64_MAX / n) ? UINT64_MAX : space * n;
+    }
+    if (_sets.empty() || _sets.size() > CAND_WORD_MAX - 1) {
+        end();
+        return false;
+    }
+    _keyspace = space;
+    _mode = MASK;
+    return true;
+}
+
+void CandidateGen::end() {
+    _reader.deinit();
+    _rules.clear();
+    _ruleIdx = 0;
+    _seekRule = 0;
+    _wordStart = 0;
+    _wordLen = 0;
+    _haveWord = false;
+    _sets.clear();
+    _setLen.clear();
+    _odo.clear();
+    _maskDone = false;
+    _maskIdx = 0;
+    _keyspace = 0;
+    _generated = 0;
+    _mode = NONE;
+}
+
+bool CandidateGen::nextRaw(char *out, size_t cap, int &len) {
+    switch (_mode) {
+        case WORDLIST:
+            if (!_reader.available() || !_reader.nextLine(out, cap)) return false;
+            len = (int)strlen(out);
+            return true;
+
+        case RULES:
+            if (!_haveWord || _ruleIdx >= _rules.size()) {
+                _wordStart = _reader.offset();
+                if (!_reader.available() || !_reader.nextLine(_word, CAND_WORD_MAX - 1)) return false;
+                _wordLen = strlen(_word);
+                _ruleIdx = _seekRule < _rules.size() ? _seekRule : 0;
+                _seekRule = 0;
+                _haveWord = true;
+            }
+            len = cand_apply_rule(_rules[_ruleIdx++].c_str(), _word, _wordLen, out, cap);
+            return true;
+
+        case MASK: {
+            if (_maskDone) return false;
+            size_t n = _sets.size();
+            for (size_t i = 0; i < n; i++) out[i] = _sets[i][_odo[i]];
+            out[n] = '\0';
+            len = (int)n;
+            _maskIdx++;
+            // Odometer, rightmost position fastest.
+            size_t i = n;
+            while (i-- > 0) {
+                if (++_odo[i] < _setLen[i]) break;
+                _odo[i] = 0;
+            }
+            if (i == (size_t)-1) _maskDone = true;
+            return true;
+        }
+
+        default: return false;
+    }
+}
+
+CandidatePos CandidateGen::position() const {
+    switch (_mode) {
+        case WORDLIST: return {_reader.offset(), 0};
+        case RULES:
+            if (_haveWord && _ruleIdx < _rules.size()) return {_wordStart, (uint32_t)_ruleIdx};
+            return {_reader.offset(), 0};
+        case MASK: return {_maskIdx, 0};
+        default: return {0, 0};
+    }
+}
+
+bool CandidateGen::seek(const CandidatePos &pos) {
+    switch (_mode) {
+        case WORDLIST:
+        case RULES:
+            _haveWord = false;
+            _seekRule = pos.rule;
+            return _reader.seek((size_t)pos.offset);
+        case MASK: {
+            if (pos.offset >= _keyspace) {
+                _maskIdx = _keyspace;
+                _maskDone = true;
+                return true;
+            }
+            // Mixed-radix digits of the index, rightmost position fastest.
+            uint64_t rem = pos.offset;
+            for (size_t i = _sets.size(); i-- > 0;) {
+                _odo[i] = rem % _setLen[i];
+                rem /= _setLen[i];
+            }
+            _maskIdx = pos.offset;
+            _maskDone = false;
+            return true;
+        }
+        default: return false;
+    }
+}
+
+bool CandidateGen::next(char *out, uint8_t &len, size_t minLen, size_t maxLen) {
+    char buf[2 * CAND_WORD_MAX + 1];
+    int n;
+    while (nextRaw(buf, 2 * CAND_WORD_MAX, n)) {
+        if (n < (int)minLen || n > (int)maxLen) continue;
+        memcpy(out, buf, n + 1);
+        len = (uint8_t)n;
+        _generated++;
+        return true;
+    }
+    return false;
+}
+
+/* ─────────────────────────────────────────────────────────────
+   PMK table reader
+───────────────────────────────────────────────────────────── */
+bool PmkTableReader::open(File *f) {
+    close();
+    if (!f || f->read((uint8_t *)&_hdr, sizeof(_hdr)) != sizeof(_hdr)) return false;
+    if (_hdr.magic != PMK_TABLE_MAGIC || _hdr.version != PMK_TABLE_VERSION) return false;
+    _hdr.ssid[32] = '\0';
+    // No SHA1 hot loop competes for the cache here, so PSRAM is fine for
+    // the big buffer: the bottleneck is the SD bus.
+    _cap = psramFound() ? PMK_TABLE_BUF : 8192;
+    _buf = (uint8_t *)(psramFound() ? ps_malloc(_cap) : malloc(_cap));
+    if (!_buf) return false;
+    _f = f;
+    _len = _pos = 0;
+    return true;
+}
+
+void PmkTableReader::close() {
+    if (_buf) free(_buf);
+    _buf = nullptr;
+    _f = nullptr;
+    _cap = _len = _pos = 0;
+}
+
+// At least `need` unread bytes in the buffer (false at end of file).
+bool PmkTableReader::fill(size_t need) {
+    if (_len - _pos >= need) return true;
+    size_t rem = _len - _pos;
+    if (rem) memmove(_buf, _buf + _pos, rem);
+    _len = rem;
+    _pos = 0;
+    while (_len < need) {
+        size_t rd = _f->read(_buf + _len, _cap - _len);
+        if (rd == 0) return false;
+        _len += rd;
+    }
+    return true;
+}
+
+bool PmkTableReader::next(char *pw, uint8_t &len, uint8_t pmk[32]) {
+    if (!_buf || !fill(1)) return false;
+    uint8_t n = _buf[_pos];
+    if (n < 8 || n > 63 || !fill(1 + n + 32)) return false;
+    memcpy(pw, _buf + _pos + 1, n);
+    pw[n] = '\0';
+    memcpy(pmk, _buf + _pos + 1 + n, 32);
+    len = n;
+    _pos += 1 + n + 32;
+    return true;
+}
+
+#endif
@@ -0,0 +1,171 @@
+// --- wifi_candidates.h ---
+#pragma once
+#ifndef LITE_VERSION
+#include <Arduino.h>
+#include <FS.h>
+#include <string>
+#include <vector>
+
+/*
+  Password candidate sources for WiFi Pass Recovery.
+
+  Candidates are produced on the fly by the producer task, nothing
+  expanded ever touches the SD card:
+    - wordlist: every line as is
+    - wordlist + rules: every line through every rule (word-major)
+    - mask: the full keyspace of a hashcat-style mask
+
+  Rules are the common hashcat subset, one rule per line, functions
+  applied left to right (spaces ignored, '#' lines are comments):
+    :  nothing           l  lowercase        u  uppercase
+    c  Capitalize        C  cAPITALIZE       t  toggle case
+    r  reverse           d  duplicate        f  reflect (word+drow)
+    {  rotate left       }  rotate right     [  drop first   ]  drop last
+    TN toggle at N       DN delete at N      'N truncate at N
+    $X append X          ^X prepend X        @X purge X
+    sXY replace X by Y   iNX insert X at N   oNX overwrite at N with X
+  N is 0-9 then A-Z (10-35).
+
+  Mask: ?l a-z  ?u A-Z  ?d 0-9  ?s symbols  ?a all printable
+        ?h 0-9a-f  ?H 0-9A-F  ?? a literal '?', anything else literal.
+*/
+
+#define CAND_WORD_MAX 64     // wordlist line / candidate buffer (WPA max is 63)
+#define CAND_RULE_MAX_LEN 64 // longest rule line kept
+#define CAND_MAX_RULES 1024  // rules kept from a rules file
+
+/* ── Buffered line reader over an SD/LittleFS file ── */
+struct WordlistReader {
+    File *file;
+    uint8_t *buf;
+    size_t cap, len, pos;
+    size_t base; // file offset of buf[0]
+    bool eof;
+
+    bool init(File *f);
+    void deinit();
+    void refill();
+    bool nextLine(char *out, size_t max_len);
+    bool available() const { return !eof || pos < len; }
+    // File offset of the next line, and a jump straight to one.
+    size_t offset() const { return base + pos; }
+    bool seek(size_t off);
+};
+
+// Applies one rule to `word`. Returns the candidate length, or -1 when the
+// rule rejects the word / has a syntax error (out is then undefined).
+int cand_apply_rule(const char *rule, const char *word, size_t wlen, char *out, size_t cap);
+
+// What the recover menu picked as the candidate source.
+struct CandidateSource {
+    String wordlist;           // wordlist path (unused by masks)
+    String rules;              // rules file path, empty for none
+    bool builtinRules = false; // wordlist through the built-in rule set
+    String mask;               // non-empty: mask attack
+    String pmkTable;           // non-empty: precomputed PMK table
+};
+
+// Resume point of a source: everything before it has been generated.
+//   wordlist: offset = byte offset of the next line, rule = 0
+//   rules:    offset = byte offset of the current word, rule = next rule
+//   mask:     offset = index in the keyspace, rule = 0
+struct CandidatePos {
+    uint64_t offset;
+    uint32_t rule;
+};
+
+class CandidateGen {
+public:
+    ~CandidateGen() { end(); }
+
+    // Lines of `wordlist`, each through every rule of `rules` (may be null).
+    bool beginWordlist(File *wordlist, File *rules = nullptr);
+    // Lines of `wordlist` through the built-in WPA rule set.
+    bool beginBuiltinRules(File *wordlist);
+    // Every candidate matching `mask`. False on an empty/oversized mask.
+    bool beginMask(const char *mask);
+    void end();
+
+    // Next candidate whose length is in [minLen, maxLen] into `out`
+    // (NUL terminated); false once the source is exhausted.
+    bool next(char *out, uint8_t &len, size_t minLen = 8, size_t maxLen = 63);
+
+    CandidatePos position() const;
+    // Continue from a position() of the same source (after begin*()).
+    bool seek(const CandidatePos &pos);
+
+    size_t rules() const { return _rules.size(); }
+    // Mask keyspace (saturates at UINT64_MAX); 0 for wordlist sources.
+    uint64_t keyspace() const { return _keyspace; }
+    uint32_t generated() const { return _generated; }
+
+private:
+    enum Mode : uint8_t { NONE, WORDLIST, RULES, MASK };
+    bool nextRaw(char *out, size_t cap, int &len);
+    bool addRule(const char *rule);
+
+    Mode _mode = NONE;
+    WordlistReader _reader = {};
+    std::vector<std::string> _rules;
+    size_t _ruleIdx = 0;
+    size_t _seekRule = 0; // first rule of the first word after a seek
+    size_t _wordStart = 0;
+    char _word[CAND_WORD_MAX];
+    size_t _wordLen = 0;
+    bool _haveWord = false;
+
+    std::vector<const char *> _sets; // per mask position: charset
+    std::vector<uint8_t> _setLen;
+    std::vector<uint8_t> _odo; // per mask position: index into its charset
+    bool _maskDone = false;
+    uint64_t _maskIdx = 0;
+    uint64_t _keyspace = 0;
+    uint32_t _generated = 0;
+};
+
+/*
+  Precomputed PMK table (.pmk, written by tools/gen_pmk_table.py)
+
+  PMK = PBKDF2(password, SSID, 4096) depends on nothing else, so for
+  one SSID it can be computed offline and the device only runs the
+  PTK/MIC (or PMKID) check per password.
+
+  Layout (little endian):
+    PmkTableHeader
+    per record, sorted by password bytes:
+      uint8_t len, char password[len] (8..63), uint8_t pmk[32]
+*/
+#define PMK_TABLE_MAGIC 0x544B4D50 // "PMKT"
+#define PMK_TABLE_VERSION 1
+#define PMK_TABLE_BUF 32768 // sequential read size (8 KB without PSRAM)
+
+struct PmkTableHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t reserved;
+    uint32_t count;
+    char ssid[33]; // NUL terminated
+    uint8_t pad[3];
+};
+
+class PmkTableReader {
+public:
+    ~PmkTableReader() { close(); }
+    // Reads and checks the header; the file stays owned by the caller.
+    bool open(File *f);
+    void close();
+    const char *ssid() const { return _hdr.ssid; }
+    uint32_t count() const { return _hdr.count; }
+    // Next record; false at the end or on a truncated/corrupt record.
+    bool next(char *pw, uint8_t &len, uint8_t pmk[32]);
+
+private:
+    bool fill(size_t need);
+
+    File *_f = nullptr;
+    uint8_t *_buf = nullptr;
+    size_t _cap = 0, _len = 0, _pos = 0;
+    PmkTableHeader _hdr = {};
+};
+
+#endif
@@ -0,0 +1,548 @@
+#ifndef LITE_VERSION
+// --- wifi_pbkdf2.cpp ---
+#include "wifi_pbkdf2.h"
+#include <string.h>
+
+#ifdef ARDUINO
+#include <esp_attr.h>
+#else
+#define IRAM_ATTR
+#endif
+
+/*
+ * We intentionally avoid mbedtls SHA1 here.
+ * ESP-IDF mbedtls routes SHA1 through the hardware SHA peripheral which
+ * has a FreeRTOS mutex. With two cores both calling SHA1 ~16,000 times
+ * per password candidate, that mutex becomes a serialization bottleneck
+ * that partially defeats the dual-core gain.
+ *
+ * This software SHA1 runs entirely in CPU registers — both cores compute
+ * independently with zero contention. It is also slightly faster than
+ * hardware SHA1 for the small block sizes used in PBKDF2 (20-64 bytes)
+ * because hardware SHA has DMA setup overhead per call.
+ */
+
+/* ═════════════════════════════════════════════════════════════
+   SOFTWARE SHA1  (optimized for PBKDF2 on ESP32 LX7)
+   ═════════════════════════════════════════════════════════════
+   Key design decisions:
+   1. IRAM_ATTR on hot functions — sha1_transform runs ~16,000×
+      per password. Placing it in IRAM avoids flash cache misses.
+   2. sha1_final uses memset+direct writes, NOT the old byte-at-a-
+      time while loop (which caused up to 55 sha1_update calls just
+      for zero padding per finalize — ~450,000 calls per password).
+   3. hmac_sha1_20: specialized path for exactly 20-byte inputs.
+      8190 of 8192 PBKDF2 HMAC calls use 20 bytes. This path
+      skips sha1_update/sha1_final entirely — builds the padded
+      64-byte block directly and calls sha1_transform once each
+      for inner and outer. Eliminates all loop/branching overhead.
+   4. bswap via memcpy+__builtin_bswap32 in sha1_transform:
+      one 32-bit load + bswap instead of 4 byte loads + 3 shifts.
+───────────────────────────────────────────────────────────── */
+#define SHA1_ROL(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+#define SHA1_BLK(i)                                                                                          \
+    (blk[i & 15] = SHA1_ROL(blk[(i + 13) & 15] ^ blk[(i + 8) & 15] ^ blk[(i + 2) & 15] ^ blk[i & 15], 1))
+
+#define R0(v, w, x, y, z, i)                                                                                 \
+    z += ((w & (x ^ y)) ^ y) + blk[i] + 0x5A827999u + SHA1_ROL(v, 5);                                        \
+    w = SHA1_ROL(w, 30)
+#define R1(v, w, x, y, z, i)                                                                                 \
+    z += ((w & (x ^ y)) ^ y) + SHA1_BLK(i) + 0x5A827999u + SHA1_ROL(v, 5);                                   \
+    w = SHA1_ROL(w, 30)
+#define R2(v, w, x, y, z, i)                                                                                 \
+    z += (w ^ x ^ y) + SHA1_BLK(i) + 0x6ED9EBA1u + SHA1_ROL(v, 5);                                           \
+    w = SHA1_ROL(w, 30)
+#define R3(v, w, x, y, z, i)                                                                                 \
+    z += (((w | x) & y) | (w & x)) + SHA1_BLK(i) + 0x8F1BBCDCu + SHA1_ROL(v, 5);                             \
+    w = SHA1_ROL(w, 30)
+#define R4(v, w, x, y, z, i)                                                                                 \
+    z += (w ^ x ^ y) + SHA1_BLK(i) + 0xCA62C1D6u + SHA1_ROL(v, 5);                                           \
+    w = SHA1_ROL(w, 30)
+
+#define SHA1_80_ROUNDS()                                                                                     \
+    R0(a, b, c, d, e, 0);                                                                                    \
+    R0(e, a, b, c, d, 1);                                                                                    \
+    R0(d, e, a, b, c, 2);                                                                                    \
+    R0(c, d, e, a, b, 3);                                                                                    \
+    R0(b, c, d, e, a, 4);                                                                                    \
+    R0(a, b, c, d, e, 5);                                                                                    \
+    R0(e, a, b, c, d, 6);                                                                                    \
+    R0(d, e, a, b, c, 7);                                                                                    \
+    R0(c, d, e, a, b, 8);                                                                                    \
+    R0(b, c, d, e, a, 9);                                                                                    \
+    R0(a, b, c, d, e, 10);                                                                                   \
+    R0(e, a, b, c, d, 11);                                                                                   \
+    R0(d, e, a, b, c, 12);                                                                                   \
+    R0(c, d, e, a, b, 13);                                                                                   \
+    R0(b, c, d, e, a, 14);                                                                                   \
+    R0(a, b, c, d, e, 15);                                                                                   \
+    R1(e, a, b, c, d, 16);                                                                                   \
+    R1(d, e, a, b, c, 17);                                                                                   \
+    R1(c, d, e, a, b, 18);                                                                                   \
+    R1(b, c, d, e, a, 19);                                                                                   \
+    R2(a, b, c, d, e, 20);                                                                                   \
+    R2(e, a, b, c, d, 21);                                                                                   \
+    R2(d, e, a, b, c, 22);                                                                                   \
+    R2(c, d, e, a, b, 23);                                                                                   \
+    R2(b, c, d, e, a, 24);                                                                                   \
+    R2(a, b, c, d, e, 25);                                                                                   \
+    R2(e, a, b, c, d, 26);                                                                                   \
+    R2(d, e, a, b, c, 27);                                                                                   \
+    R2(c, d, e, a, b, 28);                                                                                   \
+    R2(b, c, d, e, a, 29);                                                                                   \
+    R2(a, b, c, d, e, 30);                                                                                   \
+    R2(e, a, b, c, d, 31);                                                                                   \
+    R2(d, e, a, b, c, 32);                                                                                   \
+    R2(c, d, e, a, b, 33);                                                                                   \
+    R2(b, c, d, e, a, 34);                                                                                   \
+    R2(a, b, c, d, e, 35);                                                                                   \
+    R2(e, a, b, c, d, 36);                                                                                   \
+    R2(d, e, a, b, c, 37);                                                                                   \
+    R2(c, d, e, a, b, 38);                                                                                   \
+    R2(b, c, d, e, a, 39);                                                                                   \
+    R3(a, b, c, d, e, 40);                                                                                   \
+    R3(e, a, b, c, d, 41);                                                                                   \
+    R3(d, e, a, b, c, 42);                                                                                   \
+    R3(c, d, e, a, b, 43);                                                                                   \
+    R3(b, c, d, e, a, 44);                                                                                   \
+    R3(a, b, c, d, e, 45);                                                                                   \
+    R3(e, a, b, c, d, 46);                                                                                   \
+    R3(d, e, a, b, c, 47);                                                                                   \
+    R3(c, d, e, a, b, 48);                                                                                   \
+    R3(b, c, d, e, a, 49);                                                                                   \
+    R3(a, b, c, d, e, 50);                                                                                   \
+    R3(e, a, b, c, d, 51);                                                                                   \
+    R3(d, e, a, b, c, 52);                                                                                   \
+    R3(c, d, e, a, b, 53);                                                                                   \
+    R3(b, c, d, e, a, 54);                                                                                   \
+    R3(a, b, c, d, e, 55);                                                                                   \
+    R3(e, a, b, c, d, 56);                                                                                   \
+    R3(d, e, a, b, c, 57);                                                                                   \
+    R3(c, d, e, a, b, 58);                                                                                   \
+    R3(b, c, d, e, a, 59);                                                                                   \
+    R4(a, b, c, d, e, 60);                                                                                   \
+    R4(e, a, b, c, d, 61);                                                                                   \
+    R4(d, e, a, b, c, 62);                                                                                   \
+    R4(c, d, e, a, b, 63);                                                                                   \
+    R4(b, c, d, e, a, 64);                                                                                   \
+    R4(a, b, c, d, e, 65);                                                                                   \
+    R4(e, a, b, c, d, 66);                                                                                   \
+    R4(d, e, a, b, c, 67);                                                                                   \
+    R4(c, d, e, a, b, 68);                                                                                   \
+    R4(b, c, d, e, a, 69);                                                                                   \
+    R4(a, b, c, d, e, 70);                                                                                   \
+    R4(e, a, b, c, d, 71);                                                                                   \
+    R4(d, e, a, b, c, 72);                                                                                   \
+    R4(c, d, e, a, b, 73);                                                                                   \
+    R4(b, c, d, e, a, 74);                                                                                   \
+    R4(a, b, c, d, e, 75);                                                                                   \
+    R4(e, a, b, c, d, 76);                                                                                   \
+    R4(d, e, a, b, c, 77);                                                                                   \
+    R4(c, d, e, a, b, 78);                                                                                   \
+    R4(b, c, d, e, a, 79);
+
+/* ── Variant 1: general — full 16-word load from bytes (used by sha1_update) ── */
+static IRAM_ATTR __attribute__((optimize("O3"), hot)) void
+sha1_transform(uint32_t state[5], const uint8_t buf[64]) {
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+    uint32_t blk[16], tmp;
+    for (int i = 0; i < 16; i++) {
+        memcpy(&tmp, buf + i * 4, 4);
+        blk[i] = __builtin_bswap32(tmp);
+    }
+    SHA1_80_ROUNDS()
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+}
+
+/* ── Variant 2: 20-byte byte-input with fixed SHA1 padding ── */
+static inline IRAM_ATTR __attribute__((optimize("O3"), hot, always_inline)) void
+sha1_transform_20b(uint32_t state[5], const uint8_t data[20]) {
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+    uint32_t blk[16], tmp;
+    memcpy(&tmp, data + 0, 4);
+    blk[0] = __builtin_bswap32(tmp);
+    memcpy(&tmp, data + 4, 4);
+    blk[1] = __builtin_bswap32(tmp);
+    memcpy(&tmp, data + 8, 4);
+    blk[2] = __builtin_bswap32(tmp);
+    memcpy(&tmp, data + 12, 4);
+    blk[3] = __builtin_bswap32(tmp);
+    memcpy(&tmp, data + 16, 4);
+    blk[4] = __builtin_bswap32(tmp);
+    blk[5] = 0x80000000u;
+    blk[6] = 0;
+    blk[7] = 0;
+    blk[8] = 0;
+    blk[9] = 0;
+    blk[10] = 0;
+    blk[11] = 0;
+    blk[12] = 0;
+    blk[13] = 0;
+    blk[14] = 0;
+    blk[15] = 0x000002A0u;
+    SHA1_80_ROUNDS()
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+}
+
+/* ── Variant 3: 20-byte word-input with fixed SHA1 padding ── */
+static inline IRAM_ATTR __attribute__((optimize("O3"), hot, always_inline)) void
+sha1_transform_20w(uint32_t state[5], const uint32_t words[5]) {
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+    uint32_t blk[16];
+    blk[0] = words[0];
+    blk[1] = words[1];
+    blk[2] = words[2];
+    blk[3] = words[3];
+    blk[4] = words[4];
+    blk[5] = 0x80000000u;
+    blk[6] = 0;
+    blk[7] = 0;
+    blk[8] = 0;
+    blk[9] = 0;
+    blk[10] = 0;
+    blk[11] = 0;
+    blk[12] = 0;
+    blk[13] = 0;
+    blk[14] = 0;
+    blk[15] = 0x000002A0u;
+    SHA1_80_ROUNDS()
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+}
+
+static inline void sha1_extract(const uint32_t state[5], uint8_t digest[20]) {
+    for (int i = 0; i < 5; i++) {
+        uint32_t s = __builtin_bswap32(state[i]);
+        memcpy(digest + i * 4, &s, 4);
+    }
+}
+
+static void sha1_init(Sha1Ctx &ctx) {
+    ctx.state[0] = 0x67452301u;
+    ctx.state[1] = 0xEFCDAB89u;
+    ctx.state[2] = 0x98BADCFEu;
+    ctx.state[3] = 0x10325476u;
+    ctx.state[4] = 0xC3D2E1F0u;
+    ctx.count[0] = ctx.count[1] = 0;
+}
+
+static void sha1_update(Sha1Ctx &ctx, const uint8_t *data, size_t len) {
+    uint32_t j = (ctx.count[0] >> 3) & 63;
+    if ((ctx.count[0] += (uint32_t)(len << 3)) < (uint32_t)(len << 3)) ctx.count[1]++;
+    ctx.count[1] += (uint32_t)(len >> 29);
+    if (j + len > 63) {
+        size_t i = 64 - j;
+        memcpy(ctx.buf + j, data, i);
+        sha1_transform(ctx.state, ctx.buf);
+        for (; i + 63 < len; i += 64) sha1_transform(ctx.state, data + i);
+        j = 0;
+        memcpy(ctx.buf, data + i, len - i);
+    } else {
+        memcpy(ctx.buf + j, data, len);
+    }
+}
+
+static void sha1_final(Sha1Ctx &ctx, uint8_t digest[20]) {
+    uint64_t total_bits = ((uint64_t)ctx.count[1] << 32) | ctx.count[0];
+    uint32_t j = (ctx.count[0] >> 3) & 63;
+    ctx.buf[j++] = 0x80;
+    if (j > 56) {
+        memset(ctx.buf + j, 0, 64 - j);
+        sha1_transform(ctx.state, ctx.buf);
+        j = 0;
+    }
+    memset(ctx.buf + j, 0, 56 - j);
+    ctx.buf[56] = (uint8_t)(total_bits >> 56);
+    ctx.buf[57] = (uint8_t)(total_bits >> 48);
+    ctx.buf[58] = (uint8_t)(total_bits >> 40);
+    ctx.buf[59] = (uint8_t)(total_bits >> 32);
+    ctx.buf[60] = (uint8_t)(total_bits >> 24);
+    ctx.buf[61] = (uint8_t)(total_bits >> 16);
+    ctx.buf[62] = (uint8_t)(total_bits >> 8);
+    ctx.buf[63] = (uint8_t)(total_bits);
+    sha1_transform(ctx.state, ctx.buf);
+    sha1_extract(ctx.state, digest);
+}
+
+/* ─────────────────────────────────────────────────────────────
+   HMAC-SHA1 with pre-computed pads (software, no mutex)
+───────────────────────────────────────────────────────────── */
+void hmac_sha1_precompute(const uint8_t *key, size_t klen, HmacSha1Pre &out) {
+    uint8_t k_ipad[64], k_opad[64];
+    memset(k_ipad, 0x36, 64);
+    memset(k_opad, 0x5C, 64);
+    uint8_t hk[20];
+    if (klen > 64) {
+        Sha1Ctx t;
+        sha1_init(t);
+        sha1_update(t, key, klen);
+        sha1_final(t, hk);
+        key = hk;
+        klen = 20;
+    }
+    for (size_t i = 0; i < klen; i++) {
+        k_ipad[i] ^= key[i];
+        k_opad[i] ^= key[i];
+    }
+    sha1_init(out.inner);
+    sha1_update(out.inner, k_ipad, 64);
+    sha1_init(out.outer);
+    sha1_update(out.outer, k_opad, 64);
+}
+
+IRAM_ATTR __attribute__((optimize("O3"), hot)) void
+hmac_sha1_20(const HmacSha1Pre &pre, const uint8_t data[20], uint8_t out[20]) {
+    uint32_t state[5];
+    state[0] = pre.inner.state[0];
+    state[1] = pre.inner.state[1];
+    state[2] = pre.inner.state[2];
+    state[3] = pre.inner.state[3];
+    state[4] = pre.inner.state[4];
+    sha1_transform_20b(state, data);
+    uint32_t ih0 = state[0], ih1 = state[1], ih2 = state[2], ih3 = state[3], ih4 = state[4];
+    const uint32_t ih[5] = {ih0, ih1, ih2, ih3, ih4};
+    state[0] = pre.outer.state[0];
+    state[1] = pre.outer.state[1];
+    state[2] = pre.outer.state[2];
+    state[3] = pre.outer.state[3];
+    state[4] = pre.outer.state[4];
+    sha1_transform_20w(state, ih);
+    sha1_extract(state, out);
+}
+
+static inline IRAM_ATTR __attribute__((optimize("O3"), hot, always_inline)) void
+hmac_sha1_20w(const HmacSha1Pre &pre, const uint32_t data[5], uint32_t out[5]) {
+    uint32_t state[5];
+    state[0] = pre.inner.state[0];
+    state[1] = pre.inner.state[1];
+    state[2] = pre.inner.state[2];
+    state[3] = pre.inner.state[3];
+    state[4] = pre.inner.state[4];
+    sha1_transform_20w(state, data);
+    uint32_t ih[5] = {state[0], state[1], state[2], state[3], state[4]};
+    state[0] = pre.outer.state[0];
+    state[1] = pre.outer.state[1];
+    state[2] = pre.outer.state[2];
+    state[3] = pre.outer.state[3];
+    state[4] = pre.outer.state[4];
+    sha1_transform_20w(state, ih);
+    out[0] = state[0];
+    out[1] = state[1];
+    out[2] = state[2];
+    out[3] = state[3];
+    out[4] = state[4];
+}
+
+void hmac_sha1_with_pre(const HmacSha1Pre &pre, const uint8_t *data, size_t dlen, uint8_t *out20) {
+    uint8_t inner_hash[20];
+    Sha1Ctx ctx = pre.inner;
+    sha1_update(ctx, data, dlen);
+    sha1_final(ctx, inner_hash);
+    ctx = pre.outer;
+    sha1_update(ctx, inner_hash, 20);
+    sha1_final(ctx, out20);
+}
+
+/* ─────────────────────────────────────────────────────────────
+   PBKDF2-HMAC-SHA1 — fully unrolled for dklen=32 (WPA2 PMK)
+───────────────────────────────────────────────────────────── */
+IRAM_ATTR __attribute__((optimize("O3"), hot)) void pbkdf2_precomp(
+    const HmacSha1Pre &pre, const uint8_t *salt, size_t slen, unsigned int iters, uint8_t *out,
+    size_t /* dklen always 32 */
+) {
+    uint8_t salt_int[40];
+    memcpy(salt_int, salt, slen);
+
+    uint8_t U8[20];
+    uint32_t U[5];
+    uint32_t T[5];
+
+    /* Block 1 */
+    salt_int[slen] = 0;
+    salt_int[slen + 1] = 0;
+    salt_int[slen + 2] = 0;
+    salt_int[slen + 3] = 1;
+    hmac_sha1_with_pre(pre, salt_int, slen + 4, U8);
+    {
+        uint32_t t;
+        memcpy(&t, U8 + 0, 4);
+        U[0] = __builtin_bswap32(t);
+        memcpy(&t, U8 + 4, 4);
+        U[1] = __builtin_bswap32(t);
+        memcpy(&t, U8 + 8, 4);
+        U[2] = __builtin_bswap32(t);
+        memcpy(&t, U8 + 12, 4);
+        U[3] = __builtin_bswap32(t);
+        memcpy(&t, U8 + 16, 4);
+        U[4] = __builtin_bswap32(t);
+    }
+    T[0] = U[0];
+    T[1] = U[1];
+    T[2] = U[2];
+    T[3] = U[3];
+    T[4] = U[4];
+    for (unsigned int i = 1; i < iters; i++) {
+        hmac_sha1_20w(pre, U, U);
+        T[0] ^= U[0];
+        T[1] ^= U[1];
+        T[2] ^= U[2];
+        T[3] ^= U[3];
+        T[4] ^= U[4];
+    }
+    sha1_extract(T, out);
+
+    /* Block 2 */
+    salt_int[slen + 3] = 2;
+    hmac_sha1_with_pre(pre, salt_int, slen + 4, U8);
+    {
+        uint32_t t;
+        memcpy(&t, U8 + 0, 4);
+        U[0] = __builtin_bswap32(t);
+        memcpy(&t, U8 + 4, 4);
+        U[1] = __builtin_bswap32(t);
+        memcpy(&t, U8 + 8, 4);
+        U[2] = __builtin_bswap32(t);
+        memcpy(&t, U8 + 12, 4);
+        U[3] = __builtin_bswap32(t);
+        memcpy(&t, U8 + 16, 4);
+        U[4] = __builtin_bswap32(t);
+    }
+    T[0] = U[0];
+    T[1] = U[1];
+    T[2] = U[2];
+    T[3] = U[3];
+    T[4] = U[4];
+    for (unsigned int i = 1; i < iters; i++) {
+        hmac_sha1_20w(pre, U, U);
+        T[0] ^= U[0];
+        T[1] ^= U[1];
+        T[2] ^= U[2];
+        T[3] ^= U[3];
+        T[4] ^= U[4];
+    }
+    uint8_t last[20];
+    sha1_extract(T, last);
+    memcpy(out + 20, last, 12); // dklen 32: only 12 bytes of block 2
+}
+
+/* ─────────────────────────────────────────────────────────────
+   Multi-lane PBKDF2 — PBKDF2_LANES candidates per pass
+   ─────────────────────────────────────────────────────────────
+   The 80 rounds are one long dependency chain per state, so a
+   single SHA1 leaves the LX7 pipeline waiting on each add/rotate.
+   Sha1Lanes is a GCC vector of one word per candidate and runs
+   through the very same SHA1_80_ROUNDS(): on Xtensa it lowers
+   to independent per-lane ops the scheduler interleaves; a host
+   build (-DPBKDF2_LANES=8 -mavx2) gets real SIMD lanes from the
+   same source (tools/pbkdf2_lanes_test.cpp). Without SIMD the host
+   measures 2 lanes slower than one, so the device default is a
+   single lane, which is plain pbkdf2_precomp; build with
+   -DPBKDF2_LANES=2 and compare with `crackbench` on the board.
+───────────────────────────────────────────────────────────── */
+typedef uint32_t Sha1Lanes __attribute__((vector_size(4 * PBKDF2_LANES)));
+
+/* ── Lane variant of sha1_transform_20w ── */
+static inline IRAM_ATTR __attribute__((optimize("O3"), hot, always_inline)) void
+sha1_transform_20w_lanes(Sha1Lanes state[5], const Sha1Lanes words[5]) {
+    Sha1Lanes a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+    const Sha1Lanes zero = {};
+    Sha1Lanes blk[16];
+    blk[0] = words[0];
+    blk[1] = words[1];
+    blk[2] = words[2];
+    blk[3] = words[3];
+    blk[4] = words[4];
+    blk[5] = zero + 0x80000000u;
+    for (int i = 6; i < 15; i++) blk[i] = zero;
+    blk[15] = zero + 0x000002A0u;
+    SHA1_80_ROUNDS()
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+}
+
+static inline IRAM_ATTR __attribute__((optimize("O3"), hot, always_inline)) void hmac_sha1_20w_lanes(
+    const Sha1Lanes inner[5], const Sha1Lanes outer[5], const Sha1Lanes data[5], Sha1Lanes out[5]
+) {
+    Sha1Lanes state[5] = {inner[0], inner[1], inner[2], inner[3], inner[4]};
+    sha1_transform_20w_lanes(state, data);
+    const Sha1Lanes ih[5] = {state[0], state[1], state[2], state[3], state[4]};
+    state[0] = outer[0];
+    state[1] = outer[1];
+    state[2] = outer[2];
+    state[3] = outer[3];
+    state[4] = outer[4];
+    sha1_transform_20w_lanes(state, ih);
+    out[0] = state[0];
+    out[1] = state[1];
+    out[2] = state[2];
+    out[3] = state[3];
+    out[4] = state[4];
+}
+
+IRAM_ATTR __attribute__((optimize("O3"), hot)) void pbkdf2_lanes(
+    const HmacSha1Pre *const pre[PBKDF2_LANES], const uint8_t *salt, size_t slen, unsigned int iters,
+    uint8_t out[PBKDF2_LANES][32]
+) {
+#if PBKDF2_LANES == 1
+    pbkdf2_precomp(*pre[0], salt, slen, iters, out[0], 32);
+#else
+    uint8_t salt_int[40];
+    memcpy(salt_int, salt, slen);
+    salt_int[slen] = 0;
+    salt_int[slen + 1] = 0;
+    salt_int[slen + 2] = 0;
+
+    Sha1Lanes inner[5], outer[5];
+    for (int i = 0; i < 5; i++) {
+        for (int l = 0; l < PBKDF2_LANES; l++) {
+            inner[i][l] = pre[l]->inner.state[i];
+            outer[i][l] = pre[l]->outer.state[i];
+        }
+    }
+
+    Sha1Lanes U[5], T[5];
+    for (int block = 1; block <= 2; block++) {
+        salt_int[slen + 3] = (uint8_t)block;
+        for (int l = 0; l < PBKDF2_LANES; l++) {
+            uint8_t U8[20];
+            hmac_sha1_with_pre(*pre[l], salt_int, slen + 4, U8);
+            for (int i = 0; i < 5; i++) {
+                uint32_t t;
+                memcpy(&t, U8 + i * 4, 4);
+                U[i][l] = __builtin_bswap32(t);
+            }
+        }
+        for (int i = 0; i < 5; i++) T[i] = U[i];
+        for (unsigned int i = 1; i < iters; i++) {
+            hmac_sha1_20w_lanes(inner, outer, U, U);
+            T[0] ^= U[0];
+            T[1] ^= U[1];
+            T[2] ^= U[2];
+            T[3] ^= U[3];
+            T[4] ^= U[4];
+        }
+        for (int l = 0; l < PBKDF2_LANES; l++) {
+            const uint32_t lane[5] = {T[0][l], T[1][l], T[2][l], T[3][l], T[4][l]};
+            uint8_t digest[20];
+            sha1_extract(lane, digest);
+            memcpy(out[l] + (block - 1) * 20, digest, block == 1 ? 20 : 12);
+        }
+    }
+#endif
+}
+
+#endif
@@ -0,0 +1,46 @@
+// --- wifi_pbkdf2.h ---
+#pragma once
+#ifndef LITE_VERSION
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+  Software SHA1, HMAC-SHA1 and PBKDF2-HMAC-SHA1 (WPA2 PMK) for the
+  crack workers in wifi_recover.cpp. No Arduino dependencies, so the
+  host test (tools/pbkdf2_lanes_test.cpp) builds the very same kernel
+  natively, with real SIMD lanes from -DPBKDF2_LANES=8 -mavx2.
+*/
+
+struct Sha1Ctx {
+    uint32_t state[5];
+    uint32_t count[2];
+    uint8_t buf[64];
+};
+
+// Inner/outer SHA1 states after the HMAC key pads.
+struct HmacSha1Pre {
+    Sha1Ctx inner;
+    Sha1Ctx outer;
+};
+
+// Candidates per pbkdf2_lanes() pass. 1 is the single-lane kernel; wider
+// only pays off where `crackbench` shows it (see wifi_pbkdf2.cpp).
+#ifndef PBKDF2_LANES
+#define PBKDF2_LANES 1
+#endif
+
+void hmac_sha1_precompute(const uint8_t *key, size_t klen, HmacSha1Pre &out);
+void hmac_sha1_with_pre(const HmacSha1Pre &pre, const uint8_t *data, size_t dlen, uint8_t *out20);
+// Exactly 20 bytes of data: one transform per pad.
+void hmac_sha1_20(const HmacSha1Pre &pre, const uint8_t data[20], uint8_t out[20]);
+
+// PMK of one password (dklen is always 32).
+void pbkdf2_precomp(
+    const HmacSha1Pre &pre, const uint8_t *salt, size_t slen, unsigned int iters, uint8_t *out, size_t dklen
+);
+// PMKs of PBKDF2_LANES passwords at once (one pad set per lane).
+void pbkdf2_lanes(
+    const HmacSha1Pre *const pre[PBKDF2_LANES], const uint8_t *salt, size_t slen, unsigned int iters,
+    uint8_t out[PBKDF2_LANES][32]
+);
+#endif
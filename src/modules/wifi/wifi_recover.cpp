@@ -27,6 +27,8 @@
 // ─────────────────────────────────────────────────────────────────────────────
 
 #include "wifi_recover.h"
+#include "wifi_candidates.h"
+#include "wifi_pbkdf2.h"
 
 #include "core/display.h"
 #include "core/menu_items/WifiMenu.h"
@@ -36,6 +38,7 @@
 #include "core/utils.h"
 
 #include "esp_log.h"
+#include "esp_random.h"
 #include "esp_system.h"
 #include "esp_timer.h"
 #include "esp_wifi.h"
@@ -44,19 +47,6 @@
 #include "freertos/semphr.h"
 #include "freertos/task.h"
 
-/*
- * We intentionally avoid mbedtls SHA1 here.
- * ESP-IDF mbedtls routes SHA1 through the hardware SHA peripheral which
- * has a FreeRTOS mutex. With two cores both calling SHA1 ~16,000 times
- * per password candidate, that mutex becomes a serialization bottleneck
- * that partially defeats the dual-core gain.
- *
- * This software SHA1 runs entirely in CPU registers — both cores compute
- * independently with zero contention. It is also slightly faster than
- * hardware SHA1 for the small block sizes used in PBKDF2 (20-64 bytes)
- * because hardware SHA has DMA setup overhead per call.
- */
-
 #include <string.h>
 #include <string>
 
@@ -75,6 +65,11 @@ struct HandshakeData {
     uint16_t eapol_len;
     uint8_t mic[16];
     char ssid[33];
+    // PMKID = HMAC-SHA1-128(PMK, "PMK Name" || AA || SPA), from M1's key data
+    // or an association request's RSN IE. Needs no client reply.
+    bool has_pmkid;
+    uint8_t pmkid[16];
+    uint8_t pmkid_msg[20]; // "PMK Name" || AA || SPA
 };
 
 /* ─────────────────────────────────────────────────────────────
@@ -121,19 +116,76 @@ static String extract_ssid_from_beacon(const uint8_t *frame, size_t len) {
     return "";
 }
 
-static bool parse_pcap_handshake(FS &fs, const String &path, HandshakeData &hs) {
+static bool pmkid_nonzero(const uint8_t *pmkid) {
+    for (int i = 0; i < 16; i++) {
+        if (pmkid[i]) return true;
+    }
+    return false;
+}
+
+bool wifi_eapol_pmkid(const uint8_t *key, size_t len, uint8_t pmkid[16]) {
+    if (len < 95) return false;
+    size_t data_len = (size_t)((key[93] << 8) | key[94]);
+    const uint8_t *kd = key + 95;
+    if (95 + data_len > len) data_len = len - 95;
+
+    for (size_t off = 0; off + 2 <= data_len;) {
+        uint8_t type = kd[off], klen = kd[off + 1];
+        if (off + 2 + klen > data_len) break;
+        // KDE: DD len 00-0F-AC <data type> <data>; data type 4 is PMKID
+        if (type == 0xDD && klen >= 20 && kd[off + 2] == 0x00 && kd[off + 3] == 0x0F &&
+            kd[off + 4] == 0xAC && kd[off + 5] == 0x04) {
+            memcpy(pmkid, kd + off + 6, 16);
+            return pmkid_nonzero(pmkid);
+        }
+        off += 2 + klen;
+    }
+    return false;
+}
+
+// First PMKID of the RSN IE in (re)association request tagged parameters.
+static bool rsn_ie_pmkid(const uint8_t *tags, size_t len, uint8_t pmkid[16]) {
+    for (size_t off = 0; off + 2 <= len;) {
+        uint8_t tag = tags[off], tlen = tags[off + 1];
+        if (off + 2 + tlen > len) break;
+        if (tag == 0x30) {
+            const uint8_t *ie = tags + off + 2;
+            size_t p = 2 + 4; // version, group cipher
+            if (p + 2 > tlen) return false;
+            p += 2 + 4 * (size_t)(ie[p] | (ie[p + 1] << 8)); // pairwise ciphers
+            if (p + 2 > tlen) return false;
+            p += 2 + 4 * (size_t)(ie[p] | (ie[p + 1] << 8)); // AKMs
+            p += 2;                                           // RSN capabilities
+            if (p + 2 > tlen || (ie[p] | (ie[p + 1] << 8)) == 0 || p + 2 + 16 > tlen) return false;
+            memcpy(pmkid, ie + p + 2, 16);
+            return pmkid_nonzero(pmkid);
+        }
+        off += 2 + tlen;
+    }
+    return false;
+}
+
+static void set_pmkid(HandshakeData &hs, const uint8_t *pmkid, const uint8_t *aa, const uint8_t *spa) {
+    memcpy(hs.pmkid, pmkid, 16);
+    memcpy(hs.pmkid_msg, "PMK Name", 8);
+    memcpy(hs.pmkid_msg + 8, aa, 6);
+    memcpy(hs.pmkid_msg + 14, spa, 6);
+    hs.has_pmkid = true;
+}
+
+static bool parse_pcap_handshake(FS &fs, const String &path, HandshakeData &hs, bool verbose = true) {
     memset(&hs, 0, sizeof(hs));
     hs.valid = false;
 
     File f = fs.open(path, FILE_READ);
     if (!f) {
-        padprintln("Error: Cannot open PCAP file");
+        if (verbose) padprintln("Error: Cannot open PCAP file");
         return false;
     }
 
     pcap_hdr_t gh;
     if (f.read((uint8_t *)&gh, sizeof(gh)) != sizeof(gh)) {
-        padprintln("Error: Bad PCAP header");
+        if (verbose) padprintln("Error: Bad PCAP header");
         f.close();
         return false;
     }
@@ -145,12 +197,12 @@ static bool parse_pcap_handshake(FS &fs, const String &path, HandshakeData &hs)
         swapped = true;
         gh.network = swap32(gh.network);
     } else {
-        padprintln("Error: Invalid PCAP magic");
+        if (verbose) padprintln("Error: Invalid PCAP magic");
         f.close();
         return false;
     }
 
-    if (gh.network != 105) padprintf("Warning: Network type %u (expected 105)\n", gh.network);
+    if (verbose && gh.network != 105) padprintf("Warning: Network type %u (expected 105)\n", gh.network);
 
     bool have_m1 = false, have_m2 = false, have_m3 = false, have_beacon = false;
     const size_t MAX_PKT_READ = 8192;
@@ -212,6 +264,15 @@ static bool parse_pcap_handshake(FS &fs, const String &path, HandshakeData &hs)
             }
         }
 
+        // (Re)association request: the STA may list the PMKID of a cached PMK.
+        if (frame_type == 0 && (frame_sub == 0 || frame_sub == 2) && !hs.has_pmkid) {
+            size_t tags = 24 + (frame_sub == 0 ? 4 : 10);
+            uint8_t pmkid[16];
+            if (tags < read_sz && rsn_ie_pmkid(pkt + tags, read_sz - tags, pmkid)) {
+                set_pmkid(hs, pmkid, addr1, addr2);
+            }
+        }
+
         if (frame_type != 2) {
             free(pkt);
             continue;
@@ -264,6 +325,10 @@ static bool parse_pcap_handshake(FS &fs, const String &path, HandshakeData &hs)
             memcpy(hs.anonce, nonce, 32);
             memcpy(hs.ap_mac, ap_addr, 6);
             have_m1 = true;
+            uint8_t pmkid[16];
+            if (!hs.has_pmkid && wifi_eapol_pmkid(key, read_sz - (size_t)(key - pkt), pmkid)) {
+                set_pmkid(hs, pmkid, ap_addr, sta_addr);
+            }
         }
         if (msg_num == 2) {
             memcpy(hs.snonce, nonce, 32);
@@ -285,447 +350,36 @@ static bool parse_pcap_handshake(FS &fs, const String &path, HandshakeData &hs)
     }
     f.close();
 
+    // A PMKID is verified with one HMAC per candidate, so it wins over the
+    // 4-way handshake unless it belongs to another AP than the handshake.
+    bool four_way = have_m2 && (have_m1 || have_m3);
+    if (hs.has_pmkid && four_way && memcmp(hs.pmkid_msg + 8, hs.ap_mac, 6) != 0) hs.has_pmkid = false;
+    if (hs.has_pmkid) {
+        memcpy(hs.ap_mac, hs.pmkid_msg + 8, 6);
+        hs.valid = true;
+        return true;
+    }
+
     if (!have_m2) {
-        padprintln("Error: No M2 in PCAP");
+        if (verbose) padprintln("Error: No M2 or PMKID in PCAP");
         return false;
     }
     if (!have_m1 && !have_m3) {
-        padprintln("Error: Need M1 or M3");
+        if (verbose) padprintln("Error: Need M1 or M3");
         return false;
     }
     hs.valid = true;
     return true;
 }
 
-/* ═════════════════════════════════════════════════════════════
-   SOFTWARE SHA1  (optimized for PBKDF2 on ESP32 LX7)
-   ═════════════════════════════════════════════════════════════
-   Key design decisions:
-   1. IRAM_ATTR on hot functions — sha1_transform runs ~16,000×
-      per password. Placing it in IRAM avoids flash cache misses.
-   2. sha1_final uses memset+direct writes, NOT the old byte-at-a-
-      time while loop (which caused up to 55 sha1_update calls just
-      for zero padding per finalize — ~450,000 calls per password).
-   3. hmac_sha1_20: specialized path for exactly 20-byte inputs.
-      8190 of 8192 PBKDF2 HMAC calls use 20 bytes. This path
-      skips sha1_update/sha1_final entirely — builds the padded
-      64-byte block directly and calls sha1_transform once each
-      for inner and outer. Eliminates all loop/branching overhead.
-   4. bswap via memcpy+__builtin_bswap32 in sha1_transform:
-      one 32-bit load + bswap instead of 4 byte loads + 3 shifts.
-───────────────────────────────────────────────────────────── */
-struct Sha1Ctx {
-    uint32_t state[5];
-    uint32_t count[2];
-    uint8_t buf[64];
-};
-
-#define SHA1_ROL(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
-#define SHA1_BLK(i)                                                                                          \
-    (blk[i & 15] = SHA1_ROL(blk[(i + 13) & 15] ^ blk[(i + 8) & 15] ^ blk[(i + 2) & 15] ^ blk[i & 15], 1))
-
-#define R0(v, w, x, y, z, i)                                                                                 \
-    z += ((w & (x ^ y)) ^ y) + blk[i] + 0x5A827999u + SHA1_ROL(v, 5);                                        \
-    w = SHA1_ROL(w, 30)
-#define R1(v, w, x, y, z, i)                                                                                 \
-    z += ((w & (x ^ y)) ^ y) + SHA1_BLK(i) + 0x5A827999u + SHA1_ROL(v, 5);                                   \
-    w = SHA1_ROL(w, 30)
-#define R2(v, w, x, y, z, i)                                                                                 \
-    z += (w ^ x ^ y) + SHA1_BLK(i) + 0x6ED9EBA1u + SHA1_ROL(v, 5);                                           \
-    w = SHA1_ROL(w, 30)
-#define R3(v, w, x, y, z, i)                                                                                 \
-    z += (((w | x) & y) | (w & x)) + SHA1_BLK(i) + 0x8F1BBCDCu + SHA1_ROL(v, 5);                             \
-    w = SHA1_ROL(w, 30)
-#define R4(v, w, x, y, z, i)                                                                                 \
-    z += (w ^ x ^ y) + SHA1_BLK(i) + 0xCA62C1D6u + SHA1_ROL(v, 5);                                           \
-    w = SHA1_ROL(w, 30)
-
-#define SHA1_80_ROUNDS()                                                                                     \
-    R0(a, b, c, d, e, 0);                                                                                    \
-    R0(e, a, b, c, d, 1);                                                                                    \
-    R0(d, e, a, b, c, 2);                                                                                    \
-    R0(c, d, e, a, b, 3);                                                                                    \
-    R0(b, c, d, e, a, 4);                                                                                    \
-    R0(a, b, c, d, e, 5);                                                                                    \
-    R0(e, a, b, c, d, 6);                                                                                    \
-    R0(d, e, a, b, c, 7);                                                                                    \
-    R0(c, d, e, a, b, 8);                                                                                    \
-    R0(b, c, d, e, a, 9);                                                                                    \
-    R0(a, b, c, d, e, 10);                                                                                   \
-    R0(e, a, b, c, d, 11);                                                                                   \
-    R0(d, e, a, b, c, 12);                                                                                   \
-    R0(c, d, e, a, b, 13);                                                                                   \
-    R0(b, c, d, e, a, 14);                                                                                   \
-    R0(a, b, c, d, e, 15);                                                                                   \
-    R1(e, a, b, c, d, 16);                                                                                   \
-    R1(d, e, a, b, c, 17);                                                                                   \
-    R1(c, d, e, a, b, 18);                                                                                   \
-    R1(b, c, d, e, a, 19);                                                                                   \
-    R2(a, b, c, d, e, 20);                                                                                   \
-    R2(e, a, b, c, d, 21);                                                                                   \
-    R2(d, e, a, b, c, 22);                                                                                   \
-    R2(c, d, e, a, b, 23);                                                                                   \
-    R2(b, c, d, e, a, 24);                                                                                   \
-    R2(a, b, c, d, e, 25);                                                                                   \
-    R2(e, a, b, c, d, 26);                                                                                   \
-    R2(d, e, a, b, c, 27);                                                                                   \
-    R2(c, d, e, a, b, 28);                                                                                   \
-    R2(b, c, d, e, a, 29);                                                                                   \
-    R2(a, b, c, d, e, 30);                                                                                   \
-    R2(e, a, b, c, d, 31);                                                                                   \
-    R2(d, e, a, b, c, 32);                                                                                   \
-    R2(c, d, e, a, b, 33);                                                                                   \
-    R2(b, c, d, e, a, 34);                                                                                   \
-    R2(a, b, c, d, e, 35);                                                                                   \
-    R2(e, a, b, c, d, 36);                                                                                   \
-    R2(d, e, a, b, c, 37);                                                                                   \
-    R2(c, d, e, a, b, 38);                                                                                   \
-    R2(b, c, d, e, a, 39);                                                                                   \
-    R3(a, b, c, d, e, 40);                                                                                   \
-    R3(e, a, b, c, d, 41);                                                                                   \
-    R3(d, e, a, b, c, 42);                                                                                   \
-    R3(c, d, e, a, b, 43);                                                                                   \
-    R3(b, c, d, e, a, 44);                                                                                   \
-    R3(a, b, c, d, e, 45);                                                                                   \
-    R3(e, a, b, c, d, 46);                                                                                   \
-    R3(d, e, a, b, c, 47);                                                                                   \
-    R3(c, d, e, a, b, 48);                                                                                   \
-    R3(b, c, d, e, a, 49);                                                                                   \
-    R3(a, b, c, d, e, 50);                                                                                   \
-    R3(e, a, b, c, d, 51);                                                                                   \
-    R3(d, e, a, b, c, 52);                                                                                   \
-    R3(c, d, e, a, b, 53);                                                                                   \
-    R3(b, c, d, e, a, 54);                                                                                   \
-    R3(a, b, c, d, e, 55);                                                                                   \
-    R3(e, a, b, c, d, 56);                                                                                   \
-    R3(d, e, a, b, c, 57);                                                                                   \
-    R3(c, d, e, a, b, 58);                                                                                   \
-    R3(b, c, d, e, a, 59);                                                                                   \
-    R4(a, b, c, d, e, 60);                                                                                   \
-    R4(e, a, b, c, d, 61);                                                                                   \
-    R4(d, e, a, b, c, 62);                                                                                   \
-    R4(c, d, e, a, b, 63);                                                                                   \
-    R4(b, c, d, e, a, 64);                                                                                   \
-    R4(a, b, c, d, e, 65);                                                                                   \
-    R4(e, a, b, c, d, 66);                                                                                   \
-    R4(d, e, a, b, c, 67);                                                                                   \
-    R4(c, d, e, a, b, 68);                                                                                   \
-    R4(b, c, d, e, a, 69);                                                                                   \
-    R4(a, b, c, d, e, 70);                                                                                   \
-    R4(e, a, b, c, d, 71);                                                                                   \
-    R4(d, e, a, b, c, 72);                                                                                   \
-    R4(c, d, e, a, b, 73);                                                                                   \
-    R4(b, c, d, e, a, 74);                                                                                   \
-    R4(a, b, c, d, e, 75);                                                                                   \
-    R4(e, a, b, c, d, 76);                                                                                   \
-    R4(d, e, a, b, c, 77);                                                                                   \
-    R4(c, d, e, a, b, 78);                                                                                   \
-    R4(b, c, d, e, a, 79);
-
-/* ── Variant 1: general — full 16-word load from bytes (used by sha1_update) ── */
-static IRAM_ATTR __attribute__((optimize("O3"), hot)) void
-sha1_transform(uint32_t state[5], const uint8_t buf[64]) {
-    uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
-    uint32_t blk[16], tmp;
-    for (int i = 0; i < 16; i++) {
-        memcpy(&tmp, buf + i * 4, 4);
-        blk[i] = __builtin_bswap32(tmp);
-    }
-    SHA1_80_ROUNDS()
-    state[0] += a;
-    state[1] += b;
-    state[2] += c;
-    state[3] += d;
-    state[4] += e;
-}
-
-/* ── Variant 2: 20-byte byte-input with fixed SHA1 padding ── */
-static IRAM_ATTR __attribute__((optimize("O3"), hot, always_inline)) void
-sha1_transform_20b(uint32_t state[5], const uint8_t data[20]) {
-    uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
-    uint32_t blk[16], tmp;
-    memcpy(&tmp, data + 0, 4);
-    blk[0] = __builtin_bswap32(tmp);
-    memcpy(&tmp, data + 4, 4);
-    blk[1] = __builtin_bswap32(tmp);
-    memcpy(&tmp, data + 8, 4);
-    blk[2] = __builtin_bswap32(tmp);
-    memcpy(&tmp, data + 12, 4);
-    blk[3] = __builtin_bswap32(tmp);
-    memcpy(&tmp, data + 16, 4);
-    blk[4] = __builtin_bswap32(tmp);
-    blk[5] = 0x80000000u;
-    blk[6] = 0;
-    blk[7] = 0;
-    blk[8] = 0;
-    blk[9] = 0;
-    blk[10] = 0;
-    blk[11] = 0;
-    blk[12] = 0;
-    blk[13] = 0;
-    blk[14] = 0;
-    blk[15] = 0x000002A0u;
-    SHA1_80_ROUNDS()
-    state[0] += a;
-    state[1] += b;
-    state[2] += c;
-    state[3] += d;
-    state[4] += e;
-}
-
-/* ── Variant 3: 20-byte word-input with fixed SHA1 padding ── */
-static IRAM_ATTR __attribute__((optimize("O3"), hot, always_inline)) void
-sha1_transform_20w(uint32_t state[5], const uint32_t words[5]) {
-    uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
-    uint32_t blk[16];
-    blk[0] = words[0];
-    blk[1] = words[1];
-    blk[2] = words[2];
-    blk[3] = words[3];
-    blk[4] = words[4];
-    blk[5] = 0x80000000u;
-    blk[6] = 0;
-    blk[7] = 0;
-    blk[8] = 0;
-    blk[9] = 0;
-    blk[10] = 0;
-    blk[11] = 0;
-    blk[12] = 0;
-    blk[13] = 0;
-    blk[14] = 0;
-    blk[15] = 0x000002A0u;
-    SHA1_80_ROUNDS()
-    state[0] += a;
-    state[1] += b;
-    state[2] += c;
-    state[3] += d;
-    state[4] += e;
-}
-
-static inline void sha1_extract(const uint32_t state[5], uint8_t digest[20]) {
-    for (int i = 0; i < 5; i++) {
-        uint32_t s = __builtin_bswap32(state[i]);
-        memcpy(digest + i * 4, &s, 4);
-    }
-}
-
-static void sha1_init(Sha1Ctx &ctx) {
-    ctx.state[0] = 0x67452301u;
-    ctx.state[1] = 0xEFCDAB89u;
-    ctx.state[2] = 0x98BADCFEu;
-    ctx.state[3] = 0x10325476u;
-    ctx.state[4] = 0xC3D2E1F0u;
-    ctx.count[0] = ctx.count[1] = 0;
-}
-
-static void sha1_update(Sha1Ctx &ctx, const uint8_t *data, size_t len) {
-    uint32_t j = (ctx.count[0] >> 3) & 63;
-    if ((ctx.count[0] += (uint32_t)(len << 3)) < (uint32_t)(len << 3)) ctx.count[1]++;
-    ctx.count[1] += (uint32_t)(len >> 29);
-    if (j + len > 63) {
-        size_t i = 64 - j;
-        memcpy(ctx.buf + j, data, i);
-        sha1_transform(ctx.state, ctx.buf);
-        for (; i + 63 < len; i += 64) sha1_transform(ctx.state, data + i);
-        j = 0;
-        memcpy(ctx.buf, data + i, len - i);
-    } else {
-        memcpy(ctx.buf + j, data, len);
-    }
-}
-
-static void sha1_final(Sha1Ctx &ctx, uint8_t digest[20]) {
-    uint64_t total_bits = ((uint64_t)ctx.count[1] << 32) | ctx.count[0];
-    uint32_t j = (ctx.count[0] >> 3) & 63;
-    ctx.buf[j++] = 0x80;
-    if (j > 56) {
-        memset(ctx.buf + j, 0, 64 - j);
-        sha1_transform(ctx.state, ctx.buf);
-        j = 0;
-    }
-    memset(ctx.buf + j, 0, 56 - j);
-    ctx.buf[56] = (uint8_t)(total_bits >> 56);
-    ctx.buf[57] = (uint8_t)(total_bits >> 48);
-    ctx.buf[58] = (uint8_t)(total_bits >> 40);
-    ctx.buf[59] = (uint8_t)(total_bits >> 32);
-    ctx.buf[60] = (uint8_t)(total_bits >> 24);
-    ctx.buf[61] = (uint8_t)(total_bits >> 16);
-    ctx.buf[62] = (uint8_t)(total_bits >> 8);
-    ctx.buf[63] = (uint8_t)(total_bits);
-    sha1_transform(ctx.state, ctx.buf);
-    sha1_extract(ctx.state, digest);
-}
-
-/* ─────────────────────────────────────────────────────────────
-   HMAC-SHA1 with pre-computed pads (software, no mutex)
-───────────────────────────────────────────────────────────── */
-struct HmacSha1Pre {
-    Sha1Ctx inner;
-    Sha1Ctx outer;
-};
-
-static void hmac_sha1_precompute(const uint8_t *key, size_t klen, HmacSha1Pre &out) {
-    uint8_t k_ipad[64], k_opad[64];
-    memset(k_ipad, 0x36, 64);
-    memset(k_opad, 0x5C, 64);
-    uint8_t hk[20];
-    if (klen > 64) {
-        Sha1Ctx t;
-        sha1_init(t);
-        sha1_update(t, key, klen);
-        sha1_final(t, hk);
-        key = hk;
-        klen = 20;
-    }
-    for (size_t i = 0; i < klen; i++) {
-        k_ipad[i] ^= key[i];
-        k_opad[i] ^= key[i];
-    }
-    sha1_init(out.inner);
-    sha1_update(out.inner, k_ipad, 64);
-    sha1_init(out.outer);
-    sha1_update(out.outer, k_opad, 64);
-}
-
-static IRAM_ATTR __attribute__((optimize("O3"), hot, always_inline)) void
-hmac_sha1_20(const HmacSha1Pre &pre, const uint8_t data[20], uint8_t out[20]) {
-    uint32_t state[5];
-    state[0] = pre.inner.state[0];
-    state[1] = pre.inner.state[1];
-    state[2] = pre.inner.state[2];
-    state[3] = pre.inner.state[3];
-    state[4] = pre.inner.state[4];
-    sha1_transform_20b(state, data);
-    uint32_t ih0 = state[0], ih1 = state[1], ih2 = state[2], ih3 = state[3], ih4 = state[4];
-    const uint32_t ih[5] = {ih0, ih1, ih2, ih3, ih4};
-    state[0] = pre.outer.state[0];
-    state[1] = pre.outer.state[1];
-    state[2] = pre.outer.state[2];
-    state[3] = pre.outer.state[3];
-    state[4] = pre.outer.state[4];
-    sha1_transform_20w(state, ih);
-    sha1_extract(state, out);
-}
-
-static IRAM_ATTR __attribute__((optimize("O3"), hot, always_inline)) void
-hmac_sha1_20w(const HmacSha1Pre &pre, const uint32_t data[5], uint32_t out[5]) {
-    uint32_t state[5];
-    state[0] = pre.inner.state[0];
-    state[1] = pre.inner.state[1];
-    state[2] = pre.inner.state[2];
-    state[3] = pre.inner.state[3];
-    state[4] = pre.inner.state[4];
-    sha1_transform_20w(state, data);
-    uint32_t ih[5] = {state[0], state[1], state[2], state[3], state[4]};
-    state[0] = pre.outer.state[0];
-    state[1] = pre.outer.state[1];
-    state[2] = pre.outer.state[2];
-    state[3] = pre.outer.state[3];
-    state[4] = pre.outer.state[4];
-    sha1_transform_20w(state, ih);
-    out[0] = state[0];
-    out[1] = state[1];
-    out[2] = state[2];
-    out[3] = state[3];
-    out[4] = state[4];
-}
-
-static void hmac_sha1_with_pre(const HmacSha1Pre &pre, const uint8_t *data, size_t dlen, uint8_t *out20) {
-    uint8_t inner_hash[20];
-    Sha1Ctx ctx = pre.inner;
-    sha1_update(ctx, data, dlen);
-    sha1_final(ctx, inner_hash);
-    ctx = pre.outer;
-    sha1_update(ctx, inner_hash, 20);
-    sha1_final(ctx, out20);
-}
-
-/* ─────────────────────────────────────────────────────────────
-   PBKDF2-HMAC-SHA1 — fully unrolled for dklen=32 (WPA2 PMK)
-───────────────────────────────────────────────────────────── */
-static IRAM_ATTR __attribute__((optimize("O3"), hot)) void pbkdf2_precomp(
-    const HmacSha1Pre &pre, const uint8_t *salt, size_t slen, unsigned int iters, uint8_t *out,
-    size_t /* dklen always 32 */
-) {
-    uint8_t salt_int[40];
-    memcpy(salt_int, salt, slen);
-
-    uint8_t U8[20];
-    uint32_t U[5];
-    uint32_t T[5];
-
-    /* Block 1 */
-    salt_int[slen] = 0;
-    salt_int[slen + 1] = 0;
-    salt_int[slen + 2] = 0;
-    salt_int[slen + 3] = 1;
-    hmac_sha1_with_pre(pre, salt_int, slen + 4, U8);
-    {
-        uint32_t t;
-        memcpy(&t, U8 + 0, 4);
-        U[0] = __builtin_bswap32(t);
-        memcpy(&t, U8 + 4, 4);
-        U[1] = __builtin_bswap32(t);
-        memcpy(&t, U8 + 8, 4);
-        U[2] = __builtin_bswap32(t);
-        memcpy(&t, U8 + 12, 4);
-        U[3] = __builtin_bswap32(t);
-        memcpy(&t, U8 + 16, 4);
-        U[4] = __builtin_bswap32(t);
-    }
-    T[0] = U[0];
-    T[1] = U[1];
-    T[2] = U[2];
-    T[3] = U[3];
-    T[4] = U[4];
-    for (unsigned int i = 1; i < iters; i++) {
-        hmac_sha1_20w(pre, U, U);
-        T[0] ^= U[0];
-        T[1] ^= U[1];
-        T[2] ^= U[2];
-        T[3] ^= U[3];
-        T[4] ^= U[4];
-    }
-    sha1_extract(T, out);
-
-    /* Block 2 */
-    salt_int[slen + 3] = 2;
-    hmac_sha1_with_pre(pre, salt_int, slen + 4, U8);
-    {
-        uint32_t t;
-        memcpy(&t, U8 + 0, 4);
-        U[0] = __builtin_bswap32(t);
-        memcpy(&t, U8 + 4, 4);
-        U[1] = __builtin_bswap32(t);
-        memcpy(&t, U8 + 8, 4);
-        U[2] = __builtin_bswap32(t);
-        memcpy(&t, U8 + 12, 4);
-        U[3] = __builtin_bswap32(t);
-        memcpy(&t, U8 + 16, 4);
-        U[4] = __builtin_bswap32(t);
-    }
-    T[0] = U[0];
-    T[1] = U[1];
-    T[2] = U[2];
-    T[3] = U[3];
-    T[4] = U[4];
-    for (unsigned int i = 1; i < iters; i++) {
-        hmac_sha1_20w(pre, U, U);
-        T[0] ^= U[0];
-        T[1] ^= U[1];
-        T[2] ^= U[2];
-        T[3] ^= U[3];
-        T[4] ^= U[4];
-    }
-    sha1_extract(T, out + 20);
-}
-
 /* ─────────────────────────────────────────────────────────────
    PTK Derivation (PRF-512)
 ───────────────────────────────────────────────────────────── */
+// First `ptk_len` bytes of the PTK; the MIC check only needs the KCK (16),
+// i.e. one PRF block instead of four.
 static bool derive_ptk(
     const uint8_t *pmk, const uint8_t *ap_mac, const uint8_t *sta_mac, const uint8_t *anonce,
-    const uint8_t *snonce, uint8_t *ptk_out
+    const uint8_t *snonce, uint8_t *ptk_out, size_t ptk_len = 64
 ) {
     uint8_t data[76];
     size_t pos = 0;
@@ -763,12 +417,12 @@ static bool derive_ptk(
     msg[label_len] = 0x00;
     memcpy(msg + label_len + 1, data, pos);
 
-    for (int i = 0; i < 4; i++) {
+    for (int i = 0; i * 20 < (int)ptk_len; i++) {
         if (g_abortRequested) return false;
         msg[label_len + 1 + pos] = (uint8_t)i;
         uint8_t hash[20];
         hmac_sha1_with_pre(pmk_pre, msg, label_len + 1 + pos + 1, hash);
-        size_t cp = (i == 3) ? 4 : 20;
+        size_t cp = ptk_len - i * 20 < 20 ? ptk_len - i * 20 : 20;
         memcpy(ptk_out + (i * 20), hash, cp);
     }
     return true;
@@ -788,11 +442,26 @@ static bool verify_mic(const HandshakeData &hs, const uint8_t *ptk) {
     return memcmp(computed_mic, hs.mic, 16) == 0;
 }
 
+/* ─────────────────────────────────────────────────────────────
+   PMKID Verification
+   "PMK Name" || AA || SPA is exactly 20 bytes, so this is one
+   pad precompute plus the fixed-length hmac_sha1_20 path — no
+   PRF-512, no MIC HMAC over the EAPOL frame.
+───────────────────────────────────────────────────────────── */
+static bool verify_pmkid(const HandshakeData &hs, const uint8_t *pmk) {
+    HmacSha1Pre pmk_pre;
+    hmac_sha1_precompute(pmk, 32, pmk_pre);
+    uint8_t computed[20];
+    hmac_sha1_20(pmk_pre, hs.pmkid_msg, computed);
+    return memcmp(computed, hs.pmkid, 16) == 0;
+}
+
 /* ─────────────────────────────────────────────────────────────
    Dual-core cracking via FreeRTOS queue
 ───────────────────────────────────────────────────────────── */
 #define PW_MAX_LEN 64
 #define QUEUE_DEPTH 8
+#define CRACK_MAX_BATCH 8 // captures of one SSID cracked against the same PMKs
 
 struct PwEntry {
     char pw[PW_MAX_LEN];
@@ -800,52 +469,84 @@ struct PwEntry {
 };
 
 struct CrackShared {
-    const HandshakeData *hs;
+    const HandshakeData *hs; // hs_count captures, all of the same SSID
+    int hs_count;
     QueueHandle_t queue;
-    volatile bool found;
-    char found_pw[PW_MAX_LEN];
+    volatile bool found;          // every capture opened
+    volatile uint32_t found_mask; // bit i: hs[i] opened
+    char found_pw[CRACK_MAX_BATCH][PW_MAX_LEN];
     volatile uint32_t attempts;
     volatile bool abort;
     SemaphoreHandle_t done_sem;
 };
 
-static __attribute__((optimize("O3"), hot)) bool
-try_password(const CrackShared &S, const char *pw, uint8_t pw_len) {
-    const HandshakeData &hs = *S.hs;
-    const size_t ssid_len = strlen(hs.ssid);
-    HmacSha1Pre pw_pre;
-    hmac_sha1_precompute((const uint8_t *)pw, pw_len, pw_pre);
-    uint8_t pmk[32];
-    pbkdf2_precomp(pw_pre, (const uint8_t *)hs.ssid, ssid_len, 4096, pmk, 32);
-    uint8_t ptk[64];
-    if (!derive_ptk(pmk, hs.ap_mac, hs.sta_mac, hs.anonce, hs.snonce, ptk)) return false;
-    return verify_mic(hs, ptk);
+// Does this PMK open the capture (PMKID, or PTK -> EAPOL MIC)?
+static bool pmk_matches(const HandshakeData &hs, const uint8_t *pmk) {
+    if (hs.has_pmkid) return verify_pmkid(hs, pmk);
+    uint8_t kck[16];
+    if (!derive_ptk(pmk, hs.ap_mac, hs.sta_mac, hs.anonce, hs.snonce, kck, sizeof(kck))) return false;
+    return verify_mic(hs, kck);
+}
+
+// One PMK against every capture still open; records matches in S.
+static void crack_try_pmk(CrackShared &S, const char *pw, uint8_t len, const uint8_t *pmk) {
+    const uint32_t all = (1u << S.hs_count) - 1;
+    for (int h = 0; h < S.hs_count; h++) {
+        if ((S.found_mask & (1u << h)) || !pmk_matches(S.hs[h], pmk)) continue;
+        memcpy(S.found_pw[h], pw, len + 1);
+        if ((__atomic_or_fetch(&S.found_mask, 1u << h, __ATOMIC_RELAXED) & all) == all) S.found = true;
+    }
+}
+
+// Up to PBKDF2_LANES candidates through the multi-lane kernel; spare lanes
+// recompute the first candidate. The PMK only depends on SSID + password, so
+// each one is tried on every capture still open. Records matches in S and
+// counts attempts.
+static __attribute__((optimize("O3"), hot)) void crack_batch(CrackShared &S, const PwEntry *batch, int n) {
+    const HandshakeData &hs = S.hs[0];
+    HmacSha1Pre pads[PBKDF2_LANES];
+    const HmacSha1Pre *pre[PBKDF2_LANES];
+    for (int l = 0; l < PBKDF2_LANES; l++) {
+        if (l < n) hmac_sha1_precompute((const uint8_t *)batch[l].pw, batch[l].len, pads[l]);
+        pre[l] = &pads[l < n ? l : 0];
+    }
+    uint8_t pmk[PBKDF2_LANES][32];
+    pbkdf2_lanes(pre, (const uint8_t *)hs.ssid, strlen(hs.ssid), 4096, pmk);
+    for (int l = 0; l < n && !S.found; l++) crack_try_pmk(S, batch[l].pw, batch[l].len, pmk[l]);
+    __atomic_fetch_add(&S.attempts, (uint32_t)n, __ATOMIC_RELAXED);
 }
 
 static void crack_worker_task(void *arg) {
     CrackShared &S = *(CrackShared *)arg;
-    PwEntry entry;
-
-    while (true) {
-        if (xQueueReceive(S.queue, &entry, portMAX_DELAY) != pdTRUE) break;
-        if (entry.len == 0) break; // sentinel
+    PwEntry batch[PBKDF2_LANES];
+
+    bool stop = false;
+    while (!stop) {
+        if (xQueueReceive(S.queue, &batch[0], portMAX_DELAY) != pdTRUE) break;
+        if (batch[0].len == 0) break; // sentinel
+        // Fill the other lanes with whatever is already queued.
+        int n = 1;
+        while (n < PBKDF2_LANES && xQueueReceive(S.queue, &batch[n], 0) == pdTRUE) {
+            if (batch[n].len == 0) {
+                stop = true;
+                break;
+            }
+            n++;
+        }
         if (S.found || S.abort) {
-            __atomic_fetch_add(&S.attempts, 1, __ATOMIC_RELAXED);
+            __atomic_fetch_add(&S.attempts, (uint32_t)n, __ATOMIC_RELAXED);
             continue;
         }
 
-        if (try_password(S, entry.pw, entry.len)) {
-            S.found = true;
-            memcpy(S.found_pw, entry.pw, entry.len + 1);
-        }
-        __atomic_fetch_add(&S.attempts, 1, __ATOMIC_RELAXED);
+        crack_batch(S, batch, n);
 
         // Thermal throttle + TWDT keep-alive.
         // vTaskDelay(pdMS_TO_TICKS(CRACK_YIELD_MS)) blocks long enough
         // for the idle task to run (which resets the 5s watchdog) and
         // reduces CPU duty cycle to limit heat. Tune CRACK_YIELD_MS at
         // the top of the file — default 2ms costs ~2.7% speed, saves heat.
-        vTaskDelay(pdMS_TO_TICKS(CRACK_YIELD_MS));
+        // Scaled by the batch so the duty cycle per password is unchanged.
+        vTaskDelay(pdMS_TO_TICKS(CRACK_YIELD_MS * n));
     }
 
     xSemaphoreGive(S.done_sem);
@@ -853,80 +554,234 @@ static void crack_worker_task(void *arg) {
 }
 
 /* ─────────────────────────────────────────────────────────────
-   Buffered wordlist reader
+   Checkpoint (<pcap>.ckpt)
+   ─────────────────────────────────────────────────────────────
+   Written every CRACK_CKPT_SEC and on abort, only while the
+   pipeline is drained (every generated candidate was tried), so
+   the saved position never skips a password. Written to .tmp
+   first: FAT can't rename over a file, so load() falls back to
+   the .tmp when power drops between the remove and the rename.
 ───────────────────────────────────────────────────────────── */
-struct WordlistReader {
-    File *file;
-    uint8_t *buf;
-    size_t cap, len, pos;
-    bool eof;
-
-    bool init(File *f) {
-        file = f;
-        // Always use internal SRAM for the wordlist buffer.
-        // PSRAM (when present) causes D-cache pressure that slows
-        // the SHA1 hot path on Core 0. 8KB in internal SRAM is faster
-        // than 32KB in PSRAM for this sequential-read workload.
-        cap = 8192u;
-        buf = (uint8_t *)malloc(cap);
-        len = pos = 0;
-        eof = false;
-        return buf != nullptr;
+#define CRACK_CKPT_MAGIC 0x54504B43 // "CKPT"
+#define CRACK_CKPT_VERSION 1
+#define CRACK_CKPT_SEC 60
+
+struct CrackCheckpoint {
+    uint32_t magic;
+    uint16_t version;
+    uint8_t mode; // 0 wordlist, 1 rules file, 2 built-in rules, 3 mask
+    uint8_t reserved;
+    uint32_t src_size, src_mtime;     // wordlist at start (mask: 0)
+    uint32_t rules_size, rules_mtime; // rules file at start
+    uint64_t offset;                  // CandidatePos
+    uint32_t rule;
+    uint32_t attempts;
+    char source[128]; // wordlist path or mask
+    char rules[96];   // rules file path
+};
+
+static bool crack_ckpt_read(FS &fs, const String &path, CrackCheckpoint &ck) {
+    File f = fs.open(path, FILE_READ);
+    if (!f) return false;
+    bool ok = f.size() == sizeof(ck) && f.read((uint8_t *)&ck, sizeof(ck)) == sizeof(ck);
+    f.close();
+    return ok && ck.magic == CRACK_CKPT_MAGIC && ck.version == CRACK_CKPT_VERSION;
+}
+
+static bool crack_ckpt_load(FS &fs, const String &path, CrackCheckpoint &ck) {
+    return crack_ckpt_read(fs, path, ck) || crack_ckpt_read(fs, path + ".tmp", ck);
+}
+
+static bool crack_ckpt_save(FS &fs, const String &path, const CrackCheckpoint &ck) {
+    String tmp = path + ".tmp";
+    File f = fs.open(tmp, FILE_WRITE);
+    if (!f) return false;
+    bool ok = f.write((const uint8_t *)&ck, sizeof(ck)) == sizeof(ck);
+    f.close();
+    if (!ok) {
+        fs.remove(tmp);
+        return false;
     }
-    void deinit() {
-        if (buf) {
-            free(buf);
-            buf = nullptr;
+    fs.remove(path);
+    return fs.rename(tmp, path);
+}
+
+static void crack_ckpt_clear(FS &fs, const String &path) {
+    fs.remove(path);
+    fs.remove(path + ".tmp");
+}
+
+// Same source as when the checkpoint was written (position fields ignored)?
+static bool crack_ckpt_same(const CrackCheckpoint &a, const CrackCheckpoint &b) {
+    return a.mode == b.mode && a.src_size == b.src_size && a.src_mtime == b.src_mtime &&
+           a.rules_size == b.rules_size && a.rules_mtime == b.rules_mtime &&
+           strncmp(a.source, b.source, sizeof(a.source)) == 0 && strncmp(a.rules, b.rules, sizeof(a.rules)) == 0;
+}
+
+/* ─────────────────────────────────────────────────────────────
+   Batch: other captures of the same SSID next to the pcap
+   One capture per AP (same AP, same password); up to
+   CRACK_MAX_BATCH in total. Returns how many were added.
+───────────────────────────────────────────────────────────── */
+static int crack_collect_batch(FS &fs, const String &pcap_path, std::vector<HandshakeData> &caps) {
+    int slash = pcap_path.lastIndexOf('/');
+    String dir = slash > 0 ? pcap_path.substring(0, slash) : "/";
+    File root = fs.open(dir);
+    if (!root || !root.isDirectory()) return 0;
+
+    int added = 0;
+    HandshakeData hs;
+    File file = root.openNextFile();
+    while (file && caps.size() < CRACK_MAX_BATCH) {
+        String name = String(file.name());
+        String path = dir + (dir.endsWith("/") ? "" : "/") + name;
+        bool cand = !file.isDirectory() && (name.endsWith(".pcap") || name.endsWith(".cap"));
+        file.close();
+        if (cand && path != pcap_path && parse_pcap_handshake(fs, path, hs, false) &&
+            strcmp(hs.ssid, caps[0].ssid) == 0) {
+            bool dup = false;
+            for (const HandshakeData &c : caps) dup |= memcmp(c.ap_mac, hs.ap_mac, 6) == 0;
+            if (!dup) {
+                caps.push_back(hs);
+                added++;
+            }
         }
+        file = root.openNextFile();
     }
+    root.close();
+    return added;
+}
 
-    void refill() {
-        if (eof) return;
-        size_t rem = len - pos;
-        if (rem) memmove(buf, buf + pos, rem);
-        len = rem;
-        pos = 0;
-        size_t space = cap - len;
-        if (!space) return;
-        size_t rd = file->read(buf + len, space);
-        len += rd;
-        if (rd == 0) eof = true;
-    }
+// Offers the other captures of the SSID; true when a prompt was drawn.
+static bool crack_pick_batch(FS &fs, const String &pcap_path, std::vector<HandshakeData> &caps) {
+    if (!crack_collect_batch(fs, pcap_path, caps)) return false;
+    String all = "All " + String(caps.size()) + " captures";
+    bool batch = true;
+    options = {
+        {all.c_str(),         [&]() { batch = true; } },
+        {"This capture only", [&]() { batch = false; }},
+    };
+    loopOptions(options);
+    if (!batch) caps.resize(1);
+    return true;
+}
 
-    bool nextLine(char *out, size_t max_len) {
-        while (true) {
-            for (size_t i = pos; i < len; i++) {
-                if (buf[i] == '\n') {
-                    size_t ll = i - pos;
-                    if (ll > 0 && buf[pos + ll - 1] == '\r') ll--;
-                    size_t cp = (ll < max_len) ? ll : max_len;
-                    memcpy(out, buf + pos, cp);
-                    out[cp] = '\0';
-                    pos = i + 1;
-                    return true;
-                }
+/* ─────────────────────────────────────────────────────────────
+   Result screen
+───────────────────────────────────────────────────────────── */
+static void crack_show_result(const CrackShared &S) {
+    if (S.found_mask) {
+        resetTftDisplay();
+        drawMainBorderWithTitle("WiFi Password Cracker", true);
+        padprintln("");
+        tft.setTextColor(TFT_GREEN, bruceConfig.bgColor);
+        padprintln("PASSWORD FOUND!");
+        tft.setTextColor(bruceConfig.priColor, bruceConfig.bgColor);
+        padprintln("");
+        padprintf("SSID: %s\n", S.hs[0].ssid[0] ? S.hs[0].ssid : "(not found)");
+
+        for (int h = 0; h < S.hs_count; h++) {
+            if (!(S.found_mask & (1u << h))) continue;
+            String display_pw = String(S.found_pw[h]);
+            const int MAX_DISPLAY = 28;
+            if ((int)display_pw.length() > MAX_DISPLAY) {
+                int tail = MAX_DISPLAY - 17;
+                if (tail < 3) tail = 3;
+                display_pw =
+                    display_pw.substring(0, 14) + "..." + display_pw.substring(display_pw.length() - tail);
             }
-            if (eof) {
-                size_t rem = len - pos;
-                if (!rem) return false;
-                if (buf[pos + rem - 1] == '\r') rem--;
-                size_t cp = (rem < max_len) ? rem : max_len;
-                memcpy(out, buf + pos, cp);
-                out[cp] = '\0';
-                pos = len;
-                return cp > 0;
+            if (S.hs_count > 1) {
+                const uint8_t *m = S.hs[h].ap_mac;
+                padprintf("AP: %02X:%02X:%02X:%02X:%02X:%02X\n", m[0], m[1], m[2], m[3], m[4], m[5]);
             }
-            refill();
+            padprintf("Password: %s\n", display_pw.c_str());
         }
+        padprintln("");
+        padprintln("Press any key to continue...");
+        while (!check(AnyKeyPress)) vTaskDelay(pdMS_TO_TICKS(50));
+
+    } else if (!g_abortRequested) {
+        tft.setTextColor(TFT_RED, bruceConfig.bgColor);
+        padprintln("Password not found");
+        tft.setTextColor(bruceConfig.priColor, bruceConfig.bgColor);
+        displayError("No match", true);
+        vTaskDelay(pdMS_TO_TICKS(3000));
     }
+}
 
-    bool available() const { return !eof || pos < len; }
-};
+/* ─────────────────────────────────────────────────────────────
+   PMK table attack
+   No PBKDF2 at all: every record is one PTK/MIC (or PMKID)
+   check, so this runs on this core alone and the SD read rate
+   becomes the limit. Records are not checkpointed; a table
+   is minutes, not hours.
+───────────────────────────────────────────────────────────── */
+static void crack_pmk_table(FS &fs, const String &table_path, const String &pcap_path, HandshakeData &hs) {
+    File tf = fs.open(table_path, FILE_READ);
+    PmkTableReader table;
+    if (!tf || !table.open(&tf)) {
+        displayError("Bad PMK table", true);
+        if (tf) tf.close();
+        return;
+    }
+    if (hs.ssid[0] == '\0') strncpy(hs.ssid, table.ssid(), sizeof(hs.ssid) - 1);
+    if (strcmp(table.ssid(), hs.ssid) != 0) {
+        displayError("Table is for " + String(table.ssid()), true);
+        tf.close();
+        return;
+    }
+
+    std::vector<HandshakeData> caps(1, hs);
+    if (crack_pick_batch(fs, pcap_path, caps)) {
+        resetTftDisplay();
+        drawMainBorderWithTitle("WiFi Password Recover", true);
+        padprintln("");
+        padprintf("SSID: %s\n", hs.ssid);
+    }
+    if (caps.size() > 1) padprintf("Captures: %u\n", (unsigned)caps.size());
+    padprintf("PMK table: %lu\n", (unsigned long)table.count());
+    padprintln("Recovering...");
+    padprintln("(Press SEL to abort)");
+    padprintln("");
+
+    CrackShared shared = {};
+    shared.hs = caps.data();
+    shared.hs_count = (int)caps.size();
+
+    uint64_t start_time = now_us();
+    uint64_t last_ui = start_time;
+    PwEntry entry;
+    uint8_t pmk[32];
+    SelPress = false;
+    while (!shared.found && table.next(entry.pw, entry.len, pmk)) {
+        crack_try_pmk(shared, entry.pw, entry.len, pmk);
+        shared.attempts++;
+        if ((shared.attempts & 63) != 0) continue;
+
+        if (check(SelPress)) {
+            g_abortRequested = true;
+            padprintln("");
+            padprintln("Aborted by user");
+            break;
+        }
+        uint64_t now = now_us();
+        if (now - last_ui > 1000000ULL) {
+            double elapsed = (now - start_time) / 1000000.0;
+            double rate = shared.attempts / (elapsed > 0 ? elapsed : 1.0);
+            padprintf("\r%lu | %.0f/s | %.1fs     ", (uint32_t)shared.attempts, rate, elapsed);
+            last_ui = now;
+            vTaskDelay(1); // TWDT
+        }
+    }
+    table.close();
+    tf.close();
+    crack_show_result(shared);
+}
 
 /* ─────────────────────────────────────────────────────────────
    Main cracking function
 ───────────────────────────────────────────────────────────── */
-void wifi_crack_handshake(const String &wordlist_path, const String &pcap_path) {
+void wifi_crack_handshake(const CandidateSource &src, const String &pcap_path) {
     g_abortRequested = false;
 
     // Boost to 240 MHz for maximum cracking speed.
@@ -962,8 +817,9 @@ void wifi_crack_handshake(const String &wordlist_path, const String &pcap_path)
         hs.ap_mac[4],
         hs.ap_mac[5]
     );
+    padprintln(hs.has_pmkid ? "Mode: PMKID" : "Mode: 4-way handshake");
 
-    if (hs.ssid[0] == '\0') {
+    if (hs.ssid[0] == '\0' && src.pmkTable.length() == 0) { // a PMK table names its SSID
         padprintln("SSID not found in PCAP");
         String ssid = keyboard("", 32, "Enter SSID:");
         if (ssid.length() == 0 || ssid == "\x1B") {
@@ -978,25 +834,94 @@ void wifi_crack_handshake(const String &wordlist_path, const String &pcap_path)
         padprintf("SSID: %s\n", hs.ssid);
     }
 
-    File wf = fs->open(wordlist_path, FILE_READ);
-    if (!wf) {
+    if (src.pmkTable.length()) {
+        crack_pmk_table(*fs, src.pmkTable, pcap_path, hs);
         setCpuFrequencyMhz(CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ);
-        displayError("Cannot open wordlist", true);
+        vTaskDelay(pdMS_TO_TICKS(200));
         return;
     }
 
-    WordlistReader reader;
-    if (!reader.init(&wf)) {
+    // Candidate source, identified for the checkpoint.
+    CrackCheckpoint ckpt = {};
+    ckpt.magic = CRACK_CKPT_MAGIC;
+    ckpt.version = CRACK_CKPT_VERSION;
+    ckpt.mode = src.mask.length() ? 3 : src.rules.length() ? 1 : src.builtinRules ? 2 : 0;
+    strncpy(ckpt.source, (src.mask.length() ? src.mask : src.wordlist).c_str(), sizeof(ckpt.source) - 1);
+    strncpy(ckpt.rules, src.rules.c_str(), sizeof(ckpt.rules) - 1);
+
+    File wf, rf;
+    CandidateGen gen;
+    bool gen_ok;
+    if (src.mask.length()) {
+        gen_ok = gen.beginMask(src.mask.c_str());
+    } else {
+        wf = fs->open(src.wordlist, FILE_READ);
+        if (!wf) {
+            setCpuFrequencyMhz(CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ);
+            displayError("Cannot open wordlist", true);
+            return;
+        }
+        ckpt.src_size = wf.size();
+        ckpt.src_mtime = (uint32_t)wf.getLastWrite();
+        if (src.rules.length()) {
+            rf = fs->open(src.rules, FILE_READ);
+            if (rf) {
+                ckpt.rules_size = rf.size();
+                ckpt.rules_mtime = (uint32_t)rf.getLastWrite();
+            }
+            gen_ok = rf && gen.beginWordlist(&wf, &rf);
+            if (rf) rf.close(); // rules are parsed into RAM by begin
+        } else if (src.builtinRules) {
+            gen_ok = gen.beginBuiltinRules(&wf);
+        } else {
+            gen_ok = gen.beginWordlist(&wf);
+        }
+    }
+    if (!gen_ok) {
         setCpuFrequencyMhz(CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ);
-        displayError("Out of memory", true);
+        displayError(src.mask.length() ? "Invalid mask" : "Bad rules / no memory", true);
+        if (wf) wf.close();
         return;
     }
 
+    // Other captures of this SSID share every PMK: crack them in the same pass.
+    std::vector<HandshakeData> caps(1, hs);
+    bool prompted = crack_pick_batch(*fs, pcap_path, caps);
+
+    // Resume where the last run of this source on this pcap stopped.
+    String ckpt_path = pcap_path + ".ckpt";
+    CrackCheckpoint saved;
+    uint32_t attempts_base = 0;
+    if (crack_ckpt_load(*fs, ckpt_path, saved) && crack_ckpt_same(saved, ckpt)) {
+        String resume_label = "Resume (" + String(saved.attempts) + " tried)";
+        bool resume = true;
+        options = {
+            {resume_label.c_str(), [&]() { resume = true; } },
+            {"Start over",         [&]() { resume = false; }},
+        };
+        loopOptions(options);
+        if (resume && gen.seek({saved.offset, saved.rule})) attempts_base = saved.attempts;
+        prompted = true;
+    }
+
+    if (prompted) {
+        resetTftDisplay();
+        drawMainBorderWithTitle("WiFi Password Recover", true);
+        padprintln("");
+        padprintf("SSID: %s\n", hs.ssid);
+    }
+    if (caps.size() > 1) padprintf("Captures: %u\n", (unsigned)caps.size());
+    if (attempts_base) padprintf("Resumed at %lu\n", (unsigned long)attempts_base);
+    if (src.mask.length()) padprintf("Mask: %s (%llu)\n", src.mask.c_str(), (unsigned long long)gen.keyspace());
+    else if (gen.rules()) padprintf("Rules: %u per word\n", (unsigned)gen.rules());
+
     CrackShared shared;
-    shared.hs = &hs;
+    shared.hs = caps.data();
+    shared.hs_count = (int)caps.size();
     shared.found = false;
+    shared.found_mask = 0;
     shared.abort = false;
-    shared.attempts = 0;
+    shared.attempts = attempts_base;
     memset(shared.found_pw, 0, sizeof(shared.found_pw));
     shared.queue = xQueueCreate(QUEUE_DEPTH, sizeof(PwEntry));
     shared.done_sem = xSemaphoreCreateBinary();
@@ -1025,13 +950,36 @@ void wifi_crack_handshake(const String &wordlist_path, const String &pcap_path)
 
     uint64_t start_time = now_us();
     uint64_t last_ui = start_time;
+    uint64_t gen_us = 0; // producer time spent generating (incl. SD reads)
     PwEntry entry;
+    PwEntry local[PBKDF2_LANES];
+    int local_n = 0;
     bool producer_done = false;
+    uint64_t last_ckpt = start_time;
     SelPress = false;
 
+    // Drain the pipeline (overflow batch + queue + worker) so the generator
+    // position has nothing in flight, then save it.
+    auto checkpoint = [&]() {
+        if (local_n) {
+            crack_batch(shared, local, local_n);
+            local_n = 0;
+        }
+        while (shared.attempts - attempts_base != gen.generated() && !shared.found) {
+            vTaskDelay(pdMS_TO_TICKS(5));
+        }
+        CandidatePos pos = gen.position();
+        ckpt.offset = pos.offset;
+        ckpt.rule = pos.rule;
+        ckpt.attempts = shared.attempts;
+        if (!crack_ckpt_save(*fs, ckpt_path, ckpt)) ESP_LOGW(TAG, "checkpoint write failed");
+        last_ckpt = now_us();
+    };
+
     while (!shared.found && !shared.abort) {
 
         if (check(SelPress)) {
+            if (!producer_done) checkpoint();
             shared.abort = true;
             g_abortRequested = true;
             padprintln("");
@@ -1040,34 +988,37 @@ void wifi_crack_handshake(const String &wordlist_path, const String &pcap_path)
         }
 
         if (!producer_done) {
-            if (!reader.available()) {
-                producer_done = true;
-            } else if (reader.nextLine(entry.pw, PW_MAX_LEN - 1)) {
-                entry.len = (uint8_t)strlen(entry.pw);
-                if (entry.len >= 8 && entry.len <= 63) {
-                    if (xQueueSend(shared.queue, &entry, 0) != pdTRUE) {
-                        if (!shared.found) {
-                            if (try_password(shared, entry.pw, entry.len)) {
-                                shared.found = true;
-                                memcpy(shared.found_pw, entry.pw, entry.len + 1);
-                            }
-                            __atomic_fetch_add(&shared.attempts, 1, __ATOMIC_RELAXED);
-                        }
-                    }
+            uint64_t g0 = now_us();
+            bool more = gen.next(entry.pw, entry.len, 8, 63);
+            gen_us += now_us() - g0;
+            if (more) {
+                // Worker busy: this core cracks the overflow, a full batch at a time.
+                if (xQueueSend(shared.queue, &entry, 0) != pdTRUE) local[local_n++] = entry;
+                if (local_n == PBKDF2_LANES) {
+                    crack_batch(shared, local, local_n);
+                    local_n = 0;
                 }
             } else {
                 producer_done = true;
             }
+        } else if (local_n) {
+            crack_batch(shared, local, local_n);
+            local_n = 0;
         } else {
             if (uxQueueMessagesWaiting(shared.queue) == 0) break;
             vTaskDelay(pdMS_TO_TICKS(10));
         }
 
         uint64_t now = now_us();
+        if (!producer_done && now - last_ckpt > CRACK_CKPT_SEC * 1000000ULL) checkpoint();
         if (now - last_ui > 1000000ULL) {
             double elapsed = (now - start_time) / 1000000.0;
-            double rate = shared.attempts / (elapsed > 0 ? elapsed : 1.0);
-            padprintf("\r%lu | %.1f/s | %.1fs     ", (uint32_t)shared.attempts, rate, elapsed);
+            double rate = (shared.attempts - attempts_base) / (elapsed > 0 ? elapsed : 1.0);
+            // Generator rate (candidates per second of producer time) apart from the hash rate.
+            double gen_k = gen_us ? gen.generated() * 1000.0 / gen_us : 0.0;
+            padprintf(
+                "\r%lu | %.1f/s | %.1fs | gen %.0fk/s  ", (uint32_t)shared.attempts, rate, elapsed, gen_k
+            );
             last_ui = now;
         }
     }
@@ -1079,39 +1030,13 @@ void wifi_crack_handshake(const String &wordlist_path, const String &pcap_path)
 
     vQueueDelete(shared.queue);
     vSemaphoreDelete(shared.done_sem);
-    reader.deinit();
-    wf.close();
+    gen.end();
+    if (wf) wf.close();
 
-    if (shared.found) {
-        resetTftDisplay();
-        drawMainBorderWithTitle("WiFi Password Cracker", true);
-        padprintln("");
-        tft.setTextColor(TFT_GREEN, bruceConfig.bgColor);
-        padprintln("PASSWORD FOUND!");
-        tft.setTextColor(bruceConfig.priColor, bruceConfig.bgColor);
-        padprintln("");
-        padprintf("SSID: %s\n", hs.ssid[0] ? hs.ssid : "(not found)");
-
-        String display_pw = String(shared.found_pw);
-        const int MAX_DISPLAY = 28;
-        if ((int)display_pw.length() > MAX_DISPLAY) {
-            int tail = MAX_DISPLAY - 17;
-            if (tail < 3) tail = 3;
-            display_pw =
-                display_pw.substring(0, 14) + "..." + display_pw.substring(display_pw.length() - tail);
-        }
-        padprintf("Password: %s\n", display_pw.c_str());
-        padprintln("");
-        padprintln("Press any key to continue...");
-        while (!check(AnyKeyPress)) vTaskDelay(pdMS_TO_TICKS(50));
+    // Finished (found or list exhausted): the checkpoint has nothing left to resume.
+    if (!g_abortRequested) crack_ckpt_clear(*fs, ckpt_path);
 
-    } else if (!g_abortRequested) {
-        tft.setTextColor(TFT_RED, bruceConfig.bgColor);
-        padprintln("Password not found");
-        tft.setTextColor(bruceConfig.priColor, bruceConfig.bgColor);
-        displayError("No match", true);
-        vTaskDelay(pdMS_TO_TICKS(3000));
-    }
+    crack_show_result(shared);
 
     // Restore CPU frequency to firmware default before returning
     setCpuFrequencyMhz(CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ);
@@ -1119,6 +1044,151 @@ void wifi_crack_handshake(const String &wordlist_path, const String &pcap_path)
     vTaskDelay(pdMS_TO_TICKS(200));
 }
 
+/* ─────────────────────────────────────────────────────────────
+   Kernel benchmark (serial `crackbench`)
+   Single-lane pbkdf2_precomp vs pbkdf2_lanes on one core, same
+   candidates; PMKs must agree. Rates are per core.
+───────────────────────────────────────────────────────────── */
+bool wifi_crack_bench(int candidates) {
+    if (candidates < PBKDF2_LANES) candidates = PBKDF2_LANES;
+    candidates -= candidates % PBKDF2_LANES;
+    static const char ssid[] = "BruceBench";
+    setCpuFrequencyMhz(240);
+
+    bool agree = true;
+    uint64_t single_us = 0, lanes_us = 0;
+    for (int base = 0; base < candidates; base += PBKDF2_LANES) {
+        PwEntry batch[PBKDF2_LANES];
+        HmacSha1Pre pads[PBKDF2_LANES];
+        const HmacSha1Pre *pre[PBKDF2_LANES];
+        uint8_t ref[PBKDF2_LANES][32], pmk[PBKDF2_LANES][32];
+        for (int l = 0; l < PBKDF2_LANES; l++) {
+            batch[l].len = (uint8_t)snprintf(batch[l].pw, PW_MAX_LEN, "benchpw%05d", base + l);
+            hmac_sha1_precompute((const uint8_t *)batch[l].pw, batch[l].len, pads[l]);
+            pre[l] = &pads[l];
+        }
+
+        uint64_t t0 = now_us();
+        for (int l = 0; l < PBKDF2_LANES; l++) {
+            pbkdf2_precomp(pads[l], (const uint8_t *)ssid, sizeof(ssid) - 1, 4096, ref[l], 32);
+        }
+        uint64_t t1 = now_us();
+        pbkdf2_lanes(pre, (const uint8_t *)ssid, sizeof(ssid) - 1, 4096, pmk);
+        uint64_t t2 = now_us();
+        single_us += t1 - t0;
+        lanes_us += t2 - t1;
+        if (memcmp(ref, pmk, sizeof(pmk)) != 0) agree = false;
+        vTaskDelay(1); // TWDT
+    }
+
+    setCpuFrequencyMhz(CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ);
+    Serial.printf(
+        "crackbench: %d candidates, %d lanes: single %.2f/s, lanes %.2f/s (x%.2f) %s\n",
+        candidates,
+        PBKDF2_LANES,
+        candidates * 1e6 / (double)single_us,
+        candidates * 1e6 / (double)lanes_us,
+        (double)single_us / (double)lanes_us,
+        agree ? "AGREE" : "DIFFER"
+    );
+    return agree;
+}
+
+/* ─────────────────────────────────────────────────────────────
+   PMK table benchmark (serial `pmkbench`)
+   PBKDF2 + MIC per candidate vs MIC only (what a PMK table
+   record costs), on a synthetic 4-way capture; with a table
+   file also the end-to-end rate including the SD reads.
+───────────────────────────────────────────────────────────── */
+bool wifi_pmk_table_bench(int candidates, const char *table_path) {
+    if (candidates < PBKDF2_LANES) candidates = PBKDF2_LANES;
+    candidates -= candidates % PBKDF2_LANES;
+    static const char ssid[] = "BruceBench";
+    HandshakeData hs = {};
+    strcpy(hs.ssid, ssid);
+    esp_fill_random(hs.ap_mac, sizeof(hs.ap_mac));
+    esp_fill_random(hs.sta_mac, sizeof(hs.sta_mac));
+    esp_fill_random(hs.anonce, sizeof(hs.anonce));
+    esp_fill_random(hs.snonce, sizeof(hs.snonce));
+    esp_fill_random(hs.eapol, sizeof(hs.eapol));
+    esp_fill_random(hs.mic, sizeof(hs.mic));
+    hs.eapol_len = 121; // M2 without key data
+    hs.valid = true;
+    setCpuFrequencyMhz(240);
+
+    std::vector<uint8_t> pmks(candidates * 32);
+    int hits = 0;
+    uint64_t t0 = now_us();
+    for (int base = 0; base < candidates; base += PBKDF2_LANES) {
+        HmacSha1Pre pads[PBKDF2_LANES];
+        const HmacSha1Pre *pre[PBKDF2_LANES];
+        uint8_t pmk[PBKDF2_LANES][32];
+        for (int l = 0; l < PBKDF2_LANES; l++) {
+            char pw[PW_MAX_LEN];
+            int len = snprintf(pw, sizeof(pw), "benchpw%05d", base + l);
+            hmac_sha1_precompute((const uint8_t *)pw, len, pads[l]);
+            pre[l] = &pads[l];
+        }
+        pbkdf2_lanes(pre, (const uint8_t *)ssid, sizeof(ssid) - 1, 4096, pmk);
+        for (int l = 0; l < PBKDF2_LANES; l++) {
+            hits += pmk_matches(hs, pmk[l]);
+            memcpy(&pmks[(base + l) * 32], pmk[l], 32);
+        }
+        vTaskDelay(1); // TWDT
+    }
+    uint64_t pbkdf2_us = now_us() - t0;
+
+    const int rounds = 256;
+    t0 = now_us();
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < candidates; i++) hits += pmk_matches(hs, &pmks[i * 32]);
+        if ((r & 31) == 31) vTaskDelay(1);
+    }
+    uint64_t mic_us = now_us() - t0;
+
+    double pbkdf2_rate = candidates * 1e6 / (double)pbkdf2_us;
+    double mic_rate = (double)candidates * rounds * 1e6 / (double)mic_us;
+    Serial.printf(
+        "pmkbench: pbkdf2+mic %.2f/s, mic only %.0f/s (x%.0f) per core\n",
+        pbkdf2_rate,
+        mic_rate,
+        mic_rate / pbkdf2_rate
+    );
+
+    bool ok = hits == 0; // random MIC: nothing may match
+    FS *fs = nullptr;
+    if (table_path && table_path[0] && getFsStorage(fs)) {
+        File tf = fs->open(table_path, FILE_READ);
+        PmkTableReader table;
+        if (!tf || !table.open(&tf)) {
+            Serial.println("pmkbench: cannot open table");
+            ok = false;
+        } else {
+            PwEntry entry;
+            uint8_t pmk[32];
+            uint32_t n = 0;
+            t0 = now_us();
+            while (table.next(entry.pw, entry.len, pmk)) {
+                hits += pmk_matches(hs, pmk);
+                if ((++n & 1023) == 0) vTaskDelay(1);
+            }
+            uint64_t us = now_us() - t0;
+            Serial.printf(
+                "pmkbench: table %s: %lu/%lu records in %.2fs, %.0f/s\n",
+                table.ssid(),
+                (unsigned long)n,
+                (unsigned long)table.count(),
+                us / 1e6,
+                n * 1e6 / (double)(us ? us : 1)
+            );
+            ok &= n == table.count();
+        }
+        if (tf) tf.close();
+    }
+    setCpuFrequencyMhz(CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ);
+    return ok;
+}
+
 /* ─────────────────────────────────────────────────────────────
    Menu entry point
 ───────────────────────────────────────────────────────────── */
@@ -1137,10 +1207,47 @@ void wifi_recover_menu() {
         else padprintf("Warning: failed to create %s\n", WORDLIST_DIR.c_str());
     }
 
-    String wordlist = loopSD(*fs, true, "txt|lst|csv|*", WORDLIST_DIR);
-    if (wordlist.length() == 0) {
-        displayInfo("Cancelled", true);
-        return;
+    CandidateSource src;
+    int mode = -1;
+    options = {
+        {"Wordlist",            [&]() { mode = 0; }},
+        {"Wordlist + rules",    [&]() { mode = 1; }},
+        {"Wordlist + built-in", [&]() { mode = 2; }},
+        {"Mask",                [&]() { mode = 3; }},
+        {"PMK table",           [&]() { mode = 4; }},
+    };
+    loopOptions(options);
+    if (mode < 0) return;
+
+    if (mode == 4) {
+        resetTftDisplay();
+        src.pmkTable = loopSD(*fs, true, "pmk", WORDLIST_DIR);
+        if (src.pmkTable.length() == 0) {
+            displayInfo("Cancelled", true);
+            return;
+        }
+    } else if (mode == 3) {
+        src.mask = keyboard("?d?d?d?d?d?d?d?d", 63, "Mask (?l?u?d?s?a?h):");
+        if (src.mask.length() == 0 || src.mask == "\x1B") {
+            displayInfo("Cancelled", true);
+            return;
+        }
+    } else {
+        resetTftDisplay();
+        src.wordlist = loopSD(*fs, true, "txt|lst|csv|*", WORDLIST_DIR);
+        if (src.wordlist.length() == 0) {
+            displayInfo("Cancelled", true);
+            return;
+        }
+        if (mode == 1) {
+            resetTftDisplay();
+            src.rules = loopSD(*fs, true, "rule|rules|txt|*", WORDLIST_DIR);
+            if (src.rules.length() == 0) {
+                displayInfo("Cancelled", true);
+                return;
+            }
+        }
+        src.builtinRules = mode == 2;
     }
 
     const String PCAP_DIR = "/BrucePCAP";
@@ -1156,7 +1263,7 @@ void wifi_recover_menu() {
         return;
     }
 
-    wifi_crack_handshake(wordlist, pcap);
+    wifi_crack_handshake(src, pcap);
     while (!check(AnyKeyPress)) vTaskDelay(pdMS_TO_TICKS(50));
 }
 #endif
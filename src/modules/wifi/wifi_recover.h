@@ -12,6 +12,19 @@ extern "C" {
 // Called from WifiMenu::optionsMenu()
 void wifi_recover_menu();
 
+// PMKID KDE (00-0F-AC:4) in the key data of an EAPOL-Key frame. `key` points
+// at the descriptor type, `len` is the bytes available from there. False when
+// absent or all zero (APs that don't cache PMKs send zeros).
+bool wifi_eapol_pmkid(const uint8_t *key, size_t len, uint8_t pmkid[16]);
+
+// Single-lane vs multi-lane PBKDF2 on `candidates` passwords: prints both
+// rates and whether the PMKs agree (serial `crackbench`).
+bool wifi_crack_bench(int candidates);
+
+// PBKDF2+MIC vs MIC-only (PMK table) rates, plus the end-to-end rate of
+// streaming `table_path` when given (serial `pmkbench`).
+bool wifi_pmk_table_bench(int candidates, const char *table_path);
+
 #ifdef __cplusplus
 }
 #endif
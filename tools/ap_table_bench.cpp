@@ -0,0 +1,196 @@
+// Host microbenchmark for the sniffer's per-AP table (src/modules/wifi/ap_table.*)
+// against the std::map / std::set layout it replaced.
+//
+// Replays a synthetic promiscuous stream over N APs (default 500): beacons
+// update SSID, last-seen and the raw beacon cache, other frames look the
+// SSID up, and stale APs are pruned periodically. Prints ns/frame and heap
+// allocations for both, after checking ApTable against std::map on random
+// insert/erase/lookup sequences.
+//
+// Build and run:
+//   g++ -O2 -std=gnu++17 -Isrc/modules/wifi -o ap_table_bench
+//       tools/ap_table_bench.cpp src/modules/wifi/ap_table.cpp
+//   ./ap_table_bench [aps] [frames]
+#include "ap_table.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <new>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+static size_t g_allocs = 0;
+void *operator new(size_t n) {
+    g_allocs++;
+    if (void *p = malloc(n)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+struct Frame {
+    uint64_t bssid;
+    bool beacon;
+    uint32_t now;
+};
+
+static std::vector<Frame> make_stream(size_t aps, size_t frames, std::vector<uint64_t> &keys) {
+    std::mt19937_64 rng(1);
+    keys.resize(aps);
+    for (auto &k : keys) k = (0x24A160ULL << 24) | (rng() & 0xFFFFFF); // few OUIs, like real air
+    std::vector<Frame> out(frames);
+    // Skewed popularity: a few busy APs, a long tail of quiet ones.
+    std::geometric_distribution<size_t> pick(4.0 / aps);
+    for (size_t i = 0; i < frames; i++) {
+        out[i].bssid = keys[pick(rng) % aps];
+        out[i].beacon = (rng() % 10) < 7;
+        out[i].now = (uint32_t)(i / 50) + 1; // ~50 frames per ms
+    }
+    return out;
+}
+
+static const uint32_t TIMEOUT = 120000;
+static const size_t MAX_BEACON_CACHE = 64;
+
+static double run_std(const std::vector<Frame> &stream, size_t &allocs, size_t &checksum) {
+    std::map<uint64_t, std::string> ssidCache;
+    std::map<uint64_t, uint32_t> lastSeen;
+    std::map<uint64_t, BeaconFrame> beaconCache;
+    std::set<uint64_t> ready;
+    uint8_t payload[300] = {0};
+    size_t sum = 0;
+    size_t a0 = g_allocs;
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < stream.size(); i++) {
+        const Frame &f = stream[i];
+        if (f.beacon) {
+            ssidCache[f.bssid] = "BenchNetwork";
+            if (beaconCache.find(f.bssid) != beaconCache.end() || beaconCache.size() < MAX_BEACON_CACHE) {
+                BeaconFrame &b = beaconCache[f.bssid];
+                memcpy(b.data, payload, sizeof(payload));
+                b.len = sizeof(payload);
+            }
+            lastSeen[f.bssid] = f.now;
+        } else {
+            auto it = ssidCache.find(f.bssid);
+            if (it != ssidCache.end()) sum += it->second.size();
+            sum += ready.find(f.bssid) != ready.end();
+        }
+        if ((i & 0xFFFF) == 0) {
+            for (auto it = lastSeen.begin(); it != lastSeen.end();) {
+                if (f.now - it->second > TIMEOUT) {
+                    ssidCache.erase(it->first);
+                    beaconCache.erase(it->first);
+                    it = lastSeen.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    allocs = g_allocs - a0;
+    checksum = sum;
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / stream.size();
+}
+
+static double run_table(const std::vector<Frame> &stream, size_t &allocs, size_t &checksum) {
+    ApTable table;
+    table.begin(1024, MAX_BEACON_CACHE, 16);
+    uint8_t payload[300] = {0};
+    size_t sum = 0;
+    size_t a0 = g_allocs;
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < stream.size(); i++) {
+        const Frame &f = stream[i];
+        if (f.beacon) {
+            ApSlot *s = table.insert(f.bssid);
+            strcpy(s->ssid, "BenchNetwork");
+            if (BeaconFrame *b = table.beacon(*s, true)) {
+                memcpy(b->data, payload, sizeof(payload));
+                b->len = sizeof(payload);
+            }
+            s->lastSeen = f.now;
+        } else if (const ApSlot *s = table.peek(f.bssid)) {
+            sum += strlen(s->ssid);
+            sum += (s->flags & AP_HS_READY) != 0;
+        }
+        if ((i & 0xFFFF) == 0) {
+            uint32_t now = f.now;
+            table.eraseIf([now](const ApSlot &s) { return now - s.lastSeen > TIMEOUT; });
+        }
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    allocs = g_allocs - a0;
+    checksum = sum;
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / stream.size();
+}
+
+// Random operations against std::map; capacity is large enough that no
+// eviction happens, so both must agree exactly.
+static bool self_test() {
+    ApTable table;
+    if (!table.begin(256, 32, 4)) return false;
+    std::map<uint64_t, uint8_t> ref;
+    std::mt19937_64 rng(7);
+    for (int op = 0; op < 200000; op++) {
+        uint64_t key = rng() % 300;
+        switch (rng() % 3) {
+            case 0:
+                if (ref.size() < 180 || ref.count(key)) {
+                    table.insert(key)->channel = (uint8_t)key;
+                    ref[key] = (uint8_t)key;
+                }
+                break;
+            case 1:
+                table.erase(key);
+                ref.erase(key);
+                break;
+            default: {
+                const ApSlot *s = table.peek(key);
+                if ((s != nullptr) != (ref.count(key) != 0)) return false;
+                if (s && s->channel != ref[key]) return false;
+            }
+        }
+        if (table.size() != ref.size()) return false;
+    }
+    // LRU: after filling past the load limit the oldest untouched key goes first.
+    table.clear();
+    for (uint64_t k = 1; k <= 192; k++) table.insert(k);
+    table.find(1);
+    table.insert(1000);
+    if (!table.peek(1) || table.peek(2) || table.evictions() != 1) return false;
+    // A saved handshake is skipped while anything else can go...
+    table.forEach([](ApSlot &s) {
+        if (s.key == 3) s.flags = AP_HS_READY;
+    });
+    table.insert(1001);
+    if (!table.peek(3) || table.peek(4)) return false;
+    // ...and only evicted once every slot but one holds one.
+    table.forEach([](ApSlot &s) { s.flags = AP_HS_BEACON_SAVED; });
+    for (uint64_t k = 2000; k < 2200; k++) table.insert(k)->flags = AP_HS_READY;
+    return table.size() == table.capacity() - 1 && table.peek(2199);
+}
+
+int main(int argc, char **argv) {
+    size_t aps = argc > 1 ? strtoul(argv[1], nullptr, 10) : 500;
+    size_t frames = argc > 2 ? strtoul(argv[2], nullptr, 10) : 2000000;
+    if (!self_test()) {
+        printf("self-test FAILED\n");
+        return 1;
+    }
+    std::vector<uint64_t> keys;
+    std::vector<Frame> stream = make_stream(aps, frames, keys);
+    size_t allocStd, allocTable, sumStd, sumTable;
+    double nsStd = run_std(stream, allocStd, sumStd);
+    double nsTable = run_table(stream, allocTable, sumTable);
+    printf("%zu APs, %zu frames\n", aps, frames);
+    printf("std::map/set : %6.1f ns/frame, %zu allocations\n", nsStd, allocStd);
+    printf("ApTable      : %6.1f ns/frame, %zu allocations (x%.1f)\n", nsTable, allocTable, nsStd / nsTable);
+    printf("checksums %s\n", sumStd == sumTable ? "match" : "differ (beacon cache / eviction policy)");
+    return 0;
+}
@@ -0,0 +1,200 @@
+// Host test for the brute-force RMT symbol generators (src/modules/rf/rf_brute_gen.*).
+//
+// Codes: brute_gen of every protocol is drained in uneven chunks, like the RMT
+// refill does, and its pulse train compared with the sequence the former
+// bit-banged sender produced (pilot, data bits MSB first, stop; per repeat).
+//
+// De Bruijn: for every alphabet and width up to 2^20 words, an n-symbol window
+// slides over B(k, n) and every one of the k^n words must appear, in exactly
+// k^n + n - 1 symbols. Then debruijn_gen of every protocol at its default width
+// is drained the same way and its bit stream mapped back to symbols: pilot
+// first, stop last, and every code of the keyspace in between.
+//
+// Build and run:
+//   g++ -O2 -std=gnu++17 -Isrc/modules/rf -o brute_gen_test
+//       tools/brute_gen_test.cpp src/modules/rf/rf_brute_gen.cpp
+//   ./brute_gen_test
+#include "rf_brute_gen.h"
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#define VERIFY_MAX_WORDS (1UL << 20)
+
+static uint32_t seed = 1;
+
+// Chunk size the next refill asks for: 1..64 symbols.
+static size_t next_chunk() {
+    seed = seed * 1103515245 + 12345;
+    return 1 + (seed >> 16) % 64;
+}
+
+typedef size_t (*SymbolGen)(rmt_symbol_word_t *out, size_t max, bool restart, void *ctx);
+
+// Drain a generator the way RfTxStream does, as signed durations.
+static void drain(SymbolGen gen, void *ctx, std::vector<int> &out) {
+    rmt_symbol_word_t buf[64];
+    bool restart = true;
+    for (;;) {
+        size_t max = next_chunk();
+        size_t n = gen(buf, max, restart, ctx);
+        restart = false;
+        for (size_t k = 0; k < n; k++) {
+            out.push_back(buf[k].level0 ? (int)buf[k].duration0 : -(int)buf[k].duration0);
+            out.push_back(buf[k].level1 ? (int)buf[k].duration1 : -(int)buf[k].duration1);
+        }
+        if (n < max) return;
+    }
+}
+
+// The pulses the former bit-banged sender produced for `code`, one entry per
+// sendPulse() call.
+static void brute_reference(const BruteProtocol &p, int code, int repeats, std::vector<int> &out) {
+    for (int r = 0; r < repeats; ++r) {
+        if (p.pilot[0] || p.pilot[1]) {
+            out.push_back(p.pilot[0]);
+            out.push_back(p.pilot[1]);
+        }
+        for (int j = p.bits - 1; j >= 0; --j) {
+            const int *t = ((code >> j) & 1) ? p.one : p.zero;
+            out.push_back(t[0]);
+            out.push_back(t[1]);
+        }
+        if (p.stop[0] || p.stop[1]) {
+            out.push_back(p.stop[0]);
+            out.push_back(p.stop[1]);
+        }
+    }
+}
+
+static bool test_codes(const BruteProtocol &p, int repeats) {
+    BruteGen g = {};
+    g.proto = p;
+    g.repeats = repeats;
+    g.total = 1 << p.bits;
+
+    std::vector<int> got, ref;
+    drain(brute_gen, &g, got);
+    for (int code = 0; code < g.total; code++) brute_reference(p, code, repeats, ref);
+
+    bool ok = got == ref && g.code == g.total;
+    printf(
+        "codes    %-16s x%d %s (%zu pulses, full sweep %lus)\n",
+        p.name,
+        repeats,
+        ok ? "PASS" : "FAIL",
+        got.size(),
+        (unsigned long)((uint64_t)g.total * brute_code_us(p, repeats) / 1000000)
+    );
+    return ok;
+}
+
+// Every k^n word appears in `seq` (checked with an n-symbol sliding window)
+// and the sequence is exactly k^n + n - 1 symbols long.
+static bool covers(const std::vector<uint8_t> &seq, int k, int n, uint64_t &distinct) {
+    uint64_t words = DeBruijn::length(k, n) - (n - 1);
+    std::vector<uint8_t> seen((words + 7) / 8, 0);
+    uint64_t window = 0;
+    distinct = 0;
+    for (size_t i = 0; i < seq.size(); i++) {
+        window = (window * k + seq[i]) % words;
+        if (i + 1 < (size_t)n) continue;
+        uint8_t &b = seen[window >> 3];
+        if (!(b & (1 << (window & 7)))) distinct++;
+        b |= 1 << (window & 7);
+    }
+    return distinct == words && seq.size() == DeBruijn::length(k, n);
+}
+
+static bool test_sequences() {
+    bool allok = true;
+    for (int k = 2; k <= 4; k++) {
+        for (int n = 1; n <= DEBRUIJN_MAX_N; n++) {
+            if (DeBruijn::length(k, n) - (n - 1) > VERIFY_MAX_WORDS) break;
+            std::vector<uint8_t> seq;
+            DeBruijn db;
+            db.reset(k, n);
+            for (int sym = db.next(); sym >= 0; sym = db.next()) seq.push_back(sym);
+            uint64_t distinct;
+            bool ok = covers(seq, k, n, distinct);
+            if (!ok)
+                printf(
+                    "debruijn k=%d n=%d: %zu symbols, %llu words FAIL\n",
+                    k,
+                    n,
+                    seq.size(),
+                    (unsigned long long)distinct
+                );
+            allok = allok && ok;
+        }
+    }
+    printf("debruijn B(k, n), k 2..4, up to %lu words: %s\n", VERIFY_MAX_WORDS, allok ? "PASS" : "FAIL");
+    return allok;
+}
+
+static bool test_stream(const BruteProtocol &p, int k) {
+    DeBruijnTx g = {};
+    g.proto = p;
+    g.k = k;
+    g.n = p.bits / debruijn_bps(k);
+
+    std::vector<int> pulses;
+    drain(debruijn_gen, &g, pulses);
+
+    // Strip the pilot and the stop pulse, then read the data bits back.
+    bool ok = true;
+    size_t i = 0, end = pulses.size();
+    if (p.pilot[0] || p.pilot[1]) {
+        ok = end >= 2 && pulses[0] == p.pilot[0] && pulses[1] == p.pilot[1];
+        i = 2;
+    }
+    if (p.stop[0] || p.stop[1]) {
+        ok = ok && end >= i + 2 && pulses[end - 2] == p.stop[0] && pulses[end - 1] == p.stop[1];
+        end -= 2;
+    }
+    std::vector<uint8_t> bits;
+    for (; ok && i + 1 < end; i += 2) {
+        if (pulses[i] == p.one[0] && pulses[i + 1] == p.one[1]) bits.push_back(1);
+        else if (pulses[i] == p.zero[0] && pulses[i + 1] == p.zero[1]) bits.push_back(0);
+        else ok = false;
+    }
+
+    // Bit groups back to symbols.
+    const int bps = debruijn_bps(k);
+    std::vector<uint8_t> seq;
+    ok = ok && bits.size() % bps == 0;
+    for (size_t b = 0; ok && b < bits.size(); b += bps) {
+        uint8_t group = bps == 1 ? bits[b] : bits[b] << 1 | bits[b + 1];
+        int sym = -1;
+        for (int s = 0; s < k; s++)
+            if (debruijn_bits[k - 2][s] == group) sym = s;
+        ok = sym >= 0;
+        seq.push_back(sym);
+    }
+
+    uint64_t distinct = 0;
+    ok = ok && covers(seq, k, g.n, distinct) && g.sent == seq.size();
+    printf(
+        "debruijn %-16s k=%d n=%-2d %s (%zu bits, %llu codes)\n",
+        p.name,
+        k,
+        g.n,
+        ok ? "PASS" : "FAIL",
+        bits.size(),
+        (unsigned long long)distinct
+    );
+    return ok;
+}
+
+int main() {
+    bool ok = true;
+    for (int i = 0; i < BRUTE_PROTOCOL_COUNT; i++) {
+        ok = test_codes(brute_protocols[i], 1) && ok;
+        ok = test_codes(brute_protocols[i], 3) && ok;
+    }
+    ok = test_sequences() && ok;
+    for (int i = 0; i < BRUTE_PROTOCOL_COUNT; i++)
+        for (int k = 2; k <= 4; k++) ok = test_stream(brute_protocols[i], k) && ok;
+    printf("result: %s\n", ok ? "ALL PASS" : "FAILURES");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""Precompute a WPA PMK table for WiFi Pass Recovery.
+
+PMK = PBKDF2-HMAC-SHA1(password, SSID, 4096, 32) depends only on the SSID and
+the password, so for a common SSID the expensive part of every guess can be
+done once on a PC. The device then only runs the PTK/MIC (or PMKID) check per
+record, thousands of times faster than deriving the PMK itself.
+
+Output format (little endian), read by PmkTableReader in
+src/modules/wifi/wifi_candidates.h:
+    header: magic "PMKT" (u32 0x544B4D50), version u16, reserved u16,
+            count u32, ssid char[33] (NUL padded), pad[3]
+    records sorted by password bytes, duplicates removed:
+            u8 len (8..63), password[len], pmk[32]
+
+Copy the .pmk to /wordlists on the SD card and pick "PMK table" in the menu.
+
+Pure stdlib. Uses every CPU core.
+
+Usage:
+    python tools/gen_pmk_table.py SSID wordlist.txt [out.pmk]
+"""
+import hashlib
+import multiprocessing
+import os
+import struct
+import sys
+
+MAGIC = 0x544B4D50
+VERSION = 1
+
+
+def read_passwords(path):
+    """WPA-valid (8..63 bytes), unique, sorted lines of the wordlist."""
+    words = set()
+    with open(path, "rb") as f:
+        for raw in f:
+            pw = raw.rstrip(b"\r\n")
+            if 8 <= len(pw) <= 63:
+                words.add(pw)
+    return sorted(words)
+
+
+def pmk(args):
+    ssid, pw = args
+    return hashlib.pbkdf2_hmac("sha1", pw, ssid, 4096, 32)
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit(__doc__.split("Usage:")[1])
+    ssid = sys.argv[1].encode("utf-8")
+    wordlist = sys.argv[2]
+    out_path = sys.argv[3] if len(sys.argv) > 3 else sys.argv[1] + ".pmk"
+    if not 1 <= len(ssid) <= 32:
+        sys.exit("error: SSID must be 1..32 bytes")
+
+    words = read_passwords(wordlist)
+    if not words:
+        sys.exit("error: no 8..63 byte passwords in the wordlist")
+
+    with multiprocessing.Pool() as pool:
+        pmks = pool.map(pmk, ((ssid, pw) for pw in words), chunksize=256)
+
+    # Self-check against a known vector so a broken hashlib never ships a table.
+    if pmk((b"IEEE", b"password")).hex()[:16] != "f42c6fc52df0ebef":
+        sys.exit("error: PBKDF2 self-check failed")
+
+    with open(out_path, "wb") as f:
+        f.write(struct.pack("<IHHI33s3x", MAGIC, VERSION, 0, len(words), ssid))
+        for pw, key in zip(words, pmks):
+            f.write(bytes([len(pw)]) + pw + key)
+
+    print(f"wrote {out_path}: {len(words)} records for SSID {sys.argv[1]!r}, "
+          f"{os.path.getsize(out_path)} B")
+
+
+if __name__ == "__main__":
+    main()
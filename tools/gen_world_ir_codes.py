@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+"""Pack WORLD_IR_CODES.h into the compact TV-B-Gone code blob.
+
+src/modules/ir/WORLD_IR_CODES.h stays the editable source (one IrCode /
+RawIrCode with its own timing and code arrays per power code). The firmware
+no longer compiles it: this script turns the four code lists into a single
+flash-resident byte array, src/modules/ir/world_ir_codes_blob.h, read by
+tvbg_decode() in src/modules/ir/tvbg_codes.cpp.
+
+Identical timing tables are stored once, identical codes once, and every
+number is an unsigned LEB128 varint. Layout (little endian):
+    header: version u8, set count u8, first code of each set u16[sets + 1]
+            (the last one is the total), record offset u16[total]
+    record: carrier kHz u8 (0 = unmodulated), kind u8, then
+            kind 0 (raw):    varint count, count varint us
+            kind 1..4:       bits per index; varint table offset,
+                             varint pairs, ceil(pairs * kind / 8) bytes of
+                             MSB-first indexes into the table
+    table:  value count u8, varint values (tens of us, mark/space pairs)
+
+Raw codes keep every timing of their array (their numpairs field did not
+cover it). Prints the footprint of the C tables and of the blob.
+
+Also a PlatformIO pre: script (platformio.ini), regenerating the header
+when WORLD_IR_CODES.h changes; the header is committed for other builds.
+
+Usage:
+    python tools/gen_world_ir_codes.py [WORLD_IR_CODES.h] [world_ir_codes_blob.h]
+"""
+import os
+import re
+import struct
+import sys
+
+DEFAULT_SRC = "src/modules/ir/WORLD_IR_CODES.h"
+DEFAULT_OUT = "src/modules/ir/world_ir_codes_blob.h"
+VERSION = 1
+# Same order as TvbgSet in tvbg_codes.h.
+SETS = ["NApowerCodes", "EUpowerCodes", "UniversalParsedCodes", "UniversalRawCodes"]
+MAX_BITS = 4  # TVBG_MAX_TABLE in tvbg_codes.h: 2 << MAX_BITS values
+
+C_SIZE = {"uint8_t": 1, "uint16_t": 2, "uint32_t": 4}
+CODE_STRUCT_SIZE = 12  # 3 x uint8_t, 2 pointers (32-bit)
+
+
+def parse(path):
+    """Arrays, code structs and code lists of the header."""
+    with open(path, "r", encoding="utf-8") as f:
+        text = f.read()
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"//[^\n]*", "", text)
+
+    arrays = {}
+    for m in re.finditer(r"const\s+(uint8_t|uint16_t|uint32_t)\s+(\w+)\[\]\s*=\s*\{(.*?)\};", text, re.S):
+        arrays[m.group(2)] = (m.group(1), [int(v, 0) for v in m.group(3).split(",") if v.strip()])
+
+    codes = {}
+    for m in re.finditer(r"const\s+struct\s+(IrCode|RawIrCode)\s+(\w+)\s*=\s*\{(.*?)\};", text, re.S):
+        fields = [v.strip() for v in m.group(3).split(",") if v.strip()]
+        freq = re.match(r"freq_to_timerval\((\d+)\)", fields[0])
+        khz = int(freq.group(1)) // 1000 if freq else int(fields[0], 0)
+        codes[m.group(2)] = {
+            "raw": m.group(1) == "RawIrCode",
+            "khz": khz,
+            "pairs": int(fields[1], 0),
+            "bits": int(fields[2], 0),
+            "times": fields[3],
+            "codes": fields[4],
+        }
+
+    lists = {}
+    for m in re.finditer(r"const\s+(?:IrCode|RawIrCode)\s*\*const\s+(\w+)\[\]\s*=\s*\{(.*?)\};", text, re.S):
+        lists[m.group(1)] = re.findall(r"&(\w+)", m.group(2))
+    for name in SETS:
+        if name not in lists:
+            sys.exit(f"error: code list {name} not found in {path}")
+    return arrays, codes, lists
+
+
+def c_footprint(arrays, codes, lists):
+    """Bytes the referenced C tables take in flash (arrays aligned to their type)."""
+    total = 0
+    for name in set(sum(lists.values(), [])):
+        code = codes[name]
+        for arr in (code["times"], code["codes"]):
+            ctype, values = arrays[arr]
+            size = len(values) * C_SIZE[ctype]
+            total += (size + 3) & ~3
+        total += CODE_STRUCT_SIZE
+    total += 4 * sum(len(v) for v in lists.values())  # pointer lists
+    total += 4 * len(lists)  # num_* counts
+    return total
+
+
+def varint(n):
+    out = bytearray()
+    while True:
+        b = n & 0x7F
+        n >>= 7
+        out.append(b | (0x80 if n else 0))
+        if not n:
+            return bytes(out)
+
+
+def encode(arrays, codes, lists):
+    order = [name for s in SETS for name in lists[s]]
+    first = [0]
+    for s in SETS:
+        first.append(first[-1] + len(lists[s]))
+    head = 2 + 2 * (len(SETS) + 1) + 2 * len(order)
+
+    # Tables first (their offsets are known before the records need them).
+    tables, table_off, body = {}, {}, bytearray()
+    for name in order:
+        code = codes[name]
+        if code["raw"]:
+            continue
+        if not 1 <= code["bits"] <= MAX_BITS:
+            sys.exit(f"error: {name}: {code['bits']} bits per index (max {MAX_BITS})")
+        values = tuple(arrays[code["times"]][1])
+        if len(values) > 255 or any(
+            2 * i + 1 >= len(values) for i in unpack(arrays[code["codes"]][1], code["pairs"], code["bits"])
+        ):
+            sys.exit(f"error: {name}: index outside its timing table")
+        if values not in table_off:
+            table_off[values] = head + len(body)
+            body += bytes([len(values)]) + b"".join(varint(v) for v in values)
+        tables[name] = table_off[values]
+
+    rec_off, offsets = {}, []
+    for name in order:
+        code = codes[name]
+        rec = bytearray([code["khz"]])
+        if code["raw"]:
+            times = arrays[code["times"]][1]
+            rec += bytes([0]) + varint(len(times)) + b"".join(varint(v) for v in times)
+        else:
+            nbytes = (code["pairs"] * code["bits"] + 7) // 8
+            packed = arrays[code["codes"]][1][:nbytes]
+            if len(packed) < nbytes:
+                sys.exit(f"error: {name}: code array shorter than {code['pairs']} pairs")
+            rec += bytes([code["bits"]]) + varint(tables[name]) + varint(code["pairs"]) + bytes(packed)
+        rec = bytes(rec)
+        if rec not in rec_off:
+            rec_off[rec] = head + len(body)
+            body += rec
+        offsets.append(rec_off[rec])
+
+    if head + len(body) > 0xFFFF:
+        sys.exit("error: blob over 64 KB, record offsets are 16-bit")
+    blob = bytes([VERSION, len(SETS)])
+    blob += struct.pack(f"<{len(first)}H", *first)
+    blob += struct.pack(f"<{len(offsets)}H", *offsets)
+    stats = {"codes": len(order), "records": len(rec_off), "tables": len(table_off)}
+    return blob + bytes(body), stats
+
+
+def unpack(packed, pairs, bits):
+    """Table indexes of a bit-compressed code (MSB first)."""
+    acc, left, it, out = 0, 0, iter(packed), []
+    for _ in range(pairs):
+        idx = 0
+        for _ in range(bits):
+            if not left:
+                acc, left = next(it, 0), 8
+            left -= 1
+            idx = (idx << 1) | ((acc >> left) & 1)
+        out.append(idx)
+    return out
+
+
+def render(blob, stats):
+    lines = [
+        "// Generated by tools/gen_world_ir_codes.py from WORLD_IR_CODES.h - do not edit.",
+        f"// {stats['codes']} codes, {stats['records']} distinct, {stats['tables']} timing tables, "
+        f"{len(blob)} bytes.",
+        "#pragma once",
+        "#include <stdint.h>",
+        "",
+        f"#define TVBG_BLOB_VERSION {VERSION}",
+        "",
+        f"static const uint8_t tvbg_blob[{len(blob)}] = {{",
+    ]
+    for i in range(0, len(blob), 16):
+        lines.append("    " + ", ".join(f"0x{b:02X}" for b in blob[i : i + 16]) + ",")
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+def generate(src, out, verbose=True):
+    arrays, codes, lists = parse(src)
+    blob, stats = encode(arrays, codes, lists)
+    text = render(blob, stats)
+    old = None
+    if os.path.exists(out):
+        with open(out, "r", encoding="utf-8") as f:
+            old = f.read()
+    if old != text:
+        with open(out, "w", encoding="utf-8", newline="\n") as f:
+            f.write(text)
+    if verbose:
+        before = c_footprint(arrays, codes, lists)
+        print(
+            f"WORLD_IR_CODES: {stats['codes']} codes ({stats['records']} distinct, "
+            f"{stats['tables']} timing tables): C tables {before} B -> blob {len(blob)} B"
+            f"{'' if old != text else ' (unchanged)'}"
+        )
+
+
+try:
+    Import("env")  # noqa: F821 - run as a PlatformIO pre: script
+except NameError:
+    env = None
+
+if env is not None:
+    _root = env.subst("$PROJECT_DIR")
+    generate(os.path.join(_root, DEFAULT_SRC), os.path.join(_root, DEFAULT_OUT))
+elif __name__ == "__main__":
+    generate(
+        sys.argv[1] if len(sys.argv) > 1 else DEFAULT_SRC,
+        sys.argv[2] if len(sys.argv) > 2 else DEFAULT_OUT,
+    )
@@ -0,0 +1,224 @@
+// Host parser test and benchmark for the `.ir` engine (src/modules/ir/ir_db.*).
+//
+// Self-test: a generated file with parsed and raw buttons, CRLF lines,
+// comment lines, a raw line far longer than the I/O block, entries without
+// separators and no trailing "#" is indexed by IrEntryScanner and checked
+// against a plain std::getline reference parser; every entry is then read
+// back through its offset/length.
+//
+// Benchmark, on the given files (e.g. a Flipper-IRDB checkout) or on a
+// generated 2000-button remote: the old two-pass String-per-line reading,
+// the single-pass scanner, and opening through a saved `.irx`-style index.
+//
+// Build and run:
+//   g++ -O2 -std=gnu++17 -Isrc/modules/ir -o ir_db_bench tools/ir_db_bench.cpp src/modules/ir/ir_db.cpp
+//   ./ir_db_bench [file.ir ...]
+#include "ir_db.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+class StdioSource : public IrSource {
+public:
+    explicit StdioSource(FILE *f) : _f(f) {}
+    size_t read(uint8_t *buf, size_t len) override { return fread(buf, 1, len, _f); }
+    bool seek(uint32_t pos) override { return fseek(_f, pos, SEEK_SET) == 0; }
+
+private:
+    FILE *_f;
+};
+
+struct RefEntry {
+    std::string name, type, protocol;
+};
+
+static std::string trim(const std::string &s) {
+    size_t a = s.find_first_not_of(" \t\r"), b = s.find_last_not_of(" \t\r");
+    return a == std::string::npos ? "" : s.substr(a, b - a + 1);
+}
+
+// Reference: the grouping rules of IrEntryScanner written the obvious way.
+static std::vector<RefEntry> ref_parse(const std::string &path) {
+    std::ifstream in(path);
+    std::vector<RefEntry> out;
+    RefEntry cur;
+    bool open = false;
+    auto close = [&]() {
+        if (open && !cur.type.empty()) out.push_back(cur);
+        cur = RefEntry();
+        open = false;
+    };
+    std::string line;
+    while (std::getline(in, line)) {
+        line = trim(line);
+        if (line.empty()) continue;
+        if (line[0] == '#') {
+            close();
+            continue;
+        }
+        size_t c = line.find(':');
+        std::string key = trim(line.substr(0, c));
+        std::string value = c == std::string::npos ? "" : trim(line.substr(c + 1));
+        if (key == "Filetype" || key == "Version") continue;
+        if (key == "name" && open && !cur.name.empty()) close();
+        open = true;
+        if (key == "name") cur.name = value.substr(0, IR_DB_NAME_MAX);
+        else if (key == "type") cur.type = value;
+        else if (key == "protocol") cur.protocol = value.substr(0, IR_DB_PROTO_MAX);
+    }
+    close();
+    return out;
+}
+
+static std::vector<IrIndexEntry> scan(const std::string &path) {
+    std::vector<IrIndexEntry> out;
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f) return out;
+    StdioSource src(f);
+    IrEntryScanner scanner;
+    IrIndexEntry e;
+    if (scanner.begin(src))
+        while (scanner.next(e)) out.push_back(e);
+    fclose(f);
+    return out;
+}
+
+static std::string gen_raw(int timings, unsigned seed) {
+    std::string s;
+    for (int i = 0; i < timings; i++) {
+        seed = seed * 1103515245 + 12345;
+        s += std::to_string(200 + (seed >> 16) % 9000);
+        if (i + 1 < timings) s += ' ';
+    }
+    return s;
+}
+
+static void gen_file(const std::string &path, int buttons, bool quirks) {
+    std::ofstream out(path, std::ios::binary);
+    const char *nl = "\n";
+    out << "Filetype: IR signals file\nVersion: 1\n";
+    for (int i = 0; i < buttons; i++) {
+        if (quirks) nl = (i % 3 == 0) ? "\r\n" : "\n";
+        if (!quirks || i % 7) out << "# " << nl;
+        if (quirks && i % 11 == 0) out << "# comment for button " << i << nl;
+        out << "name: Button_" << i << nl;
+        if (i % 4 == 1) {
+            out << "type: raw" << nl << "frequency: 38000" << nl << "duty_cycle: 0.330000" << nl;
+            int n = quirks && i % 40 == 1 ? 1500 : 60 + i % 200;
+            out << "data: " << gen_raw(n, i) << nl;
+        } else {
+            out << "type: parsed" << nl << "protocol: " << (i % 2 ? "NECext" : "Samsung32") << nl;
+            out << "address:  07 00 00 00  " << nl << "command: " << (i & 0xFF) << " 00 00 00" << nl;
+        }
+    }
+    if (quirks) out << "name: NoType" << nl << "frequency: 38000"; // untyped, no trailing newline
+}
+
+static bool self_test() {
+    const std::string path = "/tmp/ir_db_selftest.ir";
+    gen_file(path, 600, true);
+    std::vector<RefEntry> ref = ref_parse(path);
+    std::vector<IrIndexEntry> got = scan(path);
+    if (ref.size() != got.size()) {
+        printf("entry count %zu, expected %zu\n", got.size(), ref.size());
+        return false;
+    }
+    FILE *f = fopen(path.c_str(), "rb");
+    StdioSource src(f);
+    IrTokenizer tok;
+    bool ok = true;
+    for (size_t i = 0; i < ref.size() && ok; i++) {
+        const IrIndexEntry &e = got[i];
+        uint8_t type = ir_db_entry_type(ref[i].type.c_str());
+        ok = ref[i].name == e.name && ref[i].protocol == e.protocol && type == e.type;
+        // Seek straight to the entry: first line must be its own, data intact.
+        IrLine line;
+        size_t dataLen = 0;
+        std::string name;
+        tok.begin(src, IR_DB_LINE_MAX, e.offset, e.offset + e.length);
+        while (tok.next(line)) {
+            if (!strcmp(line.key, "name")) name = line.value;
+            if (!strcmp(line.key, "data")) dataLen = line.valueLen;
+            ok = ok && !line.truncated;
+        }
+        ok = ok && name == ref[i].name && (e.type != IR_ENTRY_RAW || dataLen > 0);
+        if (!ok) printf("entry %zu (%s) mismatch\n", i, ref[i].name.c_str());
+    }
+    fclose(f);
+    return ok;
+}
+
+// Old txIrFile(): count "type:" lines, rewind, then parse with a String
+// per line (std::string stands in for Arduino String).
+static size_t old_two_pass(const std::string &path) {
+    std::ifstream in(path);
+    std::string line;
+    size_t total = 0, fields = 0;
+    while (std::getline(in, line))
+        if (line.rfind("type:", 0) == 0) total++;
+    in.clear();
+    in.seekg(0);
+    while (std::getline(in, line)) {
+        std::string txt = line.substr(line.find(':') + 1);
+        txt = trim(txt);
+        fields += !txt.empty();
+    }
+    return total + fields;
+}
+
+template <typename Fn> static double time_ms(Fn fn, int reps) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < reps; i++) fn();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(t1 - t0).count() / reps;
+}
+
+static void bench(const std::string &path) {
+    std::vector<IrIndexEntry> entries = scan(path);
+    const std::string idx = "/tmp/ir_db_bench.irx";
+    FILE *w = fopen(idx.c_str(), "wb");
+    fwrite(entries.data(), sizeof(IrIndexEntry), entries.size(), w);
+    fclose(w);
+
+    volatile size_t sink = 0;
+    double oldMs = time_ms([&]() { sink += old_two_pass(path); }, 5);
+    double scanMs = time_ms([&]() { sink += scan(path).size(); }, 5);
+    double idxMs = time_ms(
+        [&]() {
+            std::vector<IrIndexEntry> v(entries.size());
+            FILE *f = fopen(idx.c_str(), "rb");
+            sink += fread(v.data(), sizeof(IrIndexEntry), v.size(), f);
+            fclose(f);
+        },
+        20
+    );
+    printf(
+        "%-40s %5zu entries: two-pass %7.2f ms, one-pass %7.2f ms, index %6.3f ms\n",
+        path.substr(path.size() > 40 ? path.size() - 40 : 0).c_str(),
+        entries.size(),
+        oldMs,
+        scanMs,
+        idxMs
+    );
+}
+
+int main(int argc, char **argv) {
+    if (!self_test()) {
+        printf("self-test FAILED\n");
+        return 1;
+    }
+    printf("self-test ok\n");
+    if (argc > 1) {
+        for (int i = 1; i < argc; i++) bench(argv[i]);
+    } else {
+        const std::string path = "/tmp/ir_db_universal.ir";
+        gen_file(path, 2000, false);
+        bench(path);
+    }
+    return 0;
+}
@@ -0,0 +1,164 @@
+// Host test and benchmark for the bitsliced KeeLoq core
+// (src/modules/rf/protocols/rf_keeloq_cipher.*).
+//
+// Self-test: every lane of keeloq_decrypt_bs32 must equal keeloq_decrypt for its
+// own (data, key), and every lane of keeloq_derive_man_bs32 must equal
+// keeloq_derive_man for its learning type, over random batches with all
+// learning types mixed and partial batches (n < 32). keeloq_encrypt is checked
+// as the inverse of the scalar decrypt.
+//
+// Benchmark: a keystore-sized miss (no key matches, so every entry is tried),
+// once through the sequential scalar loop and once in 32-entry bitsliced
+// batches, as keeloq_search runs it on one core.
+//
+// Build and run:
+//   g++ -O2 -std=gnu++17 -Isrc/modules/rf/protocols -o keeloq_bs_bench
+//       tools/keeloq_bs_bench.cpp src/modules/rf/protocols/rf_keeloq_cipher.cpp
+//   ./keeloq_bs_bench [keys]
+#include "rf_keeloq_cipher.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+static const uint8_t TYPES[] = {
+    KEELOQ_UNKNOWN_LEARNING,
+    KEELOQ_SIMPLE_LEARNING,
+    KEELOQ_NORMAL_LEARNING,
+    KEELOQ_SECURE_LEARNING,
+    KEELOQ_MAGIC_XOR_TYPE1_LEARNING,
+    KEELOQ_MAGIC_SERIAL_TYPE1_LEARNING,
+    KEELOQ_MAGIC_SERIAL_TYPE2_LEARNING,
+    KEELOQ_MAGIC_SERIAL_TYPE3_LEARNING,
+    KEELOQ_AERF_LEARNING,
+    KEELOQ_ERREKA_LEARNING,
+    KEELOQ_PUJOL_LEARNING,
+    KEELOQ_SIMPLE_JCM_LEARNING,
+};
+static const int NTYPES = sizeof(TYPES) / sizeof(TYPES[0]);
+
+struct Key {
+    uint64_t key;
+    uint8_t type;
+};
+
+static bool self_test(std::mt19937_64 &rng) {
+    uint32_t in[KEELOQ_BS_LANES], out[KEELOQ_BS_LANES];
+    uint64_t key[KEELOQ_BS_LANES], man[KEELOQ_BS_LANES];
+    uint8_t type[KEELOQ_BS_LANES];
+    int bad = 0;
+
+    for (int round = 0; round < 2000 && bad < 10; round++) {
+        for (int j = 0; j < KEELOQ_BS_LANES; j++) {
+            in[j] = (uint32_t)rng();
+            key[j] = rng();
+            type[j] = TYPES[rng() % NTYPES];
+        }
+        keeloq_decrypt_bs32(in, key, out);
+        for (int j = 0; j < KEELOQ_BS_LANES; j++) {
+            if (out[j] != keeloq_decrypt(in[j], key[j])) {
+                printf("decrypt lane %d: data %08x key %016llx\n", j, in[j], (unsigned long long)key[j]);
+                bad++;
+            }
+            if (keeloq_encrypt(keeloq_decrypt(in[j], key[j]), key[j]) != in[j]) {
+                printf("encrypt does not invert decrypt: key %016llx\n", (unsigned long long)key[j]);
+                bad++;
+            }
+        }
+
+        uint32_t fix = (uint32_t)rng(), seed = (uint32_t)rng();
+        int n = round % 4 ? KEELOQ_BS_LANES : 1 + (int)(rng() % KEELOQ_BS_LANES);
+        keeloq_derive_man_bs32(type, key, n, fix, seed, man);
+        for (int j = 0; j < n; j++) {
+            if (man[j] != keeloq_derive_man(type[j], fix, seed, key[j])) {
+                printf("derive lane %d/%d: type %u fix %08x seed %08x\n", j, n, type[j], fix, seed);
+                bad++;
+            }
+        }
+    }
+    return bad == 0;
+}
+
+static std::vector<Key> gen_keys(size_t n, std::mt19937_64 &rng) {
+    std::vector<Key> keys(n);
+    for (Key &k : keys) {
+        k.key = rng();
+        k.type = TYPES[rng() % NTYPES];
+    }
+    return keys;
+}
+
+static int scalar_miss(const std::vector<Key> &keys, uint32_t fix, uint32_t seed, uint32_t enc) {
+    const uint8_t btn = fix >> 28;
+    for (size_t i = 0; i < keys.size(); i++) {
+        uint32_t dec = keeloq_decrypt(enc, keeloq_derive_man(keys[i].type, fix, seed, keys[i].key));
+        if (keeloq_hop_matches(dec, btn, fix)) return (int)i;
+    }
+    return -1;
+}
+
+// The per-batch body of keeloq_search without the second core.
+static int bitsliced_miss(const std::vector<Key> &keys, uint32_t fix, uint32_t seed, uint32_t enc) {
+    const uint8_t btn = fix >> 28;
+    uint8_t type[KEELOQ_BS_LANES];
+    uint64_t key[KEELOQ_BS_LANES], man[KEELOQ_BS_LANES];
+    uint32_t in[KEELOQ_BS_LANES], dec[KEELOQ_BS_LANES];
+    for (int j = 0; j < KEELOQ_BS_LANES; j++) in[j] = enc;
+
+    for (size_t base = 0; base < keys.size(); base += KEELOQ_BS_LANES) {
+        int n = keys.size() - base < KEELOQ_BS_LANES ? (int)(keys.size() - base) : KEELOQ_BS_LANES;
+        for (int j = 0; j < n; j++) {
+            type[j] = keys[base + j].type;
+            key[j] = keys[base + j].key;
+        }
+        keeloq_derive_man_bs32(type, key, n, fix, seed, man);
+        for (int j = n; j < KEELOQ_BS_LANES; j++) man[j] = 0;
+        keeloq_decrypt_bs32(in, man, dec);
+        for (int j = 0; j < n; j++)
+            if (keeloq_hop_matches(dec[j], btn, fix)) return (int)(base + j);
+    }
+    return -1;
+}
+
+template <typename Fn> static double time_ms(Fn fn, int reps) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < reps; i++) fn();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(t1 - t0).count() / reps;
+}
+
+int main(int argc, char **argv) {
+    size_t nkeys = argc > 1 ? strtoul(argv[1], nullptr, 0) : 1024;
+    std::mt19937_64 rng(0x4B45454C4F51ULL);
+
+    bool ok = self_test(rng);
+    printf("self-test: %s\n", ok ? "PASS" : "FAIL");
+    if (!ok || !nkeys) return ok ? 0 : 1;
+
+    std::vector<Key> keys = gen_keys(nkeys, rng);
+    const uint32_t fix = 0x5004D5E6u, seed = fix & 0x0FFFFFFFu;
+    // An encrypted word nothing decrypts to a plausible hop, so both loops walk
+    // the whole keystore (re-rolled until that holds for the generated keys).
+    uint32_t enc = 0xFFFFFFFFu;
+    while (scalar_miss(keys, fix, seed, enc) >= 0) enc = (uint32_t)rng();
+    if (bitsliced_miss(keys, fix, seed, enc) >= 0) {
+        printf("bitsliced search matched where the scalar loop did not\n");
+        return 1;
+    }
+
+    volatile int sink = 0;
+    int reps = nkeys >= 4096 ? 5 : 20;
+    double scalarMs = time_ms([&]() { sink += scalar_miss(keys, fix, seed, enc); }, reps);
+    double bsMs = time_ms([&]() { sink += bitsliced_miss(keys, fix, seed, enc); }, reps);
+    printf(
+        "%zu keys, full miss: scalar %.3f ms (%.0f keys/s), bitsliced %.3f ms (%.0f keys/s), %.1fx\n",
+        nkeys,
+        scalarMs,
+        nkeys / scalarMs * 1000,
+        bsMs,
+        nkeys / bsMs * 1000,
+        scalarMs / bsMs
+    );
+    return 0;
+}
@@ -0,0 +1,214 @@
+// Host test and benchmark for the KeeLoq keystore and identify search
+// (src/modules/rf/protocols/rf_keeloq_keystore.*).
+//
+// Self-test: a keystore text with CRLF endings, blank and malformed lines and
+// repeated manufacturers must parse to the expected entries, interned names and
+// Centurion id. Then every generated frame (one per keystore entry, encrypted
+// with that entry's derived key) goes through keeloq_search exactly as
+// keeloq_identify calls it, and the result must equal the sequential scalar
+// loop: the first entry in keystore order whose decryption is a plausible hop.
+// That is the frame's own entry (with its counter recovered from the hop) or an
+// earlier entry that happens to decrypt to a plausible hop too; those are
+// counted, not failed.
+//
+// Benchmark: one keystore load (what keeloq_keystore() pays on a cache miss),
+// the identify search per frame, and a frame no entry matches (every entry is
+// tried), once through keeloq_search and once through the scalar loop.
+//
+// Build and run:
+//   g++ -O2 -std=gnu++17 -Isrc/modules/rf/protocols -o keeloq_identify_bench tools/keeloq_identify_bench.cpp
+//       src/modules/rf/protocols/rf_keeloq_keystore.cpp src/modules/rf/protocols/rf_keeloq_cipher.cpp
+//   ./keeloq_identify_bench [keys | mfcodes_path]
+#include "rf_keeloq_keystore.h"
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+static const uint8_t TYPES[] = {
+    KEELOQ_SIMPLE_LEARNING,
+    KEELOQ_NORMAL_LEARNING,
+    KEELOQ_SECURE_LEARNING,
+    KEELOQ_MAGIC_XOR_TYPE1_LEARNING,
+    KEELOQ_MAGIC_SERIAL_TYPE1_LEARNING,
+    KEELOQ_MAGIC_SERIAL_TYPE2_LEARNING,
+    KEELOQ_MAGIC_SERIAL_TYPE3_LEARNING,
+    KEELOQ_AERF_LEARNING,
+    KEELOQ_ERREKA_LEARNING,
+    KEELOQ_PUJOL_LEARNING,
+    KEELOQ_SIMPLE_JCM_LEARNING,
+};
+static const int NTYPES = sizeof(TYPES) / sizeof(TYPES[0]);
+
+static bool parse_test() {
+    const char text[] = "  Alpha;0123456789ABCDEF;1\r\n"
+                        "\r\n"
+                        "Beta;FEDCBA9876543210;2\n"
+                        "no separators here\n"
+                        "Gamma;1;2;3\n"
+                        "Centurion;00000000DEADBEEF;1\n"
+                        "Alpha;1111111111111111;3";
+    KeeloqKeystore ks;
+    ks.load_text(text, sizeof(text) - 1);
+
+    const std::vector<KeeloqKeyEntry> &keys = ks.get_keys();
+    bool ok = keys.size() == 4 && ks.mf_count() == 3 && ks.find_mf("Alpha") == 0 &&
+              ks.find_mf("Beta") == 1 && ks.find_mf("Gamma") == KEELOQ_MF_NONE &&
+              ks.centurion_id() == 2 && strcmp(ks.mf_name(2), "Centurion") == 0 &&
+              strcmp(ks.mf_name(KEELOQ_MF_NONE), "Unknown") == 0;
+    ok = ok && keys[0].key == 0x0123456789ABCDEFULL && keys[0].mf_id == 0 && keys[0].type == 1 &&
+         keys[1].mf_id == 1 && keys[1].type == 2 && keys[2].key == 0xDEADBEEFULL &&
+         keys[3].mf_id == 0 && keys[3].type == 3;
+
+    // A reload replaces the table rather than appending to it.
+    ks.load_text(text, sizeof(text) - 1);
+    return ok && ks.get_keys().size() == 4 && ks.mf_count() == 3;
+}
+
+// `count` entries spread over 64 manufacturers (one of them Centurion).
+static std::string gen_keystore(size_t count, std::mt19937_64 &rng) {
+    std::string text;
+    char line[64];
+    for (size_t i = 0; i < count; i++) {
+        int mf = (int)(rng() % 64);
+        unsigned long long key = rng();
+        if (mf == 0) {
+            snprintf(line, sizeof(line), "Centurion;%016llX;1\n", key);
+        } else {
+            snprintf(line, sizeof(line), "MF_%02d;%016llX;%u\n", mf, key, TYPES[rng() % NTYPES]);
+        }
+        text += line;
+    }
+    return text;
+}
+
+static bool read_file(const char *path, std::string &out) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.append(buf, n);
+    fclose(f);
+    return true;
+}
+
+// The loop keeloq_search replaces: derive, decrypt and check one entry at a time.
+static KeeloqMatch scalar_search(
+    const KeeloqKeystore &ks, uint32_t fix, uint32_t seed, uint32_t encrypted, uint8_t btn, uint32_t serial
+) {
+    const std::vector<KeeloqKeyEntry> &keys = ks.get_keys();
+    KeeloqMatch m;
+    for (size_t i = 0; i < keys.size(); i++) {
+        uint32_t dec = keeloq_decrypt(encrypted, keeloq_derive_man(keys[i].type, fix, seed, keys[i].key));
+        if (keeloq_hop_matches(dec, btn, serial) ||
+            (keys[i].mf_id == ks.centurion_id() && keeloq_hop_matches_centurion(dec, btn))) {
+            m.index = (int)i;
+            m.hop = dec;
+            break;
+        }
+    }
+    return m;
+}
+
+static double now_us() {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+int main(int argc, char **argv) {
+    std::mt19937_64 rng(0x4B45454C4F51ULL);
+
+    bool ok = parse_test();
+    printf("parse self-test: %s\n", ok ? "PASS" : "FAIL");
+    if (!ok) return 1;
+
+    std::string text;
+    if (argc > 1 && !isdigit((unsigned char)argv[1][0])) {
+        if (!read_file(argv[1], text)) {
+            printf("cannot read %s\n", argv[1]);
+            return 1;
+        }
+    } else {
+        text = gen_keystore(argc > 1 ? strtoul(argv[1], nullptr, 0) : 1200, rng);
+    }
+
+    // Cold load: parse + intern + shrink, as keeloq_keystore() does once per change.
+    KeeloqKeystore ks;
+    const int loads = 20;
+    double t0 = now_us();
+    for (int i = 0; i < loads; i++) ks.load_text(text.c_str(), text.size());
+    double load_us = (now_us() - t0) / loads;
+
+    const std::vector<KeeloqKeyEntry> &keys = ks.get_keys();
+    if (keys.empty()) {
+        printf("keystore empty\n");
+        return 1;
+    }
+
+    // One frame per entry; fields are those rf_try_keeloq fills in from the key.
+    const uint8_t btn = 0x5;
+    const uint32_t serial = 0x4D5E6;
+    const uint32_t fix = ((uint32_t)btn << 28) | serial;
+    const uint32_t seed = fix & 0x0FFFFFFF; // keeloq_identify's fallback seed
+    const uint16_t cnt = 0x1234;
+
+    size_t own = 0, earlier = 0, bad = 0;
+    double total_us = 0, max_us = 0;
+    for (size_t i = 0; i < keys.size(); i++) {
+        const KeeloqKeyEntry &k = keys[i];
+        uint32_t field = k.mf_id == ks.centurion_id() ? 0x1CE : (serial & 0x3FF);
+        uint32_t hop = ((uint32_t)btn << 28) | field << 16 | cnt;
+        uint32_t enc = keeloq_encrypt(hop, keeloq_derive_man(k.type, fix, seed, k.key));
+
+        double t = now_us();
+        KeeloqMatch m = keeloq_search(ks, fix, seed, enc, btn, serial);
+        double dt = now_us() - t;
+        total_us += dt;
+        if (dt > max_us) max_us = dt;
+
+        KeeloqMatch ref = scalar_search(ks, fix, seed, enc, btn, serial);
+        if (m.index != ref.index || m.hop != ref.hop || m.index < 0 || m.index > (int)i) {
+            if (bad++ < 10) printf("entry %zu: search %d, scalar %d\n", i, m.index, ref.index);
+        } else if (m.index == (int)i) {
+            if (m.hop == hop && (m.hop & 0xFFFF) == cnt) own++;
+            else if (bad++ < 10) printf("entry %zu: hop %08x, want %08x\n", i, m.hop, hop);
+        } else {
+            earlier++;
+        }
+    }
+
+    // Worst case: an encrypted word no entry decrypts to a plausible hop.
+    uint32_t miss = 0xFFFFFFFFu;
+    while (scalar_search(ks, fix, seed, miss, btn, serial).index >= 0) miss = (uint32_t)rng();
+    const int reps = 10;
+    double t = now_us();
+    for (int i = 0; i < reps; i++) bad += keeloq_search(ks, fix, seed, miss, btn, serial).index >= 0;
+    double miss_us = (now_us() - t) / reps;
+    t = now_us();
+    for (int i = 0; i < reps; i++) bad += scalar_search(ks, fix, seed, miss, btn, serial).index >= 0;
+    double scalar_us = (now_us() - t) / reps;
+
+    printf(
+        "%zu keys, %zu manufacturers: load %.0f us, identify avg %.1f us max %.1f us, "
+        "miss %.1f us (scalar %.1f us)\n",
+        keys.size(),
+        ks.mf_count(),
+        load_us,
+        total_us / keys.size(),
+        max_us,
+        miss_us,
+        scalar_us
+    );
+    printf(
+        "%zu frames: %zu own entry, %zu earlier entry (same as scalar), %zu wrong\n",
+        keys.size(),
+        own,
+        earlier,
+        bad
+    );
+    return bad == 0 ? 0 : 1;
+}
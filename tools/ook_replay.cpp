@@ -0,0 +1,224 @@
+// Host replay harness for the OOK decoder (src/modules/rf/protocols/rf_ook.*).
+//
+// Every capture is decoded by rf_ook_decode with the opening-gap pre-filter (as
+// on the device) and with a full registry scan (the decoder before the
+// pre-filter); both must decode the same frame. Prints the protocol trials and
+// time per capture of each.
+//
+// Captures: the `RAW_Data:` lines of the given `.sub` files (Flipper splits one
+// capture across consecutive lines, so a file is one duration stream), or, with
+// no arguments, synthetic captures: every registry protocol with random keys,
+// repeated frames, pulse jitter and leading noise, plus pure noise. A synthetic
+// frame decoded as the protocol that was sent must carry the key that was sent;
+// same-timing protocols claiming each other's frames are only counted, and so
+// are frames longer than RF_MAX_CHANGES transitions, which the decoder drops.
+//
+// Build and run:
+//   g++ -O2 -std=gnu++17 -Isrc/modules/rf/protocols -o ook_replay tools/ook_replay.cpp
+//       src/modules/rf/protocols/rf_ook.cpp src/modules/rf/protocols/rf_registry.cpp
+//   ./ook_replay [file.sub ...]
+#include "rf_ook.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+struct Capture {
+    std::string name;
+    std::vector<int> durations;
+    const RfProtocolDef *pro = nullptr; // synthetic: what was sent
+    uint64_t key = 0;
+    int bits = 0;
+};
+
+struct Cost {
+    uint64_t trials = 0;
+    double ms = 0;
+};
+
+struct Totals {
+    int captures = 0, decoded = 0, differ = 0;
+    int missed = 0, tooLong = 0, claimed = 0, wrongKey = 0; // synthetic
+    Cost full, indexed;
+};
+
+static bool read_sub(const std::string &path, Capture &c) {
+    std::ifstream in(path);
+    if (!in) return false;
+    c.name = path;
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.rfind("RAW_Data:", 0) != 0) continue;
+        const char *p = line.c_str() + 9;
+        char *end = nullptr;
+        while (*p) {
+            long v = strtol(p, &end, 10);
+            if (end == p) break;
+            if (v != 0) c.durations.push_back((int)v);
+            p = end;
+        }
+    }
+    return !c.durations.empty();
+}
+
+// Signed durations of `repeats` back-to-back frames as the encoder sends them:
+// high-first protocols close each frame with the sync HIGH + gap LOW,
+// space-coded ones open it with the gap LOW + preamble HIGH.
+// Every pulse is off by up to `jitter` µs, the gaps by up to 50 µs.
+static void gen_frames(Capture &c, int repeats, int jitter, std::mt19937 &rng) {
+    const RfProtocolDef *pro = c.pro;
+    std::uniform_int_distribution<int> jit(-jitter, jitter);
+    std::uniform_int_distribution<int> gapJit(-50, 50);
+    auto pulse = [&](int factor) { return factor * pro->te + jit(rng); };
+    auto gap = [&](int factor) { return factor * pro->te + gapJit(rng); };
+    std::vector<int> &d = c.durations;
+
+    if (!pro->inverted) {
+        d.push_back(pulse(pro->sync.high));
+        d.push_back(-gap(pro->sync.low));
+    }
+    for (int r = 0; r < repeats; r++) {
+        if (pro->inverted) {
+            d.push_back(-gap(pro->sync.high));
+            d.push_back(pulse(pro->sync.low));
+        }
+        for (int i = c.bits - 1; i >= 0; i--) {
+            const HighLow &b = (c.key >> i) & 1 ? pro->one : pro->zero;
+            d.push_back(pro->inverted ? -pulse(b.high) : pulse(b.high));
+            d.push_back(pro->inverted ? pulse(b.low) : -pulse(b.low));
+        }
+        if (!pro->inverted) {
+            d.push_back(pulse(pro->sync.high));
+            d.push_back(-gap(pro->sync.low));
+        }
+    }
+    if (pro->inverted) d.push_back(-gap(pro->sync.high));
+}
+
+// Short random pulses, as the slicer outputs between transmissions.
+static void gen_noise(std::vector<int> &d, int count, std::mt19937 &rng) {
+    std::uniform_int_distribution<int> dur(40, 3000);
+    for (int i = 0; i < count; i++) d.push_back(i & 1 ? -dur(rng) : dur(rng));
+}
+
+static std::vector<Capture> synthetic(std::mt19937 &rng) {
+    std::vector<Capture> out;
+    for (int p = 0; p < rf_protocol_count(); p++) {
+        const RfProtocolDef *pro = rf_protocol_at(p);
+        unsigned int syncLen = pro->sync.low > pro->sync.high ? pro->sync.low : pro->sync.high;
+        if (syncLen * pro->te <= RF_SEPARATION_LIMIT) {
+            printf("skip %-14s: gap %u us is not an inter-frame gap\n", pro->name, syncLen * pro->te);
+            continue;
+        }
+        for (int k = 0; k < 40; k++) {
+            Capture c;
+            c.pro = pro;
+            c.bits = pro->bits ? pro->bits : 8 + k % 57; // variable length: 8..64 bits
+            c.key = ((uint64_t)rng() << 32 | rng()) & (c.bits == 64 ? ~0ULL : (1ULL << c.bits) - 1);
+            c.name = std::string(pro->name) + "#" + std::to_string(k);
+            if (k & 1) gen_noise(c.durations, 20 + k, rng);
+            gen_frames(c, 2 + k % 4, pro->te * (k < 20 ? 1 : 3) / 10, rng);
+            out.push_back(c);
+        }
+    }
+    for (int k = 0; k < 200; k++) {
+        Capture c;
+        c.name = "noise#" + std::to_string(k);
+        gen_noise(c.durations, 50 + k * 5, rng);
+        out.push_back(c);
+    }
+    return out;
+}
+
+static bool same(const RfOokFrame &a, const RfOokFrame &b) {
+    return a.pro == b.pro && a.key == b.key && a.bits == b.bits;
+}
+
+static void print_frame(const char *tag, bool ok, const RfOokFrame &f) {
+    if (!ok) {
+        printf("  %s: no match\n", tag);
+        return;
+    }
+    printf("  %s: %s key=%llX bits=%d te=%d\n", tag, f.pro->name, (unsigned long long)f.key, f.bits, f.te);
+}
+
+static double ms_since(std::chrono::steady_clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+}
+
+static void replay(const Capture &c, Totals &t, bool verbose) {
+    using clock = std::chrono::steady_clock;
+    RfOokFrame full, frame;
+    uint32_t fullTrials = 0, trials = 0;
+
+    auto t0 = clock::now();
+    bool f_ok = rf_ook_decode(c.durations, full, false, &fullTrials);
+    t.full.ms += ms_since(t0);
+    t0 = clock::now();
+    bool ok = rf_ook_decode(c.durations, frame, true, &trials);
+    t.indexed.ms += ms_since(t0);
+    t.full.trials += fullTrials;
+    t.indexed.trials += trials;
+
+    t.captures++;
+    t.decoded += ok;
+    bool agree = f_ok == ok && (!ok || same(full, frame));
+    if (!agree) t.differ++;
+
+    bool wrong = false;
+    if (c.pro && !ok) {
+        // 2 per bit, plus the sync pair of the frame.
+        if (2 * c.bits + 2 > RF_MAX_CHANGES) t.tooLong++;
+        else t.missed++;
+    } else if (c.pro && frame.pro != c.pro) {
+        t.claimed++;
+    } else if (c.pro && (frame.key != c.key || frame.bits != c.bits)) {
+        t.wrongKey++;
+        wrong = true;
+    }
+
+    if (verbose || !agree || wrong) {
+        const char *note = !agree ? ", PRE-FILTER DIFFERS" : wrong ? ", WRONG KEY" : "";
+        printf("%s: %zu durations%s\n", c.name.c_str(), c.durations.size(), note);
+        if (c.pro) printf("  sent  : %s key=%llX bits=%d\n", c.pro->name, (unsigned long long)c.key, c.bits);
+        print_frame("full  ", f_ok, full);
+        print_frame("decode", ok, frame);
+    }
+}
+
+int main(int argc, char **argv) {
+    std::vector<Capture> captures;
+    for (int i = 1; i < argc; i++) {
+        Capture c;
+        if (read_sub(argv[i], c)) captures.push_back(c);
+        else printf("%s: no RAW_Data\n", argv[i]);
+    }
+    bool files = !captures.empty();
+    std::mt19937 rng(0x4F4F4B);
+    if (!files && argc == 1) captures = synthetic(rng);
+
+    Totals t;
+    for (const Capture &c : captures) replay(c, t, files);
+
+    printf("%d captures: %d decoded, %d differ from the full scan\n", t.captures, t.decoded, t.differ);
+    if (!files)
+        printf(
+            "synthetic: %d missed, %d over RF_MAX_CHANGES, %d claimed by another protocol, %d wrong key\n",
+            t.missed,
+            t.tooLong,
+            t.claimed,
+            t.wrongKey
+        );
+    printf("per capture            trials      us\n");
+    const Cost *costs[] = {&t.full, &t.indexed};
+    const char *names[] = {"full scan", "pre-filtered"};
+    for (int i = 0; i < 2; i++) {
+        double n = t.captures ? t.captures : 1;
+        printf("  %-20s %8.2f %7.2f\n", names[i], costs[i]->trials / n, costs[i]->ms * 1000 / n);
+    }
+    return t.differ || t.missed || t.wrongKey ? 1 : 0;
+}
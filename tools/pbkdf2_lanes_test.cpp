@@ -0,0 +1,141 @@
+// Host test for the multi-lane PBKDF2-HMAC-SHA1 kernel of the WPA crack
+// workers (src/modules/wifi/wifi_pbkdf2.*), built natively with real SIMD lanes.
+//
+// Vectors: the IEEE 802.11i passphrase-to-PMK test vectors through both the
+// single-lane pbkdf2_precomp and every lane of pbkdf2_lanes (the vector in one
+// lane, other passwords in the rest). Agreement: random passwords (8..63 chars)
+// and SSIDs (1..32 bytes), every lane against pbkdf2_precomp. Then the
+// sustained candidates/s of both on one core.
+//
+// Build and run (AVX2, 8 lanes; -DPBKDF2_LANES=2 alone is the ESP32 case, no SIMD):
+//   g++ -O2 -std=gnu++17 -mavx2 -DPBKDF2_LANES=8 -Isrc/modules/wifi -o pbkdf2_lanes_test
+//       tools/pbkdf2_lanes_test.cpp src/modules/wifi/wifi_pbkdf2.cpp
+//   ./pbkdf2_lanes_test [candidates]
+#include "wifi_pbkdf2.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+struct PmkVector {
+    const char *pass;
+    const char *ssid;
+    const char *pmk;
+};
+
+// IEEE 802.11i-2004, Annex H.4.
+static const PmkVector vectors[] = {
+    {"password", "IEEE", "f42c6fc52df0ebef9ebb4b90b38a5f902e83fe1b135a70e23aed762e9710a12e"},
+    {"ThisIsAPassword", "ThisIsASSID", "0dc0d6eb90555ed6419756b9a15ec3e3209b63df707dd508d14581f8982721af"},
+    {"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+     "ZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZ",
+     "becb93866bb8c3832cb777c2f559807c8c59afcb6eae734885001300a981cc62"},
+};
+
+static std::string hex(const uint8_t *b, size_t n) {
+    std::string s;
+    char h[3];
+    for (size_t i = 0; i < n; i++) {
+        snprintf(h, sizeof(h), "%02x", b[i]);
+        s += h;
+    }
+    return s;
+}
+
+static void pads(const std::string &pw, HmacSha1Pre &out) {
+    hmac_sha1_precompute((const uint8_t *)pw.data(), pw.size(), out);
+}
+
+// Each lane of pbkdf2_lanes against pbkdf2_precomp for the same password.
+static bool lanes_agree(const std::string pw[PBKDF2_LANES], const std::string &ssid, uint8_t ref[][32]) {
+    HmacSha1Pre pre[PBKDF2_LANES];
+    const HmacSha1Pre *lanes[PBKDF2_LANES];
+    uint8_t pmk[PBKDF2_LANES][32];
+    for (int l = 0; l < PBKDF2_LANES; l++) {
+        pads(pw[l], pre[l]);
+        lanes[l] = &pre[l];
+        pbkdf2_precomp(pre[l], (const uint8_t *)ssid.data(), ssid.size(), 4096, ref[l], 32);
+    }
+    pbkdf2_lanes(lanes, (const uint8_t *)ssid.data(), ssid.size(), 4096, pmk);
+    return memcmp(pmk, ref, sizeof(pmk)) == 0;
+}
+
+static bool test_vectors() {
+    bool allok = true;
+    for (const PmkVector &v : vectors) {
+        bool ok = true;
+        for (int at = 0; at < PBKDF2_LANES; at++) {
+            std::string pw[PBKDF2_LANES];
+            for (int l = 0; l < PBKDF2_LANES; l++) pw[l] = l == at ? v.pass : "filler" + std::to_string(l);
+            uint8_t ref[PBKDF2_LANES][32];
+            ok = lanes_agree(pw, v.ssid, ref) && hex(ref[at], 32) == v.pmk && ok;
+            if (at == 0) printf("vector %-16.16s %-14.14s %s", v.pass, v.ssid, hex(ref[at], 32).c_str());
+        }
+        printf(" %s\n", ok ? "PASS" : "FAIL");
+        allok = allok && ok;
+    }
+    return allok;
+}
+
+static bool test_random(int rounds) {
+    std::mt19937 rng(0x504D4B);
+    std::uniform_int_distribution<int> chr(0x20, 0x7E);
+    bool ok = true;
+    for (int r = 0; r < rounds && ok; r++) {
+        std::string pw[PBKDF2_LANES], ssid(1 + rng() % 32, ' ');
+        for (char &c : ssid) c = (char)rng(); // any byte
+        for (int l = 0; l < PBKDF2_LANES; l++) {
+            pw[l].resize(8 + rng() % 56);
+            for (char &c : pw[l]) c = (char)chr(rng);
+        }
+        uint8_t ref[PBKDF2_LANES][32];
+        ok = lanes_agree(pw, ssid, ref);
+    }
+    printf("random %d x %d lanes: %s\n", rounds, PBKDF2_LANES, ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+static void bench(int candidates) {
+    using clock = std::chrono::steady_clock;
+    static const char ssid[] = "BruceBench";
+    std::vector<HmacSha1Pre> pre(candidates);
+    for (int i = 0; i < candidates; i++) pads("benchpw" + std::to_string(i), pre[i]);
+
+    uint8_t pmk[PBKDF2_LANES][32];
+    auto t0 = clock::now();
+    for (int i = 0; i < candidates; i++)
+        pbkdf2_precomp(pre[i], (const uint8_t *)ssid, sizeof(ssid) - 1, 4096, pmk[0], 32);
+    auto t1 = clock::now();
+    for (int base = 0; base < candidates; base += PBKDF2_LANES) {
+        const HmacSha1Pre *lanes[PBKDF2_LANES];
+        for (int l = 0; l < PBKDF2_LANES; l++) lanes[l] = &pre[base + l];
+        pbkdf2_lanes(lanes, (const uint8_t *)ssid, sizeof(ssid) - 1, 4096, pmk);
+    }
+    auto t2 = clock::now();
+
+    double single = candidates / std::chrono::duration<double>(t1 - t0).count();
+    double lanes = candidates / std::chrono::duration<double>(t2 - t1).count();
+    printf(
+        "bench %d candidates, one core: single %.0f/s, %d lanes %.0f/s (x%.2f)\n",
+        candidates,
+        single,
+        PBKDF2_LANES,
+        lanes,
+        lanes / single
+    );
+}
+
+int main(int argc, char **argv) {
+    int candidates = argc > 1 ? atoi(argv[1]) : 512;
+    if (candidates < PBKDF2_LANES) candidates = PBKDF2_LANES;
+    candidates -= candidates % PBKDF2_LANES;
+
+    bool ok = test_vectors();
+    ok = test_random(64) && ok;
+    bench(candidates);
+    printf("result: %s\n", ok ? "ALL PASS" : "FAILURES");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,255 @@
+// Host test and benchmark for the RAW capture CRC and the dedupe ring
+// (src/modules/rf/rf_capture.*).
+//
+// CRC: crc64_ecma and the per-value crc64_ecma_update fold rf_raw_stats runs
+// must match the former bit-by-bit crc64_ecma (kept here verbatim) on random
+// index sequences, including values outside 0..255, and the CRC-64/WE check
+// value. Then both are timed over pulse-index captures of typical length and
+// over one RMT_MAX_PULSES-long capture.
+//
+// Ring: RfCaptureRing::seen is checked for the window, te tolerance, bit count,
+// eviction and clear(). A synthetic scan where several remotes repeat their
+// frames interleaved is then deduped by the ring and by the former single-slot
+// check (last protocol + key only). Each count of reported captures is compared
+// with the ideal one: a frame is new unless the same remote was reported less
+// than the window earlier.
+//
+// Build and run:
+//   g++ -O2 -std=gnu++17 -Isrc/modules/rf -o rf_capture_bench tools/rf_capture_bench.cpp
+//       src/modules/rf/rf_capture.cpp
+//   ./rf_capture_bench [captures]
+#include "rf_capture.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#define RMT_MAX_PULSES 10000   // rf_utils.h
+#define SCAN_DUPLICATE_MS 1500 // RF_M5_SCAN_DUPLICATE_MS in rf_scan.cpp
+
+// The former crc64_ecma, one bit at a time.
+static uint64_t crc64_ecma_bitwise(const std::vector<int> &data) {
+    uint64_t crc = 0xFFFFFFFFFFFFFFFF;
+
+    for (int value : data) {
+        crc ^= (uint64_t)value << 56; // Use the value as the high byte
+        for (int i = 0; i < 8; i++) {
+            if (crc & 0x8000000000000000) {
+                crc = (crc << 1) ^ 0x42F0E1EBA9EA3693;
+            } else {
+                crc <<= 1;
+            }
+        }
+    }
+    return crc;
+}
+
+// Pulse indexes as rf_raw_stats produces them: a handful of distinct widths.
+static std::vector<int> gen_indexes(size_t n, std::mt19937 &rng) {
+    std::vector<int> v(n);
+    for (int &x : v) x = rng() % 4;
+    return v;
+}
+
+static bool crc_test(std::mt19937 &rng) {
+    int bad = 0;
+
+    // CRC-64/WE check value, before its final xor with all ones.
+    std::vector<int> check = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    if (crc64_ecma(check) != (0x62EC59E3F1A4F00AULL ^ 0xFFFFFFFFFFFFFFFFULL)) {
+        printf("check value: %016llx\n", (unsigned long long)crc64_ecma(check));
+        bad++;
+    }
+    if (crc64_ecma({}) != CRC64_ECMA_INIT) bad++;
+
+    for (int round = 0; round < 5000 && bad < 10; round++) {
+        std::vector<int> v(rng() % 300);
+        for (int &x : v) x = round % 2 ? (int)(rng() % 4) : (int)rng() - (int)(rng() >> 1);
+
+        uint64_t fold = CRC64_ECMA_INIT;
+        for (int x : v) fold = crc64_ecma_update(fold, (uint8_t)x);
+        uint64_t want = crc64_ecma_bitwise(v);
+        if (crc64_ecma(v) != want || fold != want) {
+            printf(
+                "%zu values: table %016llx, want %016llx\n",
+                v.size(),
+                (unsigned long long)fold,
+                (unsigned long long)want
+            );
+            bad++;
+        }
+    }
+    return bad == 0;
+}
+
+static bool ring_test() {
+    int bad = 0;
+    auto expect = [&](bool got, bool want, const char *what) {
+        if (got != want) {
+            printf("ring: %s: got %d\n", what, (int)got);
+            bad++;
+        }
+    };
+
+    const uint64_t a = RfCaptureRing::hash("Princeton", 0x123456);
+    const uint64_t b = RfCaptureRing::hash("Princeton", 0x123457);
+    expect(a == b, false, "key changes the hash");
+    expect(a == RfCaptureRing::hash("CAME", 0x123456), false, "protocol changes the hash");
+    expect(RfCaptureRing::hash(nullptr, 1) == RfCaptureRing::hash("", 1), true, "null protocol");
+
+    RfCaptureRing ring;
+    expect(ring.seen(a, 350, 24, 0, 1500), false, "first capture");
+    expect(ring.seen(a, 350, 24, 1499, 1500), true, "repeat inside the window");
+    expect(ring.seen(a, 350, 24, 1500, 1500), false, "repeat at the window end");
+    expect(ring.seen(a, 350 * 125 / 100, 24, 1600, 1500), true, "te at the tolerance");
+    expect(ring.seen(a, 350 * 125 / 100 + 1, 24, 1700, 1500), false, "te past the tolerance");
+    expect(ring.seen(a, 350, 25, 1800, 1500), false, "other bit count");
+    expect(ring.seen(b, 350, 24, 1900, 1500), false, "other key");
+
+    ring.clear();
+    expect(ring.seen(a, 350, 24, 2000, 1500), false, "after clear");
+    for (uint64_t k = 0; k < RF_CAPTURE_RING; k++) {
+        ring.seen(RfCaptureRing::hash("P", k), 350, 24, 2000, 1500);
+    }
+    expect(ring.seen(a, 350, 24, 2001, 1500), false, "oldest evicted");
+    const uint64_t newest = RfCaptureRing::hash("P", RF_CAPTURE_RING - 1);
+    expect(ring.seen(newest, 350, 24, 2002, 1500), true, "newest kept");
+    return bad == 0;
+}
+
+struct Capture {
+    uint32_t ms;
+    std::string protocol;
+    uint64_t key;
+    int te, bits;
+};
+
+// `remotes` remotes pressed in overlapping bursts: every press repeats its frame
+// every 100-300 ms for 2-8 frames, with te jitter of up to 10%.
+static std::vector<Capture> gen_scan(int presses, int remotes, std::mt19937 &rng) {
+    static const char *protos[] = {"Princeton", "CAME", "Nice FLO", "Holtek_HT12X"};
+    std::vector<Capture> caps;
+    uint32_t t = 0;
+    for (int p = 0; p < presses; p++) {
+        int r = rng() % remotes;
+        int te = 300 + 50 * (r % 5);
+        uint32_t at = t;
+        int frames = 2 + rng() % 7;
+        for (int f = 0; f < frames; f++) {
+            int jitter = (int)(rng() % 21) - 10;
+            caps.push_back({at, protos[r % 4], 0xA0000ULL + r, te + te * jitter / 100, 24});
+            at += 100 + rng() % 201;
+        }
+        t += 200 + rng() % 600; // the next press often starts before this one ends
+    }
+    std::stable_sort(caps.begin(), caps.end(), [](const Capture &x, const Capture &y) {
+        return x.ms < y.ms;
+    });
+    return caps;
+}
+
+// Reported captures when every remote is remembered.
+static int dedupe_ideal(const std::vector<Capture> &caps) {
+    std::map<uint64_t, uint32_t> last; // key -> when it was last reported
+    int reported = 0;
+    for (const Capture &c : caps) {
+        auto it = last.find(c.key);
+        if (it != last.end() && c.ms - it->second < SCAN_DUPLICATE_MS) continue;
+        last[c.key] = c.ms;
+        reported++;
+    }
+    return reported;
+}
+
+// Reported captures under the former check: a repeat of only the last capture.
+static int dedupe_single(const std::vector<Capture> &caps) {
+    uint64_t lastKey = 0;
+    std::string lastProtocol;
+    uint32_t lastMs = 0;
+    int reported = 0;
+    for (const Capture &c : caps) {
+        if (c.key == lastKey && c.protocol == lastProtocol && c.ms - lastMs < SCAN_DUPLICATE_MS) continue;
+        lastKey = c.key;
+        lastProtocol = c.protocol;
+        lastMs = c.ms;
+        reported++;
+    }
+    return reported;
+}
+
+static int dedupe_ring(const std::vector<Capture> &caps) {
+    RfCaptureRing ring;
+    int reported = 0;
+    for (const Capture &c : caps) {
+        if (!ring.seen(RfCaptureRing::hash(c.protocol.c_str(), c.key), c.te, c.bits, c.ms, SCAN_DUPLICATE_MS))
+            reported++;
+    }
+    return reported;
+}
+
+typedef uint64_t (*CrcFn)(const std::vector<int> &);
+static uint64_t crc_captures(const std::vector<std::vector<int>> &caps, CrcFn crc) {
+    uint64_t x = 0;
+    for (const auto &v : caps) x ^= crc(v);
+    return x;
+}
+
+template <typename Fn> static double time_ns(Fn fn, int reps) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < reps; i++) fn();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / reps;
+}
+
+int main(int argc, char **argv) {
+    int captures = argc > 1 ? atoi(argv[1]) : 2000;
+    std::mt19937 rng(0x52464352);
+
+    bool ok = crc_test(rng);
+    printf("crc self-test: %s\n", ok ? "PASS" : "FAIL");
+    bool ringOk = ring_test();
+    printf("ring self-test: %s\n", ringOk ? "PASS" : "FAIL");
+    if (!ok || !ringOk) return 1;
+
+    volatile uint64_t sink = 0;
+    std::vector<std::vector<int>> typical;
+    for (int i = 0; i < captures; i++) typical.push_back(gen_indexes(32 + rng() % 200, rng));
+    size_t values = 0;
+    for (const auto &v : typical) values += v.size();
+    double bitNs = time_ns([&]() { sink += crc_captures(typical, crc64_ecma_bitwise); }, 5);
+    double tabNs = time_ns([&]() { sink += crc_captures(typical, crc64_ecma); }, 5);
+    printf(
+        "%d captures, %zu values: bitwise %.2f ns/value, table %.2f ns/value, %.1fx\n",
+        captures,
+        values,
+        bitNs / values,
+        tabNs / values,
+        bitNs / tabNs
+    );
+
+    std::vector<int> full = gen_indexes(RMT_MAX_PULSES, rng);
+    bitNs = time_ns([&]() { sink += crc64_ecma_bitwise(full); }, 50);
+    tabNs = time_ns([&]() { sink += crc64_ecma(full); }, 50);
+    printf("%d values: bitwise %.1f us, table %.1f us\n", RMT_MAX_PULSES, bitNs / 1000, tabNs / 1000);
+
+    for (int remotes : {1, 2, 4, 8}) {
+        std::vector<Capture> scan = gen_scan(captures / 4, remotes, rng);
+        double singleNs = time_ns([&]() { sink += dedupe_single(scan); }, 5) / scan.size();
+        double ringNs = time_ns([&]() { sink += dedupe_ring(scan); }, 5) / scan.size();
+        printf(
+            "%d remotes, %zu frames: %d new, single-slot %d (%.0f ns/frame), ring %d (%.0f ns/frame)\n",
+            remotes,
+            scan.size(),
+            dedupe_ideal(scan),
+            dedupe_single(scan),
+            singleNs,
+            dedupe_ring(scan),
+            ringNs
+        );
+    }
+    return 0;
+}
@@ -0,0 +1,137 @@
+// Host test of the TV-B-Gone codes (src/modules/ir/tvbg_codes.*): checks the
+// generated code blob against WORLD_IR_CODES.h, then sums the on-air time of
+// a full sweep, per region, with the old fixed 205 ms gap after every code
+// and with the per-set gap table.
+//
+// Every parsed code decoded from the blob must match the original
+// read_bits() decompression of its WORLD_IR_CODES.h entry; raw codes must
+// start with the timings their struct covers. Every code must fit
+// TVBG_MAX_TIMINGS.
+//
+// Build and run (after python tools/gen_world_ir_codes.py):
+//   g++ -O2 -std=gnu++17 -Isrc/modules/ir -o tvbg_airtime tools/tvbg_airtime.cpp
+//       src/modules/ir/tvbg_codes.cpp src/modules/ir/ir_raw.cpp
+//   ./tvbg_airtime
+#include "tvbg_codes.h"
+#include "WORLD_IR_CODES.h"
+#include "ir_raw.h"
+#include <cstdio>
+
+// The decompression TV-B-Gone.cpp used before, global bit reader included.
+static const IrCode *refCode;
+static uint8_t refBitsLeft, refBits, refPtr;
+
+static uint8_t ref_read_bits(uint8_t count) {
+    uint8_t tmp = 0;
+    while (count--) {
+        if (refBitsLeft == 0) {
+            refBits = refCode->codes[refPtr++];
+            refBitsLeft = 8;
+        }
+        tmp = (tmp << 1) | ((refBits >> --refBitsLeft) & 1);
+    }
+    return tmp;
+}
+
+static bool same(const uint16_t *a, const uint16_t *b, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        if (a[i] != b[i]) return false;
+    return true;
+}
+
+static bool check_parsed(const IrCode *code, uint8_t set, uint16_t i) {
+    uint16_t ref[TVBG_MAX_TIMINGS], got[TVBG_MAX_TIMINGS];
+    size_t refN = 0;
+    refCode = code;
+    refBitsLeft = refPtr = 0;
+    for (uint8_t k = 0; k < code->numpairs; k++) {
+        uint16_t ti = ref_read_bits(code->bitcompression) * 2;
+        ir_raw_push(code->times[ti] * 10u, ref, refN, TVBG_MAX_TIMINGS);
+        ir_raw_push(code->times[ti + 1] * 10u, ref, refN, TVBG_MAX_TIMINGS);
+    }
+    uint8_t khz;
+    size_t n = tvbg_decode(set, i, got, TVBG_MAX_TIMINGS, khz);
+    return n == refN && khz == code->timer_val && same(ref, got, n);
+}
+
+static bool check_raw(const RawIrCode *code, uint8_t set, uint16_t i) {
+    uint16_t ref[TVBG_MAX_TIMINGS], got[TVBG_MAX_TIMINGS];
+    size_t refN = 0;
+    for (uint16_t k = 0; k < code->numpairs * 2; k++)
+        ir_raw_push(code->times[k], ref, refN, TVBG_MAX_TIMINGS);
+    uint8_t khz;
+    size_t n = tvbg_decode(set, i, got, TVBG_MAX_TIMINGS, khz);
+    return n >= refN && khz == code->timer_val && same(ref, got, refN);
+}
+
+struct Sweep {
+    size_t codes = 0;
+    double airMs = 0, oldGapMs = 0, newGapMs = 0;
+};
+
+static void add(Sweep &s, const uint16_t *t, size_t n, uint8_t set) {
+    for (size_t i = 0; i < n; i++) s.airMs += t[i] / 1000.0;
+    s.oldGapMs += TVBG_LEGACY_GAP_MS;
+    s.newGapMs += tvbg_gap_after_us(t, n, set) / 1000.0;
+    s.codes++;
+}
+
+static Sweep sweep(uint8_t region) {
+    Sweep s;
+    uint16_t t[TVBG_MAX_TIMINGS];
+    const uint8_t sets[] = {region, TVBG_SET_UNIVERSAL, TVBG_SET_UNIVERSAL_RAW};
+    for (uint8_t set : sets) {
+        for (uint16_t i = 0; i < tvbg_count(set); i++) {
+            uint8_t khz;
+            add(s, t, tvbg_decode(set, i, t, TVBG_MAX_TIMINGS, khz), set);
+        }
+    }
+    return s;
+}
+
+static void report(const char *name, const Sweep &s) {
+    double oldS = (s.airMs + s.oldGapMs) / 1000, newS = (s.airMs + s.newGapMs) / 1000;
+    printf(
+        "%s: %zu codes, on-air %.1f s; fixed gap %.1f s total, gap table %.1f s total (%.2fx)\n",
+        name,
+        s.codes,
+        s.airMs / 1000,
+        oldS,
+        newS,
+        oldS / newS
+    );
+}
+
+int main() {
+    bool ok = true;
+    const IrCode *const *parsed[] = {NApowerCodes, EUpowerCodes, UniversalParsedCodes};
+    const uint8_t counts[] = {num_NAcodes, num_EUcodes, num_UniversalParsedCodes};
+    for (uint8_t set = 0; set < 3; set++) {
+        ok = ok && tvbg_count(set) == counts[set];
+        for (uint16_t i = 0; ok && i < counts[set]; i++) {
+            if (!check_parsed(parsed[set][i], set, i)) {
+                printf("set %u code %u mismatch\n", set, i);
+                ok = false;
+            }
+        }
+    }
+    ok = ok && tvbg_count(TVBG_SET_UNIVERSAL_RAW) == num_UniversalRawCodes;
+    for (uint16_t i = 0; ok && i < num_UniversalRawCodes; i++) {
+        if (!check_raw(UniversalRawCodes[i], TVBG_SET_UNIVERSAL_RAW, i)) {
+            printf("raw code %u mismatch or too long\n", i);
+            ok = false;
+        }
+    }
+    const uint16_t tail[] = {500, 500, 500, 60000}; // long own trailing space
+    const uint16_t split[] = {500, 65535, 0, 40000}; // split raw space
+    ok = ok && tvbg_gap_after_us(tail, 4, TVBG_SET_NA) == 5000 &&
+         tvbg_gap_after_us(split, 4, TVBG_SET_NA) == 0;
+    if (!ok) {
+        printf("self-test FAILED\n");
+        return 1;
+    }
+    printf("self-test ok, blob matches WORLD_IR_CODES.h\n");
+    report("NA sweep", sweep(TVBG_SET_NA));
+    report("EU sweep", sweep(TVBG_SET_EU));
+    return 0;
+}